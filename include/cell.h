@@ -80,11 +80,21 @@ class Cell {
   //! \retval nglobal_particles_ Number of global particles of cell
   unsigned nglobal_particles() const { return nglobal_particles_; }
 
+  //! Assign cost of particles of the cell
+  //! \param[in] cost Cost of particles of the cell in units of the cheapest
+  //! particle, the vertex weight of the cell in graph partitioning
+  void particles_cost(unsigned cost) { particles_cost_ = cost; }
+
+  //! Cost of particles of the cell
+  //! \retval particles_cost_ Cost of particles in units of the cheapest
+  //! particle
+  unsigned particles_cost() const { return particles_cost_; }
+
   //! Return the status of a cell: active (if a particle is present)
   bool status() const { return particles_.size(); }
 
   //! Return particles_
-  std::vector<Index> particles() const { return particles_; }
+  const std::vector<Index>& particles() const { return particles_; }
 
   //! Number of nodes
   unsigned nnodes() const { return nodes_.size(); }
@@ -127,6 +137,12 @@ class Cell {
   //! \retval insertion_status Return the successful addition of a node
   bool add_neighbour(mpm::Index neighbour_id);
 
+  //! Remove a neighbour cell
+  //! \param[in] neighbour_id id of the neighbouring cell
+  void remove_neighbour(mpm::Index neighbour_id) {
+    neighbours_.erase(neighbour_id);
+  }
+
   //! Number of neighbours
   unsigned nneighbours() const { return neighbours_.size(); }
 
@@ -145,6 +161,14 @@ class Cell {
   //! Clear all particle ids in the cell
   void clear_particle_ids() { particles_.clear(); }
 
+  //! Assign all particle ids of the cell, replacing the current ids
+  //! \param[in] begin Start of particle ids
+  //! \param[in] end End of particle ids
+  void assign_particle_ids(std::vector<Index>::const_iterator begin,
+                           std::vector<Index>::const_iterator end) {
+    particles_.assign(begin, end);
+  }
+
   //! Compute the volume of the cell
   void compute_volume();
 
@@ -158,7 +182,7 @@ class Cell {
   Eigen::Matrix<double, Tdim, 1> centroid() const { return centroid_; }
 
   //! Return the dN/dx at the centroid of the cell
-  Eigen::MatrixXd dn_dx_centroid() const { return dn_dx_centroid_; }
+  const Eigen::MatrixXd& dn_dx_centroid() const { return dn_dx_centroid_; }
 
   //! Compute mean length of cell
   void compute_mean_length();
@@ -167,7 +191,9 @@ class Cell {
   double mean_length() const { return mean_length_; }
 
   //! Return nodal coordinates
-  Eigen::MatrixXd nodal_coordinates() const { return nodal_coordinates_; }
+  const Eigen::MatrixXd& nodal_coordinates() const {
+    return nodal_coordinates_;
+  }
 
   //! Check if a point is in a cartesian cell by checking the domain ranges
   //! \param[in] point Coordinates of point
@@ -245,6 +271,8 @@ class Cell {
   std::vector<Index> particles_;
   //! Number of global nparticles
   unsigned nglobal_particles_{0};
+  //! Cost of particles of the cell in units of the cheapest particle
+  unsigned particles_cost_{0};
   //! Container of node pointers (local id, node pointer)
   std::vector<std::shared_ptr<NodeBase<Tdim>>> nodes_;
   //! Nodal coordinates
@@ -0,0 +1,107 @@
+#ifndef MPM_DENSE_MAP_H_
+#define MPM_DENSE_MAP_H_
+
+#include <initializer_list>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace mpm {
+
+// DenseMap class
+//! \brief Named scalar values stored in a flat contiguous array
+//! \details Names are held in a layout shared by all maps of a material, so
+//! a copy only allocates the values. Values are accessed by a compile-time
+//! index in constitutive models, and by name for input and output.
+class DenseMap {
+ public:
+  //! Names of the values in index order
+  using Layout = std::vector<std::string>;
+  //! Iterator over values
+  using iterator = std::vector<double>::iterator;
+  //! Const iterator over values
+  using const_iterator = std::vector<double>::const_iterator;
+
+  //! Default constructor
+  DenseMap() = default;
+
+  //! Construct with a shared layout and zero values
+  //! \param[in] layout Names of the values in index order
+  explicit DenseMap(const std::shared_ptr<const Layout>& layout)
+      : layout_{layout}, values_(layout ? layout->size() : 0, 0.) {}
+
+  //! Construct from name and value pairs in index order
+  //! \param[in] list List of name and value pairs
+  DenseMap(std::initializer_list<std::pair<const std::string, double>> list);
+
+  //! Return number of values
+  std::size_t size() const { return values_.size(); }
+
+  //! Return true if there are no values
+  bool empty() const { return values_.empty(); }
+
+  //! Return value at an index
+  //! \param[in] index Index of the value in the layout
+  double& operator[](unsigned index) { return values_[index]; }
+
+  //! Return value at an index
+  //! \param[in] index Index of the value in the layout
+  double operator[](unsigned index) const { return values_[index]; }
+
+  //! Return value of a name, which is appended if absent
+  //! \param[in] name Name of the value
+  double& operator[](const std::string& name);
+
+  //! Return value of a name, throws std::out_of_range if absent
+  //! \param[in] name Name of the value
+  double& at(const std::string& name);
+
+  //! Return value of a name, throws std::out_of_range if absent
+  //! \param[in] name Name of the value
+  double at(const std::string& name) const;
+
+  //! Return index of a name or size() if absent
+  //! \param[in] name Name of the value
+  unsigned index(const std::string& name) const;
+
+  //! Return name at an index
+  //! \param[in] index Index of the value in the layout
+  const std::string& name(unsigned index) const { return (*layout_)[index]; }
+
+  //! Return iterator to the value of a name or end() if absent
+  //! \param[in] name Name of the value
+  iterator find(const std::string& name) {
+    return values_.begin() + this->index(name);
+  }
+
+  //! Return iterator to the value of a name or end() if absent
+  //! \param[in] name Name of the value
+  const_iterator find(const std::string& name) const {
+    return values_.cbegin() + this->index(name);
+  }
+
+  //! Return begin iterator of values
+  iterator begin() { return values_.begin(); }
+  //! Return end iterator of values
+  iterator end() { return values_.end(); }
+  //! Return begin iterator of values
+  const_iterator begin() const { return values_.cbegin(); }
+  //! Return end iterator of values
+  const_iterator end() const { return values_.cend(); }
+
+  //! Return pointer to the contiguous values
+  double* data() { return values_.data(); }
+  //! Return pointer to the contiguous values
+  const double* data() const { return values_.data(); }
+
+ private:
+  //! Names of the values shared between maps
+  std::shared_ptr<const Layout> layout_;
+  //! Values in the order of the layout
+  std::vector<double> values_;
+};  // DenseMap class
+
+}  // namespace mpm
+
+#endif  // MPM_DENSE_MAP_H_
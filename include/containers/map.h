@@ -7,12 +7,12 @@
 #include <tsl/robin_map.h>
 
 #include "data_types.h"
+#include "dense_map.h"
 
 namespace mpm {
 
-// Global dense hash map type
-using dense_map = tsl::robin_map<std::string, double>;
-// using dense_map = spp::sparse_hash_map<std::string, double>;
+// Global dense map type of named state variables
+using dense_map = DenseMap;
 
 // Map class
 //! \brief A class that offers a container and iterators
@@ -26,6 +26,14 @@ class Vector {
   //! \param[in] ptr A shared pointer
   bool remove(const std::shared_ptr<T>&);
 
+  //! Remove all elements for which a predicate is true in a single pass,
+  //! the order of the remaining elements is kept
+  //! \tparam Tpred A unary predicate
+  //! \param[in] pred Predicate which returns true for elements to remove
+  //! \retval nremoved Number of removed elements
+  template <class Tpred>
+  std::size_t remove_if(Tpred pred);
+
   //! Return number of elements in the vector
   std::size_t size() const { return elements_.size(); }
 
@@ -30,6 +30,16 @@ bool mpm::Vector<T>::remove(const std::shared_ptr<T>& ptr) {
   return !(size == elements_.size());
 }
 
+//! Remove all elements for which a predicate is true
+template <class T>
+template <class Tpred>
+std::size_t mpm::Vector<T>::remove_if(Tpred pred) {
+  const auto size = elements_.size();
+  elements_.erase(std::remove_if(elements_.begin(), elements_.end(), pred),
+                  elements_.end());
+  return size - elements_.size();
+}
+
 //! Iterate over elements in the Vector
 template <class T>
 template <class Tunaryfn>
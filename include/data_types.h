@@ -28,6 +28,18 @@ inline Eigen::Matrix<double, 3, 1> zero() {
   return Eigen::Matrix<double, 3, 1>::Zero();
 }
 
+//! Zero
+template <>
+inline Eigen::Matrix<double, 4, 1> zero() {
+  return Eigen::Matrix<double, 4, 1>::Zero();
+}
+
+//! Zero
+template <>
+inline Eigen::Matrix<double, 6, 1> zero() {
+  return Eigen::Matrix<double, 6, 1>::Zero();
+}
+
 //! Zero
 template <>
 inline double zero() {
@@ -9,10 +9,11 @@
 //! Return shape functions of a 4-node Quadrilateral Element at a given local
 //! coordinate, with particle size and deformation gradient
 template <>
-inline Eigen::VectorXd mpm::QuadrilateralElement<2, 4>::shapefn(
-    const Eigen::Matrix<double, 2, 1>& xi,
-    const Eigen::Matrix<double, 2, 1>& particle_size,
-    const Eigen::Matrix<double, 2, 1>& deformation_gradient) const {
+inline Eigen::Matrix<double, 4, 1>
+    mpm::QuadrilateralElement<2, 4>::shapefn_fixed(
+        const Eigen::Matrix<double, 2, 1>& xi,
+        const Eigen::Matrix<double, 2, 1>& particle_size,
+        const Eigen::Matrix<double, 2, 1>& deformation_gradient) const {
   Eigen::Matrix<double, 4, 1> shapefn;
   shapefn(0) = 0.25 * (1 - xi(0)) * (1 - xi(1));
   shapefn(1) = 0.25 * (1 + xi(0)) * (1 - xi(1));
@@ -24,10 +25,11 @@ inline Eigen::VectorXd mpm::QuadrilateralElement<2, 4>::shapefn(
 //! Return gradient of shape functions of a 4-node Quadrilateral Element at a
 //! given local coordinate, with particle size and deformation gradient
 template <>
-inline Eigen::MatrixXd mpm::QuadrilateralElement<2, 4>::grad_shapefn(
-    const Eigen::Matrix<double, 2, 1>& xi,
-    const Eigen::Matrix<double, 2, 1>& particle_size,
-    const Eigen::Matrix<double, 2, 1>& deformation_gradient) const {
+inline Eigen::Matrix<double, 4, 2>
+    mpm::QuadrilateralElement<2, 4>::grad_shapefn_fixed(
+        const Eigen::Matrix<double, 2, 1>& xi,
+        const Eigen::Matrix<double, 2, 1>& particle_size,
+        const Eigen::Matrix<double, 2, 1>& deformation_gradient) const {
   Eigen::Matrix<double, 4, 2> grad_shapefn;
   grad_shapefn(0, 0) = -0.25 * (1 - xi(1));
   grad_shapefn(1, 0) = 0.25 * (1 - xi(1));
@@ -72,10 +74,11 @@ inline Eigen::MatrixXd mpm::QuadrilateralElement<2, 4>::unit_cell_coordinates()
 //! Return shape functions of a 8-node Quadrilateral Element at a given local
 //! coordinate, with particle size and deformation gradient
 template <>
-inline Eigen::VectorXd mpm::QuadrilateralElement<2, 8>::shapefn(
-    const Eigen::Matrix<double, 2, 1>& xi,
-    const Eigen::Matrix<double, 2, 1>& particle_size,
-    const Eigen::Matrix<double, 2, 1>& deformation_gradient) const {
+inline Eigen::Matrix<double, 8, 1>
+    mpm::QuadrilateralElement<2, 8>::shapefn_fixed(
+        const Eigen::Matrix<double, 2, 1>& xi,
+        const Eigen::Matrix<double, 2, 1>& particle_size,
+        const Eigen::Matrix<double, 2, 1>& deformation_gradient) const {
   Eigen::Matrix<double, 8, 1> shapefn;
   shapefn(0) = -0.25 * (1. - xi(0)) * (1. - xi(1)) * (xi(0) + xi(1) + 1.);
   shapefn(1) = 0.25 * (1. + xi(0)) * (1. - xi(1)) * (xi(0) - xi(1) - 1.);
@@ -91,10 +94,11 @@ inline Eigen::VectorXd mpm::QuadrilateralElement<2, 8>::shapefn(
 //! Return gradient of shape functions of a 8-node Quadrilateral Element at a
 //! given local coordinate, with particle size and deformation gradient
 template <>
-inline Eigen::MatrixXd mpm::QuadrilateralElement<2, 8>::grad_shapefn(
-    const Eigen::Matrix<double, 2, 1>& xi,
-    const Eigen::Matrix<double, 2, 1>& particle_size,
-    const Eigen::Matrix<double, 2, 1>& deformation_gradient) const {
+inline Eigen::Matrix<double, 8, 2>
+    mpm::QuadrilateralElement<2, 8>::grad_shapefn_fixed(
+        const Eigen::Matrix<double, 2, 1>& xi,
+        const Eigen::Matrix<double, 2, 1>& particle_size,
+        const Eigen::Matrix<double, 2, 1>& deformation_gradient) const {
   Eigen::Matrix<double, 8, 2> grad_shapefn;
   grad_shapefn(0, 0) = 0.25 * (2. * xi(0) + xi(1)) * (1. - xi(1));
   grad_shapefn(1, 0) = 0.25 * (2. * xi(0) - xi(1)) * (1. - xi(1));
@@ -150,10 +154,11 @@ inline Eigen::MatrixXd mpm::QuadrilateralElement<2, 8>::unit_cell_coordinates()
 //! Return shape functions of a 9-node Quadrilateral Element at a given local
 //! coordinate, with particle size and deformation gradient
 template <>
-inline Eigen::VectorXd mpm::QuadrilateralElement<2, 9>::shapefn(
-    const Eigen::Matrix<double, 2, 1>& xi,
-    const Eigen::Matrix<double, 2, 1>& particle_size,
-    const Eigen::Matrix<double, 2, 1>& deformation_gradient) const {
+inline Eigen::Matrix<double, 9, 1>
+    mpm::QuadrilateralElement<2, 9>::shapefn_fixed(
+        const Eigen::Matrix<double, 2, 1>& xi,
+        const Eigen::Matrix<double, 2, 1>& particle_size,
+        const Eigen::Matrix<double, 2, 1>& deformation_gradient) const {
   Eigen::Matrix<double, 9, 1> shapefn;
 
   shapefn(0) = 0.25 * xi(0) * xi(1) * (xi(0) - 1.) * (xi(1) - 1.);
@@ -172,10 +177,11 @@ inline Eigen::VectorXd mpm::QuadrilateralElement<2, 9>::shapefn(
 //! Return gradient of shape functions of a 9-node Quadrilateral Element at a
 //! given local coordinate, with particle size and deformation gradient
 template <>
-inline Eigen::MatrixXd mpm::QuadrilateralElement<2, 9>::grad_shapefn(
-    const Eigen::Matrix<double, 2, 1>& xi,
-    const Eigen::Matrix<double, 2, 1>& particle_size,
-    const Eigen::Matrix<double, 2, 1>& deformation_gradient) const {
+inline Eigen::Matrix<double, 9, 2>
+    mpm::QuadrilateralElement<2, 9>::grad_shapefn_fixed(
+        const Eigen::Matrix<double, 2, 1>& xi,
+        const Eigen::Matrix<double, 2, 1>& particle_size,
+        const Eigen::Matrix<double, 2, 1>& deformation_gradient) const {
   Eigen::Matrix<double, 9, 2> grad_shapefn;
   // 9-noded
   grad_shapefn(0, 0) = 0.25 * xi(1) * (xi(1) - 1.) * (2 * xi(0) - 1.);
@@ -241,6 +247,35 @@ inline mpm::ElementDegree mpm::QuadrilateralElement<2, 9>::degree() const {
   return mpm::ElementDegree::Quadratic;
 }
 
+//! Return shape functions at a given local coordinate
+template <unsigned Tdim, unsigned Tnfunctions>
+inline Eigen::VectorXd mpm::QuadrilateralElement<Tdim, Tnfunctions>::shapefn(
+    const VectorDim& xi, const VectorDim& particle_size,
+    const VectorDim& deformation_gradient) const {
+  return this->shapefn_fixed(xi, particle_size, deformation_gradient);
+}
+
+//! Return gradient of shape functions at a given local coordinate
+template <unsigned Tdim, unsigned Tnfunctions>
+inline Eigen::MatrixXd
+    mpm::QuadrilateralElement<Tdim, Tnfunctions>::grad_shapefn(
+        const VectorDim& xi, const VectorDim& particle_size,
+        const VectorDim& deformation_gradient) const {
+  return this->grad_shapefn_fixed(xi, particle_size, deformation_gradient);
+}
+
+//! Compute shape functions and gradient of shape functions in fixed size
+//! buffers
+template <unsigned Tdim, unsigned Tnfunctions>
+inline void mpm::QuadrilateralElement<Tdim, Tnfunctions>::shapefn_grad_shapefn(
+    const VectorDim& xi, const VectorDim& particle_size,
+    const VectorDim& deformation_gradient, ShapefnVector* shapefn,
+    GradShapefnMatrix* grad_shapefn) const {
+  (*shapefn) = this->shapefn_fixed(xi, particle_size, deformation_gradient);
+  (*grad_shapefn) =
+      this->grad_shapefn_fixed(xi, particle_size, deformation_gradient);
+}
+
 //! Return local shape functions of a Quadrilateral Element at a given local
 //! coordinate, with particle size and deformation gradient
 template <unsigned Tdim, unsigned Tnfunctions>
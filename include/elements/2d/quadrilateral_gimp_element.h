@@ -39,6 +39,10 @@ class QuadrilateralGIMPElement : public QuadrilateralElement<2, 4> {
  public:
   //! Define a vector of size dimension
   using VectorDim = Eigen::Matrix<double, Tdim, 1>;
+  //! Shape functions in a fixed size buffer
+  using ShapefnVector = typename mpm::Element<Tdim>::ShapefnVector;
+  //! Gradient of shape functions in a fixed size buffer
+  using GradShapefnMatrix = typename mpm::Element<Tdim>::GradShapefnMatrix;
 
   //! constructor with number of shape functions
   QuadrilateralGIMPElement() : QuadrilateralElement<2, 4>() {
@@ -78,6 +82,38 @@ class QuadrilateralGIMPElement : public QuadrilateralElement<2, 4> {
       const VectorDim& xi, const VectorDim& particle_size,
       const VectorDim& deformation_gradient) const override;
 
+  //! Evaluate shape functions at given local coordinates in a fixed size
+  //! vector
+  //! \param[in] xi given local coordinates
+  //! \param[in] particle_size Particle size
+  //! \param[in] deformation_gradient Deformation gradient
+  //! \retval shapefn Shape function of a given cell
+  Eigen::Matrix<double, Tnfunctions, 1> shapefn_fixed(
+      const VectorDim& xi, const VectorDim& particle_size,
+      const VectorDim& deformation_gradient) const;
+
+  //! Evaluate gradient of shape functions in a fixed size matrix
+  //! \param[in] xi given local coordinates
+  //! \param[in] particle_size Particle size
+  //! \param[in] deformation_gradient Deformation gradient
+  //! \retval grad_shapefn Gradient of shape function of a given cell
+  Eigen::Matrix<double, Tnfunctions, Tdim> grad_shapefn_fixed(
+      const VectorDim& xi, const VectorDim& particle_size,
+      const VectorDim& deformation_gradient) const;
+
+  //! Evaluate shape functions and gradient of shape functions at given
+  //! local coordinates in fixed size buffers
+  //! \param[in] xi given local coordinates
+  //! \param[in] particle_size Particle size
+  //! \param[in] deformation_gradient Deformation gradient
+  //! \param[out] shapefn Shape functions
+  //! \param[out] grad_shapefn Gradient of shape functions
+  void shapefn_grad_shapefn(const VectorDim& xi,
+                            const VectorDim& particle_size,
+                            const VectorDim& deformation_gradient,
+                            ShapefnVector* shapefn,
+                            GradShapefnMatrix* grad_shapefn) const override;
+
   //! Compute Jacobian
   //! \param[in] xi given local coordinates
   //! \param[in] nodal_coordinates Coordinates of nodes forming the cell
@@ -116,6 +152,9 @@ class QuadrilateralGIMPElement : public QuadrilateralElement<2, 4> {
     return mpm::ShapefnType::GIMP;
   }
 
+  //! Return the type of element
+  std::string type() const override { return "ED2Q16G"; }
+
   //! Return number of shape functions
   unsigned nfunctions() const override { return Tnfunctions; }
 
@@ -132,7 +171,7 @@ class QuadrilateralGIMPElement : public QuadrilateralElement<2, 4> {
 
  private:
   //! Return natural nodal coordinates
-  Eigen::MatrixXd natural_nodal_coordinates() const;
+  Eigen::Matrix<double, Tnfunctions, Tdim> natural_nodal_coordinates() const;
 
   //! Logger
   std::unique_ptr<spdlog::logger> console_;
@@ -1,6 +1,6 @@
 // Return natural nodal coordinates
 template <unsigned Tdim, unsigned Tnfunctions>
-inline Eigen::MatrixXd mpm::QuadrilateralGIMPElement<
+inline Eigen::Matrix<double, Tnfunctions, Tdim> mpm::QuadrilateralGIMPElement<
     Tdim, Tnfunctions>::natural_nodal_coordinates() const {
   //! Natural coordinates of nodes
   // clang-format off
@@ -28,8 +28,8 @@ inline Eigen::MatrixXd mpm::QuadrilateralGIMPElement<
 //! Return shape functions of a 16-node Quadrilateral GIMP Element at a given
 //! local coordinate
 template <unsigned Tdim, unsigned Tnfunctions>
-inline Eigen::VectorXd
-    mpm::QuadrilateralGIMPElement<Tdim, Tnfunctions>::shapefn(
+inline Eigen::Matrix<double, Tnfunctions, 1>
+    mpm::QuadrilateralGIMPElement<Tdim, Tnfunctions>::shapefn_fixed(
         const Eigen::Matrix<double, Tdim, 1>& xi,
         const Eigen::Matrix<double, Tdim, 1>& particle_size,
         const Eigen::Matrix<double, Tdim, 1>& deformation_gradient) const {
@@ -88,8 +88,8 @@ inline Eigen::VectorXd
 //! Return gradient of shape functions of a 16-node Quadrilateral Element at a
 //! given local coordinate
 template <unsigned Tdim, unsigned Tnfunctions>
-inline Eigen::MatrixXd
-    mpm::QuadrilateralGIMPElement<Tdim, Tnfunctions>::grad_shapefn(
+inline Eigen::Matrix<double, Tnfunctions, Tdim>
+    mpm::QuadrilateralGIMPElement<Tdim, Tnfunctions>::grad_shapefn_fixed(
         const Eigen::Matrix<double, Tdim, 1>& xi,
         const Eigen::Matrix<double, Tdim, 1>& particle_size,
         const Eigen::Matrix<double, Tdim, 1>& deformation_gradient) const {
@@ -158,6 +158,37 @@ inline Eigen::MatrixXd
   return grad_shapefn;
 }
 
+//! Return shape functions at a given local coordinate
+template <unsigned Tdim, unsigned Tnfunctions>
+inline Eigen::VectorXd
+    mpm::QuadrilateralGIMPElement<Tdim, Tnfunctions>::shapefn(
+        const VectorDim& xi, const VectorDim& particle_size,
+        const VectorDim& deformation_gradient) const {
+  return this->shapefn_fixed(xi, particle_size, deformation_gradient);
+}
+
+//! Return gradient of shape functions at a given local coordinate
+template <unsigned Tdim, unsigned Tnfunctions>
+inline Eigen::MatrixXd
+    mpm::QuadrilateralGIMPElement<Tdim, Tnfunctions>::grad_shapefn(
+        const VectorDim& xi, const VectorDim& particle_size,
+        const VectorDim& deformation_gradient) const {
+  return this->grad_shapefn_fixed(xi, particle_size, deformation_gradient);
+}
+
+//! Compute shape functions and gradient of shape functions in fixed size
+//! buffers
+template <unsigned Tdim, unsigned Tnfunctions>
+inline void
+    mpm::QuadrilateralGIMPElement<Tdim, Tnfunctions>::shapefn_grad_shapefn(
+        const VectorDim& xi, const VectorDim& particle_size,
+        const VectorDim& deformation_gradient, ShapefnVector* shapefn,
+        GradShapefnMatrix* grad_shapefn) const {
+  (*shapefn) = this->shapefn_fixed(xi, particle_size, deformation_gradient);
+  (*grad_shapefn) =
+      this->grad_shapefn_fixed(xi, particle_size, deformation_gradient);
+}
+
 //! Return the B-matrix of a Quadrilateral Element at a given local
 //! coordinate for a real cell
 template <unsigned Tdim, unsigned Tnfunctions>
@@ -41,6 +41,10 @@ class TriangleElement : public Element<Tdim> {
  public:
   //! Define vector of size dimension
   using VectorDim = Eigen::Matrix<double, Tdim, 1>;
+  //! Shape functions in a fixed size buffer
+  using ShapefnVector = typename mpm::Element<Tdim>::ShapefnVector;
+  //! Gradient of shape functions in a fixed size buffer
+  using GradShapefnMatrix = typename mpm::Element<Tdim>::GradShapefnMatrix;
 
   //! constructor with number of shape functions
   TriangleElement() : mpm::Element<Tdim>() {
@@ -83,6 +87,25 @@ class TriangleElement : public Element<Tdim> {
       const VectorDim& xi, const VectorDim& particle_size,
       const VectorDim& deformation_gradient) const override;
 
+  //! Evaluate shape functions at given local coordinates in a fixed size
+  //! vector
+  //! \param[in] xi given local coordinates
+  //! \param[in] particle_size Particle size
+  //! \param[in] deformation_gradient Deformation gradient
+  //! \retval shapefn Shape function of a given cell
+  Eigen::Matrix<double, Tnfunctions, 1> shapefn_fixed(
+      const VectorDim& xi, const VectorDim& particle_size,
+      const VectorDim& deformation_gradient) const;
+
+  //! Evaluate gradient of shape functions in a fixed size matrix
+  //! \param[in] xi given local coordinates
+  //! \param[in] particle_size Particle size
+  //! \param[in] deformation_gradient Deformation gradient
+  //! \retval grad_shapefn Gradient of shape function of a given cell
+  Eigen::Matrix<double, Tnfunctions, Tdim> grad_shapefn_fixed(
+      const VectorDim& xi, const VectorDim& particle_size,
+      const VectorDim& deformation_gradient) const;
+
   //! Compute Jacobian
   //! \param[in] xi given local coordinates
   //! \param[in] nodal_coordinates Coordinates of nodes forming the cell
@@ -115,6 +138,19 @@ class TriangleElement : public Element<Tdim> {
                         const VectorDim& particle_size,
                         const VectorDim& deformation_gradient) const override;
 
+  //! Evaluate shape functions and gradient of shape functions at given
+  //! local coordinates in fixed size buffers
+  //! \param[in] xi given local coordinates
+  //! \param[in] particle_size Particle size
+  //! \param[in] deformation_gradient Deformation gradient
+  //! \param[out] shapefn Shape functions
+  //! \param[out] grad_shapefn Gradient of shape functions
+  void shapefn_grad_shapefn(const VectorDim& xi,
+                            const VectorDim& particle_size,
+                            const VectorDim& deformation_gradient,
+                            ShapefnVector* shapefn,
+                            GradShapefnMatrix* grad_shapefn) const override;
+
   //! Evaluate the B matrix at given local coordinates for a real cell
   //! \param[in] xi given local coordinates
   //! \param[in] nodal_coordinates Coordinates of nodes forming the cell
@@ -143,6 +179,11 @@ class TriangleElement : public Element<Tdim> {
   //! Return the degree of shape function
   mpm::ElementDegree degree() const override;
 
+  //! Return the type of element
+  std::string type() const override {
+    return "ED2T" + std::to_string(Tnfunctions);
+  }
+
   //! Return the type of shape function
   mpm::ShapefnType shapefn_type() const override {
     return mpm::ShapefnType::NORMAL_MPM;
@@ -10,10 +10,11 @@
 //! Return shape functions of a 3-node Triangle Element at a given local
 //! coordinate, with particle size and deformation gradient
 template <>
-inline Eigen::VectorXd mpm::TriangleElement<2, 3>::shapefn(
-    const Eigen::Matrix<double, 2, 1>& xi,
-    const Eigen::Matrix<double, 2, 1>& particle_size,
-    const Eigen::Matrix<double, 2, 1>& deformation_gradient) const {
+inline Eigen::Matrix<double, 3, 1>
+    mpm::TriangleElement<2, 3>::shapefn_fixed(
+        const Eigen::Matrix<double, 2, 1>& xi,
+        const Eigen::Matrix<double, 2, 1>& particle_size,
+        const Eigen::Matrix<double, 2, 1>& deformation_gradient) const {
   Eigen::Matrix<double, 3, 1> shapefn;
   shapefn(0) = 1 - (xi(0) + xi(1));
   shapefn(1) = xi(0);
@@ -24,10 +25,11 @@ inline Eigen::VectorXd mpm::TriangleElement<2, 3>::shapefn(
 //! Return gradient of shape functions of a 3-node Triangle Element at a
 //! given local coordinate, with particle size and deformation gradient
 template <>
-inline Eigen::MatrixXd mpm::TriangleElement<2, 3>::grad_shapefn(
-    const Eigen::Matrix<double, 2, 1>& xi,
-    const Eigen::Matrix<double, 2, 1>& particle_size,
-    const Eigen::Matrix<double, 2, 1>& deformation_gradient) const {
+inline Eigen::Matrix<double, 3, 2>
+    mpm::TriangleElement<2, 3>::grad_shapefn_fixed(
+        const Eigen::Matrix<double, 2, 1>& xi,
+        const Eigen::Matrix<double, 2, 1>& particle_size,
+        const Eigen::Matrix<double, 2, 1>& deformation_gradient) const {
   Eigen::Matrix<double, 3, 2> grad_shapefn;
 
   grad_shapefn(0, 0) = -1.;
@@ -67,10 +69,11 @@ inline Eigen::MatrixXd mpm::TriangleElement<2, 3>::unit_cell_coordinates()
 //! Return shape functions of a 6-node Triangle Element at a given local
 //! coordinate, with particle size and deformation gradient
 template <>
-inline Eigen::VectorXd mpm::TriangleElement<2, 6>::shapefn(
-    const Eigen::Matrix<double, 2, 1>& xi,
-    const Eigen::Matrix<double, 2, 1>& particle_size,
-    const Eigen::Matrix<double, 2, 1>& deformation_gradient) const {
+inline Eigen::Matrix<double, 6, 1>
+    mpm::TriangleElement<2, 6>::shapefn_fixed(
+        const Eigen::Matrix<double, 2, 1>& xi,
+        const Eigen::Matrix<double, 2, 1>& particle_size,
+        const Eigen::Matrix<double, 2, 1>& deformation_gradient) const {
   Eigen::Matrix<double, 6, 1> shapefn;
   shapefn(0) = (1. - xi(0) - xi(1)) * (1. - 2. * xi(0) - 2. * xi(1));
   shapefn(1) = xi(0) * (2. * xi(0) - 1.);
@@ -84,10 +87,11 @@ inline Eigen::VectorXd mpm::TriangleElement<2, 6>::shapefn(
 //! Return gradient of shape functions of a 6-node Triangle Element at a
 //! given local coordinate, with particle size and deformation gradient
 template <>
-inline Eigen::MatrixXd mpm::TriangleElement<2, 6>::grad_shapefn(
-    const Eigen::Matrix<double, 2, 1>& xi,
-    const Eigen::Matrix<double, 2, 1>& particle_size,
-    const Eigen::Matrix<double, 2, 1>& deformation_gradient) const {
+inline Eigen::Matrix<double, 6, 2>
+    mpm::TriangleElement<2, 6>::grad_shapefn_fixed(
+        const Eigen::Matrix<double, 2, 1>& xi,
+        const Eigen::Matrix<double, 2, 1>& particle_size,
+        const Eigen::Matrix<double, 2, 1>& deformation_gradient) const {
   Eigen::Matrix<double, 6, 2> grad_shapefn;
   grad_shapefn(0, 0) = 4. * xi(0) + 4. * xi(1) - 3.;
   grad_shapefn(1, 0) = 4. * xi(0) - 1.;
@@ -137,6 +141,34 @@ inline mpm::ElementDegree mpm::TriangleElement<2, 6>::degree() const {
   return mpm::ElementDegree::Quadratic;
 }
 
+//! Return shape functions at a given local coordinate
+template <unsigned Tdim, unsigned Tnfunctions>
+inline Eigen::VectorXd mpm::TriangleElement<Tdim, Tnfunctions>::shapefn(
+    const VectorDim& xi, const VectorDim& particle_size,
+    const VectorDim& deformation_gradient) const {
+  return this->shapefn_fixed(xi, particle_size, deformation_gradient);
+}
+
+//! Return gradient of shape functions at a given local coordinate
+template <unsigned Tdim, unsigned Tnfunctions>
+inline Eigen::MatrixXd mpm::TriangleElement<Tdim, Tnfunctions>::grad_shapefn(
+    const VectorDim& xi, const VectorDim& particle_size,
+    const VectorDim& deformation_gradient) const {
+  return this->grad_shapefn_fixed(xi, particle_size, deformation_gradient);
+}
+
+//! Compute shape functions and gradient of shape functions in fixed size
+//! buffers
+template <unsigned Tdim, unsigned Tnfunctions>
+inline void mpm::TriangleElement<Tdim, Tnfunctions>::shapefn_grad_shapefn(
+    const VectorDim& xi, const VectorDim& particle_size,
+    const VectorDim& deformation_gradient, ShapefnVector* shapefn,
+    GradShapefnMatrix* grad_shapefn) const {
+  (*shapefn) = this->shapefn_fixed(xi, particle_size, deformation_gradient);
+  (*grad_shapefn) =
+      this->grad_shapefn_fixed(xi, particle_size, deformation_gradient);
+}
+
 //! Return local shape functions of a Triangle Element at a given local
 //! coordinate, with particle size and deformation gradient
 template <unsigned Tdim, unsigned Tnfunctions>
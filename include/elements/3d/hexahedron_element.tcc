@@ -17,10 +17,11 @@
 //! \param[in] xi Coordinates of point of interest \retval
 //! shapefn Shape function of a given cell
 template <>
-inline Eigen::VectorXd mpm::HexahedronElement<3, 8>::shapefn(
-    const Eigen::Matrix<double, 3, 1>& xi,
-    const Eigen::Matrix<double, 3, 1>& particle_size,
-    const Eigen::Matrix<double, 3, 1>& deformation_gradient) const {
+inline Eigen::Matrix<double, 8, 1>
+    mpm::HexahedronElement<3, 8>::shapefn_fixed(
+        const Eigen::Matrix<double, 3, 1>& xi,
+        const Eigen::Matrix<double, 3, 1>& particle_size,
+        const Eigen::Matrix<double, 3, 1>& deformation_gradient) const {
   // 8-noded
   Eigen::Matrix<double, 8, 1> shapefn;
   shapefn(0) = 0.125 * (1 - xi(0)) * (1 - xi(1)) * (1 - xi(2));
@@ -39,10 +40,11 @@ inline Eigen::VectorXd mpm::HexahedronElement<3, 8>::shapefn(
 //! \param[in] xi Coordinates of point of interest
 //! \retval grad_shapefn Gradient of shape function of a given cell
 template <>
-inline Eigen::MatrixXd mpm::HexahedronElement<3, 8>::grad_shapefn(
-    const Eigen::Matrix<double, 3, 1>& xi,
-    const Eigen::Matrix<double, 3, 1>& particle_size,
-    const Eigen::Matrix<double, 3, 1>& deformation_gradient) const {
+inline Eigen::Matrix<double, 8, 3>
+    mpm::HexahedronElement<3, 8>::grad_shapefn_fixed(
+        const Eigen::Matrix<double, 3, 1>& xi,
+        const Eigen::Matrix<double, 3, 1>& particle_size,
+        const Eigen::Matrix<double, 3, 1>& deformation_gradient) const {
   Eigen::Matrix<double, 8, 3> grad_shapefn;
   grad_shapefn(0, 0) = -0.125 * (1 - xi(1)) * (1 - xi(2));
   grad_shapefn(1, 0) = 0.125 * (1 - xi(1)) * (1 - xi(2));
@@ -114,10 +116,11 @@ inline Eigen::MatrixXd mpm::HexahedronElement<3, 8>::unit_cell_coordinates()
 //! \param[in] xi Coordinates of point of interest
 //! \retval shapefn Shape function of a given cell
 template <>
-inline Eigen::VectorXd mpm::HexahedronElement<3, 20>::shapefn(
-    const Eigen::Matrix<double, 3, 1>& xi,
-    const Eigen::Matrix<double, 3, 1>& particle_size,
-    const Eigen::Matrix<double, 3, 1>& deformation_gradient) const {
+inline Eigen::Matrix<double, 20, 1>
+    mpm::HexahedronElement<3, 20>::shapefn_fixed(
+        const Eigen::Matrix<double, 3, 1>& xi,
+        const Eigen::Matrix<double, 3, 1>& particle_size,
+        const Eigen::Matrix<double, 3, 1>& deformation_gradient) const {
   Eigen::Matrix<double, 20, 1> shapefn;
   shapefn(0) = -0.125 * (1 - xi(0)) * (1 - xi(1)) * (1 - xi(2)) *
                (2 + xi(0) + xi(1) + xi(2));
@@ -156,10 +159,11 @@ inline Eigen::VectorXd mpm::HexahedronElement<3, 20>::shapefn(
 //! \param[in] xi Coordinates of point of interest
 //! \retval grad_shapefn Gradient of shape function of a given cell
 template <>
-inline Eigen::MatrixXd mpm::HexahedronElement<3, 20>::grad_shapefn(
-    const Eigen::Matrix<double, 3, 1>& xi,
-    const Eigen::Matrix<double, 3, 1>& particle_size,
-    const Eigen::Matrix<double, 3, 1>& deformation_gradient) const {
+inline Eigen::Matrix<double, 20, 3>
+    mpm::HexahedronElement<3, 20>::grad_shapefn_fixed(
+        const Eigen::Matrix<double, 3, 1>& xi,
+        const Eigen::Matrix<double, 3, 1>& particle_size,
+        const Eigen::Matrix<double, 3, 1>& deformation_gradient) const {
   Eigen::Matrix<double, 20, 3> grad_shapefn;
 
   grad_shapefn(0, 0) =
@@ -251,6 +255,34 @@ inline Eigen::MatrixXd mpm::HexahedronElement<3, 20>::grad_shapefn(
   return grad_shapefn;
 }
 
+//! Return shape functions at a given local coordinate
+template <unsigned Tdim, unsigned Tnfunctions>
+inline Eigen::VectorXd mpm::HexahedronElement<Tdim, Tnfunctions>::shapefn(
+    const VectorDim& xi, const VectorDim& particle_size,
+    const VectorDim& deformation_gradient) const {
+  return this->shapefn_fixed(xi, particle_size, deformation_gradient);
+}
+
+//! Return gradient of shape functions at a given local coordinate
+template <unsigned Tdim, unsigned Tnfunctions>
+inline Eigen::MatrixXd mpm::HexahedronElement<Tdim, Tnfunctions>::grad_shapefn(
+    const VectorDim& xi, const VectorDim& particle_size,
+    const VectorDim& deformation_gradient) const {
+  return this->grad_shapefn_fixed(xi, particle_size, deformation_gradient);
+}
+
+//! Compute shape functions and gradient of shape functions in fixed size
+//! buffers
+template <unsigned Tdim, unsigned Tnfunctions>
+inline void mpm::HexahedronElement<Tdim, Tnfunctions>::shapefn_grad_shapefn(
+    const VectorDim& xi, const VectorDim& particle_size,
+    const VectorDim& deformation_gradient, ShapefnVector* shapefn,
+    GradShapefnMatrix* grad_shapefn) const {
+  (*shapefn) = this->shapefn_fixed(xi, particle_size, deformation_gradient);
+  (*grad_shapefn) =
+      this->grad_shapefn_fixed(xi, particle_size, deformation_gradient);
+}
+
 //! Return local shape functions of a Hexahedron Element at a given local
 //! coordinate, with particle size and deformation gradient
 template <unsigned Tdim, unsigned Tnfunctions>
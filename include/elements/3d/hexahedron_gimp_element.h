@@ -18,6 +18,10 @@ class HexahedronGIMPElement : public HexahedronElement<3, 8> {
  public:
   //! Define a vector of size dimension
   using VectorDim = Eigen::Matrix<double, Tdim, 1>;
+  //! Shape functions in a fixed size buffer
+  using ShapefnVector = typename mpm::Element<Tdim>::ShapefnVector;
+  //! Gradient of shape functions in a fixed size buffer
+  using GradShapefnMatrix = typename mpm::Element<Tdim>::GradShapefnMatrix;
 
   //! constructor with number of shape functions
   HexahedronGIMPElement() : HexahedronElement<3, 8>() {
@@ -48,6 +52,38 @@ class HexahedronGIMPElement : public HexahedronElement<3, 8> {
       const VectorDim& xi, const VectorDim& particle_size,
       const VectorDim& deformation_gradient) const override;
 
+  //! Evaluate shape functions at given local coordinates in a fixed size
+  //! vector
+  //! \param[in] xi given local coordinates
+  //! \param[in] particle_size Particle size
+  //! \param[in] deformation_gradient Deformation gradient
+  //! \retval shapefn Shape function of a given cell
+  Eigen::Matrix<double, Tnfunctions, 1> shapefn_fixed(
+      const VectorDim& xi, const VectorDim& particle_size,
+      const VectorDim& deformation_gradient) const;
+
+  //! Evaluate gradient of shape functions in a fixed size matrix
+  //! \param[in] xi given local coordinates
+  //! \param[in] particle_size Particle size
+  //! \param[in] deformation_gradient Deformation gradient
+  //! \retval grad_shapefn Gradient of shape function of a given cell
+  Eigen::Matrix<double, Tnfunctions, Tdim> grad_shapefn_fixed(
+      const VectorDim& xi, const VectorDim& particle_size,
+      const VectorDim& deformation_gradient) const;
+
+  //! Evaluate shape functions and gradient of shape functions at given
+  //! local coordinates in fixed size buffers
+  //! \param[in] xi given local coordinates
+  //! \param[in] particle_size Particle size
+  //! \param[in] deformation_gradient Deformation gradient
+  //! \param[out] shapefn Shape functions
+  //! \param[out] grad_shapefn Gradient of shape functions
+  void shapefn_grad_shapefn(const VectorDim& xi,
+                            const VectorDim& particle_size,
+                            const VectorDim& deformation_gradient,
+                            ShapefnVector* shapefn,
+                            GradShapefnMatrix* grad_shapefn) const override;
+
   //! Evaluate local shape functions at given local coordinates
   //! \param[in] xi given local coordinates
   //! \param[in] particle_size Particle size
@@ -95,12 +131,15 @@ class HexahedronGIMPElement : public HexahedronElement<3, 8> {
     return mpm::ShapefnType::GIMP;
   }
 
+  //! Return the type of element
+  std::string type() const override { return "ED3H64G"; }
+
   //! Return number of shape functions
   unsigned nfunctions() const override { return Tnfunctions; }
 
  private:
   //! Return natural nodal coordinates
-  Eigen::MatrixXd natural_nodal_coordinates() const;
+  Eigen::Matrix<double, Tnfunctions, Tdim> natural_nodal_coordinates() const;
 
   //! Logger
   std::unique_ptr<spdlog::logger> console_;
@@ -1,6 +1,6 @@
 // Return natural nodal coordinates
 template <unsigned Tdim, unsigned Tnfunctions>
-inline Eigen::MatrixXd mpm::HexahedronGIMPElement<
+inline Eigen::Matrix<double, Tnfunctions, Tdim> mpm::HexahedronGIMPElement<
     Tdim, Tnfunctions>::natural_nodal_coordinates() const {
   //! Natural coordinates of nodes
   const Eigen::Matrix<double, Tnfunctions, Tdim> local_nodes =
@@ -23,10 +23,11 @@ inline Eigen::MatrixXd mpm::HexahedronGIMPElement<
 //! Return shape functions of a 64-node Hexahedron GIMP Element at a given
 //! local coordinate
 template <unsigned Tdim, unsigned Tnfunctions>
-inline Eigen::VectorXd mpm::HexahedronGIMPElement<Tdim, Tnfunctions>::shapefn(
-    const Eigen::Matrix<double, Tdim, 1>& xi,
-    const Eigen::Matrix<double, Tdim, 1>& particle_size,
-    const Eigen::Matrix<double, Tdim, 1>& deformation_gradient) const {
+inline Eigen::Matrix<double, Tnfunctions, 1>
+    mpm::HexahedronGIMPElement<Tdim, Tnfunctions>::shapefn_fixed(
+        const Eigen::Matrix<double, Tdim, 1>& xi,
+        const Eigen::Matrix<double, Tdim, 1>& particle_size,
+        const Eigen::Matrix<double, Tdim, 1>& deformation_gradient) const {
 
   //! length of element in local coordinate
   const double element_length = 2.;
@@ -84,8 +85,8 @@ inline Eigen::VectorXd mpm::HexahedronGIMPElement<Tdim, Tnfunctions>::shapefn(
 //! Return gradient of shape functions of a 64-node Hexahedron Element at a
 //! given local coordinate
 template <unsigned Tdim, unsigned Tnfunctions>
-inline Eigen::MatrixXd
-    mpm::HexahedronGIMPElement<Tdim, Tnfunctions>::grad_shapefn(
+inline Eigen::Matrix<double, Tnfunctions, Tdim>
+    mpm::HexahedronGIMPElement<Tdim, Tnfunctions>::grad_shapefn_fixed(
         const Eigen::Matrix<double, Tdim, 1>& xi,
         const Eigen::Matrix<double, Tdim, 1>& particle_size,
         const Eigen::Matrix<double, Tdim, 1>& deformation_gradient) const {
@@ -155,6 +156,37 @@ inline Eigen::MatrixXd
   return grad_shapefn;
 }
 
+//! Return shape functions at a given local coordinate
+template <unsigned Tdim, unsigned Tnfunctions>
+inline Eigen::VectorXd
+    mpm::HexahedronGIMPElement<Tdim, Tnfunctions>::shapefn(
+        const VectorDim& xi, const VectorDim& particle_size,
+        const VectorDim& deformation_gradient) const {
+  return this->shapefn_fixed(xi, particle_size, deformation_gradient);
+}
+
+//! Return gradient of shape functions at a given local coordinate
+template <unsigned Tdim, unsigned Tnfunctions>
+inline Eigen::MatrixXd
+    mpm::HexahedronGIMPElement<Tdim, Tnfunctions>::grad_shapefn(
+        const VectorDim& xi, const VectorDim& particle_size,
+        const VectorDim& deformation_gradient) const {
+  return this->grad_shapefn_fixed(xi, particle_size, deformation_gradient);
+}
+
+//! Compute shape functions and gradient of shape functions in fixed size
+//! buffers
+template <unsigned Tdim, unsigned Tnfunctions>
+inline void
+    mpm::HexahedronGIMPElement<Tdim, Tnfunctions>::shapefn_grad_shapefn(
+        const VectorDim& xi, const VectorDim& particle_size,
+        const VectorDim& deformation_gradient, ShapefnVector* shapefn,
+        GradShapefnMatrix* grad_shapefn) const {
+  (*shapefn) = this->shapefn_fixed(xi, particle_size, deformation_gradient);
+  (*grad_shapefn) =
+      this->grad_shapefn_fixed(xi, particle_size, deformation_gradient);
+}
+
 //! Return local shape functions of a GIMP Hexahedron Element at a given
 //! Return local shape functions of a Hexahedron Element at a given local
 //! coordinate, with particle size and deformation gradient
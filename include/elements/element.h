@@ -4,6 +4,7 @@
 #include <exception>
 #include <map>
 #include <memory>
+#include <string>
 #include <vector>
 
 #include <Eigen/Dense>
@@ -19,6 +20,10 @@ enum ElementDegree { Linear = 1, Quadratic = 2 };
 // Element Shapefn
 enum ShapefnType { NORMAL_MPM = 1, GIMP = 2, CPDI = 3 };
 
+//! Element type
+extern std::map<std::string, int> ElementType;
+extern std::map<int, std::string> ElementTypeName;
+
 //! Base class of shape functions
 //! \brief Base class that stores the information about shape functions
 //! \tparam Tdim Dimension
@@ -28,6 +33,19 @@ class Element {
   //! Define a vector of size dimension
   using VectorDim = Eigen::Matrix<double, Tdim, 1>;
 
+  //! Maximum number of shape functions of an element (GIMP)
+  static const unsigned Tmax_nfunctions = (Tdim == 3) ? 64 : 16;
+
+  //! Shape functions in a fixed size buffer (no heap allocation)
+  using ShapefnVector =
+      Eigen::Matrix<double, Eigen::Dynamic, 1, Eigen::ColMajor,
+                    Tmax_nfunctions, 1>;
+
+  //! Gradient of shape functions stored in a fixed size buffer
+  using GradShapefnMatrix =
+      Eigen::Matrix<double, Eigen::Dynamic, Tdim, Eigen::ColMajor,
+                    Tmax_nfunctions, Tdim>;
+
   //! Constructor
   //! Assign variables to zero
   Element() = default;
@@ -94,6 +112,22 @@ class Element {
       const VectorDim& particle_size,
       const VectorDim& deformation_gradient) const = 0;
 
+  //! Evaluate shape functions and dN/dx at a given local coord in place
+  //! \details The outputs are resized to the number of shape functions of
+  //! the element, buffers of the same size are reused without allocation
+  //! \param[in] xi given local coordinates
+  //! \param[in] nodal_coordinates Coordinates of nodes forming the cell
+  //! \param[in] particle_size Particle size
+  //! \param[in] deformation_gradient Deformation gradient
+  //! \param[out] shapefn Shape functions
+  //! \param[out] dn_dx Gradient of shape functions in real coordinates
+  //! \retval status Status of the dimensions of xi and nodal coordinates
+  bool shapefn_dn_dx(const VectorDim& xi,
+                     const Eigen::MatrixXd& nodal_coordinates,
+                     const VectorDim& particle_size,
+                     const VectorDim& deformation_gradient,
+                     Eigen::VectorXd* shapefn, Eigen::MatrixXd* dn_dx) const;
+
   //! Evaluate the B matrix at given local coordinates for a real cell
   //! \param[in] xi given local coordinates
   //! \param[in] nodal_coordinates Coordinates of nodes forming the cell
@@ -122,6 +156,9 @@ class Element {
   //! Return the degree of element
   virtual mpm::ElementDegree degree() const = 0;
 
+  //! Return the type of element, which is its key in the element factory
+  virtual std::string type() const = 0;
+
   //! Return the shapefn type of element
   virtual mpm::ShapefnType shapefn_type() const = 0;
 
@@ -171,8 +208,24 @@ class Element {
   virtual VectorDim natural_coordinates_analytical(
       const VectorDim& point,
       const Eigen::MatrixXd& nodal_coordinates) const = 0;
+
+ protected:
+  //! Evaluate shape functions and gradient of shape functions at given
+  //! local coordinates in fixed size buffers
+  //! \param[in] xi given local coordinates
+  //! \param[in] particle_size Particle size
+  //! \param[in] deformation_gradient Deformation gradient
+  //! \param[out] shapefn Shape functions
+  //! \param[out] grad_shapefn Gradient of shape functions
+  virtual void shapefn_grad_shapefn(const VectorDim& xi,
+                                    const VectorDim& particle_size,
+                                    const VectorDim& deformation_gradient,
+                                    ShapefnVector* shapefn,
+                                    GradShapefnMatrix* grad_shapefn) const = 0;
 };
 
 }  // namespace mpm
 
+#include "element.tcc"
+
 #endif  // MPM_ELEMENT_H_
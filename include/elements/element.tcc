@@ -0,0 +1,38 @@
+//! Compute shape functions and dN/dx at a given local coordinate
+template <unsigned Tdim>
+bool mpm::Element<Tdim>::shapefn_dn_dx(
+    const VectorDim& xi, const Eigen::MatrixXd& nodal_coordinates,
+    const VectorDim& particle_size, const VectorDim& deformation_gradient,
+    Eigen::VectorXd* shapefn, Eigen::MatrixXd* dn_dx) const {
+  // Shape functions and gradient of shape functions
+  ShapefnVector sf;
+  GradShapefnMatrix grad_sf;
+  this->shapefn_grad_shapefn(xi, particle_size, deformation_gradient, &sf,
+                             &grad_sf);
+
+  // Resize outputs to the number of shape functions of the element
+  shapefn->resize(sf.rows());
+  dn_dx->resize(grad_sf.rows(), Tdim);
+
+  // Check if matrices dimensions are correct
+  if ((grad_sf.rows() != nodal_coordinates.rows()) ||
+      (xi.size() != nodal_coordinates.cols())) {
+    shapefn->setZero();
+    dn_dx->setZero();
+    return false;
+  }
+
+  // Shape functions
+  (*shapefn) = sf;
+
+  // Jacobian dx_i/dxi_j
+  const Eigen::Matrix<double, Tdim, Tdim> jacobian =
+      grad_sf.transpose().lazyProduct(nodal_coordinates);
+
+  // Gradient shapefn of the cell
+  // dN/dx = [J]^-1 * dN/dxi
+  const Eigen::Matrix<double, Tdim, Tdim> jacobian_inverse_t =
+      jacobian.inverse().transpose();
+  dn_dx->noalias() = grad_sf.lazyProduct(jacobian_inverse_t);
+  return true;
+}
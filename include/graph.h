@@ -11,6 +11,8 @@
 
 #ifdef USE_GRAPH_PARTITIONING
 #include <parhip_interface.h>
+#include <tsl/robin_map.h>
+#include <tsl/robin_set.h>
 
 #include "cell.h"
 #include "particle.h"
@@ -46,6 +48,21 @@ class Graph {
   std::vector<mpm::Index> collect_partitions(int mpi_size, int mpi_rank,
                                              MPI_Comm* comm);
 
+  //! Construct graph of a distributed mesh, vertices are the cells of the
+  //! local rank numbered contiguously across ranks in the order of cell ids
+  //! \param[in] mpi_size # of MPI tasks
+  //! \param[in] mpi_rank MPI rank
+  //! \param[in] comm MPI Communication
+  void construct_distributed_graph(int mpi_size, int mpi_rank,
+                                   MPI_Comm* comm);
+
+  //! Collect partitions of a distributed mesh and assign them to the cells
+  //! of the local rank. A cell only moves to a rank owning one of its
+  //! neighbours, which holds the cell as a halo cell.
+  //! \param[in] mpi_rank MPI rank
+  //! \retval Return cell ids of the local rank which changed rank
+  std::vector<mpm::Index> collect_distributed_partitions(int mpi_rank);
+
   //! Return xadj
   std::vector<idxtype> xadj() const;
 
@@ -58,6 +75,9 @@ class Graph {
   //! Return vwgt
   std::vector<idxtype> vwgt() const;
 
+  //! Return adjwgt
+  std::vector<idxtype> adjwgt() const;
+
   //! Tdim
   void assign_ndims(idxtype a);
 
@@ -65,6 +85,13 @@ class Graph {
   int nparts();
 
  private:
+  //! Return the weight of the edge between neighbour cells, the number of
+  //! nodes they share and at least 1
+  //! \param[in] cell Cell
+  //! \param[in] neighbour Neighbour cell
+  static idxtype edge_weight(const std::shared_ptr<Cell<Tdim>>& cell,
+                             const std::shared_ptr<Cell<Tdim>>& neighbour);
+
   // Vector of cells
   Vector<Cell<Tdim>> cells_;
   // Number of partitions
@@ -76,11 +103,12 @@ class Graph {
 
   // Partition ids
   std::vector<mpm::Index> part_;
-  // Array that stores the weights of the adjacency lists
+  // Array that stores the weights of the adjacency lists, the number of
+  // nodes shared by neighbour cells
   std::vector<idxtype> adjwgt_;
   // Pointers to the locally stored vertices
   std::vector<idxtype> xadj_;
-  // Vertex weights
+  // Vertex weights, the cost of particles of cells
   std::vector<idxtype> vwgt_;
   // Array that stores the adjacency lists of nvtxs
   std::vector<idxtype> adjncy_;
@@ -14,9 +14,15 @@ void mpm::Graph<Tdim>::construct_graph(int mpi_size, int mpi_rank) {
   this->vtxdist_.clear();
   this->part_.clear();
 
-  //! There is no adjacency weight (edge weight)
+  //! Adjacency weights are the number of shared nodes
   this->adjwgt_.clear();
 
+  //! Cells by id to find shared nodes of neighbours
+  tsl::robin_map<mpm::Index, std::shared_ptr<Cell<Tdim>>> cells;
+  cells.reserve(cells_.size());
+  for (auto citr = cells_.cbegin(); citr != cells_.cend(); ++citr)
+    cells.insert(std::make_pair((*citr)->id(), *citr));
+
   idxtype sum = cells_.size();
 
   idxtype part = 0;
@@ -67,9 +73,11 @@ void mpm::Graph<Tdim>::construct_graph(int mpi_size, int mpi_rank) {
       //! get the id of neighbours
       for (const auto& neighbour : neighbours) {
         adjncy_.emplace_back(neighbour);
-        adjwgt_.emplace_back(1.);
+        const auto nitr = cells.find(neighbour);
+        adjwgt_.emplace_back(
+            (nitr != cells.end()) ? edge_weight(*citr, nitr->second) : 1);
       }
-      vwgt_.emplace_back((*citr)->nglobal_particles());
+      vwgt_.emplace_back((*citr)->particles_cost());
     }
   }
 
@@ -104,6 +112,26 @@ std::vector<idxtype> mpm::Graph<Tdim>::vwgt() const {
   return this->vwgt_;
 }
 
+//! Return adjwgt
+template <unsigned Tdim>
+std::vector<idxtype> mpm::Graph<Tdim>::adjwgt() const {
+  return this->adjwgt_;
+}
+
+//! Return the weight of the edge between neighbour cells
+template <unsigned Tdim>
+idxtype mpm::Graph<Tdim>::edge_weight(
+    const std::shared_ptr<Cell<Tdim>>& cell,
+    const std::shared_ptr<Cell<Tdim>>& neighbour) {
+  const auto nodes = cell->nodes();
+  const auto neighbour_nodes = neighbour->nodes();
+  idxtype nshared_nodes = 0;
+  for (const auto& node : nodes)
+    for (const auto& neighbour_node : neighbour_nodes)
+      if (node->id() == neighbour_node->id()) ++nshared_nodes;
+  return std::max<idxtype>(nshared_nodes, 1);
+}
+
 template <unsigned Tdim>
 void mpm::Graph<Tdim>::assign_ndims(idxtype n) {
   this->ndims_ = n;
@@ -143,38 +171,20 @@ std::vector<mpm::Index> mpm::Graph<Tdim>::collect_partitions(int mpi_size,
   std::vector<mpm::Index> partition(ncells, 0);
   // ID of cells, which should transfer particles
   std::vector<mpm::Index> exchange_cells;
-  if (mpi_rank == 0) {
-    int par = 0;
-    for (int i = 0; i < this->vtxdist_[1]; ++i) {
-      partition[par] = this->part_[i];
-      par = par + 1;
-    }
-
-    for (int penum = 1; penum < mpi_size; ++penum) {
-      idxtype rnvtxs = this->vtxdist_[penum + 1] - this->vtxdist_[penum];
-      std::vector<idxtype> rpart(rnvtxs);
-      //! penum is the source process
-      MPI_Recv(rpart.data(), rnvtxs, MPI_UNSIGNED_LONG_LONG, penum, 1, *comm,
-               MPI_STATUS_IGNORE);
-
-      for (int i = 0; i < rnvtxs; ++i) {
-        partition[par] = rpart[i];
-        par = par + 1;
-      }
-    }
-
-    for (int penum = 1; penum < mpi_size; ++penum)
-      MPI_Send(partition.data(), ncells, MPI_UNSIGNED_LONG_LONG, penum, 1,
-               *comm);
 
-  } else {
-    MPI_Send(this->part_.data(),
-             this->vtxdist_[mpi_rank + 1] - this->vtxdist_[mpi_rank],
-             MPI_UNSIGNED_LONG_LONG, 0, 1, *comm);
-    MPI_Recv(partition.data(), ncells, MPI_UNSIGNED_LONG_LONG, 0, 1, *comm,
-             MPI_STATUS_IGNORE);
+  // Number and offset of the vertices of each rank
+  std::vector<int> nvertices(mpi_size, 0), displacements(mpi_size, 0);
+  for (int penum = 0; penum < mpi_size; ++penum) {
+    if (static_cast<std::size_t>(penum + 1) >= this->vtxdist_.size()) break;
+    nvertices[penum] = this->vtxdist_[penum + 1] - this->vtxdist_[penum];
+    displacements[penum] = this->vtxdist_[penum];
   }
 
+  // Gather the partition of all vertices on all ranks
+  MPI_Allgatherv(this->part_.data(), nvertices[mpi_rank],
+                 MPI_UNSIGNED_LONG_LONG, partition.data(), nvertices.data(),
+                 displacements.data(), MPI_UNSIGNED_LONG_LONG, *comm);
+
   // Assign partition to cells
   for (auto citr = this->cells_.cbegin(); citr != this->cells_.cend(); ++citr) {
     auto current_rank = partition[(*citr)->id()];
@@ -191,3 +201,142 @@ std::vector<mpm::Index> mpm::Graph<Tdim>::collect_partitions(int mpi_size,
   }
   return exchange_cells;
 }
+
+//! Construct graph of a distributed mesh
+template <unsigned Tdim>
+void mpm::Graph<Tdim>::construct_distributed_graph(int mpi_size, int mpi_rank,
+                                                   MPI_Comm* comm) {
+  // Clear all graph properties
+  this->xadj_.clear();
+  this->vwgt_.clear();
+  this->adjncy_.clear();
+  this->vtxdist_.clear();
+  this->part_.clear();
+  this->adjwgt_.clear();
+  this->ndims_ = Tdim;
+
+  // Cells of the local rank are the vertices of the rank
+  std::vector<std::shared_ptr<Cell<Tdim>>> vertices;
+  for (auto citr = cells_.cbegin(); citr != cells_.cend(); ++citr)
+    if ((*citr)->rank() == mpi_rank) vertices.emplace_back(*citr);
+
+  //! Distribution of vertices across ranks
+  idxtype nvertices = vertices.size();
+  std::vector<idxtype> nrank_vertices(mpi_size, 0);
+  MPI_Allgather(&nvertices, 1, MPI_UNSIGNED_LONG_LONG, nrank_vertices.data(),
+                1, MPI_UNSIGNED_LONG_LONG, *comm);
+  vtxdist_.emplace_back(0);
+  for (int penum = 0; penum < mpi_size; ++penum)
+    vtxdist_.emplace_back(vtxdist_.back() + nrank_vertices[penum]);
+
+  //! Vertices of local cells, vertices of halo cells are requested from the
+  //! rank of the cell
+  tsl::robin_map<mpm::Index, idxtype> cell_vertices;
+  for (idxtype i = 0; i < nvertices; ++i)
+    cell_vertices.insert(
+        std::make_pair(vertices[i]->id(), vtxdist_[mpi_rank] + i));
+
+  std::vector<std::vector<mpm::Index>> requests(mpi_size);
+  tsl::robin_set<mpm::Index> requested;
+  tsl::robin_map<mpm::Index, unsigned> halo_ranks;
+  tsl::robin_map<mpm::Index, std::shared_ptr<Cell<Tdim>>> cells;
+  for (auto citr = cells_.cbegin(); citr != cells_.cend(); ++citr) {
+    cells.insert(std::make_pair((*citr)->id(), *citr));
+    if ((*citr)->rank() != mpi_rank)
+      halo_ranks.insert(std::make_pair((*citr)->id(), (*citr)->rank()));
+  }
+  for (const auto& cell : vertices)
+    for (const auto neighbour : cell->neighbours()) {
+      const auto itr = halo_ranks.find(neighbour);
+      if (itr != halo_ranks.end() && requested.insert(neighbour).second)
+        requests[itr->second].emplace_back(neighbour);
+    }
+
+  //! Exchange requested cell ids and reply their vertices
+  std::vector<int> send_counts(mpi_size, 0), recv_counts(mpi_size, 0);
+  std::vector<int> send_displs(mpi_size, 0), recv_displs(mpi_size, 0);
+  std::vector<mpm::Index> send_ids;
+  for (int penum = 0; penum < mpi_size; ++penum) {
+    send_counts[penum] = requests[penum].size();
+    send_displs[penum] = send_ids.size();
+    send_ids.insert(send_ids.end(), requests[penum].begin(),
+                    requests[penum].end());
+  }
+  MPI_Alltoall(send_counts.data(), 1, MPI_INT, recv_counts.data(), 1, MPI_INT,
+               *comm);
+  int nrecv = 0;
+  for (int penum = 0; penum < mpi_size; ++penum) {
+    recv_displs[penum] = nrecv;
+    nrecv += recv_counts[penum];
+  }
+  std::vector<mpm::Index> recv_ids(nrecv);
+  MPI_Alltoallv(send_ids.data(), send_counts.data(), send_displs.data(),
+                MPI_UNSIGNED_LONG_LONG, recv_ids.data(), recv_counts.data(),
+                recv_displs.data(), MPI_UNSIGNED_LONG_LONG, *comm);
+
+  std::vector<idxtype> reply_vertices(nrecv);
+  for (int i = 0; i < nrecv; ++i)
+    reply_vertices[i] = cell_vertices.at(recv_ids[i]);
+  std::vector<idxtype> halo_vertices(send_ids.size());
+  MPI_Alltoallv(reply_vertices.data(), recv_counts.data(), recv_displs.data(),
+                MPI_UNSIGNED_LONG_LONG, halo_vertices.data(),
+                send_counts.data(), send_displs.data(), MPI_UNSIGNED_LONG_LONG,
+                *comm);
+  for (std::size_t i = 0; i < send_ids.size(); ++i)
+    cell_vertices.insert(std::make_pair(send_ids[i], halo_vertices[i]));
+
+  //! Adjacency of the local vertices
+  this->xadj_.emplace_back(0);
+  mpm::Index offset = 0;
+  for (const auto& cell : vertices) {
+    for (const auto neighbour : cell->neighbours()) {
+      adjncy_.emplace_back(cell_vertices.at(neighbour));
+      adjwgt_.emplace_back(edge_weight(cell, cells.at(neighbour)));
+    }
+    offset += cell->nneighbours();
+    this->xadj_.emplace_back(offset);
+    vwgt_.emplace_back(cell->particles_cost());
+  }
+
+  //! assign nparts
+  nparts_ = mpi_size;
+
+  //! allocate space for part
+  part_.assign(nvertices, 0);
+}
+
+//! Collect partitions of a distributed mesh
+template <unsigned Tdim>
+std::vector<mpm::Index> mpm::Graph<Tdim>::collect_distributed_partitions(
+    int mpi_rank) {
+  // ID of cells, which should transfer particles
+  std::vector<mpm::Index> exchange_cells;
+
+  // Ranks of cells before the partition
+  tsl::robin_map<mpm::Index, unsigned> cell_ranks;
+  for (auto citr = cells_.cbegin(); citr != cells_.cend(); ++citr)
+    cell_ranks.insert(std::make_pair((*citr)->id(), (*citr)->rank()));
+
+  // Assign partition to cells in the order of vertices
+  idxtype vertex = 0;
+  for (auto citr = cells_.cbegin(); citr != cells_.cend(); ++citr) {
+    if (cell_ranks.at((*citr)->id()) != mpi_rank) continue;
+    const unsigned current_rank = this->part_[vertex++];
+    if (current_rank == mpi_rank) continue;
+
+    // A cell is only moved to a rank which holds it as a halo cell
+    bool neighbour_rank = false;
+    for (const auto neighbour : (*citr)->neighbours()) {
+      const auto itr = cell_ranks.find(neighbour);
+      if (itr != cell_ranks.end() && itr->second == current_rank)
+        neighbour_rank = true;
+    }
+    if (!neighbour_rank) continue;
+
+    // Assign current MPI rank, particles are transferred even if the cell is
+    // empty, as the receiving rank expects a message
+    (*citr)->rank(current_rank);
+    exchange_cells.emplace_back((*citr)->id());
+  }
+  return exchange_cells;
+}
@@ -1,6 +1,10 @@
 #ifndef MPM_HDF5_H_
 #define MPM_HDF5_H_
 
+#include <cstring>
+#include <string>
+#include <vector>
+
 // HDF5
 #include "hdf5.h"
 #include "hdf5_hl.h"
@@ -48,7 +52,49 @@ typedef struct HDF5Particle {
 
 namespace hdf5 {
 namespace particle {
-const hsize_t NFIELDS = 53;
+//! Number of fields of a particle without state variables
+const hsize_t NFIELDS = 33;
+
+//! Maximum number of state variables of HDF5Particle
+const unsigned NSVARS = 20;
+
+//! Index of the fields of a particle, the state variables of a particle
+//! follow the last field
+enum Field : unsigned {
+  Id,
+  Mass,
+  Volume,
+  Pressure,
+  CoordX,
+  CoordY,
+  CoordZ,
+  DisplacementX,
+  DisplacementY,
+  DisplacementZ,
+  NsizeX,
+  NsizeY,
+  NsizeZ,
+  VelocityX,
+  VelocityY,
+  VelocityZ,
+  StressXX,
+  StressYY,
+  StressZZ,
+  TauXY,
+  TauYZ,
+  TauXZ,
+  StrainXX,
+  StrainYY,
+  StrainZZ,
+  GammaXY,
+  GammaYZ,
+  GammaXZ,
+  EpsilonV,
+  Status,
+  CellId,
+  MaterialId,
+  NStateVars
+};
 
 const size_t dst_size = sizeof(HDF5Particle);
 
@@ -64,6 +110,124 @@ extern const char* field_names[NFIELDS];
 // Initialize field types
 extern const hid_t field_type[NFIELDS];
 
+//! Columns class
+//! \brief Particle data stored as one contiguous column per field
+//! \details The fields of a particle are followed by a column of doubles
+//! for each state variable
+class Columns {
+ public:
+  //! Constructor with number of particles and state variables
+  //! \param[in] nparticles Number of particles
+  //! \param[in] nstate_vars Number of state variables
+  explicit Columns(hsize_t nparticles, unsigned nstate_vars = 0);
+
+  //! Return number of particles
+  hsize_t nparticles() const { return nparticles_; }
+
+  //! Return number of state variables
+  unsigned nstate_vars() const { return nstate_vars_; }
+
+  //! Return number of fields including the state variables
+  unsigned nfields() const { return data_.size(); }
+
+  //! Return the name of a field
+  //! \param[in] field Index of the field
+  std::string name(unsigned field) const;
+
+  //! Return the HDF5 type of a field
+  //! \param[in] field Index of the field
+  hid_t type(unsigned field) const;
+
+  //! Return the size of a value of a field
+  //! \param[in] field Index of the field
+  size_t size(unsigned field) const;
+
+  //! Assign the value of a field of a particle
+  //! \tparam Tvalue Type of the field
+  //! \param[in] field Index of the field
+  //! \param[in] index Index of the particle in the columns
+  //! \param[in] value Value of the field
+  template <typename Tvalue>
+  void assign(unsigned field, hsize_t index, Tvalue value) {
+    std::memcpy(&data_[field][index * sizeof(Tvalue)], &value, sizeof(Tvalue));
+  }
+
+  //! Copy the fields of a particle to the columns
+  //! \param[in] index Index of the particle in the columns
+  //! \param[in] particle HDF5 data of particle
+  void pack(hsize_t index, const HDF5Particle& particle);
+
+  //! Return the fields of a particle in the columns
+  //! \param[in] index Index of the particle in the columns
+  HDF5Particle unpack(hsize_t index) const;
+
+  //! Return the columns of a list of particles
+  //! \param[in] indices Indices of the particles in the columns
+  Columns select(const std::vector<hsize_t>& indices) const;
+
+  //! Return the data of a field
+  //! \param[in] field Index of the field
+  char* data(unsigned field) { return data_[field].data(); }
+  const char* data(unsigned field) const { return data_[field].data(); }
+
+ private:
+  //! Number of particles
+  hsize_t nparticles_{0};
+  //! Number of state variables
+  unsigned nstate_vars_{0};
+  //! Data of each field
+  std::vector<std::vector<char>> data_;
+};
+
+//! Write the particle columns of all MPI ranks to a single file
+//! \details Each field is written as a dataset, and each rank writes its
+//! particles at the offset given by the number of particles on the lower
+//! ranks. The first rank creates the file and the ranks write in turn, the
+//! columns of all ranks have the same number of state variables. This
+//! function is collective over MPI_COMM_WORLD
+//! \param[in] filename Name of the file
+//! \param[in] columns Particle columns of this rank
+//! \param[in] compression Deflate level of chunked datasets (0 disables)
+//! \retval status Status of writing the file
+bool write_columns(const std::string& filename, const Columns& columns,
+                   unsigned compression = 0);
+
+//! Write the particle columns of a single process to a file
+//! \details No MPI calls are made, so the file can be written from any thread
+//! of a single rank
+//! \param[in] filename Name of the file
+//! \param[in] columns Particle columns
+//! \param[in] compression Deflate level of chunked datasets (0 disables)
+//! \retval status Status of writing the file
+bool write_process_columns(const std::string& filename, const Columns& columns,
+                           unsigned compression = 0);
+
+//! Return the number of particles in a file
+//! \param[in] filename Name of the file
+//! \retval nparticles Number of particles, throws if the file can't be read
+hsize_t read_nparticles(const std::string& filename);
+
+//! Read the particle columns of all particles in a file
+//! \param[in] filename Name of the file
+//! \retval columns Particle columns, throws if the file can't be read
+Columns read_columns(const std::string& filename);
+
+//! Read the particle columns of a contiguous range of particles in a file
+//! \details State variables without a dataset in the file are zero
+//! \param[in] filename Name of the file
+//! \param[in] offset Index of the first particle
+//! \param[in] count Number of particles
+//! \retval columns Particle columns, throws if the file can't be read
+Columns read_columns(const std::string& filename, hsize_t offset,
+                     hsize_t count);
+
+//! Send particle columns to the next MPI rank and receive the columns of the
+//! previous rank, the ranks form a ring
+//! \details This function is collective over MPI_COMM_WORLD
+//! \param[in] columns Particle columns sent by this rank
+//! \retval columns Particle columns received by this rank
+Columns shift_columns(const Columns& columns);
+
 }  // namespace particle
 }  // namespace hdf5
 
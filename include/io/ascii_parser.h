@@ -0,0 +1,117 @@
+#ifndef MPM_ASCII_PARSER_H_
+#define MPM_ASCII_PARSER_H_
+
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "data_types.h"
+
+//! MPM namespace
+namespace mpm {
+
+//! Parser of ascii input files
+//! \details A file is memory mapped and split into chunks of whole lines,
+//! which are parsed in parallel. Data lines are lines that are not blank and
+//! have no comment characters (# or !). Numbers are separated by whitespace.
+namespace ascii {
+
+//! MappedText class
+//! \brief Read-only memory map of a text file
+class MappedText {
+ public:
+  //! Map a text file
+  //! \details Throws if the file can not be mapped
+  //! \param[in] filename Input file
+  explicit MappedText(const std::string& filename);
+
+  //! Destructor unmaps the file
+  ~MappedText();
+
+  //! Delete copy constructor
+  MappedText(const MappedText&) = delete;
+
+  //! Delete assignment operator
+  MappedText& operator=(const MappedText&) = delete;
+
+  //! Return start of text
+  const char* begin() const { return data_; }
+
+  //! Return end of text
+  const char* end() const { return data_ + size_; }
+
+ private:
+  //! Mapped file
+  char* data_{nullptr};
+  //! Size of the file in bytes
+  std::size_t size_{0};
+};  // MappedText class
+
+//! Split text into chunks of whole lines
+//! \param[in] begin Start of text
+//! \param[in] end End of text
+//! \param[in] chunk_size Minimum size of a chunk in bytes
+//! \retval chunks Start and end of each chunk
+std::vector<std::pair<const char*, const char*>> split_lines(
+    const char* begin, const char* end, std::size_t chunk_size);
+
+//! Find the next data line and move past it
+//! \param[in,out] pos Position in text, moved to the start of the next line
+//! \param[in] end End of text
+//! \param[out] line_begin Start of data line without leading whitespace
+//! \param[out] line_end End of data line without trailing whitespace
+//! \retval status Return false if there are no more data lines
+bool next_line(const char*& pos, const char* end, const char*& line_begin,
+               const char*& line_end);
+
+//! Parse a real number and move past it
+//! \details Numbers with up to 19 significant digits and a decimal exponent
+//! up to 22 in magnitude are converted exactly without strtod
+//! \param[in,out] pos Position in line
+//! \param[in] end End of line
+//! \param[out] value Parsed value
+//! \retval status Return false if there is no number
+bool parse(const char*& pos, const char* end, double& value);
+
+//! Parse an index and move past it
+//! \param[in,out] pos Position in line
+//! \param[in] end End of line
+//! \param[out] value Parsed value
+//! \retval status Return false if there is no number
+bool parse(const char*& pos, const char* end, mpm::Index& value);
+
+//! Parse an unsigned integer and move past it
+//! \param[in,out] pos Position in line
+//! \param[in] end End of line
+//! \param[out] value Parsed value
+//! \retval status Return false if there is no number
+bool parse(const char*& pos, const char* end, unsigned& value);
+
+//! Parse an integer and move past it
+//! \param[in,out] pos Position in line
+//! \param[in] end End of line
+//! \param[out] value Parsed value
+//! \retval status Return false if there is no number
+bool parse(const char*& pos, const char* end, int& value);
+
+//! Parse data lines of text in parallel
+//! \details Text is split into chunks of whole lines, each chunk is parsed
+//! by a thread and the records of the chunks are merged in order
+//! \tparam Trecord Type of record
+//! \tparam Tparser Callable as parser(index, line_begin, line_end, records),
+//! which appends the records of a data line to records, index is the number
+//! of the data line from the start of text
+//! \param[in] begin Start of text
+//! \param[in] end End of text
+//! \param[in] parser Parser of a data line
+//! \retval records Records of all data lines in order
+template <typename Trecord, typename Tparser>
+std::vector<Trecord> parse_lines(const char* begin, const char* end,
+                                 Tparser parser);
+
+}  // namespace ascii
+}  // namespace mpm
+
+#include "ascii_parser.tcc"
+
+#endif  // MPM_ASCII_PARSER_H_
@@ -0,0 +1,39 @@
+//! Parse data lines of text in parallel
+template <typename Trecord, typename Tparser>
+std::vector<Trecord> mpm::ascii::parse_lines(const char* begin,
+                                             const char* end, Tparser parser) {
+  // Chunks of about a megabyte of lines
+  const auto chunks = mpm::ascii::split_lines(begin, end, 1 << 20);
+  const int nchunks = static_cast<int>(chunks.size());
+
+  // Count data lines of each chunk to number the lines of the next chunks
+  std::vector<mpm::Index> offsets(nchunks + 1, 0);
+#pragma omp parallel for schedule(dynamic)
+  for (int i = 0; i < nchunks; ++i) {
+    const char* pos = chunks[i].first;
+    const char *line_begin, *line_end;
+    while (mpm::ascii::next_line(pos, chunks[i].second, line_begin, line_end))
+      ++offsets[i + 1];
+  }
+  for (int i = 0; i < nchunks; ++i) offsets[i + 1] += offsets[i];
+
+  // Parse each chunk
+  std::vector<std::vector<Trecord>> chunk_records(nchunks);
+#pragma omp parallel for schedule(dynamic)
+  for (int i = 0; i < nchunks; ++i) {
+    const char* pos = chunks[i].first;
+    const char *line_begin, *line_end;
+    mpm::Index index = offsets[i];
+    while (mpm::ascii::next_line(pos, chunks[i].second, line_begin, line_end))
+      parser(index++, line_begin, line_end, chunk_records[i]);
+  }
+
+  // Merge records in order
+  std::size_t nrecords = 0;
+  for (const auto& records : chunk_records) nrecords += records.size();
+  std::vector<Trecord> records;
+  records.reserve(nrecords);
+  for (auto& chunk : chunk_records)
+    for (auto& record : chunk) records.emplace_back(std::move(record));
+  return records;
+}
@@ -0,0 +1,76 @@
+#ifndef MPM_ASYNC_WRITER_H_
+#define MPM_ASYNC_WRITER_H_
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+// Speed log
+#include "spdlog/spdlog.h"
+
+namespace mpm {
+
+//! AsyncWriter class
+//! \brief Write output on a background thread
+//! \details Output tasks run on a single writer thread in the order they are
+//! pushed. The queue is bounded and push blocks while it is full, so the
+//! solver can stage at most capacity output steps ahead of the writer.
+//! Tasks are expected to own the data they write and must not call MPI
+class AsyncWriter {
+ public:
+  //! Constructor with capacity
+  //! \param[in] capacity Maximum number of pending tasks
+  explicit AsyncWriter(unsigned capacity = 2);
+
+  //! Destructor writes pending tasks and stops the writer thread
+  ~AsyncWriter();
+
+  //! Delete copy constructor
+  AsyncWriter(const AsyncWriter&) = delete;
+
+  //! Delete assignment operator
+  AsyncWriter& operator=(const AsyncWriter&) = delete;
+
+  //! Add an output task, blocks while the queue is full
+  //! \param[in] task Output task
+  void push(std::function<void()> task);
+
+  //! Wait until all pending tasks are written
+  void wait();
+
+  //! Return number of pending (queued or running) tasks
+  unsigned npending() const;
+
+  //! Return maximum number of pending tasks
+  unsigned capacity() const { return capacity_; }
+
+ private:
+  //! Run output tasks until the writer is stopped
+  void run();
+
+ private:
+  //! Maximum number of pending tasks
+  unsigned capacity_{2};
+  //! Queued tasks
+  std::deque<std::function<void()>> tasks_;
+  //! Running task
+  bool running_{false};
+  //! Stop the writer thread
+  bool stop_{false};
+  //! Mutex of the queue
+  mutable std::mutex mutex_;
+  //! Notify the writer thread of a new task or stop
+  std::condition_variable task_added_;
+  //! Notify the solver of a finished task
+  std::condition_variable task_done_;
+  //! Logger
+  std::unique_ptr<spdlog::logger> console_;
+  //! Writer thread
+  std::thread thread_;
+};  // AsyncWriter class
+}  // namespace mpm
+
+#endif  // MPM_ASYNC_WRITER_H_
@@ -87,6 +87,19 @@ class IO {
                                       unsigned step, unsigned max_steps,
                                       bool parallel = true);
 
+  //! Return output file name of a step without its path
+  //! \param[in] attribute Attribute being written (eg., velocity / stress)
+  //! \param[in] file_extension File Extension (*.vtk or *.vtp)
+  //! \param[in] step Current step
+  //! \param[in] max_steps Total number of steps to be solved
+  //! \param[in] mpi_rank MPI rank which writes the file
+  //! \param[in] mpi_size Number of MPI ranks, the rank is a part of the name
+  //! if there is more than one rank
+  static std::string output_file_name(const std::string& attribute,
+                                      const std::string& file_extension,
+                                      unsigned step, unsigned max_steps,
+                                      int mpi_rank = 0, int mpi_size = 1);
+
  private:
   //! Number of parallel threads
   unsigned nthreads_{0};
@@ -4,6 +4,7 @@
 #include <array>
 #include <exception>
 #include <fstream>
+#include <functional>
 #include <map>
 #include <memory>
 #include <tuple>
@@ -51,6 +52,53 @@ class IOMesh {
   virtual std::vector<std::vector<mpm::Index>> read_mesh_cells(
       const std::string& mesh) = 0;
 
+  //! Read centroids of cells of a mesh
+  //! \details Reads all nodes and cells, readers which read a part of a file
+  //! at a time only hold the centroids
+  //! \param[in] mesh file name with nodes and cells
+  //! \retval centroids Centroids of cells in the order of cells
+  virtual std::vector<VectorDim> read_mesh_cell_centroids(
+      const std::string& mesh) {
+    const auto nodes = this->read_mesh_nodes(mesh);
+    const auto cells = this->read_mesh_cells(mesh);
+    std::vector<VectorDim> centroids;
+    centroids.reserve(cells.size());
+    for (const auto& cell : cells) {
+      VectorDim centroid = VectorDim::Zero();
+      for (const auto nid : cell) centroid += nodes.at(nid);
+      centroids.emplace_back(centroid / cell.size());
+    }
+    return centroids;
+  }
+
+  //! Iterate over the nodal indices of cells of a mesh in the order of cells
+  //! \details Reads all cells, readers which read a part of a file at a
+  //! time do not hold all cells
+  //! \param[in] mesh file name with nodes and cells
+  //! \param[in] oper Operation on the index and nodal indices of a cell
+  virtual void iterate_over_mesh_cells(
+      const std::string& mesh,
+      const std::function<void(mpm::Index, const std::vector<mpm::Index>&)>&
+          oper) {
+    const auto cells = this->read_mesh_cells(mesh);
+    for (mpm::Index i = 0; i < cells.size(); ++i) oper(i, cells[i]);
+  }
+
+  //! Read coordinates of some nodes of a mesh
+  //! \details Reads all nodes, readers which read a part of a file at a
+  //! time only read the nodes
+  //! \param[in] mesh file name with nodes and cells
+  //! \param[in] ids Indices of nodes
+  //! \retval coordinates Coordinates of the nodes in the order of ids
+  virtual std::vector<VectorDim> read_mesh_node_coordinates(
+      const std::string& mesh, const std::vector<mpm::Index>& ids) {
+    const auto nodes = this->read_mesh_nodes(mesh);
+    std::vector<VectorDim> coordinates;
+    coordinates.reserve(ids.size());
+    for (const auto id : ids) coordinates.emplace_back(nodes.at(id));
+    return coordinates;
+  }
+
   //! Read particles file
   //! \param[in] particles_files file name with particle coordinates
   //! \retval coordinates Vector of particle coordinates
@@ -5,6 +5,7 @@
 
 #include "Eigen/Dense"
 
+#include "ascii_parser.h"
 #include "io_mesh.h"
 
 //! MPM namespace
@@ -12,7 +13,10 @@ namespace mpm {
 
 //! IOMeshAscii class
 //! \brief Derived class that returns mesh and particles locataions from ascii
-//! file \tparam Tdim Dimension
+//! file
+//! \details Files are memory mapped and chunks of lines are parsed in
+//! parallel
+//! \tparam Tdim Dimension
 template <unsigned Tdim>
 class IOMeshAscii : public IOMesh<Tdim> {
  public:
@@ -92,6 +96,11 @@ class IOMeshAscii : public IOMesh<Tdim> {
       const std::string& forces_file) override;
 
  private:
+  //! Read ids, directions and values
+  //! \param[in] filename file name with ids, directions and values
+  std::vector<std::tuple<mpm::Index, unsigned, double>> read_directional(
+      const std::string& filename);
+
   //! Logger
   std::shared_ptr<spdlog::logger> console_;
 };  // ReadAscii class
@@ -4,61 +4,29 @@ std::vector<Eigen::Matrix<double, Tdim, 1>>
     mpm::IOMeshAscii<Tdim>::read_mesh_nodes(const std::string& mesh) {
   // Nodal coordinates
   std::vector<VectorDim> coordinates;
-  coordinates.clear();
-
-  // input file stream
-  std::fstream file;
-  file.open(mesh.c_str(), std::ios::in);
 
   try {
-    if (file.is_open() && file.good()) {
-      // Line
-      std::string line;
-      // bool to check firstline
-      bool read_first_line = false;
-      // Number of coordinate lines
-      unsigned nlines = 0;
-      // Coordinates
-      Eigen::Matrix<double, Tdim, 1> coords;
-      // # of nodes and cells
-      unsigned nnodes = 0, ncells = 0;
-      // ignore stream
-      double ignore;
-
-      while (std::getline(file, line)) {
-        boost::algorithm::trim(line);
-        std::istringstream istream(line);
-        // ignore comment lines (# or !) or blank lines
-        if ((line.find('#') == std::string::npos) &&
-            (line.find('!') == std::string::npos) && (line != "")) {
-          while (istream.good()) {
-            if (!read_first_line) {
-              // Read number of nodes and cells
-              istream >> nnodes >> ncells;
-              coordinates.reserve(nnodes);
-              read_first_line = true;
-              break;
-            }
-            // Read until nodal information is present
-            if (nlines <= nnodes) {
-              // Read to coordinates
-              for (unsigned i = 0; i < Tdim; ++i) istream >> coords[i];
-              coordinates.emplace_back(coords);
-              break;
-
-            } else {
-              // Ignore stream
-              istream >> ignore;
-            }
-          }
-          ++nlines;
-        }
-      }
-    }
-    file.close();
+    const mpm::ascii::MappedText text(mesh);
+    const char* pos = text.begin();
+    const char *line, *line_end;
+    // Read number of nodes and cells
+    mpm::Index nnodes = 0;
+    if (mpm::ascii::next_line(pos, text.end(), line, line_end))
+      mpm::ascii::parse(line, line_end, nnodes);
+
+    // Nodal coordinates are the first nnodes lines, cells are ignored
+    coordinates = mpm::ascii::parse_lines<VectorDim>(
+        pos, text.end(),
+        [nnodes](mpm::Index index, const char* begin, const char* end,
+                 std::vector<VectorDim>& records) {
+          if (index >= nnodes) return;
+          VectorDim coords;
+          for (unsigned i = 0; i < Tdim; ++i)
+            if (!mpm::ascii::parse(begin, end, coords[i])) return;
+          records.emplace_back(coords);
+        });
   } catch (std::exception& exception) {
     console_->error("Read mesh nodes: {}", exception.what());
-    file.close();
   }
 
   return coordinates;
@@ -70,65 +38,30 @@ std::vector<std::vector<mpm::Index>> mpm::IOMeshAscii<Tdim>::read_mesh_cells(
     const std::string& mesh) {
   // Indices of nodes
   std::vector<std::vector<mpm::Index>> cells;
-  cells.clear();
-
-  std::fstream file;
-  file.open(mesh.c_str(), std::ios::in);
 
   try {
-    if (file.is_open() && file.good()) {
-      std::string line;
-      // bool to check firstline
-      bool read_first_line = false;
-      // Number of coordinate lines
-      unsigned nlines = 0;
-      // Coordinates
-      Eigen::Matrix<double, Tdim, 1> coords;
-      // # of nodes and cells
-      mpm::Index nnodes = 0, ncells = 0;
-      // ignore stream
-      double ignore;
-
-      while (std::getline(file, line)) {
-        boost::algorithm::trim(line);
-        std::istringstream istream(line);
-        // Vector of node ids for a cell
-        std::vector<mpm::Index> nodes;
-        nodes.clear();
-        // ignore comment lines (# or !) or blank lines
-        if ((line.find('#') == std::string::npos) &&
-            (line.find('!') == std::string::npos) && (line != "")) {
-          while (istream.good()) {
-            if (!read_first_line) {
-              // Read number of nodes and cells
-              istream >> nnodes >> ncells;
-              cells.reserve(ncells);
-              read_first_line = true;
-              break;
-            }
-            // Ignore nodal coordinates
-            if (nlines > nnodes) {
-              // Read node ids of each cell
-              mpm::Index nid;
-              istream >> nid;
-              nodes.emplace_back(nid);
-            } else {
-              // Ignore stream not related to node ids of cells
-              istream >> ignore;
-            }
-          }
-          ++nlines;
+    const mpm::ascii::MappedText text(mesh);
+    const char* pos = text.begin();
+    const char *line, *line_end;
+    // Read number of nodes and cells
+    mpm::Index nnodes = 0;
+    if (mpm::ascii::next_line(pos, text.end(), line, line_end))
+      mpm::ascii::parse(line, line_end, nnodes);
+
+    // Node ids of each cell follow the nnodes lines of nodal coordinates
+    cells = mpm::ascii::parse_lines<std::vector<mpm::Index>>(
+        pos, text.end(),
+        [nnodes](mpm::Index index, const char* begin, const char* end,
+                 std::vector<std::vector<mpm::Index>>& records) {
+          if (index < nnodes) return;
+          std::vector<mpm::Index> nodes;
+          mpm::Index nid;
+          while (mpm::ascii::parse(begin, end, nid)) nodes.emplace_back(nid);
           // Check if nodes is not empty, before adding to cell
-          if (!nodes.empty()) {
-            cells.emplace_back(nodes);
-          }
-        }
-      }
-    }
-    file.close();
+          if (!nodes.empty()) records.emplace_back(std::move(nodes));
+        });
   } catch (std::exception& exception) {
     console_->error("Read mesh cells: {}", exception.what());
-    file.close();
   }
 
   return cells;
@@ -139,52 +72,26 @@ template <unsigned Tdim>
 std::vector<Eigen::Matrix<double, Tdim, 1>>
     mpm::IOMeshAscii<Tdim>::read_particles(const std::string& particles_file) {
 
-  // Nodal coordinates
+  // Particle coordinates
   std::vector<VectorDim> coordinates;
-  coordinates.clear();
-
-  // Expected number of particles
-  mpm::Index nparticles;
-
-  // bool to check firstline
-  bool read_first_line = false;
-
-  // input file stream
-  std::fstream file;
-  file.open(particles_file.c_str(), std::ios::in);
 
   try {
-    if (file.is_open() && file.good()) {
-      // Line
-      std::string line;
-      while (std::getline(file, line)) {
-        boost::algorithm::trim(line);
-        std::istringstream istream(line);
-        // ignore comment lines (# or !) or blank lines
-        if ((line.find('#') == std::string::npos) &&
-            (line.find('!') == std::string::npos) && (line != "")) {
-          while (istream.good()) {
-            if (!read_first_line) {
-              // Read number of nodes and cells
-              istream >> nparticles;
-              coordinates.reserve(nparticles);
-              read_first_line = true;
-              break;
-            }
-            // Coordinates
-            Eigen::Matrix<double, Tdim, 1> coords;
-            // Read to coordinates
-            for (unsigned i = 0; i < Tdim; ++i) istream >> coords[i];
-            coordinates.emplace_back(coords);
-            break;
-          }
-        }
-      }
-    }
-    file.close();
+    const mpm::ascii::MappedText text(particles_file);
+    const char* pos = text.begin();
+    const char *line, *line_end;
+    // First line is the number of particles
+    if (mpm::ascii::next_line(pos, text.end(), line, line_end))
+      coordinates = mpm::ascii::parse_lines<VectorDim>(
+          pos, text.end(),
+          [](mpm::Index, const char* begin, const char* end,
+             std::vector<VectorDim>& records) {
+            VectorDim coords;
+            for (unsigned i = 0; i < Tdim; ++i)
+              if (!mpm::ascii::parse(begin, end, coords[i])) return;
+            records.emplace_back(coords);
+          });
   } catch (std::exception& exception) {
     console_->error("Read particle coordinates: {}", exception.what());
-    file.close();
   }
 
   return coordinates;
@@ -196,52 +103,26 @@ std::vector<Eigen::Matrix<double, 6, 1>>
     mpm::IOMeshAscii<Tdim>::read_particles_stresses(
         const std::string& particles_stresses) {
 
-  // Nodal stresses
+  // Particle stresses
   std::vector<Eigen::Matrix<double, 6, 1>> stresses;
-  stresses.clear();
-
-  // Expected number of particles
-  mpm::Index nparticles;
-
-  // bool to check firstline
-  bool read_first_line = false;
-
-  // input file stream
-  std::fstream file;
-  file.open(particles_stresses.c_str(), std::ios::in);
 
   try {
-    if (file.is_open() && file.good()) {
-      // Line
-      std::string line;
-      while (std::getline(file, line)) {
-        boost::algorithm::trim(line);
-        std::istringstream istream(line);
-        // ignore comment lines (# or !) or blank lines
-        if ((line.find('#') == std::string::npos) &&
-            (line.find('!') == std::string::npos) && (line != "")) {
-          while (istream.good()) {
-            if (!read_first_line) {
-              // Read number of nodes and cells
-              istream >> nparticles;
-              stresses.reserve(nparticles);
-              read_first_line = true;
-              break;
-            }
-            // Stresses
+    const mpm::ascii::MappedText text(particles_stresses);
+    const char* pos = text.begin();
+    const char *line, *line_end;
+    // First line is the number of particles
+    if (mpm::ascii::next_line(pos, text.end(), line, line_end))
+      stresses = mpm::ascii::parse_lines<Eigen::Matrix<double, 6, 1>>(
+          pos, text.end(),
+          [](mpm::Index, const char* begin, const char* end,
+             std::vector<Eigen::Matrix<double, 6, 1>>& records) {
             Eigen::Matrix<double, 6, 1> stress;
-            // Read to stress
-            for (unsigned i = 0; i < stress.size(); ++i) istream >> stress[i];
-            stresses.emplace_back(stress);
-            break;
-          }
-        }
-      }
-    }
-    file.close();
+            for (unsigned i = 0; i < stress.size(); ++i)
+              if (!mpm::ascii::parse(begin, end, stress[i])) return;
+            records.emplace_back(stress);
+          });
   } catch (std::exception& exception) {
     console_->error("Read particle stresses: {}", exception.what());
-    file.close();
   }
   return stresses;
 }
@@ -254,38 +135,26 @@ std::map<mpm::Index, Eigen::Matrix<double, Tdim, 1>>
 
   // Nodal euler angles
   std::map<mpm::Index, Eigen::Matrix<double, Tdim, 1>> euler_angles;
-  euler_angles.clear();
-
-  // input file stream
-  std::fstream file;
-  file.open(nodal_euler_angles_file.c_str(), std::ios::in);
 
   try {
-    if (file.is_open() && file.good()) {
-      // Line
-      std::string line;
-      while (std::getline(file, line)) {
-        boost::algorithm::trim(line);
-        std::istringstream istream(line);
-        // ignore comment lines (# or !) or blank lines
-        if ((line.find('#') == std::string::npos) &&
-            (line.find('!') == std::string::npos) && (line != "")) {
-          while (istream.good()) {
-            // ID and read stream
-            mpm::Index id;
-            istream >> id;
-            // Angles and ream stream
-            Eigen::Matrix<double, Tdim, 1> angles;
-            for (unsigned i = 0; i < Tdim; ++i) istream >> angles[i];
-            euler_angles.emplace(std::make_pair(id, angles));
-          }
-        }
-      }
-    }
-    file.close();
+    const mpm::ascii::MappedText text(nodal_euler_angles_file);
+    // Ids and angles, each line may have several nodes
+    const auto records =
+        mpm::ascii::parse_lines<std::pair<mpm::Index, VectorDim>>(
+            text.begin(), text.end(),
+            [](mpm::Index, const char* begin, const char* end,
+               std::vector<std::pair<mpm::Index, VectorDim>>& records) {
+              std::pair<mpm::Index, VectorDim> record;
+              while (mpm::ascii::parse(begin, end, record.first)) {
+                for (unsigned i = 0; i < Tdim; ++i)
+                  if (!mpm::ascii::parse(begin, end, record.second[i]))
+                    return;
+                records.emplace_back(record);
+              }
+            });
+    for (const auto& record : records) euler_angles.emplace(record);
   } catch (std::exception& exception) {
     console_->error("Read euler angles: {}", exception.what());
-    file.close();
   }
   return euler_angles;
 }
@@ -298,38 +167,22 @@ std::vector<std::tuple<mpm::Index, double>>
 
   // particle volumes
   std::vector<std::tuple<mpm::Index, double>> volumes;
-  volumes.clear();
-
-  // input file stream
-  std::fstream file;
-  file.open(volume_file.c_str(), std::ios::in);
 
   try {
-    if (file.is_open() && file.good()) {
-      // Line
-      std::string line;
-      while (std::getline(file, line)) {
-        boost::algorithm::trim(line);
-        std::istringstream istream(line);
-        // ignore comment lines (# or !) or blank lines
-        if ((line.find('#') == std::string::npos) &&
-            (line.find('!') == std::string::npos) && (line != "")) {
-          while (istream.good()) {
-            // ID
-            mpm::Index id;
-            // Volume
-            double volume;
-            // Read stream
-            istream >> id >> volume;
-            volumes.emplace_back(std::make_tuple(id, volume));
-          }
-        }
-      }
-    }
-    file.close();
+    const mpm::ascii::MappedText text(volume_file);
+    volumes = mpm::ascii::parse_lines<std::tuple<mpm::Index, double>>(
+        text.begin(), text.end(),
+        [](mpm::Index, const char* begin, const char* end,
+           std::vector<std::tuple<mpm::Index, double>>& records) {
+          // ID and volume
+          mpm::Index id;
+          double volume;
+          while (mpm::ascii::parse(begin, end, id) &&
+                 mpm::ascii::parse(begin, end, volume))
+            records.emplace_back(std::make_tuple(id, volume));
+        });
   } catch (std::exception& exception) {
     console_->error("Read volume : {}", exception.what());
-    file.close();
   }
   return volumes;
 }
@@ -342,36 +195,21 @@ std::vector<std::array<mpm::Index, 2>>
 
   // Particle cells
   std::vector<std::array<mpm::Index, 2>> particles_cells;
-  particles_cells.clear();
-
-  // input file stream
-  std::fstream file;
-  file.open(particles_cells_file.c_str(), std::ios::in);
 
   try {
-    if (file.is_open() && file.good()) {
-      // Line
-      std::string line;
-      while (std::getline(file, line)) {
-        boost::algorithm::trim(line);
-        std::istringstream istream(line);
-        // ignore comment lines (# or !) or blank lines
-        if ((line.find('#') == std::string::npos) &&
-            (line.find('!') == std::string::npos) && (line != "")) {
-          while (istream.good()) {
-            // ID
-            mpm::Index pid, cid;
-            // Read stream
-            istream >> pid >> cid;
-            particles_cells.emplace_back(std::array<mpm::Index, 2>({pid, cid}));
-          }
-        }
-      }
-    }
-    file.close();
+    const mpm::ascii::MappedText text(particles_cells_file);
+    particles_cells = mpm::ascii::parse_lines<std::array<mpm::Index, 2>>(
+        text.begin(), text.end(),
+        [](mpm::Index, const char* begin, const char* end,
+           std::vector<std::array<mpm::Index, 2>>& records) {
+          // Particle and cell ids
+          mpm::Index pid, cid;
+          while (mpm::ascii::parse(begin, end, pid) &&
+                 mpm::ascii::parse(begin, end, cid))
+            records.emplace_back(std::array<mpm::Index, 2>({pid, cid}));
+        });
   } catch (std::exception& exception) {
     console_->error("Read particles cells: {}", exception.what());
-    file.close();
   }
   return particles_cells;
 }
@@ -400,40 +238,11 @@ std::vector<std::tuple<mpm::Index, unsigned, double>>
 
   // Nodal or particle velocity constraints
   std::vector<std::tuple<mpm::Index, unsigned, double>> constraints;
-  constraints.clear();
-
-  // input file stream
-  std::fstream file;
-  file.open(velocity_constraints_file.c_str(), std::ios::in);
 
   try {
-    if (file.is_open() && file.good()) {
-      // Line
-      std::string line;
-      while (std::getline(file, line)) {
-        boost::algorithm::trim(line);
-        std::istringstream istream(line);
-        // ignore comment lines (# or !) or blank lines
-        if ((line.find('#') == std::string::npos) &&
-            (line.find('!') == std::string::npos) && (line != "")) {
-          while (istream.good()) {
-            // ID
-            mpm::Index id;
-            // Direction
-            unsigned dir;
-            // Velocity
-            double velocity;
-            // Read stream
-            istream >> id >> dir >> velocity;
-            constraints.emplace_back(std::make_tuple(id, dir, velocity));
-          }
-        }
-      }
-    }
-    file.close();
+    constraints = this->read_directional(velocity_constraints_file);
   } catch (std::exception& exception) {
     console_->error("Read velocity constraints: {}", exception.what());
-    file.close();
   }
   return constraints;
 }
@@ -446,42 +255,29 @@ std::vector<std::tuple<mpm::Index, unsigned, int, double>>
 
   // Nodal friction constraints
   std::vector<std::tuple<mpm::Index, unsigned, int, double>> constraints;
-  constraints.clear();
-
-  // input file stream
-  std::fstream file;
-  file.open(friction_constraints_file.c_str(), std::ios::in);
 
   try {
-    if (file.is_open() && file.good()) {
-      // Line
-      std::string line;
-      while (std::getline(file, line)) {
-        boost::algorithm::trim(line);
-        std::istringstream istream(line);
-        // ignore comment lines (# or !) or blank lines
-        if ((line.find('#') == std::string::npos) &&
-            (line.find('!') == std::string::npos) && (line != "")) {
-          while (istream.good()) {
-            // ID
-            mpm::Index id;
-            // Direction
-            unsigned dir;
-            // Sign
-            int sign;
-            // Friction
-            double friction;
-            // Read stream
-            istream >> id >> dir >> sign >> friction;
-            constraints.emplace_back(std::make_tuple(id, dir, sign, friction));
-          }
-        }
-      }
-    }
-    file.close();
+    const mpm::ascii::MappedText text(friction_constraints_file);
+    constraints =
+        mpm::ascii::parse_lines<std::tuple<mpm::Index, unsigned, int, double>>(
+            text.begin(), text.end(),
+            [](mpm::Index, const char* begin, const char* end,
+               std::vector<std::tuple<mpm::Index, unsigned, int, double>>&
+                   records) {
+              // ID, direction, sign and friction
+              mpm::Index id;
+              unsigned dir;
+              int sign;
+              double friction;
+              while (mpm::ascii::parse(begin, end, id) &&
+                     mpm::ascii::parse(begin, end, dir) &&
+                     mpm::ascii::parse(begin, end, sign) &&
+                     mpm::ascii::parse(begin, end, friction))
+                records.emplace_back(
+                    std::make_tuple(id, dir, sign, friction));
+            });
   } catch (std::exception& exception) {
     console_->error("Read friction constraints: {}", exception.what());
-    file.close();
   }
   return constraints;
 }
@@ -493,40 +289,31 @@ std::vector<std::tuple<mpm::Index, unsigned, double>>
 
   // particle forces
   std::vector<std::tuple<mpm::Index, unsigned, double>> forces;
-  forces.clear();
-
-  // input file stream
-  std::fstream file;
-  file.open(force_file.c_str(), std::ios::in);
 
   try {
-    if (file.is_open() && file.good()) {
-      // Line
-      std::string line;
-      while (std::getline(file, line)) {
-        boost::algorithm::trim(line);
-        std::istringstream istream(line);
-        // ignore comment lines (# or !) or blank lines
-        if ((line.find('#') == std::string::npos) &&
-            (line.find('!') == std::string::npos) && (line != "")) {
-          while (istream.good()) {
-            // ID
-            mpm::Index id;
-            // Direction
-            unsigned dir;
-            // Force
-            double force;
-            // Read stream
-            istream >> id >> dir >> force;
-            forces.emplace_back(std::make_tuple(id, dir, force));
-          }
-        }
-      }
-    }
-    file.close();
+    forces = this->read_directional(force_file);
   } catch (std::exception& exception) {
     console_->error("Read force : {}", exception.what());
-    file.close();
   }
   return forces;
 }
+
+//! Return ids, directions and values
+template <unsigned Tdim>
+std::vector<std::tuple<mpm::Index, unsigned, double>>
+    mpm::IOMeshAscii<Tdim>::read_directional(const std::string& filename) {
+  const mpm::ascii::MappedText text(filename);
+  return mpm::ascii::parse_lines<std::tuple<mpm::Index, unsigned, double>>(
+      text.begin(), text.end(),
+      [](mpm::Index, const char* begin, const char* end,
+         std::vector<std::tuple<mpm::Index, unsigned, double>>& records) {
+        // ID, direction and value
+        mpm::Index id;
+        unsigned dir;
+        double value;
+        while (mpm::ascii::parse(begin, end, id) &&
+               mpm::ascii::parse(begin, end, dir) &&
+               mpm::ascii::parse(begin, end, value))
+          records.emplace_back(std::make_tuple(id, dir, value));
+      });
+}
@@ -0,0 +1,328 @@
+#ifndef MPM_IO_MESH_BINARY_H_
+#define MPM_IO_MESH_BINARY_H_
+
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <utility>
+#include <vector>
+
+#include "Eigen/Dense"
+
+#include "io_mesh.h"
+
+//! MPM namespace
+namespace mpm {
+
+//! Binary input files
+//! \details A binary input file is a 40 byte header followed by blocks of
+//! little-endian data. Each block starts at a multiple of 8 bytes from the
+//! start of the file, integers are 64 bit unsigned (signs of friction
+//! constraints are 64 bit signed) and reals are 64 bit floats. The blocks
+//! of each type of file, n is the number of records in the header, are:
+//! Mesh: coordinates [nnodes x dim], node ids of cells [ncells x nnodes]
+//! Particles: coordinates [n x dim]
+//! ParticlesStresses: stresses in Voigt notation [n x 6]
+//! ParticlesVolumes: ids [n], volumes [n]
+//! ParticlesCells: particle and cell ids [n x 2]
+//! VelocityConstraints: ids [n], directions [n], velocities [n]
+//! FrictionConstraints: ids [n], directions [n], signs [n], frictions [n]
+//! Forces: ids [n], directions [n], forces [n]
+//! EulerAngles: ids [n], angles [n x dim]
+namespace binary {
+
+//! Type of data in a binary input file
+enum class FileType : std::uint32_t {
+  Mesh = 1,
+  Particles = 2,
+  ParticlesStresses = 3,
+  ParticlesVolumes = 4,
+  ParticlesCells = 5,
+  VelocityConstraints = 6,
+  FrictionConstraints = 7,
+  Forces = 8,
+  EulerAngles = 9
+};
+
+//! Header of a binary input file
+struct Header {
+  //! File signature "MPMBIN" padded with null characters
+  char signature[8];
+  //! Version of the layout
+  std::uint32_t version;
+  //! Type of data
+  std::uint32_t type;
+  //! Dimension
+  std::uint32_t dim;
+  //! Number of nodes of each cell of a mesh, 0 for other files
+  std::uint32_t nnodes_per_cell;
+  //! Number of records (nodes of a mesh)
+  std::uint64_t nrecords;
+  //! Number of cells of a mesh, 0 for other files
+  std::uint64_t ncells;
+};
+
+//! Return header of a binary input file
+//! \param[in] type Type of data
+//! \param[in] dim Dimension
+//! \param[in] nrecords Number of records (nodes of a mesh)
+//! \param[in] ncells Number of cells of a mesh
+//! \param[in] nnodes_per_cell Number of nodes of each cell of a mesh
+Header header(FileType type, unsigned dim, std::uint64_t nrecords,
+              std::uint64_t ncells = 0, unsigned nnodes_per_cell = 0);
+
+//! MappedFile class
+//! \brief Read-only memory map of a binary input file
+class MappedFile {
+ public:
+  //! Map a binary input file
+  //! \details Throws if the file can not be mapped or if it is not a binary
+  //! input file of the type and dimension
+  //! \param[in] filename Input file
+  //! \param[in] type Type of data
+  //! \param[in] dim Dimension
+  MappedFile(const std::string& filename, FileType type, unsigned dim);
+
+  //! Destructor unmaps the file
+  ~MappedFile();
+
+  //! Delete copy constructor
+  MappedFile(const MappedFile&) = delete;
+
+  //! Delete assignment operator
+  MappedFile& operator=(const MappedFile&) = delete;
+
+  //! Return header
+  const Header& header() const;
+
+  //! Return a block of data, throws if the block exceeds the file
+  //! \param[in] offset Offset of the block after the header in bytes
+  //! \param[in] nbytes Size of the block in bytes
+  const char* data(std::size_t offset, std::size_t nbytes) const;
+
+  //! Return size in bytes of a block of records, throws if the block
+  //! exceeds the file or its size overflows
+  //! \details Checks the number of records of the header before a container
+  //! of the records is allocated
+  //! \param[in] offset Offset of the block after the header in bytes
+  //! \param[in] nrecords Number of records in the block
+  //! \param[in] record_size Size of a record in bytes
+  std::size_t nbytes(std::size_t offset, std::uint64_t nrecords,
+                     std::size_t record_size) const;
+
+ private:
+  //! Mapped file
+  void* data_{nullptr};
+  //! Size of the file in bytes
+  std::size_t size_{0};
+};  // MappedFile class
+
+//! Write a binary input file
+//! \details Throws if the file can not be written
+//! \param[in] filename Output file
+//! \param[in] header Header of the file
+//! \param[in] blocks Pointer to and size in bytes of each block of data
+void write(const std::string& filename, const Header& header,
+           const std::vector<std::pair<const void*, std::size_t>>& blocks);
+}  // namespace binary
+
+//! IOMeshBinary class
+//! \brief Derived class that returns mesh and particles locations from
+//! memory mapped binary files
+//! \details Blocks of the files are copied into the returned containers
+//! without parsing. The write functions convert data read from other
+//! formats into binary input files.
+//! \tparam Tdim Dimension
+template <unsigned Tdim>
+class IOMeshBinary : public IOMesh<Tdim> {
+ public:
+  //! Define a vector of size dimension
+  using VectorDim = Eigen::Matrix<double, Tdim, 1>;
+
+  //! Constructor
+  IOMeshBinary() : mpm::IOMesh<Tdim>() {
+    //! Logger
+    console_ =
+        std::make_unique<spdlog::logger>("IOMeshBinary", mpm::stdout_sink);
+  }
+
+  //! Destructor
+  ~IOMeshBinary() override = default;
+
+  //! Read mesh nodes file
+  //! \param[in] mesh file name with nodes and cells
+  //! \retval coordinates Vector of nodal coordinates
+  std::vector<VectorDim> read_mesh_nodes(const std::string& mesh) override;
+
+  //! Read mesh cells file
+  //! \param[in] mesh file name with nodes and cells
+  //! \retval cells Vector of nodal indices of cells
+  std::vector<std::vector<mpm::Index>> read_mesh_cells(
+      const std::string& mesh) override;
+
+  //! Read centroids of cells of a mesh from the mapped file
+  //! \param[in] mesh file name with nodes and cells
+  //! \retval centroids Centroids of cells in the order of cells
+  std::vector<VectorDim> read_mesh_cell_centroids(
+      const std::string& mesh) override;
+
+  //! Iterate over the nodal indices of cells of a mesh in the order of
+  //! cells, cells are read from the mapped file one at a time
+  //! \param[in] mesh file name with nodes and cells
+  //! \param[in] oper Operation on the index and nodal indices of a cell
+  void iterate_over_mesh_cells(
+      const std::string& mesh,
+      const std::function<void(mpm::Index, const std::vector<mpm::Index>&)>&
+          oper) override;
+
+  //! Read coordinates of some nodes of a mesh from the mapped file
+  //! \param[in] mesh file name with nodes and cells
+  //! \param[in] ids Indices of nodes
+  //! \retval coordinates Coordinates of the nodes in the order of ids
+  std::vector<VectorDim> read_mesh_node_coordinates(
+      const std::string& mesh, const std::vector<mpm::Index>& ids) override;
+
+  //! Read particles file
+  //! \param[in] particles_files file name with particle coordinates
+  //! \retval coordinates Vector of particle coordinates
+  std::vector<VectorDim> read_particles(
+      const std::string& particles_file) override;
+
+  //! Read particle stresses
+  //! \param[in] particles_stresses file name with particle stresses
+  //! \retval stresses Vector of particle stresses
+  std::vector<Eigen::Matrix<double, 6, 1>> read_particles_stresses(
+      const std::string& particles_stresses) override;
+
+  //! Read nodal euler angles file
+  //! \param[in] nodal_euler_angles_file file name with nodal id and respective
+  //! euler angles
+  std::map<mpm::Index, Eigen::Matrix<double, Tdim, 1>> read_euler_angles(
+      const std::string& nodal_euler_angles_file) override;
+
+  //! Read volume file
+  //! \param[in] volume_files file name with particle volumes
+  std::vector<std::tuple<mpm::Index, double>> read_particles_volumes(
+      const std::string& volume_file) override;
+
+  //! Read particles cells file
+  //! \param[in] particles_cells_file file name with particle cell ids
+  std::vector<std::array<mpm::Index, 2>> read_particles_cells(
+      const std::string& particles_cells_file) override;
+
+  //! Write particles cells file
+  //! \param[in] particle_cells List of particles and cells
+  //! \param[in] particles_cells_file file name with particle cell ids
+  void write_particles_cells(
+      const std::string& particles_cells_file,
+      const std::vector<std::array<mpm::Index, 2>>& particles_cells) override;
+
+  //! Read constraints file
+  //! \param[in] velocity_constraints_files file name with constraints
+  std::vector<std::tuple<mpm::Index, unsigned, double>>
+      read_velocity_constraints(
+          const std::string& velocity_constraints_file) override;
+
+  //! Read friction constraints file
+  //! \param[in] friction_constraints_files file name with frictions
+  std::vector<std::tuple<mpm::Index, unsigned, int, double>>
+      read_friction_constraints(
+          const std::string& friction_constraints_file) override;
+
+  //! Read traction file
+  //! \param[in] forces_files file name with nodal concentrated force
+  std::vector<std::tuple<mpm::Index, unsigned, double>> read_forces(
+      const std::string& forces_file) override;
+
+  //! Write mesh file
+  //! \param[in] mesh file name with nodes and cells
+  //! \param[in] coordinates Nodal coordinates
+  //! \param[in] cells Nodal indices of cells, all cells have the same number
+  //! of nodes
+  //! \retval status Return true if the file is written
+  bool write_mesh(const std::string& mesh,
+                  const std::vector<VectorDim>& coordinates,
+                  const std::vector<std::vector<mpm::Index>>& cells);
+
+  //! Write particles file
+  //! \param[in] particles_file file name with particle coordinates
+  //! \param[in] coordinates Particle coordinates
+  //! \retval status Return true if the file is written
+  bool write_particles(const std::string& particles_file,
+                       const std::vector<VectorDim>& coordinates);
+
+  //! Write particle stresses file
+  //! \param[in] particles_stresses file name with particle stresses
+  //! \param[in] stresses Particle stresses
+  //! \retval status Return true if the file is written
+  bool write_particles_stresses(
+      const std::string& particles_stresses,
+      const std::vector<Eigen::Matrix<double, 6, 1>>& stresses);
+
+  //! Write nodal euler angles file
+  //! \param[in] nodal_euler_angles_file file name with nodal euler angles
+  //! \param[in] euler_angles Euler angles of nodes
+  //! \retval status Return true if the file is written
+  bool write_euler_angles(
+      const std::string& nodal_euler_angles_file,
+      const std::map<mpm::Index, Eigen::Matrix<double, Tdim, 1>>&
+          euler_angles);
+
+  //! Write volume file
+  //! \param[in] volume_file file name with particle volumes
+  //! \param[in] volumes Particle volumes
+  //! \retval status Return true if the file is written
+  bool write_particles_volumes(
+      const std::string& volume_file,
+      const std::vector<std::tuple<mpm::Index, double>>& volumes);
+
+  //! Write velocity constraints file
+  //! \param[in] velocity_constraints_file file name with constraints
+  //! \param[in] constraints Velocity constraints
+  //! \retval status Return true if the file is written
+  bool write_velocity_constraints(
+      const std::string& velocity_constraints_file,
+      const std::vector<std::tuple<mpm::Index, unsigned, double>>&
+          constraints);
+
+  //! Write friction constraints file
+  //! \param[in] friction_constraints_file file name with frictions
+  //! \param[in] constraints Friction constraints
+  //! \retval status Return true if the file is written
+  bool write_friction_constraints(
+      const std::string& friction_constraints_file,
+      const std::vector<std::tuple<mpm::Index, unsigned, int, double>>&
+          constraints);
+
+  //! Write forces file
+  //! \param[in] forces_file file name with nodal concentrated force
+  //! \param[in] forces Nodal concentrated forces
+  //! \retval status Return true if the file is written
+  bool write_forces(
+      const std::string& forces_file,
+      const std::vector<std::tuple<mpm::Index, unsigned, double>>& forces);
+
+ private:
+  //! Read a file of ids, directions and values
+  //! \param[in] filename Input file
+  //! \param[in] type Type of data
+  std::vector<std::tuple<mpm::Index, unsigned, double>> read_directional(
+      const std::string& filename, mpm::binary::FileType type);
+
+  //! Write a file of ids, directions and values
+  //! \param[in] filename Output file
+  //! \param[in] type Type of data
+  //! \param[in] data Ids, directions and values
+  bool write_directional(
+      const std::string& filename, mpm::binary::FileType type,
+      const std::vector<std::tuple<mpm::Index, unsigned, double>>& data);
+
+ private:
+  //! Logger
+  std::unique_ptr<spdlog::logger> console_;
+};  // IOMeshBinary class
+}  // namespace mpm
+
+#include "io_mesh_binary.tcc"
+
+#endif  // MPM_IO_MESH_BINARY_H_
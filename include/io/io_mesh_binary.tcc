@@ -0,0 +1,566 @@
+//! Return coordinates of nodes in a mesh from input file
+template <unsigned Tdim>
+std::vector<Eigen::Matrix<double, Tdim, 1>>
+    mpm::IOMeshBinary<Tdim>::read_mesh_nodes(const std::string& mesh) {
+  static_assert(sizeof(VectorDim) == Tdim * sizeof(double),
+                "Coordinates are not contiguous");
+  // Nodal coordinates
+  std::vector<VectorDim> coordinates;
+
+  try {
+    mpm::binary::MappedFile file(mesh, mpm::binary::FileType::Mesh, Tdim);
+    const std::size_t nbytes =
+        file.nbytes(0, file.header().nrecords, sizeof(VectorDim));
+    coordinates.resize(file.header().nrecords);
+    std::memcpy(coordinates.data()->data(), file.data(0, nbytes), nbytes);
+  } catch (std::exception& exception) {
+    console_->error("Read mesh nodes: {}", exception.what());
+    coordinates.clear();
+  }
+  return coordinates;
+}
+
+//! Return indices of nodes of cells in a mesh from input file
+template <unsigned Tdim>
+std::vector<std::vector<mpm::Index>> mpm::IOMeshBinary<Tdim>::read_mesh_cells(
+    const std::string& mesh) {
+  // Indices of nodes
+  std::vector<std::vector<mpm::Index>> cells;
+
+  try {
+    mpm::binary::MappedFile file(mesh, mpm::binary::FileType::Mesh, Tdim);
+    const auto& header = file.header();
+    const std::size_t nnodes = header.nnodes_per_cell;
+    // Node ids of cells follow the nodal coordinates
+    const std::size_t offset =
+        file.nbytes(0, header.nrecords, sizeof(VectorDim));
+    const std::size_t nbytes =
+        file.nbytes(offset, header.ncells, nnodes * sizeof(mpm::Index));
+    const auto* ids =
+        reinterpret_cast<const mpm::Index*>(file.data(offset, nbytes));
+    cells.reserve(header.ncells);
+    for (std::size_t i = 0; i < header.ncells; ++i)
+      cells.emplace_back(ids + i * nnodes, ids + (i + 1) * nnodes);
+  } catch (std::exception& exception) {
+    console_->error("Read mesh cells: {}", exception.what());
+    cells.clear();
+  }
+  return cells;
+}
+
+//! Return centroids of cells in a mesh from input file
+template <unsigned Tdim>
+std::vector<Eigen::Matrix<double, Tdim, 1>>
+    mpm::IOMeshBinary<Tdim>::read_mesh_cell_centroids(const std::string& mesh) {
+  // Centroids of cells
+  std::vector<VectorDim> centroids;
+
+  try {
+    mpm::binary::MappedFile file(mesh, mpm::binary::FileType::Mesh, Tdim);
+    const auto& header = file.header();
+    const std::size_t nnodes = header.nnodes_per_cell;
+    const std::size_t nbytes_nodes =
+        file.nbytes(0, header.nrecords, sizeof(VectorDim));
+    const auto* nodes =
+        reinterpret_cast<const double*>(file.data(0, nbytes_nodes));
+    const std::size_t nbytes =
+        file.nbytes(nbytes_nodes, header.ncells, nnodes * sizeof(mpm::Index));
+    const auto* ids =
+        reinterpret_cast<const mpm::Index*>(file.data(nbytes_nodes, nbytes));
+    centroids.reserve(header.ncells);
+    for (std::size_t i = 0; i < header.ncells; ++i) {
+      VectorDim centroid = VectorDim::Zero();
+      for (std::size_t j = i * nnodes; j < (i + 1) * nnodes; ++j) {
+        if (ids[j] >= header.nrecords)
+          throw std::runtime_error("Node id of cell is not in the mesh");
+        centroid += Eigen::Map<const VectorDim>(nodes + ids[j] * Tdim);
+      }
+      centroids.emplace_back(centroid / nnodes);
+    }
+  } catch (std::exception& exception) {
+    console_->error("Read mesh cell centroids: {}", exception.what());
+    centroids.clear();
+  }
+  return centroids;
+}
+
+//! Iterate over indices of nodes of cells in a mesh from input file
+template <unsigned Tdim>
+void mpm::IOMeshBinary<Tdim>::iterate_over_mesh_cells(
+    const std::string& mesh,
+    const std::function<void(mpm::Index, const std::vector<mpm::Index>&)>&
+        oper) {
+  try {
+    mpm::binary::MappedFile file(mesh, mpm::binary::FileType::Mesh, Tdim);
+    const auto& header = file.header();
+    const std::size_t nnodes = header.nnodes_per_cell;
+    // Node ids of cells follow the nodal coordinates
+    const std::size_t offset =
+        file.nbytes(0, header.nrecords, sizeof(VectorDim));
+    const std::size_t nbytes =
+        file.nbytes(offset, header.ncells, nnodes * sizeof(mpm::Index));
+    const auto* ids =
+        reinterpret_cast<const mpm::Index*>(file.data(offset, nbytes));
+    std::vector<mpm::Index> cell(nnodes);
+    for (std::size_t i = 0; i < header.ncells; ++i) {
+      cell.assign(ids + i * nnodes, ids + (i + 1) * nnodes);
+      oper(i, cell);
+    }
+  } catch (std::exception& exception) {
+    console_->error("Iterate over mesh cells: {}", exception.what());
+  }
+}
+
+//! Return coordinates of some nodes in a mesh from input file
+template <unsigned Tdim>
+std::vector<Eigen::Matrix<double, Tdim, 1>>
+    mpm::IOMeshBinary<Tdim>::read_mesh_node_coordinates(
+        const std::string& mesh, const std::vector<mpm::Index>& ids) {
+  // Nodal coordinates
+  std::vector<VectorDim> coordinates;
+
+  try {
+    mpm::binary::MappedFile file(mesh, mpm::binary::FileType::Mesh, Tdim);
+    const std::size_t nnodes = file.header().nrecords;
+    const std::size_t nbytes = file.nbytes(0, nnodes, sizeof(VectorDim));
+    // Blocks are only 8 byte aligned, coordinates are read through unaligned
+    // maps
+    const auto* nodes = reinterpret_cast<const double*>(file.data(0, nbytes));
+    coordinates.reserve(ids.size());
+    for (const auto id : ids) {
+      if (id >= nnodes) throw std::runtime_error("Node id is not in the mesh");
+      coordinates.emplace_back(
+          VectorDim(Eigen::Map<const VectorDim>(nodes + id * Tdim)));
+    }
+  } catch (std::exception& exception) {
+    console_->error("Read mesh node coordinates: {}", exception.what());
+    coordinates.clear();
+  }
+  return coordinates;
+}
+
+//! Return coordinates of particles
+template <unsigned Tdim>
+std::vector<Eigen::Matrix<double, Tdim, 1>>
+    mpm::IOMeshBinary<Tdim>::read_particles(const std::string& particles_file) {
+  // Particle coordinates
+  std::vector<VectorDim> coordinates;
+
+  try {
+    mpm::binary::MappedFile file(particles_file,
+                                 mpm::binary::FileType::Particles, Tdim);
+    const std::size_t nbytes =
+        file.nbytes(0, file.header().nrecords, sizeof(VectorDim));
+    coordinates.resize(file.header().nrecords);
+    std::memcpy(coordinates.data()->data(), file.data(0, nbytes), nbytes);
+  } catch (std::exception& exception) {
+    console_->error("Read particle coordinates: {}", exception.what());
+    coordinates.clear();
+  }
+  return coordinates;
+}
+
+//! Return stresses of particles
+template <unsigned Tdim>
+std::vector<Eigen::Matrix<double, 6, 1>>
+    mpm::IOMeshBinary<Tdim>::read_particles_stresses(
+        const std::string& particles_stresses) {
+  // Particle stresses
+  std::vector<Eigen::Matrix<double, 6, 1>> stresses;
+
+  try {
+    mpm::binary::MappedFile file(
+        particles_stresses, mpm::binary::FileType::ParticlesStresses, Tdim);
+    const std::size_t nbytes =
+        file.nbytes(0, file.header().nrecords, 6 * sizeof(double));
+    stresses.resize(file.header().nrecords);
+    std::memcpy(stresses.data()->data(), file.data(0, nbytes), nbytes);
+  } catch (std::exception& exception) {
+    console_->error("Read particle stresses: {}", exception.what());
+    stresses.clear();
+  }
+  return stresses;
+}
+
+//! Return euler angles of nodes
+template <unsigned Tdim>
+std::map<mpm::Index, Eigen::Matrix<double, Tdim, 1>>
+    mpm::IOMeshBinary<Tdim>::read_euler_angles(
+        const std::string& nodal_euler_angles_file) {
+  // Nodal euler angles
+  std::map<mpm::Index, Eigen::Matrix<double, Tdim, 1>> euler_angles;
+
+  try {
+    mpm::binary::MappedFile file(nodal_euler_angles_file,
+                                 mpm::binary::FileType::EulerAngles, Tdim);
+    const std::size_t n = file.header().nrecords;
+    // Check the number of records against the size of the file
+    file.nbytes(0, n, sizeof(mpm::Index) + sizeof(VectorDim));
+    const auto* ids = reinterpret_cast<const mpm::Index*>(
+        file.data(0, n * sizeof(mpm::Index)));
+    // Blocks are only 8 byte aligned, angles are read through unaligned maps
+    const auto* angles = reinterpret_cast<const double*>(
+        file.data(n * sizeof(mpm::Index), n * sizeof(VectorDim)));
+    for (std::size_t i = 0; i < n; ++i)
+      euler_angles.emplace(std::make_pair(
+          ids[i], VectorDim(Eigen::Map<const VectorDim>(angles + i * Tdim))));
+  } catch (std::exception& exception) {
+    console_->error("Read euler angles: {}", exception.what());
+    euler_angles.clear();
+  }
+  return euler_angles;
+}
+
+//! Return particles volume
+template <unsigned Tdim>
+std::vector<std::tuple<mpm::Index, double>>
+    mpm::IOMeshBinary<Tdim>::read_particles_volumes(
+        const std::string& volume_file) {
+  // Particle volumes
+  std::vector<std::tuple<mpm::Index, double>> volumes;
+
+  try {
+    mpm::binary::MappedFile file(volume_file,
+                                 mpm::binary::FileType::ParticlesVolumes, Tdim);
+    const std::size_t n = file.header().nrecords;
+    // Check the number of records against the size of the file
+    file.nbytes(0, n, sizeof(mpm::Index) + sizeof(double));
+    const auto* ids = reinterpret_cast<const mpm::Index*>(
+        file.data(0, n * sizeof(mpm::Index)));
+    const auto* values = reinterpret_cast<const double*>(
+        file.data(n * sizeof(mpm::Index), n * sizeof(double)));
+    volumes.reserve(n);
+    for (std::size_t i = 0; i < n; ++i)
+      volumes.emplace_back(std::make_tuple(ids[i], values[i]));
+  } catch (std::exception& exception) {
+    console_->error("Read volume : {}", exception.what());
+    volumes.clear();
+  }
+  return volumes;
+}
+
+//! Return particles and their cells
+template <unsigned Tdim>
+std::vector<std::array<mpm::Index, 2>>
+    mpm::IOMeshBinary<Tdim>::read_particles_cells(
+        const std::string& particles_cells_file) {
+  // Particle cells
+  std::vector<std::array<mpm::Index, 2>> particles_cells;
+
+  try {
+    mpm::binary::MappedFile file(particles_cells_file,
+                                 mpm::binary::FileType::ParticlesCells, Tdim);
+    const std::size_t nbytes = file.nbytes(0, file.header().nrecords,
+                                           sizeof(std::array<mpm::Index, 2>));
+    particles_cells.resize(file.header().nrecords);
+    std::memcpy(particles_cells.data()->data(), file.data(0, nbytes), nbytes);
+  } catch (std::exception& exception) {
+    console_->error("Read particles cells: {}", exception.what());
+    particles_cells.clear();
+  }
+  return particles_cells;
+}
+
+//! Write particles and their cells
+template <unsigned Tdim>
+void mpm::IOMeshBinary<Tdim>::write_particles_cells(
+    const std::string& particles_cells_file,
+    const std::vector<std::array<mpm::Index, 2>>& particles_cells) {
+  try {
+    mpm::binary::write(
+        particles_cells_file,
+        mpm::binary::header(mpm::binary::FileType::ParticlesCells, Tdim,
+                            particles_cells.size()),
+        {{particles_cells.data(),
+          particles_cells.size() * sizeof(std::array<mpm::Index, 2>)}});
+  } catch (std::exception& exception) {
+    console_->error("Write particles cells: {}", exception.what());
+  }
+}
+
+//! Return velocity constraints of nodes or particles
+template <unsigned Tdim>
+std::vector<std::tuple<mpm::Index, unsigned, double>>
+    mpm::IOMeshBinary<Tdim>::read_velocity_constraints(
+        const std::string& velocity_constraints_file) {
+  return this->read_directional(velocity_constraints_file,
+                                mpm::binary::FileType::VelocityConstraints);
+}
+
+//! Return friction constraints of particles
+template <unsigned Tdim>
+std::vector<std::tuple<mpm::Index, unsigned, int, double>>
+    mpm::IOMeshBinary<Tdim>::read_friction_constraints(
+        const std::string& friction_constraints_file) {
+  // Nodal friction constraints
+  std::vector<std::tuple<mpm::Index, unsigned, int, double>> constraints;
+
+  try {
+    mpm::binary::MappedFile file(
+        friction_constraints_file, mpm::binary::FileType::FrictionConstraints,
+        Tdim);
+    const std::size_t n = file.header().nrecords;
+    // Check the number of records against the size of the file
+    file.nbytes(0, n, 4 * sizeof(std::uint64_t));
+    const std::size_t nbytes = n * sizeof(std::uint64_t);
+    const auto* ids = reinterpret_cast<const mpm::Index*>(file.data(0, nbytes));
+    const auto* dirs =
+        reinterpret_cast<const std::uint64_t*>(file.data(nbytes, nbytes));
+    const auto* signs =
+        reinterpret_cast<const std::int64_t*>(file.data(2 * nbytes, nbytes));
+    const auto* frictions =
+        reinterpret_cast<const double*>(file.data(3 * nbytes, nbytes));
+    constraints.reserve(n);
+    for (std::size_t i = 0; i < n; ++i)
+      constraints.emplace_back(std::make_tuple(
+          ids[i], static_cast<unsigned>(dirs[i]), static_cast<int>(signs[i]),
+          frictions[i]));
+  } catch (std::exception& exception) {
+    console_->error("Read friction constraints: {}", exception.what());
+    constraints.clear();
+  }
+  return constraints;
+}
+
+//! Return particles force
+template <unsigned Tdim>
+std::vector<std::tuple<mpm::Index, unsigned, double>>
+    mpm::IOMeshBinary<Tdim>::read_forces(const std::string& forces_file) {
+  return this->read_directional(forces_file, mpm::binary::FileType::Forces);
+}
+
+//! Return ids, directions and values of a file
+template <unsigned Tdim>
+std::vector<std::tuple<mpm::Index, unsigned, double>>
+    mpm::IOMeshBinary<Tdim>::read_directional(const std::string& filename,
+                                              mpm::binary::FileType type) {
+  // Ids, directions and values
+  std::vector<std::tuple<mpm::Index, unsigned, double>> data;
+
+  try {
+    mpm::binary::MappedFile file(filename, type, Tdim);
+    const std::size_t n = file.header().nrecords;
+    // Check the number of records against the size of the file
+    file.nbytes(0, n, 3 * sizeof(std::uint64_t));
+    const std::size_t nbytes = n * sizeof(std::uint64_t);
+    const auto* ids = reinterpret_cast<const mpm::Index*>(file.data(0, nbytes));
+    const auto* dirs =
+        reinterpret_cast<const std::uint64_t*>(file.data(nbytes, nbytes));
+    const auto* values =
+        reinterpret_cast<const double*>(file.data(2 * nbytes, nbytes));
+    data.reserve(n);
+    for (std::size_t i = 0; i < n; ++i)
+      data.emplace_back(
+          std::make_tuple(ids[i], static_cast<unsigned>(dirs[i]), values[i]));
+  } catch (std::exception& exception) {
+    console_->error("Read {}: {}", filename, exception.what());
+    data.clear();
+  }
+  return data;
+}
+
+//! Write nodes and cells of a mesh
+template <unsigned Tdim>
+bool mpm::IOMeshBinary<Tdim>::write_mesh(
+    const std::string& mesh, const std::vector<VectorDim>& coordinates,
+    const std::vector<std::vector<mpm::Index>>& cells) {
+  bool status = true;
+  try {
+    const unsigned nnodes = cells.empty() ? 0 : cells.front().size();
+    std::vector<mpm::Index> ids;
+    ids.reserve(cells.size() * nnodes);
+    for (const auto& cell : cells) {
+      if (cell.size() != nnodes)
+        throw std::runtime_error("Cells have different number of nodes");
+      ids.insert(ids.end(), cell.begin(), cell.end());
+    }
+
+    mpm::binary::write(
+        mesh,
+        mpm::binary::header(mpm::binary::FileType::Mesh, Tdim,
+                            coordinates.size(), cells.size(), nnodes),
+        {{coordinates.data(), coordinates.size() * sizeof(VectorDim)},
+         {ids.data(), ids.size() * sizeof(mpm::Index)}});
+  } catch (std::exception& exception) {
+    console_->error("Write mesh: {}", exception.what());
+    status = false;
+  }
+  return status;
+}
+
+//! Write coordinates of particles
+template <unsigned Tdim>
+bool mpm::IOMeshBinary<Tdim>::write_particles(
+    const std::string& particles_file,
+    const std::vector<VectorDim>& coordinates) {
+  bool status = true;
+  try {
+    mpm::binary::write(
+        particles_file,
+        mpm::binary::header(mpm::binary::FileType::Particles, Tdim,
+                            coordinates.size()),
+        {{coordinates.data(), coordinates.size() * sizeof(VectorDim)}});
+  } catch (std::exception& exception) {
+    console_->error("Write particle coordinates: {}", exception.what());
+    status = false;
+  }
+  return status;
+}
+
+//! Write stresses of particles
+template <unsigned Tdim>
+bool mpm::IOMeshBinary<Tdim>::write_particles_stresses(
+    const std::string& particles_stresses,
+    const std::vector<Eigen::Matrix<double, 6, 1>>& stresses) {
+  bool status = true;
+  try {
+    mpm::binary::write(
+        particles_stresses,
+        mpm::binary::header(mpm::binary::FileType::ParticlesStresses, Tdim,
+                            stresses.size()),
+        {{stresses.data(), stresses.size() * 6 * sizeof(double)}});
+  } catch (std::exception& exception) {
+    console_->error("Write particle stresses: {}", exception.what());
+    status = false;
+  }
+  return status;
+}
+
+//! Write euler angles of nodes
+template <unsigned Tdim>
+bool mpm::IOMeshBinary<Tdim>::write_euler_angles(
+    const std::string& nodal_euler_angles_file,
+    const std::map<mpm::Index, Eigen::Matrix<double, Tdim, 1>>& euler_angles) {
+  bool status = true;
+  try {
+    std::vector<mpm::Index> ids;
+    std::vector<VectorDim> angles;
+    ids.reserve(euler_angles.size());
+    angles.reserve(euler_angles.size());
+    for (const auto& euler_angle : euler_angles) {
+      ids.emplace_back(euler_angle.first);
+      angles.emplace_back(euler_angle.second);
+    }
+
+    mpm::binary::write(
+        nodal_euler_angles_file,
+        mpm::binary::header(mpm::binary::FileType::EulerAngles, Tdim,
+                            ids.size()),
+        {{ids.data(), ids.size() * sizeof(mpm::Index)},
+         {angles.data(), angles.size() * sizeof(VectorDim)}});
+  } catch (std::exception& exception) {
+    console_->error("Write euler angles: {}", exception.what());
+    status = false;
+  }
+  return status;
+}
+
+//! Write volumes of particles
+template <unsigned Tdim>
+bool mpm::IOMeshBinary<Tdim>::write_particles_volumes(
+    const std::string& volume_file,
+    const std::vector<std::tuple<mpm::Index, double>>& volumes) {
+  bool status = true;
+  try {
+    std::vector<mpm::Index> ids;
+    std::vector<double> values;
+    ids.reserve(volumes.size());
+    values.reserve(volumes.size());
+    for (const auto& volume : volumes) {
+      ids.emplace_back(std::get<0>(volume));
+      values.emplace_back(std::get<1>(volume));
+    }
+
+    mpm::binary::write(
+        volume_file,
+        mpm::binary::header(mpm::binary::FileType::ParticlesVolumes, Tdim,
+                            ids.size()),
+        {{ids.data(), ids.size() * sizeof(mpm::Index)},
+         {values.data(), values.size() * sizeof(double)}});
+  } catch (std::exception& exception) {
+    console_->error("Write volume: {}", exception.what());
+    status = false;
+  }
+  return status;
+}
+
+//! Write velocity constraints of nodes or particles
+template <unsigned Tdim>
+bool mpm::IOMeshBinary<Tdim>::write_velocity_constraints(
+    const std::string& velocity_constraints_file,
+    const std::vector<std::tuple<mpm::Index, unsigned, double>>& constraints) {
+  return this->write_directional(velocity_constraints_file,
+                                 mpm::binary::FileType::VelocityConstraints,
+                                 constraints);
+}
+
+//! Write friction constraints of nodes
+template <unsigned Tdim>
+bool mpm::IOMeshBinary<Tdim>::write_friction_constraints(
+    const std::string& friction_constraints_file,
+    const std::vector<std::tuple<mpm::Index, unsigned, int, double>>&
+        constraints) {
+  bool status = true;
+  try {
+    std::vector<mpm::Index> ids;
+    std::vector<std::uint64_t> dirs;
+    std::vector<std::int64_t> signs;
+    std::vector<double> frictions;
+    for (const auto& constraint : constraints) {
+      ids.emplace_back(std::get<0>(constraint));
+      dirs.emplace_back(std::get<1>(constraint));
+      signs.emplace_back(std::get<2>(constraint));
+      frictions.emplace_back(std::get<3>(constraint));
+    }
+
+    const std::size_t nbytes = constraints.size() * sizeof(std::uint64_t);
+    mpm::binary::write(
+        friction_constraints_file,
+        mpm::binary::header(mpm::binary::FileType::FrictionConstraints, Tdim,
+                            constraints.size()),
+        {{ids.data(), nbytes},
+         {dirs.data(), nbytes},
+         {signs.data(), nbytes},
+         {frictions.data(), nbytes}});
+  } catch (std::exception& exception) {
+    console_->error("Write friction constraints: {}", exception.what());
+    status = false;
+  }
+  return status;
+}
+
+//! Write nodal concentrated forces
+template <unsigned Tdim>
+bool mpm::IOMeshBinary<Tdim>::write_forces(
+    const std::string& forces_file,
+    const std::vector<std::tuple<mpm::Index, unsigned, double>>& forces) {
+  return this->write_directional(forces_file, mpm::binary::FileType::Forces,
+                                 forces);
+}
+
+//! Write ids, directions and values to a file
+template <unsigned Tdim>
+bool mpm::IOMeshBinary<Tdim>::write_directional(
+    const std::string& filename, mpm::binary::FileType type,
+    const std::vector<std::tuple<mpm::Index, unsigned, double>>& data) {
+  bool status = true;
+  try {
+    std::vector<mpm::Index> ids;
+    std::vector<std::uint64_t> dirs;
+    std::vector<double> values;
+    for (const auto& record : data) {
+      ids.emplace_back(std::get<0>(record));
+      dirs.emplace_back(std::get<1>(record));
+      values.emplace_back(std::get<2>(record));
+    }
+
+    const std::size_t nbytes = data.size() * sizeof(std::uint64_t);
+    mpm::binary::write(
+        filename, mpm::binary::header(type, Tdim, data.size()),
+        {{ids.data(), nbytes}, {dirs.data(), nbytes}, {values.data(), nbytes}});
+  } catch (std::exception& exception) {
+    console_->error("Write {}: {}", filename, exception.what());
+    status = false;
+  }
+  return status;
+}
@@ -0,0 +1,120 @@
+#ifndef MPM_VTP_WRITER_H_
+#define MPM_VTP_WRITER_H_
+
+#include <array>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <Eigen/Dense>
+
+#include "data_types.h"
+// Speed log
+#include "spdlog/spdlog.h"
+
+namespace mpm {
+
+//! VtpWriter class
+//! \brief Write points and all their attributes to a single VTK PolyData file
+//! \details Arrays are appended to the XML file as raw binary straight from
+//! contiguous buffers, optionally compressed with zlib in blocks as done by
+//! vtkZLibDataCompressor. The writer does not copy the buffers, they have to
+//! outlive the writer. Symmetric tensors are written as 6 component arrays
+//! in Voigt order (xx, yy, zz, xy, yz, xz), as read by ParaView.
+class VtpWriter {
+ public:
+  //! Constructor with point coordinates
+  //! \param[in] coordinates Point coordinates
+  //! \param[in] compression Compress the arrays with zlib
+  explicit VtpWriter(
+      const std::vector<Eigen::Matrix<double, 3, 1>>& coordinates,
+      bool compression = false);
+
+  //! Return if zlib compression is available
+  static bool compression_available();
+
+  //! Add scalar point data
+  //! \param[in] name Attribute name
+  //! \param[in] data Scalar data of each point
+  //! \retval status Return false if the data size does not match the points
+  bool add_point_data(const std::string& name, const std::vector<double>& data);
+
+  //! Add vector or tensor point data
+  //! \tparam Tsize Number of components
+  //! \param[in] name Attribute name
+  //! \param[in] data Vector or tensor data of each point
+  //! \retval status Return false if the data size does not match the points
+  template <int Tsize>
+  bool add_point_data(const std::string& name,
+                      const std::vector<Eigen::Matrix<double, Tsize, 1>>& data);
+
+  //! Add lines between pairs of points
+  //! \param[in] pairs Indices of the end points of each line
+  void add_lines(const std::vector<std::array<mpm::Index, 2>>& pairs);
+
+  //! Return name and number of components of each point data attribute
+  std::vector<std::pair<std::string, unsigned>> point_data() const;
+
+  //! Write PolyData (.vtp) file
+  //! \param[in] filename Output file
+  //! \retval status Return true if the file is written
+  bool write(const std::string& filename) const;
+
+  //! Write parallel PolyData (.pvtp) container file of the pieces of all ranks
+  //! \param[in] filename Output container file
+  //! \param[in] pieces Piece file of each rank, relative to the container
+  //! \retval status Return true if the file is written
+  bool write_parallel(const std::string& filename,
+                      const std::vector<std::string>& pieces) const;
+
+ private:
+  //! Array appended to the file
+  struct DataArray {
+    //! Array name
+    std::string name;
+    //! VTK data type
+    std::string type;
+    //! Number of components
+    unsigned ncomponents;
+    //! Contiguous data
+    const char* data;
+    //! Size of the data in bytes
+    std::size_t nbytes;
+  };
+
+  //! Add point data from a contiguous buffer
+  //! \param[in] name Attribute name
+  //! \param[in] data Contiguous data, ncomponents per point
+  //! \param[in] size Number of points in the data
+  //! \param[in] ncomponents Number of components
+  //! \retval status Return false if the data size does not match the points
+  bool add_point_data(const std::string& name, const double* data,
+                      std::size_t size, unsigned ncomponents);
+
+  //! Compress an array as written to the appended data section
+  //! \param[in] array Data array
+  //! \retval encoded Block header and compressed blocks of the array
+  std::vector<char> compress(const DataArray& array) const;
+
+ private:
+  //! Number of points
+  std::size_t npoints_{0};
+  //! Compress arrays
+  bool compression_{false};
+  //! Point coordinates
+  DataArray points_;
+  //! Point data attributes
+  std::vector<DataArray> point_data_;
+  //! Line connectivity
+  std::vector<DataArray> lines_;
+  //! Offsets of the lines in the connectivity
+  std::vector<mpm::Index> line_offsets_;
+  //! Logger
+  std::unique_ptr<spdlog::logger> console_;
+};  // VtpWriter class
+}  // namespace mpm
+
+#include "vtp_writer.tcc"
+
+#endif  // MPM_VTP_WRITER_H_
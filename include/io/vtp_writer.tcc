@@ -0,0 +1,12 @@
+//! Add vector or tensor point data
+template <int Tsize>
+bool mpm::VtpWriter::add_point_data(
+    const std::string& name,
+    const std::vector<Eigen::Matrix<double, Tsize, 1>>& data) {
+  // Fixed size vectors are stored without padding
+  static_assert(sizeof(Eigen::Matrix<double, Tsize, 1>) ==
+                    Tsize * sizeof(double),
+                "Point data is not contiguous");
+  return this->add_point_data(
+      name, reinterpret_cast<const double*>(data.data()), data.size(), Tsize);
+}
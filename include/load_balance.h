@@ -0,0 +1,38 @@
+#ifndef MPM_LOAD_BALANCE_H_
+#define MPM_LOAD_BALANCE_H_
+
+#include <map>
+#include <set>
+#include <vector>
+
+//! MPM namespace
+namespace mpm {
+
+//! Incremental load balancing of ranks
+//! \details Loads are measured per rank (e.g., time of a step). Ranks that
+//! share cells exchange load along the edges of the rank graph with a first
+//! order diffusion scheme, so each balance moves only a layer of boundary
+//! cells instead of recomputing the whole partition.
+namespace load_balance {
+
+//! Return the imbalance of loads as the ratio of maximum to mean load - 1
+//! \param[in] loads Load of each rank
+double imbalance(const std::vector<double>& loads);
+
+//! Return the load to send from a rank to each of its neighbour ranks
+//! \details The flow along an edge (i, j) of the rank graph is
+//! (L_i - L_j) / (max(d_i, d_j) + 1), where d is the number of neighbours of
+//! a rank. Only flows from a rank to less loaded ranks are returned.
+//! \param[in] rank Rank of the process
+//! \param[in] neighbours Neighbour ranks of the rank
+//! \param[in] loads Load of each rank
+//! \param[in] degrees Number of neighbour ranks of each rank
+//! \retval flows Load to send to each less loaded neighbour rank
+std::map<unsigned, double> diffusive_flows(
+    unsigned rank, const std::set<unsigned>& neighbours,
+    const std::vector<double>& loads, const std::vector<unsigned>& degrees);
+
+}  // namespace load_balance
+}  // namespace mpm
+
+#endif  // MPM_LOAD_BALANCE_H_
@@ -6,7 +6,8 @@ bool mpm::Constraints<Tdim>::assign_nodal_velocity_constraint(
   try {
     int set_id = vconstraint->setid();
     auto nset = mesh_->nodes(set_id);
-    if (nset.size() == 0)
+    // A rank of a distributed mesh may hold none of the nodes of a set
+    if (nset.size() == 0 && !mesh_->is_distributed())
       throw std::runtime_error(
           "Node set is empty for assignment of velocity constraints");
 
@@ -39,6 +40,11 @@ bool mpm::Constraints<Tdim>::assign_nodal_velocity_constraints(
       // Velocity
       double velocity = std::get<2>(velocity_constraint);
 
+      // A distributed mesh only holds some of the nodes
+      if (mesh_->is_distributed() && mesh_->local_node_index(nid) ==
+                                         std::numeric_limits<mpm::Index>::max())
+        continue;
+
       // Apply constraint
       if (!mesh_->node(nid)->assign_velocity_constraint(dir, velocity))
         throw std::runtime_error(
@@ -59,7 +65,8 @@ bool mpm::Constraints<Tdim>::assign_nodal_frictional_constraint(
   try {
     int set_id = fconstraint->setid();
     auto nset = mesh_->nodes(set_id);
-    if (nset.size() == 0)
+    // A rank of a distributed mesh may hold none of the nodes of a set
+    if (nset.size() == 0 && !mesh_->is_distributed())
       throw std::runtime_error(
           "Node set is empty for assignment of velocity constraints");
     unsigned dir = fconstraint->dir();
@@ -94,6 +101,11 @@ bool mpm::Constraints<Tdim>::assign_nodal_friction_constraints(
       // Friction
       double friction = std::get<3>(friction_constraint);
 
+      // A distributed mesh only holds some of the nodes
+      if (mesh_->is_distributed() && mesh_->local_node_index(nid) ==
+                                         std::numeric_limits<mpm::Index>::max())
+        continue;
+
       // Apply constraint
       if (!mesh_->node(nid)->assign_friction_constraint(dir, sign, friction))
         throw std::runtime_error(
@@ -21,6 +21,9 @@ class Bingham : public Material<Tdim> {
   //! Define a Matrix of 6 x 6
   using Matrix6x6 = Eigen::Matrix<double, 6, 6>;
 
+  //! State variable indices in the order of state_variables()
+  enum StateVariable : unsigned { Pressure };
+
   //! Constructor with id and material properties
   //! \param[in] id Material ID
   //! \param[in] material_properties Material properties
@@ -32,7 +32,8 @@ mpm::Bingham<Tdim>::Bingham(unsigned id, const Json& material_properties)
 //! Initialise history variables
 template <unsigned Tdim>
 mpm::dense_map mpm::Bingham<Tdim>::initialise_state_variables() {
-  mpm::dense_map state_vars = {{"pressure", 0.0}};
+  mpm::dense_map state_vars = this->zero_state_variables();
+  state_vars[Pressure] = 0.0;
   return state_vars;
 }
 
@@ -96,7 +97,7 @@ Eigen::Matrix<double, 6, 1> mpm::Bingham<Tdim>::compute_stress(
   if (trace_invariant2 < (tau0_ * tau0_)) tau.setZero();
 
   // Update pressure
-  (*state_vars).at("pressure") +=
+  (*state_vars)[Pressure] +=
       (compressibility_multiplier_ *
        this->thermodynamic_pressure(ptr->dvolumetric_strain()));
 
@@ -105,7 +106,7 @@ Eigen::Matrix<double, 6, 1> mpm::Bingham<Tdim>::compute_stress(
   // stress = -thermodynamic_pressure I + tau, where I is identity matrix or
   // direc_delta in Voigt notation
   const Eigen::Matrix<double, 6, 1> updated_stress =
-      -(*state_vars).at("pressure") * this->dirac_delta() *
+      -(*state_vars)[Pressure] * this->dirac_delta() *
           compressibility_multiplier_ +
       tau;
 
@@ -20,6 +20,8 @@ class LinearElastic : public Material<Tdim> {
   using Vector6d = Eigen::Matrix<double, 6, 1>;
   //! Define a Matrix of 6 x 6
   using Matrix6x6 = Eigen::Matrix<double, 6, 6>;
+  //! Define a Matrix of 6 x n, one column per particle
+  using Matrix6X = Eigen::Matrix<double, 6, Eigen::Dynamic>;
 
   //! Constructor with id
   //! \param[in] material_properties Material properties
@@ -54,6 +56,16 @@ class LinearElastic : public Material<Tdim> {
                           const ParticleBase<Tdim>* ptr,
                           mpm::dense_map* state_vars) override;
 
+  //! Compute stress of a batch of particles
+  //! \param[in] ptrs Constant pointers to the particles of the batch
+  //! \param[in] dstrains Strain increments, one column per particle
+  //! \param[in] state_vars History-dependent state variables per particle
+  //! \param[in,out] stresses Stresses, one column per particle
+  void compute_stress_batch(const std::vector<const ParticleBase<Tdim>*>& ptrs,
+                            const Matrix6X& dstrains,
+                            const std::vector<mpm::dense_map*>& state_vars,
+                            Matrix6X* stresses) override;
+
  protected:
   //! material id
   using Material<Tdim>::id_;
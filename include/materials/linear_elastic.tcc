@@ -50,3 +50,13 @@ Eigen::Matrix<double, 6, 1> mpm::LinearElastic<Tdim>::compute_stress(
   const Vector6d dstress = this->de_ * dstrain;
   return (stress + dstress);
 }
+
+//! Compute stress of a batch of particles
+template <unsigned Tdim>
+void mpm::LinearElastic<Tdim>::compute_stress_batch(
+    const std::vector<const ParticleBase<Tdim>*>& ptrs,
+    const Matrix6X& dstrains, const std::vector<mpm::dense_map*>& state_vars,
+    Matrix6X* stresses) {
+  // Stress increments of the batch in one matrix product
+  stresses->noalias() += this->de_ * dstrains;
+}
@@ -1,7 +1,12 @@
 #ifndef MPM_MATERIAL_MATERIAL_H_
 #define MPM_MATERIAL_MATERIAL_H_
 
+#include <cmath>
 #include <limits>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
 
 #include "Eigen/Dense"
 #include "json.hpp"
@@ -33,6 +38,8 @@ class Material {
   using Vector6d = Eigen::Matrix<double, 6, 1>;
   //! Define a Matrix of 6 x 6
   using Matrix6x6 = Eigen::Matrix<double, 6, 6>;
+  //! Define a Matrix of 6 x n, one column per particle
+  using Matrix6X = Eigen::Matrix<double, 6, Eigen::Dynamic>;
 
   // Constructor with id
   //! \param[in] id Material id
@@ -61,6 +68,13 @@ class Material {
   template <typename Ttype>
   Ttype property(const std::string& key);
 
+  //! Return the speed of elastic pressure waves in the material
+  //! \details Computed once from the density and the "wave_speed", the
+  //! "youngs_modulus" and "poisson_ratio" or the "bulk_modulus" properties.
+  //! Throws if none of them are defined.
+  //! \retval wave_speed Elastic wave speed
+  virtual double wave_speed();
+
   //! Initialise history variables
   virtual mpm::dense_map initialise_state_variables() = 0;
 
@@ -78,13 +92,63 @@ class Material {
                                   const ParticleBase<Tdim>* ptr,
                                   mpm::dense_map* state_vars) = 0;
 
+  //! Compute stress of a batch of particles of this material
+  //! \details Calls compute_stress for each particle, materials override it
+  //! to evaluate the batch at once
+  //! \param[in] ptrs Constant pointers to the particles of the batch
+  //! \param[in] dstrains Strain increments, one column per particle
+  //! \param[in] state_vars History-dependent state variables per particle
+  //! \param[in,out] stresses Stresses, one column per particle
+  virtual void compute_stress_batch(
+      const std::vector<const ParticleBase<Tdim>*>& ptrs,
+      const Matrix6X& dstrains, const std::vector<mpm::dense_map*>& state_vars,
+      Matrix6X* stresses);
+
+  //! Record the time of stress updates of particles of this material
+  //! \details Not thread safe, called once per batched stress update
+  //! \param[in] duration Time of the stress updates in seconds
+  //! \param[in] nparticles Number of particles updated
+  void record_stress_cost(double duration, mpm::Index nparticles) {
+    stress_time_ += duration;
+    nstress_updates_ += nparticles;
+  }
+
+  //! Return the recorded time and number of particle stress updates
+  std::pair<double, mpm::Index> stress_cost() const {
+    return std::make_pair(stress_time_, nstress_updates_);
+  }
+
  protected:
+  //! Return zero state variables with names shared by all particles
+  //! \details Names are taken from state_variables() on the first call
+  mpm::dense_map zero_state_variables() {
+    std::call_once(state_vars_layout_flag_, [this]() {
+      state_vars_layout_ = std::make_shared<const mpm::dense_map::Layout>(
+          this->state_variables());
+    });
+    return mpm::dense_map(state_vars_layout_);
+  }
+
   //! material id
   unsigned id_{std::numeric_limits<unsigned>::max()};
   //! Material properties
   Json properties_;
   //! Logger
   std::unique_ptr<spdlog::logger> console_;
+
+ private:
+  //! Names of state variables shared by all particles
+  std::shared_ptr<const mpm::dense_map::Layout> state_vars_layout_;
+  //! Flag to create the state variable names once
+  std::once_flag state_vars_layout_flag_;
+  //! Elastic wave speed
+  double wave_speed_{0.};
+  //! Flag to compute the elastic wave speed once
+  std::once_flag wave_speed_flag_;
+  //! Time of particle stress updates in seconds
+  double stress_time_{0.};
+  //! Number of particle stress updates
+  mpm::Index nstress_updates_{0};
 };  // Material class
 }  // namespace mpm
 
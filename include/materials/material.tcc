@@ -11,3 +11,48 @@ Ttype mpm::Material<Tdim>::property(const std::string& key) {
         "Property call to material parameter not found or invalid type");
   }
 }
+
+//! Return the speed of elastic pressure waves in the material
+template <unsigned Tdim>
+double mpm::Material<Tdim>::wave_speed() {
+  std::call_once(wave_speed_flag_, [this]() {
+    // Wave speed is given explicitly for state dependent stiffness
+    if (properties_.contains("wave_speed")) {
+      wave_speed_ = properties_.at("wave_speed").template get<double>();
+      return;
+    }
+
+    const double density = this->template property<double>("density");
+    // Constrained (P-wave) modulus, K + 4/3 G
+    double modulus = 0.;
+    if (properties_.contains("youngs_modulus") &&
+        properties_.contains("poisson_ratio")) {
+      const double youngs_modulus =
+          properties_.at("youngs_modulus").template get<double>();
+      const double poisson_ratio =
+          properties_.at("poisson_ratio").template get<double>();
+      modulus = youngs_modulus * (1. - poisson_ratio) /
+                ((1. + poisson_ratio) * (1. - 2. * poisson_ratio));
+    } else if (properties_.contains("bulk_modulus")) {
+      modulus = properties_.at("bulk_modulus").template get<double>();
+    } else
+      throw std::runtime_error(
+          "Wave speed of material is undefined, specify a wave_speed");
+
+    wave_speed_ = std::sqrt(modulus / density);
+  });
+  return wave_speed_;
+}
+
+//! Compute stress of a batch of particles
+template <unsigned Tdim>
+void mpm::Material<Tdim>::compute_stress_batch(
+    const std::vector<const ParticleBase<Tdim>*>& ptrs,
+    const Matrix6X& dstrains, const std::vector<mpm::dense_map*>& state_vars,
+    Matrix6X* stresses) {
+  for (unsigned i = 0; i < ptrs.size(); ++i) {
+    const Vector6d stress = stresses->col(i);
+    stresses->col(i) = this->compute_stress(stress, dstrains.col(i), ptrs[i],
+                                            state_vars[i]);
+  }
+}
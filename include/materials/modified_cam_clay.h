@@ -25,6 +25,28 @@ class ModifiedCamClay : public Material<Tdim> {
   //! Failure state
   enum FailureState { Elastic = 0, Yield = 1 };
 
+  //! State variable indices in the order of state_variables()
+  enum StateVariable : unsigned {
+    BulkModulus,
+    ShearModulus,
+    P,
+    Q,
+    Theta,
+    Pc,
+    VoidRatio,
+    DeltaPhi,
+    MTheta,
+    FFunction,
+    DPVStrain,
+    DPDStrain,
+    PVStrain,
+    PDStrain,
+    Chi,
+    Pcd,
+    Pcc,
+    SubloadingR
+  };
+
   //! Constructor with id and material properties
   //! \param[in] material_properties Material properties
   ModifiedCamClay(unsigned id, const Json& material_properties);
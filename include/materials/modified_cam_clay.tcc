@@ -73,49 +73,49 @@ mpm::ModifiedCamClay<Tdim>::ModifiedCamClay(unsigned id,
 //! Initialise state variables
 template <unsigned Tdim>
 mpm::dense_map mpm::ModifiedCamClay<Tdim>::initialise_state_variables() {
-  mpm::dense_map state_vars = {
-      // Elastic modulus
-      // Bulk modulus
-      {"bulk_modulus", youngs_modulus_ / (2 * (1 + poisson_ratio_))},
-      // Shear modulus
-      {"shear_modulus", 3 * youngs_modulus_ * (1 - 2 * poisson_ratio_) /
-                            (2 * (1 + poisson_ratio_))},
-      // Stress invariants
-      // Volumetric stress
-      {"p", 0.},
-      // Deviatoric stress
-      {"q", 0.},
-      // Lode's angle
-      {"theta", 0.},
-      // Modified Cam clay parameters
-      // Preconsolidation pressure
-      {"pc", pc0_},
-      // void_ratio
-      {"void_ratio", e0_},
-      // Consistency parameter
-      {"delta_phi", 0.},
-      // M_theta
-      {"m_theta", m_},
-      // Yield function
-      {"f_function", 0.},
-      // Incremental plastic strain
-      // Incremental plastic volumetic strain
-      {"dpvstrain", 0.},
-      // Incremental plastic deviatoric strain
-      {"dpdstrain", 0.},
-      // Plastic volumetic strain
-      {"pvstrain", 0.},
-      // Plastic deviatoric strain
-      {"pdstrain", 0.},
-      // Bonding parameters
-      // Chi
-      {"chi", 1.},
-      // Pcd
-      {"pcd", 0.},
-      // Pcc
-      {"pcc", 0.},
-      // Subloading surface ratio
-      {"subloading_r", 1.}};
+  mpm::dense_map state_vars = this->zero_state_variables();
+  // Elastic modulus
+  // Bulk modulus
+  state_vars[BulkModulus] = youngs_modulus_ / (2 * (1 + poisson_ratio_));
+  // Shear modulus
+  state_vars[ShearModulus] = 3 * youngs_modulus_ * (1 - 2 * poisson_ratio_) /
+                             (2 * (1 + poisson_ratio_));
+  // Stress invariants
+  // Volumetric stress
+  state_vars[P] = 0.;
+  // Deviatoric stress
+  state_vars[Q] = 0.;
+  // Lode's angle
+  state_vars[Theta] = 0.;
+  // Modified Cam clay parameters
+  // Preconsolidation pressure
+  state_vars[Pc] = pc0_;
+  // void_ratio
+  state_vars[VoidRatio] = e0_;
+  // Consistency parameter
+  state_vars[DeltaPhi] = 0.;
+  // M_theta
+  state_vars[MTheta] = m_;
+  // Yield function
+  state_vars[FFunction] = 0.;
+  // Incremental plastic strain
+  // Incremental plastic volumetic strain
+  state_vars[DPVStrain] = 0.;
+  // Incremental plastic deviatoric strain
+  state_vars[DPDStrain] = 0.;
+  // Plastic volumetic strain
+  state_vars[PVStrain] = 0.;
+  // Plastic deviatoric strain
+  state_vars[PDStrain] = 0.;
+  // Bonding parameters
+  // Chi
+  state_vars[Chi] = 1.;
+  // Pcd
+  state_vars[Pcd] = 0.;
+  // Pcc
+  state_vars[Pcc] = 0.;
+  // Subloading surface ratio
+  state_vars[SubloadingR] = 1.;
   return state_vars;
 }
 
@@ -135,29 +135,28 @@ template <unsigned Tdim>
 bool mpm::ModifiedCamClay<Tdim>::compute_elastic_tensor(
     mpm::dense_map* state_vars) {
   // Compute elastic modulus based on stress status
-  if ((*state_vars).at("p") > std::numeric_limits<double>::epsilon()) {
+  if ((*state_vars)[P] > std::numeric_limits<double>::epsilon()) {
     // Bulk modulus
-    (*state_vars).at("bulk_modulus") =
-        (1 + (*state_vars).at("void_ratio")) / kappa_ * (*state_vars).at("p");
+    (*state_vars)[BulkModulus] =
+        (1 + (*state_vars)[VoidRatio]) / kappa_ * (*state_vars)[P];
     // Shear modulus
-    (*state_vars).at("shear_modulus") = 3 * (*state_vars).at("bulk_modulus") *
+    (*state_vars)[ShearModulus] = 3 * (*state_vars)[BulkModulus] *
                                         (1 - 2 * poisson_ratio_) /
                                         (2 * (1 + poisson_ratio_));
   }
   // Compute bonding part
   if (bonding_) {
     // Bonded shear modulus
-    (*state_vars).at("shear_modulus") +=
-        m_shear_ * (*state_vars).at("chi") * s_h_;
+    (*state_vars)[ShearModulus] += m_shear_ * (*state_vars)[Chi] * s_h_;
     // Bonded bulk modulus
-    (*state_vars).at("bulk_modulus") = (*state_vars).at("shear_modulus") *
+    (*state_vars)[BulkModulus] = (*state_vars)[ShearModulus] *
                                        (2 * (1 + poisson_ratio_)) /
                                        (1 - 2 * poisson_ratio_) / 3;
   }
   // Components in stiffness matrix
-  const double G = (*state_vars).at("shear_modulus");
-  const double a1 = (*state_vars).at("bulk_modulus") + (4.0 / 3.0) * G;
-  const double a2 = (*state_vars).at("bulk_modulus") - (2.0 / 3.0) * G;
+  const double G = (*state_vars)[ShearModulus];
+  const double a1 = (*state_vars)[BulkModulus] + (4.0 / 3.0) * G;
+  const double a2 = (*state_vars)[BulkModulus] - (2.0 / 3.0) * G;
   // Compute elastic stiffness matrix
   // clang-format off
   de_(0,0)=a1;    de_(0,1)=a2;    de_(0,2)=a2;    de_(0,3)=0;    de_(0,4)=0;    de_(0,5)=0;
@@ -175,19 +174,19 @@ template <unsigned Tdim>
 bool mpm::ModifiedCamClay<Tdim>::compute_plastic_tensor(
     const Vector6d& stress, mpm::dense_map* state_vars) {
   // Current stress
-  const double p = (*state_vars).at("p");
-  const double q = (*state_vars).at("q");
+  const double p = (*state_vars)[P];
+  const double q = (*state_vars)[Q];
   // Preconsolidation pressure
-  const double pc = (*state_vars).at("pc");
+  const double pc = (*state_vars)[Pc];
   // Bonding parameters
-  const double pcc = (*state_vars).at("pcc");
-  const double pcd = (*state_vars).at("pcd");
+  const double pcc = (*state_vars)[Pcc];
+  const double pcd = (*state_vars)[Pcd];
   // Subloading ratio
-  const double subloading_r = (*state_vars).at("subloading_r");
+  const double subloading_r = (*state_vars)[SubloadingR];
   // Compute dF / dp
   double df_dp = 2 * p - pc - pcd;
   // Compute dF / dq
-  const double df_dq = 2 * q / std::pow((*state_vars).at("m_theta"), 2);
+  const double df_dq = 2 * q / std::pow((*state_vars)[MTheta], 2);
   // Compute dF / dpc
   double df_dpc = -p - pcc;
   // Compute dF / dpcd
@@ -202,17 +201,15 @@ bool mpm::ModifiedCamClay<Tdim>::compute_plastic_tensor(
     df_dpcc = p - subloading_r * (p + pc + pcd + 2 * pcc);
   }
   // Upsilon
-  const double upsilon =
-      (1 + (*state_vars).at("void_ratio")) / (lambda_ - kappa_);
+  const double upsilon = (1 + (*state_vars)[VoidRatio]) / (lambda_ - kappa_);
   // Coefficients in plastic stiffness matrix
-  const double a1 = std::pow(((*state_vars).at("bulk_modulus") * df_dp), 2);
-  const double a2 = -std::sqrt(6) * (*state_vars).at("bulk_modulus") * df_dp *
-                    (*state_vars).at("shear_modulus") * df_dq;
-  const double a3 =
-      6 * std::pow(((*state_vars).at("shear_modulus") * df_dq), 2);
+  const double a1 = std::pow(((*state_vars)[BulkModulus] * df_dp), 2);
+  const double a2 = -std::sqrt(6) * (*state_vars)[BulkModulus] * df_dp *
+                    (*state_vars)[ShearModulus] * df_dq;
+  const double a3 = 6 * std::pow(((*state_vars)[ShearModulus] * df_dq), 2);
   // Numerator
-  const double num = (*state_vars).at("bulk_modulus") * (df_dp * df_dp) +
-                     3 * (*state_vars).at("shear_modulus") * (df_dq * df_dq);
+  const double num = (*state_vars)[BulkModulus] * (df_dp * df_dp) +
+                     3 * (*state_vars)[ShearModulus] * (df_dq * df_dq);
 
   // Hardening parameter
   double hardening = upsilon * pc * df_dp * df_dpc;
@@ -234,14 +231,14 @@ bool mpm::ModifiedCamClay<Tdim>::compute_plastic_tensor(
     // Compute subloading hardening parameter
     const double hardening_subloading =
         -df_dr * subloading_u_ * (1 + (pcd + pcc) / pc) * log(subloading_r) *
-        std::sqrt(std::pow((*state_vars).at("dpvstrain"), 2) +
-                  std::pow((*state_vars).at("dpdstrain"), 2));
+        std::sqrt(std::pow((*state_vars)[DPVStrain], 2) +
+                  std::pow((*state_vars)[DPDStrain], 2));
     // Update hardening parameter
     hardening += hardening_subloading;
   }
   // Compute the deviatoric stress
   auto dev_stress = stress;
-  for (unsigned i = 0; i < 3; ++i) dev_stress(i) += (*state_vars).at("p");
+  for (unsigned i = 0; i < 3; ++i) dev_stress(i) += (*state_vars)[P];
   // Initialise matrix
   Eigen::Matrix<double, 6, 6> n_l = Matrix6x6::Zero();
   Eigen::Matrix<double, 6, 6> l_n = Matrix6x6::Zero();
@@ -280,12 +277,12 @@ template <unsigned Tdim>
 bool mpm::ModifiedCamClay<Tdim>::compute_stress_invariants(
     const Vector6d& stress, mpm::dense_map* state_vars) {
   // Compute volumetic stress
-  (*state_vars).at("p") = -mpm::materials::p(stress);
+  (*state_vars)[P] = -mpm::materials::p(stress);
   // Compute deviatoric q
-  (*state_vars).at("q") = mpm::materials::q(stress);
+  (*state_vars)[Q] = mpm::materials::q(stress);
   // Compute theta (Lode angle)
   if (three_invariants_)
-    (*state_vars).at("theta") = mpm::materials::lode_angle(stress);
+    (*state_vars)[Theta] = mpm::materials::lode_angle(stress);
 
   return true;
 }
@@ -298,9 +295,9 @@ Eigen::Matrix<double, 6, 1>
   // Initialise deviatoric stress tensor
   Vector6d n = Vector6d::Zero();
   // Mean stress
-  const double p = (*state_vars).at("p");
+  const double p = (*state_vars)[P];
   // Deviatoric stress
-  const double q = (*state_vars).at("q");
+  const double q = (*state_vars)[Q];
   // Compute the deviatoric stress
   Vector6d dev_stress = stress;
   for (unsigned i = 0; i < 3; ++i) dev_stress(i) += p;
@@ -316,24 +313,24 @@ typename mpm::ModifiedCamClay<Tdim>::FailureState
     mpm::ModifiedCamClay<Tdim>::compute_yield_state(
         mpm::dense_map* state_vars) {
   // Get stress invariants
-  const double p = (*state_vars).at("p");
-  const double q = (*state_vars).at("q");
-  const double m_theta = (*state_vars).at("m_theta");
+  const double p = (*state_vars)[P];
+  const double q = (*state_vars)[Q];
+  const double m_theta = (*state_vars)[MTheta];
   // Plastic volumetic strain
-  const double pc = (*state_vars).at("pc");
+  const double pc = (*state_vars)[Pc];
   // Get bonding parameters
-  const double pcd = (*state_vars).at("pcd");
-  const double pcc = (*state_vars).at("pcc");
+  const double pcd = (*state_vars)[Pcd];
+  const double pcc = (*state_vars)[Pcc];
   // Subloading surface ratio
-  const double subloading_r = (*state_vars).at("subloading_r");
+  const double subloading_r = (*state_vars)[SubloadingR];
   // Initialise yield status (0: elastic, 1: yield)
   auto yield_type = FailureState::Elastic;
   // Compute yield functions
-  (*state_vars).at("f_function") =
+  (*state_vars)[FFunction] =
       std::pow(q / m_theta, 2) +
       (p + pcc) * (p - subloading_r * (pc + pcd + pcc));
   // Tension failure
-  if ((*state_vars).at("f_function") > std::numeric_limits<double>::epsilon())
+  if ((*state_vars)[FFunction] > std::numeric_limits<double>::epsilon())
     yield_type = FailureState::Yield;
 
   return yield_type;
@@ -344,16 +341,13 @@ template <unsigned Tdim>
 void mpm::ModifiedCamClay<Tdim>::compute_bonding_parameters(
     const double chi, mpm::dense_map* state_vars) {
   // Compute chi
-  (*state_vars).at("chi") =
-      chi - m_degradation_ * chi * (*state_vars).at("dpdstrain");
-  if ((*state_vars).at("chi") < 0.) (*state_vars).at("chi") = 0.;
-  if ((*state_vars).at("chi") > 1.) (*state_vars).at("chi") = 1.;
+  (*state_vars)[Chi] = chi - m_degradation_ * chi * (*state_vars)[DPDStrain];
+  if ((*state_vars)[Chi] < 0.) (*state_vars)[Chi] = 0.;
+  if ((*state_vars)[Chi] > 1.) (*state_vars)[Chi] = 1.;
   // Compute pcd
-  (*state_vars).at("pcd") =
-      mc_a_ * std::pow((*state_vars).at("chi") * s_h_, mc_b_);
+  (*state_vars)[Pcd] = mc_a_ * std::pow((*state_vars)[Chi] * s_h_, mc_b_);
   // Compute pcc
-  (*state_vars).at("pcc") =
-      mc_c_ * std::pow((*state_vars).at("chi") * s_h_, mc_d_);
+  (*state_vars)[Pcc] = mc_c_ * std::pow((*state_vars)[Chi] * s_h_, mc_d_);
 }
 
 //! Compute subloading parameters
@@ -361,29 +355,29 @@ template <unsigned Tdim>
 void mpm::ModifiedCamClay<Tdim>::compute_subloading_parameters(
     const double subloading_r, mpm::dense_map* state_vars) {
   // Mean pressure
-  const double p = (*state_vars).at("p");
+  const double p = (*state_vars)[P];
   // Preconsolidation pressure
-  const double pc = (*state_vars).at("pc");
+  const double pc = (*state_vars)[Pc];
   // Get bonding parameters
-  const double pcd = (*state_vars).at("pcd");
-  const double pcc = (*state_vars).at("pcc");
+  const double pcd = (*state_vars)[Pcd];
+  const double pcc = (*state_vars)[Pcc];
   // Plastic strain
-  const double dpvstrain = (*state_vars).at("dpvstrain");
-  const double dpdstrain = (*state_vars).at("dpdstrain");
+  const double dpvstrain = (*state_vars)[DPVStrain];
+  const double dpdstrain = (*state_vars)[DPDStrain];
   // Initialise subloading surface ratio
-  if ((*state_vars).at("subloading_r") == 1.0)
-    (*state_vars).at("subloading_r") = p / (pc + pcd + pcc);
+  if ((*state_vars)[SubloadingR] == 1.0)
+    (*state_vars)[SubloadingR] = p / (pc + pcd + pcc);
   else
     // Update subloading surface ratio
-    (*state_vars).at("subloading_r") =
+    (*state_vars)[SubloadingR] =
         subloading_r -
         subloading_u_ * (1 + (pcd + pcc) / pc) * log(subloading_r) *
             std::sqrt(dpvstrain * dpvstrain + dpdstrain * dpdstrain);
   // Threshhold
-  if ((*state_vars).at("subloading_r") < std::numeric_limits<double>::epsilon())
-    (*state_vars).at("subloading_r") = 1.E-5;
-  if ((*state_vars).at("subloading_r") > 1.)
-    (*state_vars).at("subloading_r") = 1.;
+  if ((*state_vars)[SubloadingR] < std::numeric_limits<double>::epsilon())
+    (*state_vars)[SubloadingR] = 1.E-5;
+  if ((*state_vars)[SubloadingR] > 1.)
+    (*state_vars)[SubloadingR] = 1.;
 }
 
 //! Compute dF/dmul
@@ -391,19 +385,19 @@ template <unsigned Tdim>
 void mpm::ModifiedCamClay<Tdim>::compute_df_dmul(
     const mpm::dense_map* state_vars, double* df_dmul) {
   // Stress invariants
-  const double p = (*state_vars).at("p");
-  const double q = (*state_vars).at("q");
-  const double m_theta = (*state_vars).at("m_theta");
+  const double p = (*state_vars)[P];
+  const double q = (*state_vars)[Q];
+  const double m_theta = (*state_vars)[MTheta];
   // Preconsolidation pressure
-  const double pc = (*state_vars).at("pc");
+  const double pc = (*state_vars)[Pc];
   // Get bonding parameters
-  const double pcd = (*state_vars).at("pcd");
-  const double pcc = (*state_vars).at("pcc");
+  const double pcd = (*state_vars)[Pcd];
+  const double pcc = (*state_vars)[Pcc];
   // Get elastic modulus
-  const double e_b = (*state_vars).at("bulk_modulus");
-  const double e_s = (*state_vars).at("shear_modulus");
+  const double e_b = (*state_vars)[BulkModulus];
+  const double e_s = (*state_vars)[ShearModulus];
   // Get consistency parameter
-  const double mul = (*state_vars).at("delta_phi");
+  const double mul = (*state_vars)[DeltaPhi];
   // Compute dF / dp
   double df_dp = 2 * p - pc - pcd;
   // Compute dF / dq
@@ -411,7 +405,7 @@ void mpm::ModifiedCamClay<Tdim>::compute_df_dmul(
   // Compute dF / dpc
   double df_dpc = -(p + pcc);
   // Upsilon
-  double upsilon = (1 + (*state_vars).at("void_ratio")) / (lambda_ - kappa_);
+  double upsilon = (1 + (*state_vars)[VoidRatio]) / (lambda_ - kappa_);
   // A_den
   double a_den = 1 + (2 * e_b + upsilon * (pc + pcd)) * mul;
   // Compute dp / dmul
@@ -453,21 +447,20 @@ void mpm::ModifiedCamClay<Tdim>::compute_dg_dpc(
     const mpm::dense_map* state_vars, const double pc_n, const double p_trial,
     double* g_function, double* dg_dpc) {
   // Upsilon
-  const double upsilon =
-      (1 + (*state_vars).at("void_ratio")) / (lambda_ - kappa_);
+  const double upsilon = (1 + (*state_vars)[VoidRatio]) / (lambda_ - kappa_);
   // Exponential index
   double e_index =
-      upsilon * (*state_vars).at("delta_phi") *
-      (2 * p_trial - (*state_vars).at("pc") - (*state_vars).at("pcd")) /
+      upsilon * (*state_vars)[DeltaPhi] *
+      (2 * p_trial - (*state_vars)[Pc] - (*state_vars)[Pcd]) /
       (1 +
-       2 * (*state_vars).at("delta_phi") * (*state_vars).at("bulk_modulus"));
+       2 * (*state_vars)[DeltaPhi] * (*state_vars)[BulkModulus]);
   // Compute consistency parameter function
-  (*g_function) = pc_n * exp(e_index) - (*state_vars).at("pc");
+  (*g_function) = pc_n * exp(e_index) - (*state_vars)[Pc];
   // Compute dG / dpc
   (*dg_dpc) = pc_n * exp(e_index) *
-                  (-upsilon * (*state_vars).at("delta_phi") /
-                   (1 + 2 * (*state_vars).at("delta_phi") *
-                            (*state_vars).at("bulk_modulus"))) -
+                  (-upsilon * (*state_vars)[DeltaPhi] /
+                   (1 + 2 * (*state_vars)[DeltaPhi] *
+                            (*state_vars)[BulkModulus])) -
               1;
 }
 
@@ -477,14 +470,14 @@ void mpm::ModifiedCamClay<Tdim>::compute_df_dsigma(
     const mpm::dense_map* state_vars, const Vector6d& stress,
     Vector6d* df_dsigma) {
   // Get stress invariants
-  const double p = (*state_vars).at("p");
-  const double q = (*state_vars).at("q");
-  const double theta = (*state_vars).at("theta");
+  const double p = (*state_vars)[P];
+  const double q = (*state_vars)[Q];
+  const double theta = (*state_vars)[Theta];
   // Get MCC parameters
-  const double m_theta = (*state_vars).at("m_theta");
-  const double pc = (*state_vars).at("pc");
-  const double pcc = (*state_vars).at("pcc");
-  const double pcd = (*state_vars).at("pcd");
+  const double m_theta = (*state_vars)[MTheta];
+  const double pc = (*state_vars)[Pc];
+  const double pcc = (*state_vars)[Pcc];
+  const double pcd = (*state_vars)[Pcd];
   // Compute the deviatoric stress
   Vector6d dev_stress = stress;
   for (unsigned i = 0; i < 3; ++i) dev_stress(i) += p;
@@ -527,7 +520,7 @@ Eigen::Matrix<double, 6, 1> mpm::ModifiedCamClay<Tdim>::compute_stress(
   // Maximum subiteration step number
   const int substep = 100;
   // Compute current mean pressure
-  (*state_vars).at("p") = -(stress(0) + stress(1) + stress(2)) / 3.;
+  (*state_vars)[P] = -(stress(0) + stress(1) + stress(2)) / 3.;
   // Set elastic tensor
   this->compute_elastic_tensor(state_vars);
   //-------------------------------------------------------------------------
@@ -541,18 +534,18 @@ Eigen::Matrix<double, 6, 1> mpm::ModifiedCamClay<Tdim>::compute_stress(
   // Compute deviatoric stress tensor
   n_trial = this->compute_deviatoric_stress_tensor(trial_stress, state_vars);
   // Bonding parameter of last step
-  const double chi_n = (*state_vars).at("chi");
+  const double chi_n = (*state_vars)[Chi];
   // Compute bonding parameters
   if (bonding_) this->compute_bonding_parameters(chi_n, state_vars);
   // Subloading parameter of last step
-  const double subloading_r = (*state_vars).at("subloading_r");
+  const double subloading_r = (*state_vars)[SubloadingR];
   // Compute subloading parameters
   if (subloading_)
     this->compute_subloading_parameters(subloading_r, state_vars);
   // Update Mtheta
   if (three_invariants_)
-    (*state_vars).at("m_theta") =
-        m_ - std::pow(m_, 2) / (3 + m_) * cos(1.5 * (*state_vars).at("theta"));
+    (*state_vars)[MTheta] =
+        m_ - std::pow(m_, 2) / (3 + m_) * cos(1.5 * (*state_vars)[Theta]);
   // Check yield status
   auto yield_type = this->compute_yield_state(state_vars);
   // Return the updated stress in elastic state
@@ -563,28 +556,28 @@ Eigen::Matrix<double, 6, 1> mpm::ModifiedCamClay<Tdim>::compute_stress(
   int counter_f = 0;
   int counter_g = 0;
   // Initialise consistency parameter
-  (*state_vars).at("delta_phi") = 0.;
+  (*state_vars)[DeltaPhi] = 0.;
   // Volumetric trial stress
-  const double p_trial = (*state_vars).at("p");
+  const double p_trial = (*state_vars)[P];
   // Deviatoric trial stress
-  const double q_trial = (*state_vars).at("q");
+  const double q_trial = (*state_vars)[Q];
   // M_theta of trial stress
-  const double m_theta_trial = (*state_vars).at("m_theta");
+  const double m_theta_trial = (*state_vars)[MTheta];
   // Preconsolidation pressure of last step
-  const double pc_n = (*state_vars).at("pc");
+  const double pc_n = (*state_vars)[Pc];
   // Initialise dF / dmul
   double df_dmul = 0;
   // Initialise updated stress
   Vector6d updated_stress = trial_stress;
   // Iteration for consistency parameter
-  while (std::fabs((*state_vars).at("f_function")) > Ftolerance &&
+  while (std::fabs((*state_vars)[FFunction]) > Ftolerance &&
          counter_f < itrstep) {
     // Get back the m_theta of trial_stress
-    (*state_vars).at("m_theta") = m_theta_trial;
+    (*state_vars)[MTheta] = m_theta_trial;
     // Compute dF / dmul
     this->compute_df_dmul(state_vars, &df_dmul);
     // Update consistency parameter
-    (*state_vars).at("delta_phi") -= ((*state_vars).at("f_function") / df_dmul);
+    (*state_vars)[DeltaPhi] -= ((*state_vars)[FFunction] / df_dmul);
     // Initialise G and dG / dpc
     double g_function = 0;
     double dg_dpc = 0;
@@ -593,34 +586,34 @@ Eigen::Matrix<double, 6, 1> mpm::ModifiedCamClay<Tdim>::compute_stress(
     // Subiteraction for preconsolidation pressure
     while (std::fabs(g_function) > Gtolerance && counter_g < substep) {
       // Update preconsolidation pressure
-      (*state_vars).at("pc") -= g_function / dg_dpc;
+      (*state_vars)[Pc] -= g_function / dg_dpc;
       // Update G and dG / dpc
       this->compute_dg_dpc(state_vars, pc_n, p_trial, &g_function, &dg_dpc);
       // Counter subiteration step
       ++counter_g;
     }
     // Update mean pressure p
-    (*state_vars).at("p") =
-        (p_trial + (*state_vars).at("bulk_modulus") *
-                       (*state_vars).at("delta_phi") * (*state_vars).at("pc")) /
+    (*state_vars)[P] =
+        (p_trial + (*state_vars)[BulkModulus] *
+                       (*state_vars)[DeltaPhi] * (*state_vars)[Pc]) /
         (1 +
-         2 * (*state_vars).at("bulk_modulus") * (*state_vars).at("delta_phi"));
+         2 * (*state_vars)[BulkModulus] * (*state_vars)[DeltaPhi]);
     // Update deviatoric stress q
     // Equation(3.10b)
-    (*state_vars).at("q") =
-        q_trial / (1 + 6 * (*state_vars).at("shear_modulus") *
-                           (*state_vars).at("delta_phi") /
-                           std::pow((*state_vars).at("m_theta"), 2));
+    (*state_vars)[Q] =
+        q_trial / (1 + 6 * (*state_vars)[ShearModulus] *
+                           (*state_vars)[DeltaPhi] /
+                           std::pow((*state_vars)[MTheta], 2));
     // Compute incremental plastic volumetic strain
     // Equation(2.8)
-    (*state_vars).at("dpvstrain") =
-        (*state_vars).at("delta_phi") *
-        (2 * (*state_vars).at("p") - (*state_vars).at("pc") -
-         (*state_vars).at("pcd"));
+    (*state_vars)[DPVStrain] =
+        (*state_vars)[DeltaPhi] *
+        (2 * (*state_vars)[P] - (*state_vars)[Pc] -
+         (*state_vars)[Pcd]);
     // Compute plastic deviatoric strain
-    (*state_vars).at("dpdstrain") = (*state_vars).at("delta_phi") *
-                                    (std::sqrt(6) * (*state_vars).at("q") /
-                                     std::pow((*state_vars).at("m_theta"), 2));
+    (*state_vars)[DPDStrain] = (*state_vars)[DeltaPhi] *
+                                    (std::sqrt(6) * (*state_vars)[Q] /
+                                     std::pow((*state_vars)[MTheta], 2));
     // Update bonding parameters
     if (bonding_) this->compute_bonding_parameters(chi_n, state_vars);
     // Compute subloading parameters
@@ -630,17 +623,16 @@ Eigen::Matrix<double, 6, 1> mpm::ModifiedCamClay<Tdim>::compute_stress(
     if (three_invariants_) {
       // Update stress
       // Type-1 Equation(3.16)
-      updated_stress = (*state_vars).at("q") * n_trial;
-      for (int i = 0; i < 3; ++i) updated_stress(i) -= (*state_vars).at("p");
+      updated_stress = (*state_vars)[Q] * n_trial;
+      for (int i = 0; i < 3; ++i) updated_stress(i) -= (*state_vars)[P];
       // Compute stress invariants
       this->compute_stress_invariants(updated_stress, state_vars);
       // Compute deviatoric stress tensor
       n_trial =
           this->compute_deviatoric_stress_tensor(trial_stress, state_vars);
       // Update Mtheta
-      (*state_vars).at("m_theta") =
-          m_ -
-          std::pow(m_, 2) / (3 + m_) * cos(1.5 * (*state_vars).at("theta"));
+      (*state_vars)[MTheta] =
+          m_ - std::pow(m_, 2) / (3 + m_) * cos(1.5 * (*state_vars)[Theta]);
     }
     // Update yield function
     yield_type = this->compute_yield_state(state_vars);
@@ -648,13 +640,13 @@ Eigen::Matrix<double, 6, 1> mpm::ModifiedCamClay<Tdim>::compute_stress(
     ++counter_f;
   }
   // Update plastic strain
-  (*state_vars).at("pvstrain") += (*state_vars).at("dpvstrain");
-  (*state_vars).at("pdstrain") += (*state_vars).at("dpdstrain");
+  (*state_vars)[PVStrain] += (*state_vars)[DPVStrain];
+  (*state_vars)[PDStrain] += (*state_vars)[DPDStrain];
   // Update stress
-  updated_stress = (*state_vars).at("q") * n_trial;
-  for (int i = 0; i < 3; ++i) updated_stress(i) -= (*state_vars).at("p");
+  updated_stress = (*state_vars)[Q] * n_trial;
+  for (int i = 0; i < 3; ++i) updated_stress(i) -= (*state_vars)[P];
   // Update void_ratio
-  (*state_vars).at("void_ratio") +=
+  (*state_vars)[VoidRatio] +=
       ((dstrain(0) + dstrain(1) + dstrain(2)) * (1 + e0_));
 
   return updated_stress;
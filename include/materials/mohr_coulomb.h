@@ -27,6 +27,19 @@ class MohrCoulomb : public Material<Tdim> {
   using Vector6d = Eigen::Matrix<double, 6, 1>;
   //! Define a Matrix of 6 x 6
   using Matrix6x6 = Eigen::Matrix<double, 6, 6>;
+  //! Define a Matrix of 6 x n, one column per particle
+  using Matrix6X = Eigen::Matrix<double, 6, Eigen::Dynamic>;
+
+  //! State variable indices in the order of state_variables()
+  enum StateVariable : unsigned {
+    Phi,
+    Psi,
+    Cohesion,
+    Epsilon,
+    Rho,
+    Theta,
+    PDStrain
+  };
 
   //! Constructor with id and material properties
   //! \param[in] material_properties Material properties
@@ -58,6 +71,16 @@ class MohrCoulomb : public Material<Tdim> {
                           const ParticleBase<Tdim>* ptr,
                           mpm::dense_map* state_vars) override;
 
+  //! Compute stress of a batch of particles
+  //! \param[in] ptrs Constant pointers to the particles of the batch
+  //! \param[in] dstrains Strain increments, one column per particle
+  //! \param[in] state_vars History-dependent state variables per particle
+  //! \param[in,out] stresses Stresses, one column per particle
+  void compute_stress_batch(const std::vector<const ParticleBase<Tdim>*>& ptrs,
+                            const Matrix6X& dstrains,
+                            const std::vector<mpm::dense_map*>& state_vars,
+                            Matrix6X* stresses) override;
+
   //! Compute stress invariants (j2, j3, rho, theta, and epsilon)
   //! \param[in] stress Stress
   //! \param[in] state_vars History-dependent state variables
@@ -97,6 +120,17 @@ class MohrCoulomb : public Material<Tdim> {
   //! Compute elastic tensor
   bool compute_elastic_tensor();
 
+  //! Compute stress from the trial stress of the elastic predictor
+  //! \param[in] stress Stress
+  //! \param[in] dstrain Strain
+  //! \param[in] trial_stress Trial stress of the elastic predictor
+  //! \param[in] state_vars History-dependent state variables
+  //! \retval updated_stress Updated value of stress
+  Vector6d compute_corrected_stress(const Vector6d& stress,
+                                    const Vector6d& dstrain,
+                                    const Vector6d& trial_stress,
+                                    mpm::dense_map* state_vars);
+
   //! Elastic stiffness matrix
   Matrix6x6 de_;
   //! Density
@@ -55,22 +55,23 @@ mpm::MohrCoulomb<Tdim>::MohrCoulomb(unsigned id,
 //! Initialise state variables
 template <unsigned Tdim>
 mpm::dense_map mpm::MohrCoulomb<Tdim>::initialise_state_variables() {
-  mpm::dense_map state_vars = {// MC parameters
-                               // Friction (phi)
-                               {"phi", this->phi_peak_},
-                               // Dilation (psi)
-                               {"psi", this->psi_peak_},
-                               // Cohesion
-                               {"cohesion", this->cohesion_peak_},
-                               // Stress invariants
-                               // Epsilon
-                               {"epsilon", 0.},
-                               // Rho
-                               {"rho", 0.},
-                               // Theta
-                               {"theta", 0.},
-                               // Plastic deviatoric strain
-                               {"pdstrain", 0.}};
+  mpm::dense_map state_vars = this->zero_state_variables();
+  // MC parameters
+  // Friction (phi)
+  state_vars[Phi] = this->phi_peak_;
+  // Dilation (psi)
+  state_vars[Psi] = this->psi_peak_;
+  // Cohesion
+  state_vars[Cohesion] = this->cohesion_peak_;
+  // Stress invariants
+  // Epsilon
+  state_vars[Epsilon] = 0.;
+  // Rho
+  state_vars[Rho] = 0.;
+  // Theta
+  state_vars[Theta] = 0.;
+  // Plastic deviatoric strain
+  state_vars[PDStrain] = 0.;
   return state_vars;
 }
 
@@ -107,11 +108,11 @@ template <unsigned Tdim>
 bool mpm::MohrCoulomb<Tdim>::compute_stress_invariants(
     const Vector6d& stress, mpm::dense_map* state_vars) {
   // Compute the mean pressure
-  (*state_vars).at("epsilon") = mpm::materials::p(stress) * std::sqrt(3.);
+  (*state_vars)[Epsilon] = mpm::materials::p(stress) * std::sqrt(3.);
   // Compute theta value
-  (*state_vars).at("theta") = mpm::materials::lode_angle(stress);
+  (*state_vars)[Theta] = mpm::materials::lode_angle(stress);
   // Compute rho
-  (*state_vars).at("rho") = std::sqrt(2. * mpm::materials::j2(stress));
+  (*state_vars)[Rho] = std::sqrt(2. * mpm::materials::j2(stress));
 
   return true;
 }
@@ -125,12 +126,12 @@ typename mpm::mohrcoulomb::FailureState
   // Tolerance for yield function
   const double Tolerance = -1E-1;
   // Get stress invariants
-  const double epsilon = state_vars.at("epsilon");
-  const double rho = state_vars.at("rho");
-  const double theta = state_vars.at("theta");
+  const double epsilon = state_vars[Epsilon];
+  const double rho = state_vars[Rho];
+  const double theta = state_vars[Theta];
   // Get MC parameters
-  const double phi = state_vars.at("phi");
-  const double cohesion = state_vars.at("cohesion");
+  const double phi = state_vars[Phi];
+  const double cohesion = state_vars[Cohesion];
   // Compute yield functions (tension & shear)
   // Tension
   (*yield_function)(0) = std::sqrt(2. / 3.) * cos(theta) * rho +
@@ -179,13 +180,13 @@ void mpm::MohrCoulomb<Tdim>::compute_df_dp(
     const Vector6d& stress, Vector6d* df_dsigma, Vector6d* dp_dsigma,
     double* dp_dq, double* softening) {
   // Get stress invariants
-  const double rho = (*state_vars).at("rho");
-  const double theta = (*state_vars).at("theta");
+  const double rho = (*state_vars)[Rho];
+  const double theta = (*state_vars)[Theta];
   // Get MC parameters
-  const double phi = (*state_vars).at("phi");
-  const double psi = (*state_vars).at("psi");
+  const double phi = (*state_vars)[Phi];
+  const double psi = (*state_vars)[Psi];
   // Get equivalent plastic deviatoric strain
-  const double pdstrain = (*state_vars).at("pdstrain");
+  const double pdstrain = (*state_vars)[PDStrain];
   // Compute dF / dEpsilon,  dF / dRho, dF / dTheta
   double df_depsilon, df_drho, df_dtheta;
   // Values in tension yield
@@ -329,32 +330,57 @@ template <unsigned Tdim>
 Eigen::Matrix<double, 6, 1> mpm::MohrCoulomb<Tdim>::compute_stress(
     const Vector6d& stress, const Vector6d& dstrain,
     const ParticleBase<Tdim>* ptr, mpm::dense_map* state_vars) {
+  // Elastic-predictor stage: compute the trial stress
+  const Vector6d trial_stress = stress + (this->de_ * dstrain);
+  return this->compute_corrected_stress(stress, dstrain, trial_stress,
+                                        state_vars);
+}
+
+//! Compute stress of a batch of particles
+template <unsigned Tdim>
+void mpm::MohrCoulomb<Tdim>::compute_stress_batch(
+    const std::vector<const ParticleBase<Tdim>*>& ptrs,
+    const Matrix6X& dstrains, const std::vector<mpm::dense_map*>& state_vars,
+    Matrix6X* stresses) {
+  // Elastic-predictor stage: compute the trial stresses of the batch
+  const Matrix6X trial_stresses = (*stresses) + this->de_ * dstrains;
+  // Plastic-corrector stage of each particle
+  for (unsigned i = 0; i < ptrs.size(); ++i) {
+    const Vector6d stress = stresses->col(i);
+    stresses->col(i) = this->compute_corrected_stress(
+        stress, dstrains.col(i), trial_stresses.col(i), state_vars[i]);
+  }
+}
+
+//! Compute stress from the trial stress of the elastic predictor
+template <unsigned Tdim>
+Eigen::Matrix<double, 6, 1> mpm::MohrCoulomb<Tdim>::compute_corrected_stress(
+    const Vector6d& stress, const Vector6d& dstrain,
+    const Vector6d& trial_stress, mpm::dense_map* state_vars) {
   // Get equivalent plastic deviatoric strain
-  const double pdstrain = (*state_vars).at("pdstrain");
+  const double pdstrain = (*state_vars)[PDStrain];
   // Update MC parameters using a linear softening rule
   if (softening_ && pdstrain > pdstrain_peak_) {
     if (pdstrain < pdstrain_residual_) {
-      (*state_vars).at("phi") =
+      (*state_vars)[Phi] =
           phi_residual_ +
           ((phi_peak_ - phi_residual_) * (pdstrain - pdstrain_residual_) /
            (pdstrain_peak_ - pdstrain_residual_));
-      (*state_vars).at("psi") =
+      (*state_vars)[Psi] =
           psi_residual_ +
           ((psi_peak_ - psi_residual_) * (pdstrain - pdstrain_residual_) /
            (pdstrain_peak_ - pdstrain_residual_));
-      (*state_vars).at("cohesion") =
+      (*state_vars)[Cohesion] =
           cohesion_residual_ + ((cohesion_peak_ - cohesion_residual_) *
                                 (pdstrain - pdstrain_residual_) /
                                 (pdstrain_peak_ - pdstrain_residual_));
     } else {
-      (*state_vars).at("phi") = phi_residual_;
-      (*state_vars).at("psi") = psi_residual_;
-      (*state_vars).at("cohesion") = cohesion_residual_;
+      (*state_vars)[Phi] = phi_residual_;
+      (*state_vars)[Psi] = psi_residual_;
+      (*state_vars)[Cohesion] = cohesion_residual_;
     }
   }
   //-------------------------------------------------------------------------
-  // Elastic-predictor stage: compute the trial stress
-  Vector6d trial_stress = stress + (this->de_ * dstrain);
   // Compute stress invariants based on trial stress
   this->compute_stress_invariants(trial_stress, state_vars);
   // Compute yield function based on the trial stress
@@ -459,7 +485,7 @@ Eigen::Matrix<double, 6, 1> mpm::MohrCoulomb<Tdim>::compute_stress(
   // Compute stress invariants based on updated stress
   this->compute_stress_invariants(updated_stress, state_vars);
   // Update plastic deviatoric strain
-  (*state_vars).at("pdstrain") += dpdstrain;
+  (*state_vars)[PDStrain] += dpdstrain;
 
   return updated_stress;
 }
@@ -26,7 +26,8 @@ mpm::Newtonian<Tdim>::Newtonian(unsigned id, const Json& material_properties)
 //! Initialise history variables
 template <unsigned Tdim>
 mpm::dense_map mpm::Newtonian<Tdim>::initialise_state_variables() {
-  mpm::dense_map state_vars = {{"pressure", 0.0}};
+  mpm::dense_map state_vars = this->zero_state_variables();
+  state_vars[Pressure] = 0.0;
   return state_vars;
 }
 
@@ -56,14 +57,14 @@ Eigen::Matrix<double, 6, 1> mpm::Newtonian<2>::compute_stress(
   const double volumetric_strain_rate = strain_rate(0) + strain_rate(1);
 
   // Update pressure
-  (*state_vars).at("pressure") +=
+  (*state_vars)[Pressure] +=
       (compressibility_multiplier_ *
        this->thermodynamic_pressure(ptr->dvolumetric_strain()));
 
   // Volumetric stress component
   const double volumetric_component =
       compressibility_multiplier_ *
-      (-(*state_vars).at("pressure") -
+      (-(*state_vars)[Pressure] -
        (2. * dynamic_viscosity_ * volumetric_strain_rate / 3.));
 
   // Update stress component
@@ -90,14 +91,14 @@ Eigen::Matrix<double, 6, 1> mpm::Newtonian<3>::compute_stress(
       strain_rate(0) + strain_rate(1) + strain_rate(2);
 
   // Update pressure
-  (*state_vars).at("pressure") +=
+  (*state_vars)[Pressure] +=
       (compressibility_multiplier_ *
        this->thermodynamic_pressure(ptr->dvolumetric_strain()));
 
   // Volumetric stress component
   const double volumetric_component =
       compressibility_multiplier_ *
-      (-(*state_vars).at("pressure") -
+      (-(*state_vars)[Pressure] -
        (2. * dynamic_viscosity_ * volumetric_strain_rate / 3.));
 
   // Update stress component
@@ -111,3 +112,39 @@ Eigen::Matrix<double, 6, 1> mpm::Newtonian<3>::compute_stress(
 
   return pstress;
 }
+
+//! Compute stress of a batch of particles
+template <unsigned Tdim>
+void mpm::Newtonian<Tdim>::compute_stress_batch(
+    const std::vector<const ParticleBase<Tdim>*>& ptrs,
+    const Matrix6X& dstrains, const std::vector<mpm::dense_map*>& state_vars,
+    Matrix6X* stresses) {
+  // Number of shear components
+  const unsigned nshear = Tdim * (Tdim - 1) / 2;
+  const unsigned nparticles = ptrs.size();
+
+  // Gather strain rates and update pressures
+  Matrix6X strain_rates(6, nparticles);
+  Eigen::RowVectorXd pressures(nparticles);
+  for (unsigned i = 0; i < nparticles; ++i) {
+    strain_rates.col(i) = ptrs[i]->strain_rate();
+    (*state_vars[i])[Pressure] +=
+        (compressibility_multiplier_ *
+         this->thermodynamic_pressure(ptrs[i]->dvolumetric_strain()));
+    pressures(i) = (*state_vars[i])[Pressure];
+  }
+
+  // Volumetric stress components
+  const Eigen::RowVectorXd volumetric_components =
+      compressibility_multiplier_ *
+      (-pressures - (2. * dynamic_viscosity_ *
+                     strain_rates.topRows(Tdim).colwise().sum() / 3.));
+
+  // Update stress components
+  stresses->setZero();
+  stresses->topRows(3).rowwise() += volumetric_components;
+  stresses->topRows(Tdim) +=
+      2. * dynamic_viscosity_ * strain_rates.topRows(Tdim);
+  stresses->middleRows(3, nshear) =
+      dynamic_viscosity_ * strain_rates.middleRows(3, nshear);
+}
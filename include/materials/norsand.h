@@ -26,6 +26,23 @@ class NorSand : public Material<Tdim> {
   //! Define a Matrix of 6 x 6
   using Matrix6x6 = Eigen::Matrix<double, 6, 6>;
 
+  //! State variable indices in the order of state_variables()
+  enum StateVariable : unsigned {
+    MTheta,
+    VoidRatio,
+    EImage,
+    PImage,
+    PCohesion,
+    PDilation,
+    PDStrain,
+    PlasticStrain0,
+    PlasticStrain1,
+    PlasticStrain2,
+    PlasticStrain3,
+    PlasticStrain4,
+    PlasticStrain5
+  };
+
   //! Constructor with id and material properties
   //! \param[in] material_properties Material properties
   NorSand(unsigned id, const Json& material_properties);
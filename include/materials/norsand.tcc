@@ -73,29 +73,29 @@ mpm::NorSand<Tdim>::NorSand(unsigned id, const Json& material_properties)
 //! Initialise state variables
 template <unsigned Tdim>
 mpm::dense_map mpm::NorSand<Tdim>::initialise_state_variables() {
-  mpm::dense_map state_vars = {
-      // M_theta
-      {"M_theta", Mtc_},
-      // Current void ratio
-      {"void_ratio", void_ratio_initial_},
-      // Void ratio image
-      {"e_image",
-       gamma_ - lambda_ * log(p_image_initial_ / reference_pressure_)},
-      // Image pressure
-      {"p_image", p_image_initial_},
-      // p_cohesion
-      {"p_cohesion", p_cohesion_initial_},
-      // p_dilation
-      {"p_dilation", p_dilation_initial_},
-      // Equivalent plastic deviatoric strain
-      {"pdstrain", 0.},
-      // Plastic strain components
-      {"plastic_strain0", 0.},
-      {"plastic_strain1", 0.},
-      {"plastic_strain2", 0.},
-      {"plastic_strain3", 0.},
-      {"plastic_strain4", 0.},
-      {"plastic_strain5", 0.}};
+  mpm::dense_map state_vars = this->zero_state_variables();
+  // M_theta
+  state_vars[MTheta] = Mtc_;
+  // Current void ratio
+  state_vars[VoidRatio] = void_ratio_initial_;
+  // Void ratio image
+  state_vars[EImage] =
+      gamma_ - lambda_ * log(p_image_initial_ / reference_pressure_);
+  // Image pressure
+  state_vars[PImage] = p_image_initial_;
+  // p_cohesion
+  state_vars[PCohesion] = p_cohesion_initial_;
+  // p_dilation
+  state_vars[PDilation] = p_dilation_initial_;
+  // Equivalent plastic deviatoric strain
+  state_vars[PDStrain] = 0.;
+  // Plastic strain components
+  state_vars[PlasticStrain0] = 0.;
+  state_vars[PlasticStrain1] = 0.;
+  state_vars[PlasticStrain2] = 0.;
+  state_vars[PlasticStrain3] = 0.;
+  state_vars[PlasticStrain4] = 0.;
+  state_vars[PlasticStrain5] = 0.;
 
   return state_vars;
 }
@@ -171,16 +171,16 @@ void mpm::NorSand<Tdim>::compute_state_variables(
                                   &mtheta);
 
   // Get state variables (note that M_theta used is at current stress)
-  const double M_theta = (*state_vars).at("M_theta");
-  const double p_cohesion = (*state_vars).at("p_cohesion");
-  const double p_dilation = (*state_vars).at("p_dilation");
+  const double M_theta = (*state_vars)[MTheta];
+  const double p_cohesion = (*state_vars)[PCohesion];
+  const double p_dilation = (*state_vars)[PDilation];
   double p_image;
   double e_image;
 
   if (yield_type == mpm::norsand::FailureState::Elastic) {
     // Keep the same pressure image and void ratio image at critical state
-    p_image = (*state_vars).at("p_image");
-    e_image = (*state_vars).at("e_image");
+    p_image = (*state_vars)[PImage];
+    e_image = (*state_vars)[EImage];
   } else {
     // Compute and update pressure image
     p_image =
@@ -190,23 +190,23 @@ void mpm::NorSand<Tdim>::compute_state_variables(
                  (1 - N_)),
                 ((N_ - 1) / N_)) -
         p_cohesion - p_dilation;
-    (*state_vars).at("p_image") = p_image;
+    (*state_vars)[PImage] = p_image;
 
     // Compute and update void ratio image
     // e_image = e_max_ - (e_max_ - e_min_) / log(crushing_pressure_ / p_image);
     e_image = check_low(gamma_ - lambda_ * log(p_image / reference_pressure_));
 
-    (*state_vars).at("e_image") = e_image;
+    (*state_vars)[EImage] = e_image;
   }
 
   // Update M_theta at the updated stress state
-  (*state_vars).at("M_theta") = mtheta;
+  (*state_vars)[MTheta] = mtheta;
 
   // Update void ratio
   // Note that dstrain is in tension positive - depsv = de / (1 + e_initial)
   double dvolumetric_strain = dstrain(0) + dstrain(1) + dstrain(2);
-  (*state_vars).at("void_ratio") =
-      check_low((*state_vars).at("void_ratio") -
+  (*state_vars)[VoidRatio] =
+      check_low((*state_vars)[VoidRatio] -
                 (1 + void_ratio_initial_) * dvolumetric_strain);
 }
 
@@ -215,22 +215,22 @@ template <unsigned Tdim>
 void mpm::NorSand<Tdim>::compute_p_bond(mpm::dense_map* state_vars) {
 
   // Compute current zeta cohesion
-  double zeta_cohesion = exp(-m_cohesion_ * (*state_vars).at("pdstrain"));
+  double zeta_cohesion = exp(-m_cohesion_ * (*state_vars)[PDStrain]);
   zeta_cohesion = check_one(zeta_cohesion);
   zeta_cohesion = check_low(zeta_cohesion);
 
   // Update p_cohesion
   double p_cohesion = p_cohesion_initial_ * zeta_cohesion;
-  (*state_vars).at("p_cohesion") = p_cohesion;
+  (*state_vars)[PCohesion] = p_cohesion;
 
   // Compute current zeta dilation
-  double zeta_dilation = exp(-m_dilation_ * (*state_vars).at("pdstrain"));
+  double zeta_dilation = exp(-m_dilation_ * (*state_vars)[PDStrain]);
   zeta_dilation = check_one(zeta_dilation);
   zeta_dilation = check_low(zeta_dilation);
 
   // Update p_dilation
   double p_dilation = p_dilation_initial_ * zeta_dilation;
-  (*state_vars).at("p_dilation") = p_dilation;
+  (*state_vars)[PDilation] = p_dilation;
 }
 
 //! Compute yield function and yield state
@@ -250,10 +250,10 @@ typename mpm::norsand::FailureState mpm::NorSand<Tdim>::compute_yield_state(
                                   &mtheta);
 
   // Get state variables
-  const double p_image = (*state_vars).at("p_image");
-  const double M_theta = (*state_vars).at("M_theta");
-  const double p_cohesion = (*state_vars).at("p_cohesion");
-  const double p_dilation = (*state_vars).at("p_dilation");
+  const double p_image = (*state_vars)[PImage];
+  const double M_theta = (*state_vars)[MTheta];
+  const double p_cohesion = (*state_vars)[PCohesion];
+  const double p_dilation = (*state_vars)[PDilation];
 
   // Initialise yield status (Elastic, Yield)
   auto yield_type = mpm::norsand::FailureState::Elastic;
@@ -291,12 +291,12 @@ void mpm::NorSand<Tdim>::compute_plastic_tensor(const Vector6d& stress,
                                   &mtheta);
 
   // Get state variables
-  const double M_theta = (*state_vars).at("M_theta");
-  const double p_image = (*state_vars).at("p_image");
-  const double e_image = (*state_vars).at("e_image");
-  const double void_ratio = (*state_vars).at("void_ratio");
-  const double p_cohesion = (*state_vars).at("p_cohesion");
-  const double p_dilation = (*state_vars).at("p_dilation");
+  const double M_theta = (*state_vars)[MTheta];
+  const double p_image = (*state_vars)[PImage];
+  const double e_image = (*state_vars)[EImage];
+  const double void_ratio = (*state_vars)[VoidRatio];
+  const double p_cohesion = (*state_vars)[PCohesion];
+  const double p_dilation = (*state_vars)[PDilation];
 
   // Estimate dilatancy at peak
   const double D_min = chi_ * (void_ratio - e_image);
@@ -378,7 +378,7 @@ void mpm::NorSand<Tdim>::compute_plastic_tensor(const Vector6d& stress,
 
     const double dpcohesion_depsd =
         -p_cohesion_initial_ * m_cohesion_ *
-        exp(-m_cohesion_ * (*state_vars).at("pdstrain"));
+        exp(-m_cohesion_ * (*state_vars)[PDStrain]);
 
     // Derivatives in respect to p_dilation
     const double dF_dpdilation =
@@ -388,7 +388,7 @@ void mpm::NorSand<Tdim>::compute_plastic_tensor(const Vector6d& stress,
 
     const double dpdilation_depsd =
         -p_dilation_initial_ * m_dilation_ *
-        exp(-m_dilation_ * (*state_vars).at("pdstrain"));
+        exp(-m_dilation_ * (*state_vars)[PDStrain]);
 
     hardening_term = dF_dpi * dpi_depsd * dF_dsigma_deviatoric +
                      dF_dpcohesion * dpcohesion_depsd * dF_dsigma_deviatoric +
@@ -417,9 +417,9 @@ Eigen::Matrix<double, 6, 1> mpm::NorSand<Tdim>::compute_stress(
 
   // Elastic step
   // Bulk modulus computation
-  bulk_modulus_ = (1. + (*state_vars).at("void_ratio")) / kappa_ * mean_p +
-                  m_modulus_ * ((*state_vars).at("p_cohesion") +
-                                (*state_vars).at("p_dilation"));
+  bulk_modulus_ = (1. + (*state_vars)[VoidRatio]) / kappa_ * mean_p +
+                  m_modulus_ * ((*state_vars)[PCohesion] +
+                                (*state_vars)[PDilation]);
   // Shear modulus computation
   shear_modulus_ = 3. * bulk_modulus_ * (1. - 2. * poisson_ratio_) /
                    (2.0 * (1. + poisson_ratio_));
@@ -469,23 +469,23 @@ Eigen::Matrix<double, 6, 1> mpm::NorSand<Tdim>::compute_stress(
   if (Tdim == 2) dpstrain(4) = dpstrain(5) = 0.;
 
   // Update plastic strain
-  (*state_vars).at("plastic_strain0") += dpstrain(0);
-  (*state_vars).at("plastic_strain1") += dpstrain(1);
-  (*state_vars).at("plastic_strain2") += dpstrain(2);
-  (*state_vars).at("plastic_strain3") += dpstrain(3);
-  (*state_vars).at("plastic_strain4") += dpstrain(4);
-  (*state_vars).at("plastic_strain5") += dpstrain(5);
+  (*state_vars)[PlasticStrain0] += dpstrain(0);
+  (*state_vars)[PlasticStrain1] += dpstrain(1);
+  (*state_vars)[PlasticStrain2] += dpstrain(2);
+  (*state_vars)[PlasticStrain3] += dpstrain(3);
+  (*state_vars)[PlasticStrain4] += dpstrain(4);
+  (*state_vars)[PlasticStrain5] += dpstrain(5);
 
   Vector6d plastic_strain;
-  plastic_strain(0) = (*state_vars).at("plastic_strain0");
-  plastic_strain(1) = (*state_vars).at("plastic_strain1");
-  plastic_strain(2) = (*state_vars).at("plastic_strain2");
-  plastic_strain(3) = (*state_vars).at("plastic_strain3");
-  plastic_strain(4) = (*state_vars).at("plastic_strain4");
-  plastic_strain(5) = (*state_vars).at("plastic_strain5");
+  plastic_strain(0) = (*state_vars)[PlasticStrain0];
+  plastic_strain(1) = (*state_vars)[PlasticStrain1];
+  plastic_strain(2) = (*state_vars)[PlasticStrain2];
+  plastic_strain(3) = (*state_vars)[PlasticStrain3];
+  plastic_strain(4) = (*state_vars)[PlasticStrain4];
+  plastic_strain(5) = (*state_vars)[PlasticStrain5];
 
   // Update equivalent plastic deviatoric strain
-  (*state_vars).at("pdstrain") = mpm::materials::pdstrain(plastic_strain);
+  (*state_vars)[PDStrain] = mpm::materials::pdstrain(plastic_strain);
 
   // Update p_cohesion
   this->compute_p_bond(state_vars);
@@ -3,9 +3,14 @@
 
 #include <algorithm>
 #include <array>
+#include <chrono>
+#include <cmath>
+#include <cstring>
 #include <limits>
+#include <map>
 #include <memory>
 #include <numeric>
+#include <set>
 #include <vector>
 
 // Eigen
@@ -20,6 +25,7 @@
 #endif
 // TSL Maps
 #include <tsl/robin_map.h>
+#include <tsl/robin_set.h>
 // JSON
 #include "json.hpp"
 using Json = nlohmann::json;
@@ -35,10 +41,13 @@ using Json = nlohmann::json;
 #include "io_mesh.h"
 #include "logger.h"
 #include "material.h"
+#include "morton.h"
 #include "nodal_properties.h"
 #include "node.h"
+#include "node_store.h"
 #include "particle.h"
 #include "particle_base.h"
+#include "particle_store.h"
 #include "traction.h"
 #include "vector.h"
 #include "velocity_constraint.h"
@@ -133,16 +142,65 @@ class Mesh {
   template <typename Toper>
   void iterate_over_active_nodes(Toper oper);
 
+  //! Initialise all nodes and clear the active nodes of the last step
+  //! \details The node store is reset in bulk, the state held by a node
+  //! itself is reset only for the active and shared nodes of the last step,
+  //! which are the nodes it is updated on. Before the first list of active
+  //! nodes is built, every node is reset.
+  void initialise_nodes();
+
+  //! Compute velocity from momentum of active nodes
+  void compute_nodal_velocity();
+
+  //! Compute acceleration and velocity of active nodes
+  //! \param[in] phase Index corresponding to the phase
+  //! \param[in] dt Timestep in analysis
+  void compute_nodal_acceleration_velocity(unsigned phase, double dt);
+
+  //! Compute acceleration and velocity with cundall damping factor of active
+  //! nodes
+  //! \param[in] phase Index corresponding to the phase
+  //! \param[in] dt Timestep in analysis
+  //! \param[in] damping_factor Damping factor
+  void compute_nodal_acceleration_velocity_cundall(unsigned phase, double dt,
+                                                   double damping_factor);
+
+  //! Return the number of active nodes
+  mpm::Index nactive_nodes() const { return active_nodes_.size(); }
+
 #ifdef USE_MPI
-  //! All reduce over nodal property
+  //! Sum nodal property over the MPI ranks sharing a node
+  //! Values are only exchanged with neighbour ranks that share nodes; several
+  //! properties can be exchanged in a single message by packing them in Ttype
   //! \tparam Ttype Type of property to accumulate
   //! \tparam Tnparam Size of individual property
   //! \tparam Tgetfunctor Functor for getter
   //! \tparam Tsetfunctor Functor for setter
   //! \param[in] getter Getter function
+  //! \param[in] setter Setter function
   template <typename Ttype, unsigned Tnparam, typename Tgetfunctor,
             typename Tsetfunctor>
   void nodal_halo_exchange(Tgetfunctor getter, Tsetfunctor setter);
+
+  //! Post a non-blocking nodal halo exchange, only one exchange can be in
+  //! flight at a time. Contributions to the halo nodes must be complete.
+  //! \tparam Ttype Type of property to accumulate
+  //! \tparam Tnparam Size of individual property
+  //! \tparam Tgetfunctor Functor for getter
+  //! \param[in] getter Getter function
+  template <typename Ttype, unsigned Tnparam, typename Tgetfunctor>
+  void begin_nodal_halo_exchange(Tgetfunctor getter);
+
+  //! Wait for the posted nodal halo exchange and sum the contributions
+  //! \tparam Ttype Type of property to accumulate
+  //! \tparam Tnparam Size of individual property
+  //! \tparam Tgetfunctor Functor for getter
+  //! \tparam Tsetfunctor Functor for setter
+  //! \param[in] getter Getter function
+  //! \param[in] setter Setter function
+  template <typename Ttype, unsigned Tnparam, typename Tgetfunctor,
+            typename Tsetfunctor>
+  void end_nodal_halo_exchange(Tgetfunctor getter, Tsetfunctor setter);
 #endif
 
   //! Create cells from list of nodes
@@ -182,9 +240,16 @@ class Mesh {
   //! Find cell neighbours
   void find_cell_neighbours();
 
-  //! Find global nparticles across MPI ranks / cell
+  //! Find global nparticles and cost of particles across MPI ranks / cell
+  //! \details The cost of a particle is the relative stress update cost of
+  //! its solid phase material
   void find_nglobal_particles_cells();
 
+  //! Return the cost of a particle stress update of each material relative
+  //! to the cheapest material, from the recorded stress update times of all
+  //! ranks. Materials without recorded updates have a cost of 1.
+  std::map<unsigned, double> relative_material_costs() const;
+
   //! Create particles from coordinates
   //! \param[in] particle_type Particle type
   //! \param[in] coordinates Nodal coordinates
@@ -213,7 +278,8 @@ class Mesh {
   //! Remove a particle by id
   bool remove_particle_by_id(mpm::Index id);
 
-  //! Remove a particle from the mesh
+  //! Remove particles from the mesh in a single pass over the container of
+  //! particles, the order of the remaining particles is kept
   //! \param[in] pids Vector of particle ids
   void remove_particles(const std::vector<mpm::Index>& pids);
 
@@ -228,21 +294,138 @@ class Mesh {
   void transfer_nonrank_particles(
       const std::vector<mpm::Index>& exchange_cells);
 
+  //! Remove cells and nodes which are neither in the local rank nor in a
+  //! layer of halo cells sharing a node with a cell of the local rank, after
+  //! which the mesh is distributed. Particles in non-rank cells must be
+  //! removed or transferred before.
+  void remove_all_nonrank_cells();
+
+  //! Create only the cells of the local rank and a layer of halo cells
+  //! sharing a node with them, and the nodes of these cells, from a list of
+  //! nodes and cells which contains at least these, e.g., the global mesh.
+  //! The mesh is distributed after creation.
+  //! \param[in] node_type Node type
+  //! \param[in] node_ids Ids of nodes
+  //! \param[in] coordinates Coordinates of nodes
+  //! \param[in] element Element of the cells
+  //! \param[in] cell_ids Ids of cells
+  //! \param[in] cells Node ids of cells
+  //! \param[in] cell_ranks Rank of each cell
+  //! \retval status Create status
+  bool create_distributed_mesh(
+      const std::string& node_type, const std::vector<mpm::Index>& node_ids,
+      const std::vector<VectorDim>& coordinates,
+      const std::shared_ptr<mpm::Element<Tdim>>& element,
+      const std::vector<mpm::Index>& cell_ids,
+      const std::vector<std::vector<mpm::Index>>& cells,
+      const std::vector<unsigned>& cell_ranks);
+
+  //! Transfer cells and nodes of a distributed mesh after the ranks of local
+  //! cells are repartitioned. Ranks of halo cells are updated from their
+  //! previous ranks, and a rank receiving a cell receives its neighbours to
+  //! complete the halo layer. Received cells keep their element type, and
+  //! received nodes keep their boundary conditions. Both are added to the
+  //! sets which hold them. Cells which are no longer needed are kept until
+  //! remove_all_nonrank_cells is called.
+  //! \param[in,out] exchange_cells Cell ids of the local rank which changed
+  //! rank, cells received by the local rank are appended
+  void transfer_nonrank_cells(std::vector<mpm::Index>& exchange_cells);
+
+  //! Return if the mesh only holds the cells of the local rank and a layer
+  //! of halo cells
+  bool is_distributed() const { return distributed_; }
+
+  //! Return the local index of a cell in the container of cells of a
+  //! distributed mesh
+  //! \param[in] id Global id of the cell
+  //! \retval index Local index, maximum Index if the cell is not in the mesh
+  mpm::Index local_cell_index(mpm::Index id) const;
+
+  //! Return the local index of a node in the container of nodes of a
+  //! distributed mesh
+  //! \param[in] id Global id of the node
+  //! \retval index Local index, maximum Index if the node is not in the mesh
+  mpm::Index local_node_index(mpm::Index id) const;
+
+  //! Return the ranks which own a neighbour of a cell of the local rank
+  std::set<unsigned> neighbour_ranks() const;
+
+  //! Shift boundary cells of the local rank to neighbour ranks
+  //! \details Cells with the most neighbours in a neighbour rank are shifted
+  //! first, until the number of particles to send to the rank is reached.
+  //! Empty cells are not shifted and the local rank keeps at least one cell.
+  //! Ranks of shifted cells are updated on all ranks of a global mesh.
+  //! \param[in] nparticles Number of particles to send to each neighbour rank
+  //! \retval exchange_cells Cell ids which changed rank, of all ranks for a
+  //! global mesh and of the local rank for a distributed mesh
+  std::vector<mpm::Index> shift_boundary_cells(
+      const std::map<unsigned, double>& nparticles);
+
   //! Find shared nodes across MPI domains in the mesh
   void find_domain_shared_nodes();
 
   //! Find number of domain shared nodes in local rank
   mpm::Index nshared_nodes() const { return domain_shared_nodes_.size(); }
 
+  //! Number of neighbour MPI ranks sharing nodes with the local rank
+  unsigned nhalo_neighbours() const { return halo_neighbour_ranks_.size(); }
+
   //! Number of particles in the mesh
   mpm::Index nparticles() const { return particles_.size(); }
 
+  //! Return the structure-of-arrays store of particle state
+  std::shared_ptr<mpm::ParticleStore<Tdim>> particle_store() const {
+    return particle_store_;
+  }
+
+  //! Return the structure-of-arrays store of nodal state
+  std::shared_ptr<mpm::NodeStore<Tdim>> node_store() const {
+    return node_store_;
+  }
+
   //! Locate particles in a cell
   //! Iterate over all cells in a mesh to find the cell in which particles
-  //! are located.
+  //! are located. Particle ids of cells are assigned in bulk after all
+  //! particles are located.
   //! \retval particles Particles which cannot be located in the mesh
   std::vector<std::shared_ptr<mpm::ParticleBase<Tdim>>> locate_particles_mesh();
 
+  //! Assign particle ids of all cells from the cells of particles
+  //! \details Particle ids are sorted by cell with a counting sort, particle
+  //! ids of a cell are in the order of the container of particles
+  void assign_cell_particle_ids();
+
+  //! Compute a uniform grid of buckets over the bounding boxes of cells,
+  //! which is used to find candidate cells when locating particles
+  //! \retval status Status of bucket grid creation
+  bool compute_cell_buckets();
+
+  //! Number of buckets in the cell bucket grid
+  mpm::Index ncell_buckets() const { return cell_buckets_.size(); }
+
+  //! Compute a structured grid of cells, if the cells of a cartesian mesh
+  //! form a regular rectilinear grid. Particles are then located in a cell
+  //! arithmetically from their coordinates without any search.
+  //! \retval status Return true if the mesh is a structured grid
+  bool compute_structured_grid();
+
+  //! Return if the mesh is a structured grid
+  bool is_structured() const { return !structured_cells_.empty(); }
+
+  //! Order cells and the node store slots along a Morton curve
+  //! \details Cells are ordered by their centroids and node store slots by
+  //! nodal coordinates. The containers of cells and nodes keep the order of
+  //! ids, which is used in graph partitioning and mesh output, and cells
+  //! are visited in Morton order in cell colours and halo / interior cells.
+  //! \retval status Status of reordering
+  bool reorder_mesh();
+
+  //! Order particles and their store slots by the Morton order of their
+  //! cells, cell particle lists and particle sets follow the new order
+  //! \details Cells are ordered by their ids if reorder_mesh was not called.
+  //! Particles in the same cell keep their relative order.
+  void reorder_particles();
+
   //! Iterate over particles
   //! \tparam Toper Callable object typically a baseclass functor
   template <typename Toper>
@@ -254,6 +437,59 @@ class Mesh {
   template <typename Toper>
   void iterate_over_particle_set(int set_id, Toper oper);
 
+  //! Compute stresses of particles in batches of the same material
+  //! \details Particles are grouped by material and the stresses of each
+  //! batch are computed by a single call to Material::compute_stress_batch
+  //! \param[in] phase Index corresponding to the phase
+  void compute_stress_batched(unsigned phase);
+
+  //! Compute the critical time step of local particles
+  //! \details The critical time step of a particle is the mean length of its
+  //! cell divided by the sum of the elastic wave speed of its material and
+  //! the particle speed
+  //! \param[in] phase Index corresponding to the phase
+  //! \retval dt Minimum critical time step of particles, the maximum double
+  //! value if there are no particles
+  double critical_time_step(unsigned phase);
+
+  //! Compute a colouring of cells such that no two cells of the same colour
+  //! share a node
+  //! \retval status Status of cell colouring
+  bool compute_cell_colours();
+
+  //! Number of cell colours
+  unsigned ncell_colours() const { return cell_colours_.size(); }
+
+  //! Return cells of a colour
+  //! \param[in] colour Colour of cells
+  const Vector<Cell<Tdim>>& cell_colour(unsigned colour) const {
+    return cell_colours_.at(colour);
+  }
+
+  //! Iterate over particles by cell colour, cells of a colour are processed
+  //! in parallel and colours in sequence, so no two threads write to the same
+  //! node at the same time. Falls back to iterate_over_particles if cell
+  //! colours are not computed.
+  //! \tparam Toper Callable object typically a baseclass functor
+  //! \param[in] oper Operation on a particle and a flag to lock nodes, which
+  //! is false only when cells are coloured
+  template <typename Toper>
+  void iterate_over_particles_coloured(Toper oper);
+
+  //! Iterate over particles in local cells that touch a domain shared node
+  //! (halo cells) or in the remaining local cells (interior cells)
+  //! \tparam Toper Callable object typically a baseclass functor
+  //! \param[in] oper Operation on a particle
+  //! \param[in] halo Iterate over halo cells if true, else interior cells
+  template <typename Toper>
+  void iterate_over_halo_particles(Toper oper, bool halo);
+
+  //! Number of local cells touching a domain shared node
+  unsigned nhalo_cells() const { return halo_cells_.size(); }
+
+  //! Number of local cells not touching a domain shared node
+  unsigned ninterior_cells() const { return interior_cells_.size(); }
+
   //! Return coordinates of particles
   std::vector<Eigen::Matrix<double, 3, 1>> particle_coordinates();
 
@@ -389,12 +625,21 @@ class Mesh {
   void find_ghost_boundary_cells();
 
   //! Write HDF5 particles
+  //! \details Particles of all MPI ranks are written to a single file with a
+  //! dataset for each field, the call is collective over MPI ranks
   //! \param[in] phase Index corresponding to the phase
   //! \param[in] filename Name of HDF5 file to write particles data
+  //! \param[in] compression Deflate level of chunked datasets (0 disables)
   //! \retval status Status of writing HDF5 output
-  bool write_particles_hdf5(unsigned phase, const std::string& filename);
+  bool write_particles_hdf5(unsigned phase, const std::string& filename,
+                            unsigned compression = 0);
 
   //! Read HDF5 particles
+  //! \details A file written by any number of MPI ranks can be read. Each
+  //! rank of a distributed mesh reads a slice of the particles and passes
+  //! the particles outside its cells around the ranks until each particle
+  //! is kept by the rank of its cell, the call is then collective over MPI
+  //! ranks. Otherwise all particles in the file are read.
   //! \param[in] phase Index corresponding to the phase
   //! \param[in] filename Name of HDF5 file to write particles data
   //! \retval status Status of reading HDF5 output
@@ -404,6 +649,12 @@ class Mesh {
   //! \retval particles_hdf5 Vector of HDF5 particles
   std::vector<mpm::HDF5Particle> particles_hdf5() const;
 
+  //! Return HDF5 fields of particles as columns
+  //! \details The columns hold the largest number of state variables of the
+  //! particles of all ranks, the call is collective over MPI ranks
+  //! \retval columns Particle columns
+  mpm::hdf5::particle::Columns particles_hdf5_columns() const;
+
   //! Return nodal coordinates
   std::vector<Eigen::Matrix<double, 3, 1>> nodal_coordinates() const;
 
@@ -437,6 +688,12 @@ class Mesh {
   //! Get the vector of cell
   mpm::Vector<Cell<Tdim>> cells();
 
+  //! Return a vector of cells in a set
+  //! \param[in] set_id Set id of cells
+  Vector<Cell<Tdim>> cells(unsigned set_id) const {
+    return cell_sets_.at(set_id);
+  }
+
   //! Return particle cell ids
   std::map<mpm::Index, mpm::Index>* particles_cell_ids();
 
@@ -467,9 +724,61 @@ class Mesh {
   bool read_particles_file(const std::shared_ptr<mpm::IO>& io,
                            const Json& generator, unsigned pset_id);
 
-  // Locate a particle in mesh cells
+  // Return cells in Morton order if the mesh is reordered, otherwise in the
+  // order of the cell container
+  std::vector<std::shared_ptr<Cell<Tdim>>> ordered_cells() const;
+
+  // Order the containers of cells and nodes by id and index the local cells
+  // and nodes of a distributed mesh, cell and node lookups which depend on
+  // the set of cells are cleared, and cell colours and the structured grid
+  // are recomputed if they were in use
+  void index_distributed_mesh();
+
+  // Keep the particles of a distributed mesh which are located in a cell of
+  // the local rank, every rank creates the same particles. A particle on
+  // the boundary of cells belongs to the cell with the lowest id.
+  //! \param[in,out] pids Ids of the created particles, ids of the particles
+  //! which are not kept are removed
+  //! \retval status Each particle is kept by a rank
+  bool keep_rank_particles(std::vector<mpm::Index>& pids);
+
+  // Locate a particle of a distributed mesh and return if it is in a cell
+  // of the local rank. A particle on the boundary of cells belongs to the
+  // cell with the lowest id.
+  //! \param[in] particle Particle to be located
+  //! \param[in] mpi_rank Local MPI rank
+  bool locate_rank_particle(
+      const std::shared_ptr<mpm::ParticleBase<Tdim>>& particle, int mpi_rank);
+
+  // Create a particle with its state in the particle store of the mesh
+  std::shared_ptr<mpm::ParticleBase<Tdim>> create_particle(
+      const std::string& particle_type, mpm::Index id,
+      const VectorDim& coordinates);
+
+  // Locate a particle in mesh cells, the particle id is moved to the
+  // particle ids of the cell if update_cell is true
   bool locate_particle_cells(
-      const std::shared_ptr<mpm::ParticleBase<Tdim>>& particle);
+      const std::shared_ptr<mpm::ParticleBase<Tdim>>& particle,
+      bool update_cell = true);
+
+  // Locate a particle in the candidate cells of its bucket
+  bool locate_particle_buckets(
+      const std::shared_ptr<mpm::ParticleBase<Tdim>>& particle,
+      bool update_cell = true);
+
+  // Locate a particle in a structured grid from its coordinates
+  bool locate_particle_structured(
+      const std::shared_ptr<mpm::ParticleBase<Tdim>>& particle,
+      bool update_cell = true);
+
+  // Send particles to ranks and receive particles from ranks, with a single
+  // batched message between each pair of ranks. Sent particles are removed.
+  //! \param[in] send_particles Ids of particles to send to each rank, an
+  //! empty list still sends an (empty) message to the rank
+  //! \param[in] recv_ranks Ranks that send particles to the current rank
+  void exchange_particles(
+      const std::map<unsigned, std::vector<mpm::Index>>& send_particles,
+      const std::set<unsigned>& recv_ranks);
 
  private:
   //! mesh id
@@ -486,16 +795,40 @@ class Mesh {
   tsl::robin_map<unsigned, std::vector<mpm::Index>> particle_sets_;
   //! Map of particles for fast retrieval
   Map<ParticleBase<Tdim>> map_particles_;
+  //! Contiguous store of particle state
+  std::shared_ptr<ParticleStore<Tdim>> particle_store_;
+  //! Contiguous store of nodal state
+  std::shared_ptr<NodeStore<Tdim>> node_store_{nullptr};
   //! Vector of nodes
   Vector<NodeBase<Tdim>> nodes_;
   //! Vector of domain shared nodes
   Vector<NodeBase<Tdim>> domain_shared_nodes_;
+  //! Neighbour MPI ranks sharing nodes with the local rank
+  std::vector<unsigned> halo_neighbour_ranks_;
+  //! Domain shared nodes exchanged with each neighbour rank
+  std::vector<Vector<NodeBase<Tdim>>> halo_neighbour_nodes_;
+  //! Local cells touching a domain shared node
+  Vector<Cell<Tdim>> halo_cells_;
+  //! Local cells not touching a domain shared node
+  Vector<Cell<Tdim>> interior_cells_;
+#ifdef USE_MPI
+  //! Send buffers of the posted halo exchange for each neighbour rank
+  std::vector<std::vector<double>> halo_send_buffers_;
+  //! Receive buffers of the posted halo exchange for each neighbour rank
+  std::vector<std::vector<double>> halo_recv_buffers_;
+  //! Requests of the posted halo exchange
+  std::vector<MPI_Request> halo_requests_;
+#endif
   //! Boundary nodes
   Vector<NodeBase<Tdim>> boundary_nodes_;
   //! Vector of node sets
   tsl::robin_map<unsigned, Vector<NodeBase<Tdim>>> node_sets_;
   //! Vector of active nodes
   Vector<NodeBase<Tdim>> active_nodes_;
+  //! Node store indices of active nodes without constraints
+  std::vector<mpm::Index> active_node_indices_;
+  //! Active nodes with velocity or friction constraints
+  Vector<NodeBase<Tdim>> active_constrained_nodes_;
   //! Map of nodes for fast retrieval
   Map<NodeBase<Tdim>> map_nodes_;
   //! Map of cells for fast retrieval
@@ -508,6 +841,40 @@ class Mesh {
   Vector<Cell<Tdim>> local_ghost_cells_;
   //! Vector of cell sets
   tsl::robin_map<unsigned, Vector<Cell<Tdim>>> cell_sets_;
+  //! Cells grouped by colour, cells of a colour do not share nodes
+  std::vector<Vector<Cell<Tdim>>> cell_colours_;
+  //! Cells are coloured, colours are recomputed when cells are changed
+  bool coloured_cells_{false};
+  //! Origin of the cell bucket grid
+  VectorDim bucket_origin_;
+  //! Size of a bucket in each direction
+  VectorDim bucket_size_;
+  //! Number of buckets in each direction
+  std::array<mpm::Index, Tdim> nbuckets_;
+  //! Cells whose bounding box overlaps a bucket
+  std::vector<std::vector<std::shared_ptr<Cell<Tdim>>>> cell_buckets_;
+  //! Origin of the structured grid
+  VectorDim structured_origin_;
+  //! Size of a cell in the structured grid
+  VectorDim structured_size_;
+  //! Number of cells in each direction of the structured grid
+  std::array<mpm::Index, Tdim> structured_ncells_;
+  //! Cells of the structured grid ordered by their grid index
+  std::vector<std::shared_ptr<Cell<Tdim>>> structured_cells_;
+  //! Cells form a structured grid, which is recomputed when cells change
+  bool structured_grid_{false};
+  //! Position of each cell id along the Morton curve
+  tsl::robin_map<mpm::Index, mpm::Index> cell_order_;
+  //! Mesh only holds the cells of the local rank and a layer of halo cells
+  bool distributed_{false};
+  //! Node type of the mesh, used to create transferred nodes
+  std::string node_type_;
+  //! Math functions of nodal concentrated forces by their id
+  std::map<unsigned, std::shared_ptr<FunctionBase>> force_functions_;
+  //! Local index of each global cell id
+  tsl::robin_map<mpm::Index, mpm::Index> local_cells_;
+  //! Local index of each global node id
+  tsl::robin_map<mpm::Index, mpm::Index> local_nodes_;
   //! Map of ghost cells to the neighbours ranks
   std::map<unsigned, std::vector<unsigned>> ghost_cells_neighbour_ranks_;
   //! Faces and cells
@@ -525,7 +892,7 @@ class Mesh {
   std::shared_ptr<mpm::NodalProperties> nodal_properties_{nullptr};
   //! Logger
   std::unique_ptr<spdlog::logger> console_;
-  //! Maximum number of halo nodes
+  //! Number of halo nodes on the local rank
   unsigned nhalo_nodes_{0};
   //! Maximum number of halo nodes
   unsigned ncomms_{0};
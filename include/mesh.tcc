@@ -9,6 +9,8 @@ mpm::Mesh<Tdim>::Mesh(unsigned id, bool isoparametric)
   console_ = std::make_unique<spdlog::logger>(logger, mpm::stdout_sink);
 
   particles_.clear();
+  // Structure-of-arrays store of particle state
+  particle_store_ = std::make_shared<mpm::ParticleStore<Tdim>>();
 }
 
 //! Create nodes from coordinates
@@ -22,6 +24,8 @@ bool mpm::Mesh<Tdim>::create_nodes(mpm::Index gnid,
     // Check if nodal coordinates is empty
     if (coordinates.empty())
       throw std::runtime_error("List of coordinates is empty");
+    // Node type is used to create nodes transferred to the rank
+    node_type_ = node_type;
     // Iterate over all coordinates
     for (const auto& node_coordinates : coordinates) {
       // Add node to mesh and check
@@ -51,8 +55,15 @@ template <unsigned Tdim>
 bool mpm::Mesh<Tdim>::add_node(const std::shared_ptr<mpm::NodeBase<Tdim>>& node,
                                bool check_duplicates) {
   bool insertion_status = nodes_.add(node, check_duplicates);
-  // Add node to map
-  if (insertion_status) map_nodes_.insert(node->id(), node);
+  if (insertion_status) {
+    // Add node to map
+    map_nodes_.insert(node->id(), node);
+    // Move nodal state to the contiguous node store of the mesh
+    if (node_store_ == nullptr)
+      node_store_ = std::make_shared<mpm::NodeStore<Tdim>>(
+          node->node_store()->nphases());
+    node->assign_node_store(node_store_);
+  }
   return insertion_status;
 }
 
@@ -88,9 +99,19 @@ template <unsigned Tdim>
 void mpm::Mesh<Tdim>::find_active_nodes() {
   // Clear existing list of active nodes
   this->active_nodes_.clear();
+  this->active_node_indices_.clear();
+  this->active_constrained_nodes_.clear();
 
-  for (auto nitr = nodes_.cbegin(); nitr != nodes_.cend(); ++nitr)
-    if ((*nitr)->status()) this->active_nodes_.add(*nitr);
+  for (auto nitr = nodes_.cbegin(); nitr != nodes_.cend(); ++nitr) {
+    if ((*nitr)->status()) {
+      this->active_nodes_.add(*nitr, false);
+      // Nodes without constraints are computed over the node store
+      if (!(*nitr)->constrained() && (*nitr)->node_store() == node_store_)
+        this->active_node_indices_.emplace_back((*nitr)->store_index());
+      else
+        this->active_constrained_nodes_.add(*nitr, false);
+    }
+  }
 }
 
 //! Iterate over active nodes
@@ -102,6 +123,72 @@ void mpm::Mesh<Tdim>::iterate_over_active_nodes(Toper oper) {
     oper(*nitr);
 }
 
+//! Initialise all nodes and clear the active nodes of the last step
+template <unsigned Tdim>
+void mpm::Mesh<Tdim>::initialise_nodes() {
+  // Inactive nodes may hold concentrated forces or state received from other
+  // ranks, the store of all nodes is reset
+  if (node_store_ != nullptr) node_store_->initialise();
+
+  if (active_nodes_.size() == 0) {
+    this->iterate_over_nodes(
+        std::bind(&mpm::NodeBase<Tdim>::initialise, std::placeholders::_1));
+  } else {
+    // State outside the store is only updated on the active nodes and on the
+    // nodes shared with other ranks
+    this->iterate_over_active_nodes(std::bind(
+        &mpm::NodeBase<Tdim>::initialise_state, std::placeholders::_1));
+    for (auto nitr = domain_shared_nodes_.cbegin();
+         nitr != domain_shared_nodes_.cend(); ++nitr)
+      (*nitr)->initialise_state();
+  }
+  // Clear the list of active nodes of the last step
+  this->active_nodes_.clear();
+  this->active_node_indices_.clear();
+  this->active_constrained_nodes_.clear();
+}
+
+//! Compute velocity from momentum of active nodes
+template <unsigned Tdim>
+void mpm::Mesh<Tdim>::compute_nodal_velocity() {
+  if (node_store_ != nullptr)
+    node_store_->compute_velocity(active_node_indices_);
+
+#pragma omp parallel for schedule(runtime)
+  for (auto nitr = active_constrained_nodes_.cbegin();
+       nitr != active_constrained_nodes_.cend(); ++nitr)
+    (*nitr)->compute_velocity();
+}
+
+//! Compute acceleration and velocity of active nodes
+template <unsigned Tdim>
+void mpm::Mesh<Tdim>::compute_nodal_acceleration_velocity(unsigned phase,
+                                                          double dt) {
+  if (node_store_ != nullptr)
+    node_store_->compute_acceleration_velocity(active_node_indices_, phase,
+                                               dt);
+
+#pragma omp parallel for schedule(runtime)
+  for (auto nitr = active_constrained_nodes_.cbegin();
+       nitr != active_constrained_nodes_.cend(); ++nitr)
+    (*nitr)->compute_acceleration_velocity(phase, dt);
+}
+
+//! Compute acceleration and velocity with cundall damping factor of active
+//! nodes
+template <unsigned Tdim>
+void mpm::Mesh<Tdim>::compute_nodal_acceleration_velocity_cundall(
+    unsigned phase, double dt, double damping_factor) {
+  if (node_store_ != nullptr)
+    node_store_->compute_acceleration_velocity_cundall(
+        active_node_indices_, phase, dt, damping_factor);
+
+#pragma omp parallel for schedule(runtime)
+  for (auto nitr = active_constrained_nodes_.cbegin();
+       nitr != active_constrained_nodes_.cend(); ++nitr)
+    (*nitr)->compute_acceleration_velocity_cundall(phase, dt, damping_factor);
+}
+
 #ifdef USE_MPI
 #ifdef USE_HALO_EXCHANGE
 //! Nodal halo exchange
@@ -161,29 +248,98 @@ void mpm::Mesh<Tdim>::nodal_halo_exchange(Tgetfunctor getter,
   }
 }
 
+//! Post non-blocking nodal halo exchange
+template <unsigned Tdim>
+template <typename Ttype, unsigned Tnparam, typename Tgetfunctor>
+void mpm::Mesh<Tdim>::begin_nodal_halo_exchange(Tgetfunctor getter) {
+  // Point to point exchange is posted on completion
+}
+
+//! Complete nodal halo exchange
+template <unsigned Tdim>
+template <typename Ttype, unsigned Tnparam, typename Tgetfunctor,
+          typename Tsetfunctor>
+void mpm::Mesh<Tdim>::end_nodal_halo_exchange(Tgetfunctor getter,
+                                              Tsetfunctor setter) {
+  // Point to point exchange is blocking
+  this->template nodal_halo_exchange<Ttype, Tnparam>(getter, setter);
+}
 #else
-//! All reduce over nodal scalar property
+//! Sum nodal property over neighbour ranks sharing a node
 template <unsigned Tdim>
 template <typename Ttype, unsigned Tnparam, typename Tgetfunctor,
           typename Tsetfunctor>
 void mpm::Mesh<Tdim>::nodal_halo_exchange(Tgetfunctor getter,
                                           Tsetfunctor setter) {
-  // Create vector of nodal scalars
-  std::vector<Ttype> prop_get(nhalo_nodes_, mpm::zero<Ttype>());
-  std::vector<Ttype> prop_set(nhalo_nodes_, mpm::zero<Ttype>());
+  this->template begin_nodal_halo_exchange<Ttype, Tnparam>(getter);
+  this->template end_nodal_halo_exchange<Ttype, Tnparam>(getter, setter);
+}
+
+//! Post non-blocking nodal halo exchange
+template <unsigned Tdim>
+template <typename Ttype, unsigned Tnparam, typename Tgetfunctor>
+void mpm::Mesh<Tdim>::begin_nodal_halo_exchange(Tgetfunctor getter) {
+  // Pack and post a single message to and from each neighbour rank
+  const unsigned nneighbours = halo_neighbour_ranks_.size();
+  halo_send_buffers_.resize(nneighbours);
+  halo_recv_buffers_.resize(nneighbours);
+  halo_requests_.resize(2 * nneighbours);
+  for (unsigned i = 0; i < nneighbours; ++i) {
+    const auto& nodes = halo_neighbour_nodes_[i];
+    auto& send_buffer = halo_send_buffers_[i];
+    send_buffer.resize(nodes.size() * Tnparam);
+    halo_recv_buffers_[i].resize(nodes.size() * Tnparam);
+
+    auto bitr = send_buffer.begin();
+    for (auto nitr = nodes.cbegin(); nitr != nodes.cend(); ++nitr) {
+      const Ttype property = getter((*nitr));
+      const double* data = reinterpret_cast<const double*>(&property);
+      bitr = std::copy(data, data + Tnparam, bitr);
+    }
+
+    MPI_Irecv(halo_recv_buffers_[i].data(), nodes.size() * Tnparam,
+              MPI_DOUBLE, halo_neighbour_ranks_[i], 0, MPI_COMM_WORLD,
+              &halo_requests_[2 * i]);
+    MPI_Isend(send_buffer.data(), nodes.size() * Tnparam, MPI_DOUBLE,
+              halo_neighbour_ranks_[i], 0, MPI_COMM_WORLD,
+              &halo_requests_[2 * i + 1]);
+  }
+}
 
-#pragma omp parallel for schedule(runtime) shared(prop_get)
+//! Complete nodal halo exchange
+template <unsigned Tdim>
+template <typename Ttype, unsigned Tnparam, typename Tgetfunctor,
+          typename Tsetfunctor>
+void mpm::Mesh<Tdim>::end_nodal_halo_exchange(Tgetfunctor getter,
+                                              Tsetfunctor setter) {
+  // Local contribution at the halo nodes
+  std::vector<Ttype> prop(nhalo_nodes_, mpm::zero<Ttype>());
+
+#pragma omp parallel for schedule(runtime) shared(prop)
   for (auto nitr = domain_shared_nodes_.cbegin();
        nitr != domain_shared_nodes_.cend(); ++nitr)
-    prop_get.at((*nitr)->ghost_id()) = getter((*nitr));
+    prop.at((*nitr)->ghost_id()) = getter((*nitr));
 
-  MPI_Allreduce(prop_get.data(), prop_set.data(), nhalo_nodes_ * Tnparam,
-                MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+  MPI_Waitall(halo_requests_.size(), halo_requests_.data(),
+              MPI_STATUSES_IGNORE);
+
+  // Accumulate neighbour contributions
+  for (unsigned i = 0; i < halo_neighbour_ranks_.size(); ++i) {
+    const auto& nodes = halo_neighbour_nodes_[i];
+    auto bitr = halo_recv_buffers_[i].cbegin();
+    for (auto nitr = nodes.cbegin(); nitr != nodes.cend(); ++nitr) {
+      Ttype value;
+      std::copy(bitr, bitr + Tnparam, reinterpret_cast<double*>(&value));
+      bitr += Tnparam;
+      prop[(*nitr)->ghost_id()] += value;
+    }
+  }
+  halo_requests_.clear();
 
 #pragma omp parallel for schedule(runtime)
   for (auto nitr = domain_shared_nodes_.cbegin();
        nitr != domain_shared_nodes_.cend(); ++nitr)
-    setter((*nitr), prop_set.at((*nitr)->ghost_id()));
+    setter((*nitr), prop.at((*nitr)->ghost_id()));
 }
 #endif
 #endif
@@ -243,7 +399,14 @@ bool mpm::Mesh<Tdim>::add_cell(const std::shared_ptr<mpm::Cell<Tdim>>& cell,
                                bool check_duplicates) {
   bool insertion_status = cells_.add(cell, check_duplicates);
   // Add cell to map
-  if (insertion_status) map_cells_.insert(cell->id(), cell);
+  if (insertion_status) {
+    map_cells_.insert(cell->id(), cell);
+    // Cell colours, buckets and structured grid are recomputed for the new
+    // cell
+    cell_colours_.clear();
+    cell_buckets_.clear();
+    structured_cells_.clear();
+  }
   return insertion_status;
 }
 
@@ -252,6 +415,11 @@ template <unsigned Tdim>
 bool mpm::Mesh<Tdim>::remove_cell(
     const std::shared_ptr<mpm::Cell<Tdim>>& cell) {
   const mpm::Index id = cell->id();
+  // Cell colours, buckets and structured grid are recomputed without the
+  // cell
+  cell_colours_.clear();
+  cell_buckets_.clear();
+  structured_cells_.clear();
   // Remove a cell if found in the container
   return (cells_.remove(cell) && map_cells_.remove(id));
 }
@@ -293,15 +461,91 @@ void mpm::Mesh<Tdim>::find_nglobal_particles_cells() {
   int mpi_rank = 0;
 #ifdef USE_MPI
   MPI_Comm_rank(MPI_COMM_WORLD, &mpi_rank);
-  for (auto citr = cells_.cbegin(); citr != cells_.cend(); ++citr) {
-    int nparticles;
-    // Determine the rank of the broadcast emitter process
-    if ((*citr)->rank() == mpi_rank) nparticles = (*citr)->nparticles();
-    MPI_Bcast(&nparticles, 1, MPI_INT, (*citr)->rank(), MPI_COMM_WORLD);
-    // Receive broadcast and update on all ranks
-    (*citr)->nglobal_particles(nparticles);
+
+  // Cost of a particle of each material
+  const auto material_costs = this->relative_material_costs();
+  const auto particles_cost =
+      [this, &material_costs](const std::shared_ptr<Cell<Tdim>>& cell) {
+        double cost = 0.;
+        for (const auto pid : cell->particles()) {
+          const auto mitr = material_costs.find(
+              map_particles_[pid]->material_id(mpm::ParticlePhase::Solid));
+          cost += (mitr != material_costs.end()) ? mitr->second : 1.;
+        }
+        return (cell->nparticles() > 0)
+                   ? std::max(1, static_cast<int>(std::lround(cost)))
+                   : 0;
+      };
+
+  // Cells of a distributed mesh are only weighted in their rank
+  if (distributed_) {
+    for (auto citr = cells_.cbegin(); citr != cells_.cend(); ++citr)
+      if ((*citr)->rank() == mpi_rank) {
+        (*citr)->nglobal_particles((*citr)->nparticles());
+        (*citr)->particles_cost(particles_cost(*citr));
+      }
+    return;
+  }
+
+  // Number and cost of particles of cells in the local rank, zero elsewhere
+  const std::size_t ncells = cells_.size();
+  std::vector<int> weights(2 * ncells, 0);
+#pragma omp parallel for schedule(runtime)
+  for (std::size_t i = 0; i < ncells; ++i)
+    if (cells_[i]->rank() == mpi_rank) {
+      weights[i] = cells_[i]->nparticles();
+      weights[ncells + i] = particles_cost(cells_[i]);
+    }
+
+  // Sum the number and cost of particles of all cells in a single collective
+  MPI_Allreduce(MPI_IN_PLACE, weights.data(), weights.size(), MPI_INT, MPI_SUM,
+                MPI_COMM_WORLD);
+
+#pragma omp parallel for schedule(runtime)
+  for (std::size_t i = 0; i < ncells; ++i) {
+    cells_[i]->nglobal_particles(weights[i]);
+    cells_[i]->particles_cost(weights[ncells + i]);
+  }
+#endif
+}
+
+//! Return the relative cost of a particle stress update of each material
+template <unsigned Tdim>
+std::map<unsigned, double> mpm::Mesh<Tdim>::relative_material_costs() const {
+  // Recorded time and number of stress updates of each material
+  std::vector<double> costs;
+  costs.reserve(2 * materials_.size());
+  for (const auto& material : materials_) {
+    const auto cost = material.second->stress_cost();
+    costs.emplace_back(cost.first);
+    costs.emplace_back(static_cast<double>(cost.second));
   }
+
+#ifdef USE_MPI
+  int mpi_size = 1;
+  MPI_Comm_size(MPI_COMM_WORLD, &mpi_size);
+  if (mpi_size > 1 && !costs.empty())
+    MPI_Allreduce(MPI_IN_PLACE, costs.data(), costs.size(), MPI_DOUBLE,
+                  MPI_SUM, MPI_COMM_WORLD);
 #endif
+
+  // Mean time of a stress update of each material
+  std::vector<double> mean_costs(materials_.size(), 0.);
+  double min_cost = std::numeric_limits<double>::max();
+  for (std::size_t i = 0; i < mean_costs.size(); ++i)
+    if (costs[2 * i] > 0. && costs[2 * i + 1] > 0.) {
+      mean_costs[i] = costs[2 * i] / costs[2 * i + 1];
+      min_cost = std::min(min_cost, mean_costs[i]);
+    }
+
+  std::map<unsigned, double> relative_costs;
+  std::size_t i = 0;
+  for (const auto& material : materials_) {
+    relative_costs[material.first] =
+        (mean_costs[i] > 0.) ? mean_costs[i] / min_cost : 1.;
+    ++i;
+  }
+  return relative_costs;
 }
 
 //! Find particle neighbours for all particle
@@ -473,7 +717,6 @@ bool mpm::Mesh<Tdim>::generate_material_points(
     if (cells_.size() > 0) {
       // Particle ids
       std::vector<mpm::Index> pids;
-      unsigned before_generation = this->nparticles();
       bool checks = false;
       // Get material
       std::vector<std::shared_ptr<mpm::Material<Tdim>>> materials;
@@ -482,34 +725,67 @@ bool mpm::Mesh<Tdim>::generate_material_points(
 
       // If set id is -1, use all cells
       auto cset = (cset_id == -1) ? this->cells_ : cell_sets_.at(cset_id);
-      // Iterate over each cell to generate points
+      // Reserve the particle store for the generated particles
+      particle_store_->reserve(particle_store_->size() +
+                               cset.size() * std::pow(nquadratures, Tdim));
+
+      // Points of each cell, a rank of a distributed mesh only generates
+      // points in its own cells
+      int mpi_rank = 0;
+#ifdef USE_MPI
+      MPI_Comm_rank(MPI_COMM_WORLD, &mpi_rank);
+#endif
+      std::vector<std::shared_ptr<Cell<Tdim>>> cells;
+      std::vector<std::vector<VectorDim>> points;
+      mpm::Index npoints = 0;
       for (auto citr = cset.cbegin(); citr != cset.cend(); ++citr) {
+        if (distributed_ && (*citr)->rank() != mpi_rank) continue;
         (*citr)->assign_quadrature(nquadratures);
+        cells.emplace_back(*citr);
         // Genereate particles at the Gauss points
-        const auto cpoints = (*citr)->generate_points();
+        points.emplace_back((*citr)->generate_points());
+        npoints += points.back().size();
+      }
+
+      // Particles of a distributed mesh are numbered after the particles of
+      // all ranks and the points of lower ranks
+      mpm::Index pid = particles_.size();
+      mpm::Index ngenerated = npoints;
+#ifdef USE_MPI
+      if (distributed_) {
+        mpm::Index first_pid = 0;
+        MPI_Exscan(&npoints, &first_pid, 1, MPI_UNSIGNED_LONG_LONG, MPI_SUM,
+                   MPI_COMM_WORLD);
+        if (mpi_rank == 0) first_pid = 0;
+        MPI_Allreduce(MPI_IN_PLACE, &pid, 1, MPI_UNSIGNED_LONG_LONG, MPI_SUM,
+                      MPI_COMM_WORLD);
+        MPI_Allreduce(MPI_IN_PLACE, &ngenerated, 1, MPI_UNSIGNED_LONG_LONG,
+                      MPI_SUM, MPI_COMM_WORLD);
+        pid += first_pid;
+      }
+#endif
+
+      // Iterate over each cell to generate points
+      for (unsigned i = 0; i < cells.size(); ++i) {
         // Iterate over each coordinate to generate material points
-        for (const auto& coordinates : cpoints) {
-          // Particle id
-          mpm::Index pid = particles_.size();
+        for (const auto& coordinates : points[i]) {
           // Create particle
           auto particle =
-              Factory<mpm::ParticleBase<Tdim>, mpm::Index,
-                      const Eigen::Matrix<double, Tdim, 1>&>::instance()
-                  ->create(particle_type, static_cast<mpm::Index>(pid),
-                           coordinates);
+              this->create_particle(particle_type, pid, coordinates);
 
           // Add particle to mesh
           status = this->add_particle(particle, checks);
           if (status) {
-            map_particles_[pid]->assign_cell(*citr);
+            map_particles_[pid]->assign_cell(cells[i]);
             for (unsigned phase = 0; phase < materials.size(); phase++)
               map_particles_[pid]->assign_material(materials[phase], phase);
             pids.emplace_back(pid);
+            ++pid;
           } else
             throw std::runtime_error("Generate particles in mesh failed");
         }
       }
-      if (before_generation == this->nparticles())
+      if (ngenerated == 0)
         throw std::runtime_error("No particles were generated!");
 
       // Add particles to set
@@ -522,8 +798,8 @@ bool mpm::Mesh<Tdim>::generate_material_points(
       console_->info(
           "Generate points:\n# of cells: {}\nExpected # of points: {}\n"
           "# of points generated: {}",
-          cells_.size(), cells_.size() * std::pow(nquadratures, Tdim),
-          particles_.size());
+          cells.size(), cells.size() * std::pow(nquadratures, Tdim),
+          pids.size());
     } else
       throw std::runtime_error("No cells are found in the mesh!");
   } catch (std::exception& exception) {
@@ -549,15 +825,23 @@ bool mpm::Mesh<Tdim>::create_particles(
     // Check if particle coordinates is empty
     if (coordinates.empty())
       throw std::runtime_error("List of coordinates is empty");
+    // Reserve the particle store for the new particles
+    particle_store_->reserve(particle_store_->size() + coordinates.size());
+    // Every rank of a distributed mesh creates the particles, which are
+    // numbered after the particles of all ranks
+    mpm::Index first_pid = particles_.size();
+#ifdef USE_MPI
+    if (distributed_)
+      MPI_Allreduce(MPI_IN_PLACE, &first_pid, 1, MPI_UNSIGNED_LONG_LONG,
+                    MPI_SUM, MPI_COMM_WORLD);
+#endif
     // Iterate over particle coordinates
     for (const auto& particle_coordinates : coordinates) {
       // Particle id
-      mpm::Index pid = particles_.size();
+      mpm::Index pid = first_pid + pids.size();
       // Create particle
-      auto particle = Factory<mpm::ParticleBase<Tdim>, mpm::Index,
-                              const Eigen::Matrix<double, Tdim, 1>&>::instance()
-                          ->create(particle_type, static_cast<mpm::Index>(pid),
-                                   particle_coordinates);
+      auto particle =
+          this->create_particle(particle_type, pid, particle_coordinates);
 
       // Add particle to mesh and check
       bool insert_status = this->add_particle(particle, check_duplicates);
@@ -570,6 +854,9 @@ bool mpm::Mesh<Tdim>::create_particles(
       } else
         throw std::runtime_error("Addition of particle to mesh failed!");
     }
+    // Particles outside the cells of the local rank belong to other ranks
+    if (distributed_ && !this->keep_rank_particles(pids))
+      throw std::runtime_error("Particle outside the mesh domain");
     // Add particles to set
     status = this->particle_sets_
                  .insert(std::pair<mpm::Index, std::vector<mpm::Index>>(pset_id,
@@ -583,6 +870,17 @@ bool mpm::Mesh<Tdim>::create_particles(
   return status;
 }
 
+//! Create a particle with its state in the particle store of the mesh
+template <unsigned Tdim>
+std::shared_ptr<mpm::ParticleBase<Tdim>> mpm::Mesh<Tdim>::create_particle(
+    const std::string& particle_type, mpm::Index id,
+    const VectorDim& coordinates) {
+  return Factory<mpm::ParticleBase<Tdim>, mpm::Index,
+                 const Eigen::Matrix<double, Tdim, 1>&,
+                 const std::shared_ptr<mpm::ParticleStore<Tdim>>&>::instance()
+      ->create(particle_type, std::move(id), coordinates, particle_store_);
+}
+
 //! Add a particle pointer to the mesh
 template <unsigned Tdim>
 bool mpm::Mesh<Tdim>::add_particle(
@@ -590,6 +888,9 @@ bool mpm::Mesh<Tdim>::add_particle(
   bool status = false;
   try {
     if (checks) {
+      // Build the cell bucket grid to locate particles
+      if (cell_buckets_.empty() && cells_.size() > 0)
+        this->compute_cell_buckets();
       // Add only if particle can be located in any cell of the mesh
       if (this->locate_particle_cells(particle)) {
         status = particles_.add(particle, checks);
@@ -606,6 +907,9 @@ bool mpm::Mesh<Tdim>::add_particle(
       map_particles_.insert(particle->id(), particle);
     }
     if (!status) throw std::runtime_error("Particle addition failed");
+    // Move the state of a particle created outside the mesh to the particle
+    // store of the mesh, particles created by the mesh are already in it
+    particle->assign_particle_store(particle_store_);
   } catch (std::exception& exception) {
     console_->error("{} #{}: {}\n", __FILE__, __LINE__, exception.what());
     status = false;
@@ -637,24 +941,19 @@ bool mpm::Mesh<Tdim>::remove_particle_by_id(mpm::Index id) {
 template <unsigned Tdim>
 void mpm::Mesh<Tdim>::remove_particles(const std::vector<mpm::Index>& pids) {
   if (!pids.empty()) {
-    // Get MPI rank
-    int mpi_size = 1;
-#ifdef USE_MPI
-    MPI_Comm_size(MPI_COMM_WORLD, &mpi_size);
-#endif
+    tsl::robin_set<mpm::Index> remove_pids;
+    remove_pids.reserve(pids.size());
     for (auto& id : pids) {
       map_particles_[id]->remove_cell();
       map_particles_.remove(id);
+      remove_pids.insert(id);
     }
 
-    // Get number of particles to reserve size
-    unsigned nparticles = this->nparticles();
-    // Clear particles and start a new element of particles
-    particles_.clear();
-    particles_.reserve(static_cast<int>(nparticles / mpi_size));
-    // Iterate over the map of particles and add them to container
-    for (auto& particle : map_particles_)
-      particles_.add(particle.second, false);
+    // Remove particles from the container in a single pass
+    particles_.remove_if(
+        [&remove_pids](const std::shared_ptr<mpm::ParticleBase<Tdim>>& ptr) {
+          return remove_pids.find(ptr->id()) != remove_pids.end();
+        });
   }
 }
 
@@ -663,13 +962,12 @@ template <unsigned Tdim>
 void mpm::Mesh<Tdim>::remove_all_nonrank_particles() {
   // Get MPI rank
   int mpi_rank = 0;
-  int mpi_size = 1;
 #ifdef USE_MPI
-  MPI_Comm_size(MPI_COMM_WORLD, &mpi_size);
   MPI_Comm_rank(MPI_COMM_WORLD, &mpi_rank);
 #endif
 
   // Remove associated cell for the particle
+  bool removed = false;
   for (auto citr = this->cells_.cbegin(); citr != this->cells_.cend(); ++citr) {
     // If cell is non empty
     if ((*citr)->particles().size() != 0 && (*citr)->rank() != mpi_rank) {
@@ -680,140 +978,106 @@ void mpm::Mesh<Tdim>::remove_all_nonrank_particles() {
         map_particles_.remove(id);
       }
       (*citr)->clear_particle_ids();
+      removed = true;
     }
   }
 
-  // Get number of particles to reserve size
-  unsigned nparticles = this->nparticles();
-  // Clear particles and start a new element of particles
-  particles_.clear();
-  particles_.reserve(static_cast<int>(nparticles / mpi_size));
-  // Iterate over the map of particles and add them to container
-  for (auto& particle : map_particles_) particles_.add(particle.second, false);
+  // Remove particles which are no longer in the map in a single pass, the
+  // order of the remaining particles is kept
+  if (removed)
+    particles_.remove_if(
+        [this](const std::shared_ptr<mpm::ParticleBase<Tdim>>& ptr) {
+          return map_particles_.find(ptr->id()) == map_particles_.end();
+        });
 }
 
-//! Transfer all particles in cells that are not in local rank
+//! Keep particles of a distributed mesh located in cells of the local rank
 template <unsigned Tdim>
-void mpm::Mesh<Tdim>::transfer_halo_particles() {
+bool mpm::Mesh<Tdim>::keep_rank_particles(std::vector<mpm::Index>& pids) {
+  int mpi_rank = 0;
 #ifdef USE_MPI
-  // Get number of MPI ranks
-  int mpi_size;
-  MPI_Comm_size(MPI_COMM_WORLD, &mpi_size);
-  int mpi_rank;
   MPI_Comm_rank(MPI_COMM_WORLD, &mpi_rank);
+#endif
+  const mpm::Index nparticles = pids.size();
 
-  if (mpi_size > 1) {
-    std::vector<MPI_Request> send_requests;
-    send_requests.reserve(ghost_cells_.size());
+  // Build the cell bucket grid to locate particles
+  if (cell_buckets_.empty() && structured_cells_.empty())
+    this->compute_cell_buckets();
 
-    unsigned i = 0;
-    unsigned np = 0;
-    std::vector<mpm::Index> remove_pids;
-    // Iterate through the ghost cells and send particles
-    for (auto citr = this->ghost_cells_.cbegin();
-         citr != this->ghost_cells_.cend(); ++citr, ++i) {
+  std::vector<mpm::Index> rank_pids, remove_pids;
+  rank_pids.reserve(nparticles);
+  for (const auto pid : pids) {
+    if (this->locate_rank_particle(map_particles_[pid], mpi_rank))
+      rank_pids.emplace_back(pid);
+    else
+      remove_pids.emplace_back(pid);
+  }
+  this->remove_particles(remove_pids);
+  pids = std::move(rank_pids);
 
-      // Send number of particles to receiver rank
-      auto particle_ids = (*citr)->particles();
-      unsigned nparticles = particle_ids.size();
-      MPI_Isend(&nparticles, 1, MPI_UNSIGNED, (*citr)->rank(), 1,
-                MPI_COMM_WORLD, &send_requests[i]);
+  // Particles kept by all ranks
+  mpm::Index nrank_particles = pids.size();
+#ifdef USE_MPI
+  MPI_Allreduce(MPI_IN_PLACE, &nrank_particles, 1, MPI_UNSIGNED_LONG_LONG,
+                MPI_SUM, MPI_COMM_WORLD);
+#endif
+  return (nrank_particles == nparticles);
+}
+
+//! Locate a particle of a distributed mesh in a cell of the local rank
+template <unsigned Tdim>
+bool mpm::Mesh<Tdim>::locate_rank_particle(
+    const std::shared_ptr<mpm::ParticleBase<Tdim>>& particle, int mpi_rank) {
+  if (!this->locate_particle_cells(particle, false)) return false;
+
+  // Cells holding a point share a node, so every rank which holds one of
+  // them as a local cell finds the same cell with the lowest id
+  const auto cell = map_cells_[particle->cell_id()];
+  const VectorDim coordinates = particle->coordinates();
+  Eigen::Matrix<double, Tdim, 1> xi;
+  for (const auto neighbour : cell->neighbours()) {
+    if (neighbour > cell->id()) break;
+    // Neighbours of a cell in the halo layer may be outside the mesh, they
+    // share no point with the cells of the local rank
+    if (map_cells_.find(neighbour) == map_cells_.end()) continue;
+    if (map_cells_[neighbour]->is_point_in_cell(coordinates, &xi)) {
+      particle->assign_cell_xi(map_cells_[neighbour], xi, false);
+      break;
     }
+  }
+  return (map_cells_[particle->cell_id()]->rank() == mpi_rank);
+}
 
-    // Iterate through the ghost cells and send particles
+//! Transfer particles in ghost cells to the rank of the ghost cell
+template <unsigned Tdim>
+void mpm::Mesh<Tdim>::transfer_halo_particles() {
+#ifdef USE_MPI
+  // Get number of MPI ranks
+  int mpi_size;
+  MPI_Comm_size(MPI_COMM_WORLD, &mpi_size);
+
+  if (mpi_size > 1) {
+    // Particles in ghost cells are sent to the rank of the cell, every
+    // neighbour rank receives a message even if it is empty
+    std::map<unsigned, std::vector<mpm::Index>> send_particles;
     for (auto citr = this->ghost_cells_.cbegin();
-         citr != this->ghost_cells_.cend(); ++citr, ++i) {
-      // Send number of particles to receiver rank
-      auto particle_ids = (*citr)->particles();
-      for (auto& id : particle_ids) {
-        // Create a vector of serialized particle
-        std::vector<uint8_t> buffer = map_particles_[id]->serialize();
-        MPI_Send(buffer.data(), buffer.size(), MPI_UINT8_T, (*citr)->rank(), 0,
-                 MPI_COMM_WORLD);
-        ++np;
-        // Particles to be removed from the current rank
-        remove_pids.emplace_back(id);
-      }
+         citr != this->ghost_cells_.cend(); ++citr) {
+      auto& pids = send_particles[(*citr)->rank()];
+      const auto& particle_ids = (*citr)->particles();
+      pids.insert(pids.end(), particle_ids.begin(), particle_ids.end());
       (*citr)->clear_particle_ids();
     }
-    // Remove all sent particles
-    this->remove_particles(remove_pids);
-    // Send complete
-    for (unsigned i = 0; i < this->ghost_cells_.size(); ++i)
-      MPI_Wait(&send_requests[i], MPI_STATUS_IGNORE);
-
-    // Particle id
-    mpm::Index pid = 0;
-    // Initial particle coordinates
-    Eigen::Matrix<double, Tdim, 1> pcoordinates =
-        Eigen::Matrix<double, Tdim, 1>::Zero();
 
-    // Iterate through the local ghost cells and receive particles
+    // Neighbour ranks of local ghost cells send particles to this rank
+    std::set<unsigned> recv_ranks;
     for (auto citr = this->local_ghost_cells_.cbegin();
          citr != this->local_ghost_cells_.cend(); ++citr) {
-      std::vector<unsigned> neighbour_ranks =
-          ghost_cells_neighbour_ranks_[(*citr)->id()];
-      // Total number of particles
-      std::vector<unsigned> nrank_particles(neighbour_ranks.size(), 0);
-      for (unsigned i = 0; i < neighbour_ranks.size(); ++i)
-        MPI_Recv(&nrank_particles[i], 1, MPI_UNSIGNED, neighbour_ranks[i], 1,
-                 MPI_COMM_WORLD, MPI_STATUS_IGNORE);
-
-      // Receive number of particles
-      unsigned nrecv_particles =
-          std::accumulate(nrank_particles.begin(), nrank_particles.end(), 0);
-
-      for (unsigned j = 0; j < nrecv_particles; ++j) {
-        // Retrieve information about the incoming message
-        MPI_Status status;
-        MPI_Probe(MPI_ANY_SOURCE, 0, MPI_COMM_WORLD, &status);
-
-        // Get buffer size
-        int size;
-        MPI_Get_count(&status, MPI_UINT8_T, &size);
-
-        // Allocate the buffer now that we know how many elements there are
-        std::vector<uint8_t> buffer;
-        buffer.resize(size);
-
-        // Finally receive the message
-        MPI_Recv(buffer.data(), size, MPI_UINT8_T, MPI_ANY_SOURCE, 0,
-                 MPI_COMM_WORLD, MPI_STATUS_IGNORE);
-
-        uint8_t* bufptr = const_cast<uint8_t*>(&buffer[0]);
-        int position = 0;
-
-        // Get particle type
-        int ptype;
-        MPI_Unpack(bufptr, buffer.size(), &position, &ptype, 1, MPI_INT,
-                   MPI_COMM_WORLD);
-        std::string particle_type = mpm::ParticleTypeName.at(ptype);
-
-        // Get materials material id
-        int nmaterials = 0;
-        MPI_Unpack(bufptr, buffer.size(), &position, &nmaterials, 1,
-                   MPI_UNSIGNED, MPI_COMM_WORLD);
-        // Vector of materials
-        std::vector<std::shared_ptr<mpm::Material<Tdim>>> materials;
-        materials.reserve(nmaterials);
-        for (unsigned k = 0; k < nmaterials; ++k) {
-          int mat_id;
-          MPI_Unpack(bufptr, buffer.size(), &position, &mat_id, 1, MPI_UNSIGNED,
-                     MPI_COMM_WORLD);
-          materials.emplace_back(materials_.at(mat_id));
-        }
-
-        // Create particle
-        auto particle =
-            Factory<mpm::ParticleBase<Tdim>, mpm::Index,
-                    const Eigen::Matrix<double, Tdim, 1>&>::instance()
-                ->create(particle_type, static_cast<mpm::Index>(pid),
-                         pcoordinates);
-        particle->deserialize(buffer, materials);
-        // Add particle to mesh
-        this->add_particle(particle, true);
-      }
+      const auto& neighbour_ranks =
+          ghost_cells_neighbour_ranks_.at((*citr)->id());
+      recv_ranks.insert(neighbour_ranks.begin(), neighbour_ranks.end());
     }
+
+    this->exchange_particles(send_particles, recv_ranks);
   }
 #endif
 }
@@ -830,238 +1094,1318 @@ void mpm::Mesh<Tdim>::transfer_nonrank_particles(
   MPI_Comm_rank(MPI_COMM_WORLD, &mpi_rank);
 
   if (mpi_size > 1) {
-    std::vector<MPI_Request> send_requests;
-    send_requests.reserve(exchange_cells.size());
-    std::vector<MPI_Request> send_particle_requests;
-    send_particle_requests.reserve(exchange_cells.size() * 100);
-    unsigned nsend_requests = 0;
-    unsigned np = 0;
-    std::vector<mpm::Index> remove_pids;
-    // Iterate through the ghost cells and send particles
+    std::map<unsigned, std::vector<mpm::Index>> send_particles;
+    std::set<unsigned> recv_ranks;
     for (auto cid : exchange_cells) {
       // Get cell pointer
       auto cell = map_cells_[cid];
+      if (cell->rank() == cell->previous_mpirank()) continue;
+
       // If the previous rank of cell is the current MPI rank,
       // then send all particles
-      if ((cell->rank() != cell->previous_mpirank()) &&
-          (cell->previous_mpirank() == mpi_rank)) {
-
-        // Send number of particles to receiver rank
-        unsigned nparticles = cell->nparticles();
-        MPI_Ibsend(&nparticles, 1, MPI_UNSIGNED, cell->rank(), 0,
-                   MPI_COMM_WORLD, &send_requests[nsend_requests]);
-
-        auto particle_ids = cell->particles();
-        for (auto& id : particle_ids) {
-          // Create a vector of serialized particle
-          std::vector<uint8_t> buffer = map_particles_[id]->serialize();
-          MPI_Ibsend(buffer.data(), buffer.size(), MPI_UINT8_T, cell->rank(), 0,
-                     MPI_COMM_WORLD, &send_particle_requests[np]);
-          ++np;
-
-          // Particles to be removed from the current rank
-          remove_pids.emplace_back(id);
-        }
+      if (cell->previous_mpirank() == mpi_rank) {
+        auto& pids = send_particles[cell->rank()];
+        const auto& particle_ids = cell->particles();
+        pids.insert(pids.end(), particle_ids.begin(), particle_ids.end());
         cell->clear_particle_ids();
-        ++nsend_requests;
       }
-    }
-    // Remove all sent particles
-    this->remove_particles(remove_pids);
-    // Send complete iterate only upto valid send requests
-    for (unsigned i = 0; i < nsend_requests; ++i)
-      MPI_Wait(&send_requests[i], MPI_STATUS_IGNORE);
-    // Send particles complete
-    for (unsigned i = 0; i < np; ++i)
-      MPI_Wait(&send_particle_requests[i], MPI_STATUS_IGNORE);
-
-    // Particle id
-    mpm::Index pid = 0;
-    // Initial particle coordinates
-    Eigen::Matrix<double, Tdim, 1> pcoordinates =
-        Eigen::Matrix<double, Tdim, 1>::Zero();
-
-    // Iterate through the ghost cells and receive particles
-    for (auto cid : exchange_cells) {
-      // Get cell pointer
-      auto cell = map_cells_[cid];
       // If the current rank is the MPI rank receive particles
-      if ((cell->rank() != cell->previous_mpirank()) &&
-          (cell->rank() == mpi_rank)) {
-        // Receive number of particles
-        unsigned nrecv_particles;
-        MPI_Recv(&nrecv_particles, 1, MPI_UNSIGNED, cell->previous_mpirank(), 0,
-                 MPI_COMM_WORLD, MPI_STATUS_IGNORE);
-
-        for (unsigned j = 0; j < nrecv_particles; ++j) {
-          // Retrieve information about the incoming message
-          MPI_Status status;
-          MPI_Probe(cell->previous_mpirank(), 0, MPI_COMM_WORLD, &status);
-
-          // Get buffer size
-          int size;
-          MPI_Get_count(&status, MPI_UINT8_T, &size);
-
-          // Allocate the buffer now that we know how many elements there are
-          std::vector<uint8_t> buffer;
-          buffer.resize(size);
-
-          // Finally receive the message
-          MPI_Recv(buffer.data(), size, MPI_UINT8_T, cell->previous_mpirank(),
-                   0, MPI_COMM_WORLD, MPI_STATUS_IGNORE);
-
-          uint8_t* bufptr = const_cast<uint8_t*>(&buffer[0]);
-          int position = 0;
-
-          // Get particle type
-          int ptype;
-          MPI_Unpack(bufptr, buffer.size(), &position, &ptype, 1, MPI_INT,
-                     MPI_COMM_WORLD);
-          std::string particle_type = mpm::ParticleTypeName.at(ptype);
-
-          // Get materials material id
-          int nmaterials = 0;
-          MPI_Unpack(bufptr, buffer.size(), &position, &nmaterials, 1,
-                     MPI_UNSIGNED, MPI_COMM_WORLD);
-          std::vector<std::shared_ptr<mpm::Material<Tdim>>> materials;
-          materials.reserve(nmaterials);
-          for (unsigned k = 0; k < nmaterials; ++k) {
-            int mat_id;
-            MPI_Unpack(bufptr, buffer.size(), &position, &mat_id, 1,
-                       MPI_UNSIGNED, MPI_COMM_WORLD);
-            // Get material
-            materials.emplace_back(materials_.at(mat_id));
-          }
-
-          // Create particle
-          auto particle =
-              Factory<mpm::ParticleBase<Tdim>, mpm::Index,
-                      const Eigen::Matrix<double, Tdim, 1>&>::instance()
-                  ->create(particle_type, static_cast<mpm::Index>(pid),
-                           pcoordinates);
-          particle->deserialize(buffer, materials);
-          // Add particle to mesh
-          this->add_particle(particle, true);
-        }
-      }
+      if (cell->rank() == mpi_rank) recv_ranks.insert(cell->previous_mpirank());
     }
+
+    this->exchange_particles(send_particles, recv_ranks);
   }
 #endif
 }
 
-//! Find shared nodes across MPI domains
+//! Remove all cells and nodes outside the local rank and its halo layer
 template <unsigned Tdim>
-void mpm::Mesh<Tdim>::find_domain_shared_nodes() {
-  // Clear MPI rank at the nodes
-#pragma omp parallel for schedule(runtime)
-  for (auto nitr = nodes_.cbegin(); nitr != nodes_.cend(); ++nitr)
-    (*nitr)->clear_mpi_ranks();
-
-  // Get MPI rank
+void mpm::Mesh<Tdim>::remove_all_nonrank_cells() {
   int mpi_rank = 0;
 #ifdef USE_MPI
   MPI_Comm_rank(MPI_COMM_WORLD, &mpi_rank);
 #endif
 
-#pragma omp parallel for schedule(runtime)
-  // Assign MPI rank to nodes of cell
+  // Nodes of cells in the local rank
+  tsl::robin_set<mpm::Index> rank_nodes;
   for (auto citr = cells_.cbegin(); citr != cells_.cend(); ++citr)
-    (*citr)->assign_mpi_rank_to_nodes();
-
-  this->domain_shared_nodes_.clear();
+    if ((*citr)->rank() == mpi_rank)
+      for (const auto& node : (*citr)->nodes()) rank_nodes.insert(node->id());
 
-#ifdef USE_HALO_EXCHANGE
-  ncomms_ = 0;
-  for (auto nitr = nodes_.cbegin(); nitr != nodes_.cend(); ++nitr) {
-    // If node has more than 1 MPI rank
-    std::set<unsigned> nodal_mpi_ranks = (*nitr)->mpi_ranks();
-    const unsigned nodal_mpi_ranks_size = nodal_mpi_ranks.size();
-    if (nodal_mpi_ranks_size > 1) {
-      if (nodal_mpi_ranks.find(mpi_rank) != nodal_mpi_ranks.end()) {
-        // Create Ghost ID
-        (*nitr)->ghost_id(ncomms_);
-        // Add to list of shared nodes on local rank
-        domain_shared_nodes_.add(*nitr);
-        ncomms_ += nodal_mpi_ranks_size - 1;
-      }
-    }
+  // Keep cells of the local rank and halo cells sharing a node with them
+  tsl::robin_set<mpm::Index> keep_cells, keep_nodes;
+  Vector<Cell<Tdim>> cells;
+  for (auto citr = cells_.cbegin(); citr != cells_.cend(); ++citr) {
+    const auto& nodes = (*citr)->nodes();
+    bool keep = ((*citr)->rank() == mpi_rank);
+    for (auto nitr = nodes.cbegin(); !keep && nitr != nodes.cend(); ++nitr)
+      if (rank_nodes.find((*nitr)->id()) != rank_nodes.end()) keep = true;
+
+    if (keep) {
+      cells.add(*citr, false);
+      keep_cells.insert((*citr)->id());
+      for (const auto& node : nodes) keep_nodes.insert(node->id());
+    } else
+      map_cells_.remove((*citr)->id());
   }
-#else
-  nhalo_nodes_ = 0;
+  cells_ = std::move(cells);
+
+  // Keep nodes of the remaining cells
+  const auto keep_node = [&keep_nodes](
+                             const std::shared_ptr<NodeBase<Tdim>>& node) {
+    return keep_nodes.find(node->id()) != keep_nodes.end();
+  };
+  Vector<NodeBase<Tdim>> nodes;
   for (auto nitr = nodes_.cbegin(); nitr != nodes_.cend(); ++nitr) {
-    std::set<unsigned> nodal_mpi_ranks = (*nitr)->mpi_ranks();
-    // If node has more than 1 MPI rank
-    if (nodal_mpi_ranks.size() > 1) {
-      (*nitr)->ghost_id(nhalo_nodes_);
-      nhalo_nodes_ += 1;
-      // Add to domain shared nodes only if active on current MPI rank
-      if (nodal_mpi_ranks.find(mpi_rank) != nodal_mpi_ranks.end())
-        domain_shared_nodes_.add(*nitr);
-    }
+    if (keep_node(*nitr))
+      nodes.add(*nitr, false);
+    else
+      map_nodes_.remove((*nitr)->id());
   }
-#endif
-}
-
-//! Locate particles in a cell
-template <unsigned Tdim>
-std::vector<std::shared_ptr<mpm::ParticleBase<Tdim>>>
-    mpm::Mesh<Tdim>::locate_particles_mesh() {
-
-  std::vector<std::shared_ptr<mpm::ParticleBase<Tdim>>> particles;
+  nodes_ = std::move(nodes);
 
-  std::for_each(particles_.cbegin(), particles_.cend(),
-                [=, &particles](
-                    const std::shared_ptr<mpm::ParticleBase<Tdim>>& particle) {
-                  // If particle is not found in mesh add to a list of particles
-                  if (!this->locate_particle_cells(particle))
-                    particles.emplace_back(particle);
-                });
+  // Remove neighbours which are no longer in the mesh
+  for (auto citr = cells_.cbegin(); citr != cells_.cend(); ++citr)
+    for (const auto neighbour : (*citr)->neighbours())
+      if (keep_cells.find(neighbour) == keep_cells.end())
+        (*citr)->remove_neighbour(neighbour);
+
+  // Sets only hold the remaining cells and nodes
+  for (auto sitr = node_sets_.begin(); sitr != node_sets_.end(); ++sitr) {
+    Vector<NodeBase<Tdim>> set_nodes;
+    for (auto nitr = sitr->second.cbegin(); nitr != sitr->second.cend(); ++nitr)
+      if (keep_node(*nitr)) set_nodes.add(*nitr, false);
+    sitr.value() = std::move(set_nodes);
+  }
+  for (auto sitr = cell_sets_.begin(); sitr != cell_sets_.end(); ++sitr) {
+    Vector<Cell<Tdim>> set_cells;
+    for (auto citr = sitr->second.cbegin(); citr != sitr->second.cend(); ++citr)
+      if (keep_cells.find((*citr)->id()) != keep_cells.end())
+        set_cells.add(*citr, false);
+    sitr.value() = std::move(set_cells);
+  }
+  Vector<NodeBase<Tdim>> boundary_nodes;
+  for (auto nitr = boundary_nodes_.cbegin(); nitr != boundary_nodes_.cend();
+       ++nitr)
+    if (keep_node(*nitr)) boundary_nodes.add(*nitr, false);
+  boundary_nodes_ = std::move(boundary_nodes);
 
-  return particles;
+  distributed_ = true;
+  this->index_distributed_mesh();
 }
 
-//! Locate particles in a cell
+//! Create the cells of the local rank and a halo layer of a distributed mesh
 template <unsigned Tdim>
-bool mpm::Mesh<Tdim>::locate_particle_cells(
-    const std::shared_ptr<mpm::ParticleBase<Tdim>>& particle) {
-  // Check the current cell if it is not invalid
-  if (particle->cell_id() != std::numeric_limits<mpm::Index>::max()) {
-    // If a cell id is present, but not a cell locate the cell from map
-    if (!particle->cell_ptr())
-      particle->assign_cell(map_cells_[particle->cell_id()]);
-    if (particle->compute_reference_location()) return true;
+bool mpm::Mesh<Tdim>::create_distributed_mesh(
+    const std::string& node_type, const std::vector<mpm::Index>& node_ids,
+    const std::vector<VectorDim>& coordinates,
+    const std::shared_ptr<mpm::Element<Tdim>>& element,
+    const std::vector<mpm::Index>& cell_ids,
+    const std::vector<std::vector<mpm::Index>>& cells,
+    const std::vector<unsigned>& cell_ranks) {
+  bool status = true;
+  try {
+    if (coordinates.empty())
+      throw std::runtime_error("List of coordinates is empty");
+    if (cells.empty())
+      throw std::runtime_error("List of nodes of cells is empty");
+    if (node_ids.size() != coordinates.size())
+      throw std::runtime_error("Number of nodes and coordinates don't match");
+    if (cells.size() != cell_ids.size() || cells.size() != cell_ranks.size())
+      throw std::runtime_error("Number of cells and cell ranks don't match");
 
-    // Check if material point is in any of its nearest neighbours
-    const auto neighbours = map_cells_[particle->cell_id()]->neighbours();
-    Eigen::Matrix<double, Tdim, 1> xi;
-    Eigen::Matrix<double, Tdim, 1> coordinates = particle->coordinates();
-    for (auto neighbour : neighbours) {
-      if (map_cells_[neighbour]->is_point_in_cell(coordinates, &xi)) {
-        particle->assign_cell_xi(map_cells_[neighbour], xi);
-        return true;
+    int mpi_rank = 0;
+#ifdef USE_MPI
+    MPI_Comm_rank(MPI_COMM_WORLD, &mpi_rank);
+#endif
+
+    // Nodes of cells in the local rank
+    tsl::robin_set<mpm::Index> rank_nodes;
+    for (mpm::Index i = 0; i < cells.size(); ++i)
+      if (cell_ranks[i] == mpi_rank)
+        rank_nodes.insert(cells[i].cbegin(), cells[i].cend());
+
+    // Cells of the local rank and halo cells sharing a node with them
+    std::vector<mpm::Index> mesh_cells;
+    tsl::robin_set<mpm::Index> mesh_nodes;
+    for (mpm::Index i = 0; i < cells.size(); ++i) {
+      const auto& nodes = cells[i];
+      bool keep = (cell_ranks[i] == mpi_rank);
+      for (auto nitr = nodes.cbegin(); !keep && nitr != nodes.cend(); ++nitr)
+        if (rank_nodes.find(*nitr) != rank_nodes.end()) keep = true;
+
+      if (keep) {
+        mesh_cells.emplace_back(i);
+        mesh_nodes.insert(nodes.cbegin(), nodes.cend());
       }
     }
-  }
 
-  bool status = false;
-#pragma omp parallel for schedule(runtime)
-  for (auto citr = cells_.cbegin(); citr != cells_.cend(); ++citr) {
-    // Check if particle is already found, if so don't run for other cells
-    // Check if co-ordinates is within the cell, if true
-    // add particle to cell
-    Eigen::Matrix<double, Tdim, 1> xi;
-    if (!status && (*citr)->is_point_in_cell(particle->coordinates(), &xi)) {
-      particle->assign_cell_xi(*citr, xi);
-      status = true;
+    // Node type is used to create nodes transferred to the rank
+    node_type_ = node_type;
+    for (mpm::Index i = 0; i < node_ids.size(); ++i) {
+      if (mesh_nodes.find(node_ids[i]) == mesh_nodes.end()) continue;
+      bool insert_status = this->add_node(
+          Factory<mpm::NodeBase<Tdim>, mpm::Index,
+                  const Eigen::Matrix<double, Tdim, 1>&>::instance()
+              ->create(node_type, static_cast<mpm::Index>(node_ids[i]),
+                       coordinates[i]),
+          false);
+      if (!insert_status)
+        throw std::runtime_error("Addition of node to mesh failed!");
     }
-  }
-
-  return status;
-}
 
-//! Iterate over particles
-template <unsigned Tdim>
-template <typename Toper>
+    for (const auto i : mesh_cells) {
+      const auto& nodes = cells[i];
+      auto cell = std::make_shared<mpm::Cell<Tdim>>(
+          cell_ids[i], nodes.size(), element, this->isoparametric_);
+      // Cell local node id
+      unsigned local_nid = 0;
+      for (const auto nid : nodes) {
+        if (map_nodes_.find(nid) == map_nodes_.end())
+          throw std::runtime_error("Node of cell is not in the list of nodes");
+        cell->add_node(local_nid, map_nodes_[nid]);
+        ++local_nid;
+      }
+      if (cell->nnodes() != nodes.size())
+        throw std::runtime_error("Invalid node ids for cell!");
+
+      // Initialise cell before insertion
+      cell->initialise();
+      if (!cell->is_initialised() || !this->add_cell(cell, false))
+        throw std::runtime_error("Addition of cell to mesh failed!");
+      cell->rank(cell_ranks[i]);
+    }
+
+    this->find_cell_neighbours();
+    distributed_ = true;
+    this->index_distributed_mesh();
+  } catch (std::exception& exception) {
+    console_->error("{} #{}: {}\n", __FILE__, __LINE__, exception.what());
+    status = false;
+  }
+  return status;
+}
+
+//! Transfer cells and nodes of a distributed mesh after a repartition
+template <unsigned Tdim>
+void mpm::Mesh<Tdim>::transfer_nonrank_cells(
+    std::vector<mpm::Index>& exchange_cells) {
+#ifdef USE_MPI
+  // Get number of MPI ranks
+  int mpi_size;
+  MPI_Comm_size(MPI_COMM_WORLD, &mpi_size);
+  int mpi_rank;
+  MPI_Comm_rank(MPI_COMM_WORLD, &mpi_rank);
+
+  if (mpi_size > 1) {
+    // Message tags of cell ranks, cell and node indices and nodes
+    const int rank_tag = 3;
+    const int index_tag = 4;
+    const int node_tag = 5;
+
+    // Cells of the local rank before the repartition
+    const tsl::robin_set<mpm::Index> moved_cells(exchange_cells.cbegin(),
+                                                 exchange_cells.cend());
+    std::vector<std::shared_ptr<Cell<Tdim>>> rank_cells;
+    for (auto citr = cells_.cbegin(); citr != cells_.cend(); ++citr)
+      if ((*citr)->rank() == mpi_rank ||
+          moved_cells.find((*citr)->id()) != moved_cells.end())
+        rank_cells.emplace_back(*citr);
+
+    // New ranks of cells are sent to the neighbour ranks sharing a node with
+    // them, which hold the cells as halo cells. Ranks of nodes are still those
+    // of the previous partition.
+    std::map<unsigned, std::vector<mpm::Index>> send_ranks;
+    for (const auto& cell : rank_cells) {
+      std::set<unsigned> ranks;
+      for (const auto& node : cell->nodes())
+        for (const auto rank : node->mpi_ranks())
+          if (rank != mpi_rank && rank < mpi_size) ranks.insert(rank);
+      for (const auto rank : ranks) {
+        send_ranks[rank].emplace_back(cell->id());
+        send_ranks[rank].emplace_back(cell->rank());
+      }
+    }
+
+    // Send a buffer to each rank in send and receive one from each rank which
+    // sends to the local rank. Sizes of buffers are exchanged first, so that a
+    // rank need not receive from the ranks it sends to.
+    const auto exchange = [mpi_size](const auto& send, auto& recv,
+                                     MPI_Datatype type, int tag) {
+      std::vector<int> send_sizes(mpi_size, 0), recv_sizes(mpi_size, 0);
+      for (const auto& rank_buffer : send)
+        send_sizes[rank_buffer.first] = rank_buffer.second.size();
+      MPI_Alltoall(send_sizes.data(), 1, MPI_INT, recv_sizes.data(), 1,
+                   MPI_INT, MPI_COMM_WORLD);
+
+      std::vector<MPI_Request> requests;
+      requests.reserve(2 * mpi_size);
+      for (int rank = 0; rank < mpi_size; ++rank) {
+        if (recv_sizes[rank] == 0) continue;
+        auto& buffer = recv[rank];
+        buffer.resize(recv_sizes[rank]);
+        requests.emplace_back();
+        MPI_Irecv(buffer.data(), buffer.size(), type, rank, tag,
+                  MPI_COMM_WORLD, &requests.back());
+      }
+      for (const auto& rank_buffer : send) {
+        const auto& buffer = rank_buffer.second;
+        if (buffer.empty()) continue;
+        requests.emplace_back();
+        MPI_Isend(buffer.data(), buffer.size(), type, rank_buffer.first, tag,
+                  MPI_COMM_WORLD, &requests.back());
+      }
+      MPI_Waitall(requests.size(), requests.data(), MPI_STATUSES_IGNORE);
+    };
+
+    // Update the rank of a cell in the mesh, particles of cells moved to the
+    // local rank are received
+    const auto update_rank = [mpi_rank, &exchange_cells](
+                                 const std::shared_ptr<Cell<Tdim>>& cell,
+                                 unsigned rank) {
+      if (cell->rank() == rank) return;
+      cell->rank(rank);
+      if (rank == mpi_rank) exchange_cells.emplace_back(cell->id());
+    };
+
+    // Update ranks of halo cells
+    std::map<unsigned, std::vector<mpm::Index>> recv_ranks;
+    exchange(send_ranks, recv_ranks, MPI_UNSIGNED_LONG_LONG, rank_tag);
+    for (const auto& rank_ids : recv_ranks) {
+      const auto& ids = rank_ids.second;
+      for (std::size_t i = 0; i + 1 < ids.size(); i += 2) {
+        const auto citr = map_cells_.find(ids[i]);
+        if (citr != map_cells_.end()) update_rank(citr->second, ids[i + 1]);
+      }
+    }
+
+    // A cell moved to another rank is sent with its neighbours, which
+    // complete the halo layer of the rank
+    std::map<unsigned, std::set<mpm::Index>> send_cells;
+    for (const auto& cell : rank_cells) {
+      if (cell->rank() == mpi_rank) continue;
+      auto& cell_ids = send_cells[cell->rank()];
+      cell_ids.insert(cell->id());
+      for (const auto neighbour : cell->neighbours())
+        if (map_cells_.find(neighbour) != map_cells_.end())
+          cell_ids.insert(neighbour);
+    }
+
+    // Ids of the sets which hold a node or a cell
+    const auto set_ids = [](const auto& sets) {
+      tsl::robin_map<mpm::Index, std::vector<mpm::Index>> ids;
+      for (auto sitr = sets.cbegin(); sitr != sets.cend(); ++sitr)
+        for (auto itr = sitr->second.cbegin(); itr != sitr->second.cend();
+             ++itr)
+          ids[(*itr)->id()].emplace_back(sitr->first);
+      return ids;
+    };
+    const auto node_set_ids = set_ids(node_sets_);
+    const auto cell_set_ids = set_ids(cell_sets_);
+    const auto pack_set_ids = [](const auto& ids, mpm::Index id,
+                                 std::vector<mpm::Index>& indices) {
+      const auto itr = ids.find(id);
+      if (itr == ids.end()) {
+        indices.emplace_back(0);
+        return;
+      }
+      indices.emplace_back(itr->second.size());
+      indices.insert(indices.end(), itr->second.begin(), itr->second.end());
+    };
+
+    // Pack nodes as [id, nbytes, nsets, set ids] with the serialized nodes,
+    // and cells as [id, rank, previous rank, element type, nnodes, node ids,
+    // nsets, set ids]. The previous rank of a cell is the local rank if it
+    // held the cell before the repartition.
+    std::map<unsigned, std::vector<mpm::Index>> send_indices;
+    std::map<unsigned, std::vector<uint8_t>> send_nodes;
+    for (const auto& rank_ids : send_cells) {
+      auto& indices = send_indices[rank_ids.first];
+      auto& node_buffer = send_nodes[rank_ids.first];
+      const auto& cell_ids = rank_ids.second;
+
+      std::set<mpm::Index> node_ids;
+      for (const auto id : cell_ids)
+        for (const auto nid : map_cells_[id]->nodes_id()) node_ids.insert(nid);
+
+      indices.emplace_back(node_ids.size());
+      for (const auto nid : node_ids) {
+        const auto buffer = map_nodes_[nid]->serialize();
+        indices.emplace_back(nid);
+        indices.emplace_back(buffer.size());
+        pack_set_ids(node_set_ids, nid, indices);
+        node_buffer.insert(node_buffer.end(), buffer.begin(), buffer.end());
+      }
+
+      indices.emplace_back(cell_ids.size());
+      for (const auto id : cell_ids) {
+        const auto cell = map_cells_[id];
+        const bool rank_cell = (cell->rank() == mpi_rank ||
+                                moved_cells.find(id) != moved_cells.end());
+        indices.emplace_back(id);
+        indices.emplace_back(cell->rank());
+        indices.emplace_back(rank_cell ? mpi_rank : cell->rank());
+        indices.emplace_back(ElementType.at(cell->element_ptr()->type()));
+        indices.emplace_back(cell->nnodes());
+        for (const auto& node : cell->nodes()) indices.emplace_back(node->id());
+        pack_set_ids(cell_set_ids, id, indices);
+      }
+    }
+
+    std::map<unsigned, std::vector<mpm::Index>> recv_indices;
+    std::map<unsigned, std::vector<uint8_t>> recv_nodes;
+    exchange(send_indices, recv_indices, MPI_UNSIGNED_LONG_LONG, index_tag);
+    exchange(send_nodes, recv_nodes, MPI_UINT8_T, node_tag);
+
+    // Create received nodes and cells which are not in the mesh
+    std::map<int, std::shared_ptr<const mpm::Element<Tdim>>> elements;
+    for (const auto& rank_indices : recv_indices) {
+      const auto& indices = rank_indices.second;
+      const auto& node_buffer = recv_nodes[rank_indices.first];
+      std::size_t i = 0, position = 0;
+
+      const mpm::Index nnodes = indices[i++];
+      for (mpm::Index n = 0; n < nnodes; ++n) {
+        const mpm::Index nid = indices[i++];
+        const mpm::Index nbytes = indices[i++];
+        const mpm::Index nsets = indices[i++];
+        const std::vector<uint8_t> buffer(
+            node_buffer.begin() + position,
+            node_buffer.begin() + position + nbytes);
+        position += nbytes;
+        if (map_nodes_.find(nid) == map_nodes_.end()) {
+          if (node_type_.empty())
+            throw std::runtime_error("Node type of received nodes is unknown");
+          auto node = Factory<mpm::NodeBase<Tdim>, mpm::Index,
+                              const Eigen::Matrix<double, Tdim, 1>&>::instance()
+                          ->create(node_type_, static_cast<mpm::Index>(nid),
+                                   VectorDim::Zero());
+          node->deserialize(buffer, force_functions_);
+          this->add_node(node, false);
+          for (mpm::Index s = 0; s < nsets; ++s)
+            node_sets_[indices[i + s]].add(node, false);
+        }
+        i += nsets;
+      }
+
+      const mpm::Index ncells = indices[i++];
+      for (mpm::Index c = 0; c < ncells; ++c) {
+        const mpm::Index id = indices[i++];
+        const unsigned cell_rank = indices[i++];
+        const unsigned previous_rank = indices[i++];
+        const int element_type = indices[i++];
+        const unsigned nnodes_cell = indices[i++];
+        const auto citr = map_cells_.find(id);
+        if (citr != map_cells_.end()) {
+          update_rank(citr->second, cell_rank);
+          i += nnodes_cell;
+          i += 1 + indices[i];
+          continue;
+        }
+
+        // Element of the cell is created once for each type
+        auto& element = elements[element_type];
+        if (element == nullptr)
+          element = Factory<mpm::Element<Tdim>>::instance()->create(
+              ElementTypeName.at(element_type));
+        auto cell = std::make_shared<mpm::Cell<Tdim>>(id, nnodes_cell, element,
+                                                      this->isoparametric_);
+        for (unsigned k = 0; k < nnodes_cell; ++k)
+          cell->add_node(k, map_nodes_[indices[i++]]);
+        cell->initialise();
+        cell->rank(previous_rank);
+        cell->rank(cell_rank);
+        this->add_cell(cell, false);
+        // Particles of a cell moved to the local rank are received
+        if (cell_rank == mpi_rank && previous_rank != mpi_rank)
+          exchange_cells.emplace_back(id);
+
+        const mpm::Index nsets = indices[i++];
+        for (mpm::Index s = 0; s < nsets; ++s)
+          cell_sets_[indices[i++]].add(cell, false);
+      }
+    }
+
+    // Neighbours of received cells
+    this->find_cell_neighbours();
+    this->index_distributed_mesh();
+  }
+#endif
+}
+
+//! Return the local index of a cell of a distributed mesh
+template <unsigned Tdim>
+mpm::Index mpm::Mesh<Tdim>::local_cell_index(mpm::Index id) const {
+  const auto itr = local_cells_.find(id);
+  return (itr != local_cells_.end()) ? itr->second
+                                     : std::numeric_limits<mpm::Index>::max();
+}
+
+//! Return the local index of a node of a distributed mesh
+template <unsigned Tdim>
+mpm::Index mpm::Mesh<Tdim>::local_node_index(mpm::Index id) const {
+  const auto itr = local_nodes_.find(id);
+  return (itr != local_nodes_.end()) ? itr->second
+                                     : std::numeric_limits<mpm::Index>::max();
+}
+
+//! Return the ranks which own a neighbour of a cell of the local rank
+template <unsigned Tdim>
+std::set<unsigned> mpm::Mesh<Tdim>::neighbour_ranks() const {
+  int mpi_rank = 0;
+#ifdef USE_MPI
+  MPI_Comm_rank(MPI_COMM_WORLD, &mpi_rank);
+#endif
+
+  std::set<unsigned> ranks;
+  for (auto citr = cells_.cbegin(); citr != cells_.cend(); ++citr) {
+    if ((*citr)->rank() != mpi_rank) continue;
+    for (const auto neighbour : (*citr)->neighbours()) {
+      const auto nitr = map_cells_.find(neighbour);
+      if (nitr != map_cells_.end() && nitr->second->rank() != mpi_rank)
+        ranks.insert(nitr->second->rank());
+    }
+  }
+  return ranks;
+}
+
+//! Shift boundary cells of the local rank to neighbour ranks
+template <unsigned Tdim>
+std::vector<mpm::Index> mpm::Mesh<Tdim>::shift_boundary_cells(
+    const std::map<unsigned, double>& nparticles) {
+  int mpi_rank = 0;
+#ifdef USE_MPI
+  MPI_Comm_rank(MPI_COMM_WORLD, &mpi_rank);
+#endif
+
+  // Boundary cells of the local rank with their number of neighbours in each
+  // neighbour rank to which particles are sent
+  std::map<unsigned,
+           std::vector<std::pair<unsigned, std::shared_ptr<Cell<Tdim>>>>>
+      boundary_cells;
+  mpm::Index nrank_cells = 0;
+  for (auto citr = cells_.cbegin(); citr != cells_.cend(); ++citr) {
+    if ((*citr)->rank() != mpi_rank) continue;
+    ++nrank_cells;
+    std::map<unsigned, unsigned> nneighbours;
+    for (const auto neighbour : (*citr)->neighbours()) {
+      const auto nitr = map_cells_.find(neighbour);
+      if (nitr == map_cells_.end()) continue;
+      const unsigned rank = nitr->second->rank();
+      if (rank != mpi_rank && nparticles.find(rank) != nparticles.end())
+        ++nneighbours[rank];
+    }
+    for (const auto& neighbours : nneighbours)
+      boundary_cells[neighbours.first].emplace_back(neighbours.second, *citr);
+  }
+
+  std::vector<mpm::Index> exchange_cells;
+  for (auto& target : boundary_cells) {
+    // Cells deepest in the neighbour rank first to keep partitions compact
+    auto& cells = target.second;
+    std::stable_sort(
+        cells.begin(), cells.end(),
+        [](const std::pair<unsigned, std::shared_ptr<Cell<Tdim>>>& a,
+           const std::pair<unsigned, std::shared_ptr<Cell<Tdim>>>& b) {
+          return a.first > b.first;
+        });
+
+    double remaining = nparticles.at(target.first);
+    for (const auto& candidate : cells) {
+      if (remaining <= 0.) break;
+      const auto& cell = candidate.second;
+      const double ncell_particles = cell->nparticles();
+      // A cell is shifted once and only if it reduces the remaining particles
+      if (cell->rank() != mpi_rank || ncell_particles == 0 ||
+          ncell_particles >= 2. * remaining ||
+          exchange_cells.size() + 1 >= nrank_cells)
+        continue;
+      cell->rank(target.first);
+      exchange_cells.emplace_back(cell->id());
+      remaining -= ncell_particles;
+    }
+  }
+
+#ifdef USE_MPI
+  // Ranks of shifted cells of all ranks in a global mesh
+  int mpi_size = 1;
+  MPI_Comm_size(MPI_COMM_WORLD, &mpi_size);
+  if (!distributed_ && mpi_size > 1) {
+    // Shifted cells as pairs of cell id and new rank
+    std::vector<mpm::Index> shifted;
+    shifted.reserve(2 * exchange_cells.size());
+    for (const auto id : exchange_cells) {
+      shifted.emplace_back(id);
+      shifted.emplace_back(map_cells_[id]->rank());
+    }
+
+    int nshifted = shifted.size();
+    std::vector<int> counts(mpi_size, 0);
+    MPI_Allgather(&nshifted, 1, MPI_INT, counts.data(), 1, MPI_INT,
+                  MPI_COMM_WORLD);
+    std::vector<int> displacements(mpi_size, 0);
+    std::partial_sum(counts.begin(), counts.end() - 1,
+                     displacements.begin() + 1);
+    std::vector<mpm::Index> all_shifted(displacements.back() + counts.back());
+    MPI_Allgatherv(shifted.data(), nshifted, MPI_UNSIGNED_LONG_LONG,
+                   all_shifted.data(), counts.data(), displacements.data(),
+                   MPI_UNSIGNED_LONG_LONG, MPI_COMM_WORLD);
+
+    exchange_cells.clear();
+    for (std::size_t i = 0; i < all_shifted.size(); i += 2) {
+      auto cell = map_cells_[all_shifted[i]];
+      if (cell->rank() != all_shifted[i + 1]) cell->rank(all_shifted[i + 1]);
+      exchange_cells.emplace_back(all_shifted[i]);
+    }
+  }
+#endif
+  return exchange_cells;
+}
+
+//! Order cells and nodes of a distributed mesh by id and index them
+template <unsigned Tdim>
+void mpm::Mesh<Tdim>::index_distributed_mesh() {
+  // Cells in the order of ids
+  std::vector<std::shared_ptr<Cell<Tdim>>> cells(cells_.cbegin(),
+                                                 cells_.cend());
+  std::sort(cells.begin(), cells.end(),
+            [](const std::shared_ptr<Cell<Tdim>>& a,
+               const std::shared_ptr<Cell<Tdim>>& b) {
+              return a->id() < b->id();
+            });
+  cells_.clear();
+  cells_.reserve(cells.size());
+  local_cells_.clear();
+  local_cells_.reserve(cells.size());
+  for (mpm::Index i = 0; i < cells.size(); ++i) {
+    cells_.add(cells[i], false);
+    local_cells_.insert(std::make_pair(cells[i]->id(), i));
+  }
+
+  // Nodes in the order of ids, which matches shared nodes across ranks
+  std::vector<std::shared_ptr<NodeBase<Tdim>>> nodes(nodes_.cbegin(),
+                                                     nodes_.cend());
+  std::sort(nodes.begin(), nodes.end(),
+            [](const std::shared_ptr<NodeBase<Tdim>>& a,
+               const std::shared_ptr<NodeBase<Tdim>>& b) {
+              return a->id() < b->id();
+            });
+  nodes_.clear();
+  nodes_.reserve(nodes.size());
+  local_nodes_.clear();
+  local_nodes_.reserve(nodes.size());
+  for (mpm::Index i = 0; i < nodes.size(); ++i) {
+    nodes_.add(nodes[i], false);
+    local_nodes_.insert(std::make_pair(nodes[i]->id(), i));
+  }
+
+  // Lookups of cells and nodes are recomputed for the new set of cells
+  cell_colours_.clear();
+  cell_buckets_.clear();
+  structured_cells_.clear();
+  active_nodes_.clear();
+  active_node_indices_.clear();
+  active_constrained_nodes_.clear();
+  if (!cell_order_.empty()) this->reorder_mesh();
+
+  // Shared nodes and ghost cells of the new set of cells
+  this->find_domain_shared_nodes();
+  this->find_ghost_boundary_cells();
+
+  // Colours and the structured grid are recomputed if they were in use, a
+  // reordered mesh is coloured in the new order
+  if (coloured_cells_ && cell_colours_.empty()) this->compute_cell_colours();
+  if (structured_grid_) this->compute_structured_grid();
+}
+
+//! Exchange particles with batched messages between ranks
+template <unsigned Tdim>
+void mpm::Mesh<Tdim>::exchange_particles(
+    const std::map<unsigned, std::vector<mpm::Index>>& send_particles,
+    const std::set<unsigned>& recv_ranks) {
+#ifdef USE_MPI
+  // Message tag of batched particles
+  const int tag = 2;
+
+  // Pack particles for each destination rank as records of
+  // [record size, serialized particle]
+  std::vector<std::vector<uint8_t>> send_buffers;
+  send_buffers.reserve(send_particles.size());
+  std::vector<MPI_Request> send_requests(send_particles.size());
+  std::vector<mpm::Index> remove_pids;
+  unsigned i = 0;
+  for (const auto& rank_particles : send_particles) {
+    send_buffers.emplace_back();
+    auto& buffer = send_buffers.back();
+    for (const auto id : rank_particles.second) {
+      const std::vector<uint8_t> record = map_particles_[id]->serialize();
+      const uint32_t record_size = record.size();
+      const uint8_t* size_ptr = reinterpret_cast<const uint8_t*>(&record_size);
+      buffer.insert(buffer.end(), size_ptr, size_ptr + sizeof(record_size));
+      buffer.insert(buffer.end(), record.begin(), record.end());
+      // Particles to be removed from the current rank
+      remove_pids.emplace_back(id);
+    }
+    MPI_Isend(buffer.data(), buffer.size(), MPI_UINT8_T, rank_particles.first,
+              tag, MPI_COMM_WORLD, &send_requests[i]);
+    ++i;
+  }
+  // Remove all sent particles
+  this->remove_particles(remove_pids);
+
+  // Particle id
+  mpm::Index pid = 0;
+  // Initial particle coordinates
+  Eigen::Matrix<double, Tdim, 1> pcoordinates =
+      Eigen::Matrix<double, Tdim, 1>::Zero();
+
+  // Receive a single message from each source rank
+  std::vector<uint8_t> buffer;
+  std::vector<uint8_t> record;
+  for (const auto rank : recv_ranks) {
+    MPI_Status status;
+    MPI_Probe(rank, tag, MPI_COMM_WORLD, &status);
+    int size;
+    MPI_Get_count(&status, MPI_UINT8_T, &size);
+    buffer.resize(size);
+    MPI_Recv(buffer.data(), size, MPI_UINT8_T, rank, tag, MPI_COMM_WORLD,
+             MPI_STATUS_IGNORE);
+
+    std::size_t offset = 0;
+    while (offset < buffer.size()) {
+      uint32_t record_size;
+      std::memcpy(&record_size, &buffer[offset], sizeof(record_size));
+      offset += sizeof(record_size);
+      record.assign(buffer.begin() + offset,
+                    buffer.begin() + offset + record_size);
+      offset += record_size;
+
+      uint8_t* bufptr = record.data();
+      int position = 0;
+
+      // Get particle type
+      int ptype;
+      MPI_Unpack(bufptr, record.size(), &position, &ptype, 1, MPI_INT,
+                 MPI_COMM_WORLD);
+      std::string particle_type = mpm::ParticleTypeName.at(ptype);
+
+      // Get materials material id
+      int nmaterials = 0;
+      MPI_Unpack(bufptr, record.size(), &position, &nmaterials, 1,
+                 MPI_UNSIGNED, MPI_COMM_WORLD);
+      std::vector<std::shared_ptr<mpm::Material<Tdim>>> materials;
+      materials.reserve(nmaterials);
+      for (unsigned k = 0; k < nmaterials; ++k) {
+        int mat_id;
+        MPI_Unpack(bufptr, record.size(), &position, &mat_id, 1, MPI_UNSIGNED,
+                   MPI_COMM_WORLD);
+        materials.emplace_back(materials_.at(mat_id));
+      }
+
+      // Create particle
+      auto particle = this->create_particle(particle_type, pid, pcoordinates);
+      particle->deserialize(record, materials);
+      // Add particle to mesh
+      this->add_particle(particle, true);
+    }
+  }
+
+  // Send complete
+  MPI_Waitall(send_requests.size(), send_requests.data(), MPI_STATUSES_IGNORE);
+#endif
+}
+
+//! Find shared nodes across MPI domains
+template <unsigned Tdim>
+void mpm::Mesh<Tdim>::find_domain_shared_nodes() {
+  // Clear MPI rank at the nodes
+#pragma omp parallel for schedule(runtime)
+  for (auto nitr = nodes_.cbegin(); nitr != nodes_.cend(); ++nitr)
+    (*nitr)->clear_mpi_ranks();
+
+  // Get MPI rank
+  int mpi_rank = 0;
+#ifdef USE_MPI
+  MPI_Comm_rank(MPI_COMM_WORLD, &mpi_rank);
+#endif
+
+#pragma omp parallel for schedule(runtime)
+  // Assign MPI rank to nodes of cell
+  for (auto citr = cells_.cbegin(); citr != cells_.cend(); ++citr)
+    (*citr)->assign_mpi_rank_to_nodes();
+
+  this->domain_shared_nodes_.clear();
+
+#ifdef USE_HALO_EXCHANGE
+  ncomms_ = 0;
+  for (auto nitr = nodes_.cbegin(); nitr != nodes_.cend(); ++nitr) {
+    // If node has more than 1 MPI rank
+    std::set<unsigned> nodal_mpi_ranks = (*nitr)->mpi_ranks();
+    const unsigned nodal_mpi_ranks_size = nodal_mpi_ranks.size();
+    if (nodal_mpi_ranks_size > 1) {
+      if (nodal_mpi_ranks.find(mpi_rank) != nodal_mpi_ranks.end()) {
+        // Create Ghost ID
+        (*nitr)->ghost_id(ncomms_);
+        // Add to list of shared nodes on local rank
+        domain_shared_nodes_.add(*nitr);
+        ncomms_ += nodal_mpi_ranks_size - 1;
+      }
+    }
+  }
+#else
+  // Get number of MPI ranks
+  int mpi_size = 1;
+#ifdef USE_MPI
+  MPI_Comm_size(MPI_COMM_WORLD, &mpi_size);
+#endif
+
+  // Shared nodes for each neighbour rank, nodes are visited in the same order
+  // on every rank, so the lists match on both sides of an exchange
+  std::map<unsigned, Vector<NodeBase<Tdim>>> neighbour_nodes;
+  nhalo_nodes_ = 0;
+  for (auto nitr = nodes_.cbegin(); nitr != nodes_.cend(); ++nitr) {
+    std::set<unsigned> nodal_mpi_ranks = (*nitr)->mpi_ranks();
+    // Add to domain shared nodes if node has more than 1 MPI rank and is
+    // active on current MPI rank
+    if (nodal_mpi_ranks.size() > 1 &&
+        nodal_mpi_ranks.find(mpi_rank) != nodal_mpi_ranks.end()) {
+      (*nitr)->ghost_id(nhalo_nodes_);
+      nhalo_nodes_ += 1;
+      domain_shared_nodes_.add(*nitr, false);
+      for (auto rank : nodal_mpi_ranks)
+        if (rank != mpi_rank && rank < mpi_size)
+          neighbour_nodes[rank].add(*nitr, false);
+    }
+  }
+
+  this->halo_neighbour_ranks_.clear();
+  this->halo_neighbour_nodes_.clear();
+  for (auto& neighbour : neighbour_nodes) {
+    halo_neighbour_ranks_.emplace_back(neighbour.first);
+    halo_neighbour_nodes_.emplace_back(std::move(neighbour.second));
+  }
+#endif
+
+  // Split local cells into cells touching a domain shared node and the rest
+  this->halo_cells_.clear();
+  this->interior_cells_.clear();
+  const auto cells = this->ordered_cells();
+  for (auto citr = cells.cbegin(); citr != cells.cend(); ++citr) {
+    if ((*citr)->rank() != mpi_rank) continue;
+    bool halo = false;
+    for (const auto& node : (*citr)->nodes())
+      if (node->mpi_ranks().size() > 1) halo = true;
+    if (halo)
+      halo_cells_.add(*citr, false);
+    else
+      interior_cells_.add(*citr, false);
+  }
+}
+
+//! Locate particles in a cell
+template <unsigned Tdim>
+std::vector<std::shared_ptr<mpm::ParticleBase<Tdim>>>
+    mpm::Mesh<Tdim>::locate_particles_mesh() {
+
+  std::vector<std::shared_ptr<mpm::ParticleBase<Tdim>>> particles;
+
+  // Build the cell bucket grid before locating particles in parallel
+  if (cell_buckets_.empty()) this->compute_cell_buckets();
+
+#pragma omp parallel
+  {
+    // Particles which are not found in mesh by each thread
+    std::vector<std::shared_ptr<mpm::ParticleBase<Tdim>>> unlocatable;
+#pragma omp for schedule(runtime) nowait
+    for (auto pitr = particles_.cbegin(); pitr != particles_.cend(); ++pitr) {
+      if (!this->locate_particle_cells(*pitr, false))
+        unlocatable.emplace_back(*pitr);
+    }
+#pragma omp critical
+    particles.insert(particles.end(), unlocatable.begin(), unlocatable.end());
+  }
+
+  // Particle ids of cells from the located cells of particles
+  this->assign_cell_particle_ids();
+
+  return particles;
+}
+
+//! Assign particle ids of all cells from the cells of particles
+template <unsigned Tdim>
+void mpm::Mesh<Tdim>::assign_cell_particle_ids() {
+  const mpm::Index ncells = cells_.size();
+  const mpm::Index nparticles = particles_.size();
+
+  // Local index of each cell
+  tsl::robin_map<mpm::Index, mpm::Index> cell_indices;
+  cell_indices.reserve(ncells);
+  mpm::Index index = 0;
+  for (auto citr = cells_.cbegin(); citr != cells_.cend(); ++citr, ++index)
+    cell_indices.insert(std::make_pair((*citr)->id(), index));
+
+  // Local cell index of each particle, particles without a cell in the mesh
+  // are counted in an extra cell
+  std::vector<mpm::Index> particle_cells(nparticles, ncells);
+#pragma omp parallel for schedule(runtime)
+  for (mpm::Index i = 0; i < nparticles; ++i) {
+    const auto itr = cell_indices.find((*(particles_.cbegin() + i))->cell_id());
+    if (itr != cell_indices.end()) particle_cells[i] = itr->second;
+  }
+
+  // Offsets of the particle ids of each cell
+  std::vector<mpm::Index> offsets(ncells + 2, 0);
+  for (const auto cell : particle_cells) ++offsets[cell + 1];
+  std::partial_sum(offsets.begin(), offsets.end(), offsets.begin());
+
+  // Particle ids sorted by cell in the order of particles
+  std::vector<mpm::Index> positions(offsets.begin(), offsets.end() - 1);
+  std::vector<mpm::Index> pids(nparticles);
+  index = 0;
+  for (auto pitr = particles_.cbegin(); pitr != particles_.cend();
+       ++pitr, ++index)
+    pids[positions[particle_cells[index]]++] = (*pitr)->id();
+
+#pragma omp parallel for schedule(runtime)
+  for (mpm::Index i = 0; i < ncells; ++i)
+    (*(cells_.cbegin() + i))
+        ->assign_particle_ids(pids.cbegin() + offsets[i],
+                              pids.cbegin() + offsets[i + 1]);
+}
+
+//! Compute a uniform grid of buckets over the bounding boxes of cells
+template <unsigned Tdim>
+bool mpm::Mesh<Tdim>::compute_cell_buckets() {
+  bool status = true;
+  try {
+    if (cells_.size() == 0)
+      throw std::runtime_error("No cells are found in the mesh to bucket!");
+
+    cell_buckets_.clear();
+
+    // Bounding box of mesh and average size of cells
+    VectorDim mesh_min, mesh_max, cell_size;
+    mesh_min.fill(std::numeric_limits<double>::max());
+    mesh_max.fill(std::numeric_limits<double>::lowest());
+    cell_size.setZero();
+    for (auto citr = cells_.cbegin(); citr != cells_.cend(); ++citr) {
+      const Eigen::MatrixXd coordinates = (*citr)->nodal_coordinates();
+      const VectorDim cell_min = coordinates.colwise().minCoeff().transpose();
+      const VectorDim cell_max = coordinates.colwise().maxCoeff().transpose();
+      mesh_min = mesh_min.cwiseMin(cell_min);
+      mesh_max = mesh_max.cwiseMax(cell_max);
+      cell_size += (cell_max - cell_min);
+    }
+    cell_size /= static_cast<double>(cells_.size());
+
+    // Tolerance on the bounding box to include points on the boundary
+    const double tolerance = 1.E-8 * (mesh_max - mesh_min).norm();
+    mesh_min.array() -= tolerance;
+    mesh_max.array() += tolerance;
+
+    // Bucket grid with a bucket of the size of an average cell
+    bucket_origin_ = mesh_min;
+    mpm::Index nbuckets = 1;
+    for (unsigned i = 0; i < Tdim; ++i) {
+      const double length = mesh_max(i) - mesh_min(i);
+      nbuckets_[i] = (cell_size(i) > tolerance)
+                         ? std::max<mpm::Index>(
+                               1, std::ceil(length / cell_size(i)))
+                         : 1;
+      bucket_size_(i) = length / nbuckets_[i];
+      nbuckets *= nbuckets_[i];
+    }
+    cell_buckets_.resize(nbuckets);
+
+    // Add each cell to the buckets overlapping its bounding box
+    for (auto citr = cells_.cbegin(); citr != cells_.cend(); ++citr) {
+      const Eigen::MatrixXd coordinates = (*citr)->nodal_coordinates();
+      std::array<mpm::Index, Tdim> start, end;
+      for (unsigned i = 0; i < Tdim; ++i) {
+        const double cmin = coordinates.col(i).minCoeff() - tolerance;
+        const double cmax = coordinates.col(i).maxCoeff() + tolerance;
+        start[i] = std::max<double>(
+            0., std::floor((cmin - bucket_origin_(i)) / bucket_size_(i)));
+        end[i] = std::min<double>(
+            nbuckets_[i] - 1,
+            std::floor((cmax - bucket_origin_(i)) / bucket_size_(i)));
+      }
+
+      // Iterate over the range of buckets
+      std::array<mpm::Index, Tdim> index = start;
+      while (true) {
+        mpm::Index bucket = 0;
+        for (int i = Tdim - 1; i >= 0; --i)
+          bucket = bucket * nbuckets_[i] + index[i];
+        cell_buckets_[bucket].emplace_back(*citr);
+
+        // Increment index
+        unsigned dir = 0;
+        while (dir < Tdim && index[dir] == end[dir]) {
+          index[dir] = start[dir];
+          ++dir;
+        }
+        if (dir == Tdim) break;
+        ++index[dir];
+      }
+    }
+  } catch (std::exception& exception) {
+    console_->error("{} #{}: {}\n", __FILE__, __LINE__, exception.what());
+    cell_buckets_.clear();
+    status = false;
+  }
+  return status;
+}
+
+//! Locate a particle in the candidate cells of its bucket
+template <unsigned Tdim>
+bool mpm::Mesh<Tdim>::locate_particle_buckets(
+    const std::shared_ptr<mpm::ParticleBase<Tdim>>& particle,
+    bool update_cell) {
+  const VectorDim coordinates = particle->coordinates();
+
+  // Find the bucket of the particle
+  mpm::Index bucket = 0;
+  for (int i = Tdim - 1; i >= 0; --i) {
+    const double index =
+        std::floor((coordinates(i) - bucket_origin_(i)) / bucket_size_(i));
+    // Particle is outside the bounding box of the mesh
+    if (!(index >= 0. && index < nbuckets_[i])) return false;
+    bucket = bucket * nbuckets_[i] + static_cast<mpm::Index>(index);
+  }
+
+  // Check candidate cells in the bucket
+  Eigen::Matrix<double, Tdim, 1> xi;
+  for (const auto& cell : cell_buckets_[bucket]) {
+    if (cell->is_point_in_cell(coordinates, &xi)) {
+      particle->assign_cell_xi(cell, xi, update_cell);
+      return true;
+    }
+  }
+  return false;
+}
+
+//! Compute a structured grid of cells
+template <unsigned Tdim>
+bool mpm::Mesh<Tdim>::compute_structured_grid() {
+  structured_cells_.clear();
+  structured_grid_ = false;
+  // Only cartesian meshes of box cells are structured
+  if (isoparametric_ || cells_.size() == 0) return false;
+
+  // Corner coordinates of each cell
+  std::vector<std::pair<VectorDim, VectorDim>> boxes;
+  boxes.reserve(cells_.size());
+  VectorDim mesh_min, mesh_max;
+  mesh_min.fill(std::numeric_limits<double>::max());
+  mesh_max.fill(std::numeric_limits<double>::lowest());
+  for (auto citr = cells_.cbegin(); citr != cells_.cend(); ++citr) {
+    const auto element = (*citr)->element_ptr();
+    const Eigen::VectorXi corners = element->corner_indices();
+    if (corners.size() != (1 << Tdim)) return false;
+
+    const Eigen::MatrixXd coordinates = (*citr)->nodal_coordinates();
+    VectorDim cell_min, cell_max;
+    cell_min.fill(std::numeric_limits<double>::max());
+    cell_max.fill(std::numeric_limits<double>::lowest());
+    for (unsigned i = 0; i < corners.size(); ++i) {
+      const VectorDim corner = coordinates.row(corners(i)).transpose();
+      cell_min = cell_min.cwiseMin(corner);
+      cell_max = cell_max.cwiseMax(corner);
+    }
+
+    // Corner nodes should be aligned with the unit cell of the element
+    const Eigen::MatrixXd unit_cell = element->unit_cell_coordinates();
+    const VectorDim centre = 0.5 * (cell_min + cell_max);
+    const VectorDim half_size = 0.5 * (cell_max - cell_min);
+    for (unsigned i = 0; i < corners.size(); ++i) {
+      const VectorDim xi =
+          (coordinates.row(corners(i)).transpose() - centre).cwiseQuotient(
+              half_size);
+      if ((xi - unit_cell.row(corners(i)).transpose()).norm() > 1.E-6)
+        return false;
+    }
+
+    mesh_min = mesh_min.cwiseMin(cell_min);
+    mesh_max = mesh_max.cwiseMax(cell_max);
+    boxes.emplace_back(std::make_pair(cell_min, cell_max));
+  }
+
+  // Cells should have the same size and tile the bounding box of the mesh
+  const VectorDim size = boxes.front().second - boxes.front().first;
+  const double tolerance = 1.E-6 * size.minCoeff();
+  mpm::Index ncells = 1;
+  for (unsigned i = 0; i < Tdim; ++i) {
+    structured_ncells_[i] = std::llround((mesh_max(i) - mesh_min(i)) / size(i));
+    ncells *= structured_ncells_[i];
+  }
+  // Cells of a rank and its halo in a distributed mesh may not fill their
+  // bounding box, grid slots without a cell are outside the local mesh
+  if (ncells < cells_.size() || (!distributed_ && ncells != cells_.size()))
+    return false;
+
+  std::vector<std::shared_ptr<Cell<Tdim>>> cells(ncells, nullptr);
+  unsigned index = 0;
+  for (auto citr = cells_.cbegin(); citr != cells_.cend(); ++citr, ++index) {
+    const auto& box = boxes.at(index);
+    if (((box.second - box.first) - size).cwiseAbs().maxCoeff() > tolerance)
+      return false;
+
+    // Grid index of the cell
+    mpm::Index cell_index = 0;
+    for (int i = Tdim - 1; i >= 0; --i)
+      cell_index = cell_index * structured_ncells_[i] +
+                   std::llround((box.first(i) - mesh_min(i)) / size(i));
+    if (cells.at(cell_index) != nullptr) return false;
+    cells.at(cell_index) = *citr;
+  }
+
+  structured_origin_ = mesh_min;
+  structured_size_ = size;
+  structured_cells_ = std::move(cells);
+  structured_grid_ = true;
+  return true;
+}
+
+//! Locate a particle in a structured grid from its coordinates
+template <unsigned Tdim>
+bool mpm::Mesh<Tdim>::locate_particle_structured(
+    const std::shared_ptr<mpm::ParticleBase<Tdim>>& particle,
+    bool update_cell) {
+  const VectorDim coordinates = particle->coordinates();
+  // Position of the particle in units of cells
+  const VectorDim position =
+      (coordinates - structured_origin_).cwiseQuotient(structured_size_);
+
+  const double tolerance = std::numeric_limits<double>::epsilon();
+  mpm::Index cell_index = 0;
+  Eigen::Matrix<double, Tdim, 1> xi;
+  for (int i = Tdim - 1; i >= 0; --i) {
+    // Particle is outside the mesh
+    if (!(position(i) >= -tolerance &&
+          position(i) <= structured_ncells_[i] + tolerance))
+      return false;
+    // Particles on the upper boundary belong to the last cell
+    const mpm::Index index = std::min<mpm::Index>(
+        std::max(0., std::floor(position(i))), structured_ncells_[i] - 1);
+    cell_index = cell_index * structured_ncells_[i] + index;
+    // Local coordinates in the unit cell
+    xi(i) = std::min(std::max(2. * (position(i) - index) - 1., -1. + tolerance),
+                     1. - tolerance);
+  }
+
+  // Grid slot is not a cell of the local mesh
+  if (!structured_cells_[cell_index]) return false;
+
+  return particle->assign_cell_xi(structured_cells_[cell_index], xi,
+                                  update_cell);
+}
+
+//! Order cells and the node store slots along a Morton curve
+template <unsigned Tdim>
+bool mpm::Mesh<Tdim>::reorder_mesh() {
+  bool status = true;
+  try {
+    if (cells_.size() == 0)
+      throw std::runtime_error("No cells are found in the mesh to reorder!");
+
+    // Position of cells along the curve through their centroids
+    std::vector<VectorDim> centroids;
+    centroids.reserve(cells_.size());
+    for (auto citr = cells_.cbegin(); citr != cells_.cend(); ++citr)
+      centroids.emplace_back((*citr)->centroid());
+    const auto cell_order = mpm::morton::order<Tdim>(centroids);
+
+    cell_order_.clear();
+    cell_order_.reserve(cells_.size());
+    for (mpm::Index i = 0; i < cell_order.size(); ++i)
+      cell_order_.insert(std::make_pair(cells_[cell_order[i]]->id(), i));
+
+    if (node_store_ != nullptr) {
+      // Slots of nodes in the node store of the mesh along the curve
+      std::vector<VectorDim> coordinates;
+      std::vector<mpm::Index> slots;
+      coordinates.reserve(nodes_.size());
+      slots.reserve(nodes_.size());
+      for (auto nitr = nodes_.cbegin(); nitr != nodes_.cend(); ++nitr) {
+        if ((*nitr)->node_store() != node_store_) continue;
+        coordinates.emplace_back((*nitr)->coordinates());
+        slots.emplace_back((*nitr)->store_index());
+      }
+      const auto node_order = mpm::morton::order<Tdim>(coordinates);
+
+      // Slots which do not belong to a node of the mesh are placed last
+      std::vector<mpm::Index> order;
+      order.reserve(node_store_->size());
+      std::vector<bool> ordered(node_store_->size(), false);
+      for (const auto i : node_order) {
+        order.emplace_back(slots[i]);
+        ordered[slots[i]] = true;
+      }
+      for (mpm::Index slot = 0; slot < node_store_->size(); ++slot)
+        if (!ordered[slot]) order.emplace_back(slot);
+      node_store_->permute(order);
+    }
+
+    // Cell colours are recomputed to visit cells in the new order
+    cell_colours_.clear();
+    if (coloured_cells_ && !this->compute_cell_colours())
+      throw std::runtime_error("Colouring of reordered cells failed!");
+  } catch (std::exception& exception) {
+    console_->error("{} #{}: {}\n", __FILE__, __LINE__, exception.what());
+    cell_order_.clear();
+    status = false;
+  }
+  return status;
+}
+
+//! Order particles and their store slots by the Morton order of their cells
+template <unsigned Tdim>
+void mpm::Mesh<Tdim>::reorder_particles() {
+  const mpm::Index nparticles = particles_.size();
+  if (nparticles == 0) return;
+
+  // Position of the cell of each particle along the curve, particles without
+  // a cell are placed last
+  std::vector<mpm::Index> keys(nparticles);
+#pragma omp parallel for schedule(runtime)
+  for (mpm::Index i = 0; i < nparticles; ++i) {
+    const mpm::Index cell_id = particles_[i]->cell_id();
+    if (cell_order_.empty())
+      keys[i] = cell_id;
+    else {
+      const auto itr = cell_order_.find(cell_id);
+      keys[i] = (itr != cell_order_.end())
+                    ? itr->second
+                    : std::numeric_limits<mpm::Index>::max();
+    }
+  }
+  std::vector<mpm::Index> order(nparticles);
+  std::iota(order.begin(), order.end(), 0);
+  std::stable_sort(
+      order.begin(), order.end(),
+      [&keys](mpm::Index a, mpm::Index b) { return keys[a] < keys[b]; });
+
+  // Particles in the new order
+  std::vector<std::shared_ptr<mpm::ParticleBase<Tdim>>> particles;
+  particles.reserve(nparticles);
+  for (const auto i : order) particles.emplace_back(particles_[i]);
+  particles_.clear();
+  particles_.reserve(nparticles);
+  for (const auto& particle : particles) particles_.add(particle, false);
+
+  // Store slots follow the particles, other slots are placed last
+  std::vector<mpm::Index> slots;
+  slots.reserve(particle_store_->size());
+  std::vector<bool> ordered(particle_store_->size(), false);
+  for (const auto& particle : particles) {
+    if (particle->particle_store() != particle_store_) continue;
+    slots.emplace_back(particle->store_index());
+    ordered[particle->store_index()] = true;
+  }
+  for (mpm::Index slot = 0; slot < particle_store_->size(); ++slot)
+    if (!ordered[slot]) slots.emplace_back(slot);
+  particle_store_->permute(slots);
+
+  // Position of each particle id in the new order
+  tsl::robin_map<mpm::Index, mpm::Index> positions;
+  positions.reserve(nparticles);
+  for (mpm::Index i = 0; i < nparticles; ++i)
+    positions.insert(std::make_pair(particles[i]->id(), i));
+
+  // Particle sets in the new order, ids of particles which are not in the
+  // mesh are placed last
+  for (auto sitr = particle_sets_.begin(); sitr != particle_sets_.end();
+       ++sitr) {
+    auto& set = sitr.value();
+    std::stable_sort(set.begin(), set.end(),
+                     [&positions](mpm::Index a, mpm::Index b) {
+                       const auto aitr = positions.find(a);
+                       const auto bitr = positions.find(b);
+                       if (bitr == positions.end()) return aitr != bitr;
+                       return aitr != positions.end() &&
+                              aitr->second < bitr->second;
+                     });
+  }
+
+  // Particle ids of each cell in the new order
+  this->assign_cell_particle_ids();
+}
+
+//! Return cells in Morton order
+template <unsigned Tdim>
+std::vector<std::shared_ptr<mpm::Cell<Tdim>>> mpm::Mesh<Tdim>::ordered_cells()
+    const {
+  std::vector<std::shared_ptr<mpm::Cell<Tdim>>> cells(cells_.cbegin(),
+                                                       cells_.cend());
+  if (!cell_order_.empty()) {
+    // Cells added after reordering are placed last
+    const auto position = [this](const std::shared_ptr<mpm::Cell<Tdim>>& cell) {
+      const auto itr = cell_order_.find(cell->id());
+      return (itr != cell_order_.end())
+                 ? itr->second
+                 : std::numeric_limits<mpm::Index>::max();
+    };
+    std::stable_sort(cells.begin(), cells.end(),
+                     [&position](const std::shared_ptr<mpm::Cell<Tdim>>& a,
+                                 const std::shared_ptr<mpm::Cell<Tdim>>& b) {
+                       return position(a) < position(b);
+                     });
+  }
+  return cells;
+}
+
+//! Locate particles in a cell
+template <unsigned Tdim>
+bool mpm::Mesh<Tdim>::locate_particle_cells(
+    const std::shared_ptr<mpm::ParticleBase<Tdim>>& particle,
+    bool update_cell) {
+  // Compute the cell of the particle in a structured grid
+  if (!structured_cells_.empty())
+    return this->locate_particle_structured(particle, update_cell);
+
+  // Check the current cell if it is not invalid
+  if (particle->cell_id() != std::numeric_limits<mpm::Index>::max()) {
+    // If a cell id is present, but not a cell locate the cell from map
+    if (!particle->cell_ptr())
+      particle->assign_cell(map_cells_[particle->cell_id()]);
+    if (particle->compute_reference_location()) return true;
+
+    // Check if material point is in any of its nearest neighbours
+    const auto neighbours = map_cells_[particle->cell_id()]->neighbours();
+    Eigen::Matrix<double, Tdim, 1> xi;
+    Eigen::Matrix<double, Tdim, 1> coordinates = particle->coordinates();
+    for (auto neighbour : neighbours) {
+      if (map_cells_[neighbour]->is_point_in_cell(coordinates, &xi)) {
+        particle->assign_cell_xi(map_cells_[neighbour], xi, update_cell);
+        return true;
+      }
+    }
+  }
+
+  // Search candidate cells in the bucket grid
+  if (!cell_buckets_.empty())
+    return this->locate_particle_buckets(particle, update_cell);
+
+  bool status = false;
+#pragma omp parallel for schedule(runtime)
+  for (auto citr = cells_.cbegin(); citr != cells_.cend(); ++citr) {
+    // Check if particle is already found, if so don't run for other cells
+    // Check if co-ordinates is within the cell, if true
+    // add particle to cell
+    Eigen::Matrix<double, Tdim, 1> xi;
+    if (!status && (*citr)->is_point_in_cell(particle->coordinates(), &xi)) {
+      particle->assign_cell_xi(*citr, xi, update_cell);
+      status = true;
+    }
+  }
+
+  return status;
+}
+
+//! Iterate over particles
+template <unsigned Tdim>
+template <typename Toper>
 void mpm::Mesh<Tdim>::iterate_over_particles(Toper oper) {
 #pragma omp parallel for schedule(runtime)
   for (auto pitr = particles_.cbegin(); pitr != particles_.cend(); ++pitr)
@@ -1087,6 +2431,159 @@ void mpm::Mesh<Tdim>::iterate_over_particle_set(int set_id, Toper oper) {
   }
 }
 
+//! Compute a colouring of cells such that no two cells of the same colour
+//! share a node
+template <unsigned Tdim>
+bool mpm::Mesh<Tdim>::compute_cell_colours() {
+  bool status = true;
+  try {
+    if (cells_.size() == 0)
+      throw std::runtime_error("No cells are found in the mesh to colour!");
+
+    cell_colours_.clear();
+    coloured_cells_ = false;
+    // Colours of cells connected to each node
+    tsl::robin_map<mpm::Index, std::vector<unsigned>> node_colours;
+
+    // Greedy colouring: assign the smallest colour not used by any cell
+    // sharing a node with the current cell
+    const auto cells = this->ordered_cells();
+    for (auto citr = cells.cbegin(); citr != cells.cend(); ++citr) {
+      const auto nodes = (*citr)->nodes();
+      std::vector<bool> used(cell_colours_.size(), false);
+      for (const auto& node : nodes) {
+        auto nitr = node_colours.find(node->id());
+        if (nitr != node_colours.end())
+          for (const auto colour : nitr->second) used.at(colour) = true;
+      }
+
+      const unsigned colour =
+          std::find(used.begin(), used.end(), false) - used.begin();
+      if (colour == cell_colours_.size())
+        cell_colours_.emplace_back(Vector<Cell<Tdim>>());
+      cell_colours_.at(colour).add(*citr, false);
+
+      for (const auto& node : nodes)
+        node_colours[node->id()].emplace_back(colour);
+    }
+    coloured_cells_ = true;
+  } catch (std::exception& exception) {
+    console_->error("{} #{}: {}\n", __FILE__, __LINE__, exception.what());
+    cell_colours_.clear();
+    status = false;
+  }
+  return status;
+}
+
+//! Compute stresses of particles in batches of the same material
+template <unsigned Tdim>
+void mpm::Mesh<Tdim>::compute_stress_batched(unsigned phase) {
+  using Matrix6X = typename mpm::Material<Tdim>::Matrix6X;
+  // Number of particles in a batch
+  const mpm::Index nbatch = 256;
+
+  // Group particles by material id
+  std::map<unsigned, std::vector<mpm::ParticleBase<Tdim>*>> material_particles;
+  for (auto pitr = particles_.cbegin(); pitr != particles_.cend(); ++pitr)
+    material_particles[(*pitr)->material_id(phase)].emplace_back(pitr->get());
+
+  for (const auto& group : material_particles) {
+    const auto& particles = group.second;
+    const auto material = particles.front()->material(phase);
+    if (material == nullptr) continue;
+
+    const mpm::Index nparticles = particles.size();
+    const mpm::Index nbatches = (nparticles + nbatch - 1) / nbatch;
+    // Time of the stress updates of all batches in seconds
+    double duration = 0.;
+#pragma omp parallel for schedule(runtime) reduction(+ : duration)
+    for (mpm::Index batch = 0; batch < nbatches; ++batch) {
+      const mpm::Index begin = batch * nbatch;
+      const mpm::Index size = std::min(nbatch, nparticles - begin);
+
+      // Gather stresses, strain increments and state variables
+      std::vector<const mpm::ParticleBase<Tdim>*> ptrs(size);
+      std::vector<mpm::dense_map*> state_vars(size);
+      Matrix6X stresses(6, size);
+      Matrix6X dstrains(6, size);
+      for (mpm::Index i = 0; i < size; ++i) {
+        auto particle = particles[begin + i];
+        const mpm::Index index = particle->store_index();
+        ptrs[i] = particle;
+        state_vars[i] = particle->state_variables_ptr(phase);
+        stresses.col(i) = particle_store_->stress(index);
+        dstrains.col(i) = particle_store_->dstrain(index);
+      }
+
+      const auto batch_begin = std::chrono::steady_clock::now();
+      material->compute_stress_batch(ptrs, dstrains, state_vars, &stresses);
+      duration += std::chrono::duration<double>(
+                      std::chrono::steady_clock::now() - batch_begin)
+                      .count();
+
+      // Scatter updated stresses
+      for (mpm::Index i = 0; i < size; ++i)
+        particle_store_->stress(particles[begin + i]->store_index()) =
+            stresses.col(i);
+    }
+    material->record_stress_cost(duration, nparticles);
+  }
+}
+
+//! Compute the critical time step of local particles
+template <unsigned Tdim>
+double mpm::Mesh<Tdim>::critical_time_step(unsigned phase) {
+  // Wave speeds are computed once per material before the parallel loop
+  for (const auto& material : materials_) material.second->wave_speed();
+
+  double dt = std::numeric_limits<double>::max();
+#pragma omp parallel for schedule(runtime) reduction(min : dt)
+  for (auto pitr = particles_.cbegin(); pitr != particles_.cend(); ++pitr) {
+    const auto& particle = *pitr;
+    const auto material = particle->material(phase);
+    const auto citr = map_cells_.find(particle->cell_id());
+    if (material == nullptr || citr == map_cells_.end()) continue;
+    const double speed = material->wave_speed() + particle->velocity().norm();
+    if (speed > 0.) dt = std::min(dt, citr->second->mean_length() / speed);
+  }
+  return dt;
+}
+
+//! Iterate over particles by cell colour
+template <unsigned Tdim>
+template <typename Toper>
+void mpm::Mesh<Tdim>::iterate_over_particles_coloured(Toper oper) {
+  // Use the particle iterator if cells are not coloured, nodes are locked
+  if (cell_colours_.empty()) {
+    this->iterate_over_particles(
+        [&oper](const std::shared_ptr<mpm::ParticleBase<Tdim>>& particle) {
+          oper(particle, true);
+        });
+    return;
+  }
+
+  // Cells of a colour do not share nodes, colours are run in sequence and
+  // nodes are updated without locks
+  for (const auto& cells : cell_colours_) {
+#pragma omp parallel for schedule(runtime)
+    for (auto citr = cells.cbegin(); citr != cells.cend(); ++citr) {
+      for (const auto pid : (*citr)->particles())
+        oper(map_particles_[pid], false);
+    }
+  }
+}
+
+//! Iterate over particles in halo or interior cells
+template <unsigned Tdim>
+template <typename Toper>
+void mpm::Mesh<Tdim>::iterate_over_halo_particles(Toper oper, bool halo) {
+  const auto& cells = halo ? halo_cells_ : interior_cells_;
+#pragma omp parallel for schedule(runtime)
+  for (auto citr = cells.cbegin(); citr != cells.cend(); ++citr) {
+    for (const auto pid : (*citr)->particles()) oper(map_particles_[pid]);
+  }
+}
+
 //! Add a neighbour mesh, using the local id of the mesh and a mesh pointer
 template <unsigned Tdim>
 bool mpm::Mesh<Tdim>::add_neighbour(
@@ -1233,9 +2730,11 @@ bool mpm::Mesh<Tdim>::compute_nodal_rotation_matrices(
       // Compute rotation matrix
       const auto rotation_matrix = mpm::geometry::rotation_matrix(angles);
 
-      // Apply rotation matrix to nodes
-      map_nodes_[nid]->assign_rotation_matrix(rotation_matrix);
+      // Apply rotation matrix to nodes, a distributed mesh only holds some
+      // of the nodes
       status = true;
+      if (distributed_ && map_nodes_.find(nid) == map_nodes_.end()) continue;
+      map_nodes_[nid]->assign_rotation_matrix(rotation_matrix);
     }
   } catch (std::exception& exception) {
     console_->error("{} #{}: {}\n", __FILE__, __LINE__, exception.what());
@@ -1278,7 +2777,7 @@ void mpm::Mesh<Tdim>::apply_traction_on_particles(double current_time) {
                           std::placeholders::_1, dir, traction));
   }
   if (!particle_tractions_.empty()) {
-    this->iterate_over_particles(std::bind(
+    this->iterate_over_particles_coloured(std::bind(
         &mpm::ParticleBase<Tdim>::map_traction_force, std::placeholders::_1));
   }
 }
@@ -1341,6 +2840,9 @@ bool mpm::Mesh<Tdim>::assign_nodal_concentrated_forces(
     Vector<NodeBase<Tdim>> nodes =
         (set_id == -1) ? this->nodes_ : node_sets_.at(set_id);
 
+    // Math function is kept to be assigned to nodes transferred to this rank
+    if (mfunction != nullptr) force_functions_[mfunction->id()] = mfunction;
+
 #pragma omp parallel for schedule(runtime)
     for (auto nitr = nodes.cbegin(); nitr != nodes.cend(); ++nitr) {
       if (!(*nitr)->assign_concentrated_force(phase, dir, concentrated_force,
@@ -1364,14 +2866,22 @@ bool mpm::Mesh<Tdim>::assign_particles_stresses(
       throw std::runtime_error(
           "No particles have been assigned in mesh, cannot assign stresses");
 
-    if (particles_.size() != particle_stresses.size())
-      throw std::runtime_error(
-          "Number of particles in mesh and initial stresses don't match");
-
-    unsigned i = 0;
-    for (auto pitr = particles_.cbegin(); pitr != particles_.cend(); ++pitr) {
-      (*pitr)->initial_stress(particle_stresses.at(i));
-      ++i;
+    // A distributed mesh holds some of the particles, whose ids are the
+    // indices of their stresses
+    if (distributed_) {
+      for (auto pitr = particles_.cbegin(); pitr != particles_.cend(); ++pitr)
+        (*pitr)->initial_stress(particle_stresses.at((*pitr)->id()));
+    } else {
+      if (particles_.size() != particle_stresses.size())
+        throw std::runtime_error(
+            "Number of particles in mesh and initial stresses don't match");
+
+      unsigned i = 0;
+      for (auto pitr = particles_.cbegin(); pitr != particles_.cend();
+           ++pitr) {
+        (*pitr)->initial_stress(particle_stresses.at(i));
+        ++i;
+      }
     }
   } catch (std::exception& exception) {
     console_->error("{} #{}: {}\n", __FILE__, __LINE__, exception.what());
@@ -1389,12 +2899,23 @@ bool mpm::Mesh<Tdim>::assign_particles_cells(
     if (!particles_.size())
       throw std::runtime_error(
           "No particles have been assigned in mesh, cannot assign cells");
+    int mpi_rank = 0;
+#ifdef USE_MPI
+    MPI_Comm_rank(MPI_COMM_WORLD, &mpi_rank);
+#endif
     for (const auto& particle_cell : particles_cells) {
       // Particle id
       mpm::Index pid = particle_cell[0];
       // Cell id
       mpm::Index cid = particle_cell[1];
 
+      // Particles of a distributed mesh are only assigned to local cells
+      if (distributed_ &&
+          (map_particles_.find(pid) == map_particles_.end() ||
+           map_cells_.find(cid) == map_cells_.end() ||
+           map_cells_[cid]->rank() != mpi_rank))
+        continue;
+
       map_particles_[pid]->assign_cell_id(cid);
     }
   } catch (std::exception& exception) {
@@ -1428,64 +2949,104 @@ std::vector<std::array<mpm::Index, 2>> mpm::Mesh<Tdim>::particles_cells()
 //! Write particles to HDF5
 template <unsigned Tdim>
 bool mpm::Mesh<Tdim>::write_particles_hdf5(unsigned phase,
-                                           const std::string& filename) {
-  const unsigned nparticles = this->nparticles();
-
-  std::vector<HDF5Particle> particle_data;  // = new HDF5Particle[nparticles];
-  particle_data.reserve(nparticles);
+                                           const std::string& filename,
+                                           unsigned compression) {
+  // Write the columns of all ranks to a single file
+  return mpm::hdf5::particle::write_columns(
+      filename, this->particles_hdf5_columns(), compression);
+}
 
+//! Return HDF5 fields of particles as columns
+template <unsigned Tdim>
+mpm::hdf5::particle::Columns mpm::Mesh<Tdim>::particles_hdf5_columns()
+    const {
+  // State variables of the materials of the particles of all ranks
+  unsigned nstate_vars = 0;
   for (auto pitr = particles_.cbegin(); pitr != particles_.cend(); ++pitr)
-    particle_data.emplace_back((*pitr)->hdf5());
-
-  // Calculate the size and the offsets of our struct members in memory
-  const hsize_t NRECORDS = nparticles;
-
-  const hsize_t NFIELDS = mpm::hdf5::particle::NFIELDS;
-
-  hid_t file_id;
-  hsize_t chunk_size = 10000;
-  int* fill_data = NULL;
-  int compress = 0;
-
-  // Create a new file using default properties.
-  file_id =
-      H5Fcreate(filename.c_str(), H5F_ACC_TRUNC, H5P_DEFAULT, H5P_DEFAULT);
-
-  // make a table
-  H5TBmake_table(
-      "Table Title", file_id, "table", NFIELDS, NRECORDS,
-      mpm::hdf5::particle::dst_size, mpm::hdf5::particle::field_names,
-      mpm::hdf5::particle::dst_offset, mpm::hdf5::particle::field_type,
-      chunk_size, fill_data, compress, particle_data.data());
+    if ((*pitr)->material() != nullptr)
+      nstate_vars = std::max(nstate_vars, (*pitr)->nstate_vars());
+#ifdef USE_MPI
+  MPI_Allreduce(MPI_IN_PLACE, &nstate_vars, 1, MPI_UNSIGNED, MPI_MAX,
+                MPI_COMM_WORLD);
+#endif
 
-  H5Fclose(file_id);
-  return true;
+  // Write the fields of each particle to columns
+  mpm::hdf5::particle::Columns columns(this->nparticles(), nstate_vars);
+  hsize_t index = 0;
+  for (auto pitr = particles_.cbegin(); pitr != particles_.cend(); ++pitr)
+    (*pitr)->hdf5_columns(columns, index++);
+  return columns;
 }
 
 //! Write particles to HDF5
 template <unsigned Tdim>
 bool mpm::Mesh<Tdim>::read_particles_hdf5(unsigned phase,
                                           const std::string& filename) {
+  // Each rank of a distributed mesh reads a slice of the records, and the
+  // records which are not in a cell of the rank are passed to the next rank
+  if (distributed_) {
+    int mpi_rank = 0;
+    int mpi_size = 1;
+#ifdef USE_MPI
+    MPI_Comm_rank(MPI_COMM_WORLD, &mpi_rank);
+    MPI_Comm_size(MPI_COMM_WORLD, &mpi_size);
+#endif
+    const hsize_t nrecords = mpm::hdf5::particle::read_nparticles(filename);
+    const hsize_t begin = nrecords * mpi_rank / mpi_size;
+    const hsize_t end = nrecords * (mpi_rank + 1) / mpi_size;
+    auto columns =
+        mpm::hdf5::particle::read_columns(filename, begin, end - begin);
+
+    const std::string particle_type =
+        (particles_.size() > 0) ? (*particles_.cbegin())->type()
+                                : ((Tdim == 2) ? "P2D" : "P3D");
+    std::vector<mpm::Index> pids;
+    for (auto pitr = particles_.cbegin(); pitr != particles_.cend(); ++pitr)
+      pids.emplace_back((*pitr)->id());
+    this->remove_particles(pids);
+
+    // Build the cell bucket grid to locate particles
+    if (cell_buckets_.empty() && structured_cells_.empty())
+      this->compute_cell_buckets();
+
+    // Every record visits each rank once
+    mpm::Index nrank_particles = 0;
+    const VectorDim coordinates = VectorDim::Zero();
+    for (int round = 0; round < mpi_size; ++round) {
+      std::vector<hsize_t> remaining;
+      for (hsize_t i = 0; i < columns.nparticles(); ++i) {
+        HDF5Particle record = columns.unpack(i);
+        // Cell of the record is a hint to locate the particle if it is a
+        // cell of the local rank, whose neighbours are all in the mesh
+        const auto citr = map_cells_.find(record.cell_id);
+        if (citr == map_cells_.end() ||
+            static_cast<int>(citr->second->rank()) != mpi_rank)
+          record.cell_id = std::numeric_limits<mpm::Index>::max();
+        auto particle =
+            this->create_particle(particle_type, record.id, coordinates);
+        particle->initialise_particle(record,
+                                      materials_.at(record.material_id));
+        if (this->locate_rank_particle(particle, mpi_rank)) {
+          this->add_particle(particle, false);
+          ++nrank_particles;
+        } else
+          remaining.emplace_back(i);
+      }
+      if (round < mpi_size - 1)
+        columns = mpm::hdf5::particle::shift_columns(columns.select(remaining));
+    }
 
-  // Create a new file using default properties.
-  hid_t file_id = H5Fopen(filename.c_str(), H5F_ACC_RDONLY, H5P_DEFAULT);
-  // Throw an error if file can't be found
-  if (file_id < 0) throw std::runtime_error("HDF5 particle file is not found");
-
-  // Calculate the size and the offsets of our struct members in memory
-  hsize_t nrecords = 0;
-  hsize_t nfields = 0;
-  H5TBget_table_info(file_id, "table", &nfields, &nrecords);
-
-  if (nfields != mpm::hdf5::particle::NFIELDS)
-    throw std::runtime_error("HDF5 table has incorrect number of fields");
+    // Particles kept by all ranks
+#ifdef USE_MPI
+    MPI_Allreduce(MPI_IN_PLACE, &nrank_particles, 1, MPI_UNSIGNED_LONG_LONG,
+                  MPI_SUM, MPI_COMM_WORLD);
+#endif
+    return (nrank_particles == nrecords);
+  }
 
-  std::vector<HDF5Particle> dst_buf;
-  dst_buf.reserve(nrecords);
-  // Read the table
-  H5TBread_table(file_id, "table", mpm::hdf5::particle::dst_size,
-                 mpm::hdf5::particle::dst_offset,
-                 mpm::hdf5::particle::dst_sizes, dst_buf.data());
+  // Read the columns of all particles in the file
+  const auto columns = mpm::hdf5::particle::read_columns(filename);
+  const hsize_t nrecords = columns.nparticles();
 
   // Vector of particles
   Vector<ParticleBase<Tdim>> particles;
@@ -1496,7 +3057,7 @@ bool mpm::Mesh<Tdim>::read_particles_hdf5(unsigned phase,
   unsigned i = 0;
   for (auto pitr = particles_.cbegin(); pitr != particles_.cend(); ++pitr) {
     if (i < nrecords) {
-      HDF5Particle particle = dst_buf[i];
+      HDF5Particle particle = columns.unpack(i);
       // Get particle's material from list of materials
       auto material = materials_.at(particle.material_id);
       // Initialise particle with HDF5 data
@@ -1507,8 +3068,6 @@ bool mpm::Mesh<Tdim>::read_particles_hdf5(unsigned phase,
       ++i;
     }
   }
-  // close the file
-  H5Fclose(file_id);
 
   // Overwrite particles container
   this->particles_ = particles;
@@ -1636,8 +3195,10 @@ bool mpm::Mesh<Tdim>::create_node_sets(
       Vector<NodeBase<Tdim>> nodes;
       // Reserve the size of the container
       nodes.reserve((sitr->second).size());
-      // Add nodes to the container
+      // Add nodes to the container, a distributed mesh only holds some of
+      // the nodes
       for (auto pid : sitr->second) {
+        if (distributed_ && map_nodes_.find(pid) == map_nodes_.end()) continue;
         nodes.add(map_nodes_[pid], check_duplicates);
       }
 
@@ -1672,8 +3233,10 @@ bool mpm::Mesh<Tdim>::create_cell_sets(
       Vector<Cell<Tdim>> cells;
       // Reserve the size of the container
       cells.reserve((sitr->second).size());
-      // Add cells to the container
+      // Add cells to the container, a distributed mesh only holds some of
+      // the cells
       for (auto pid : sitr->second) {
+        if (distributed_ && map_cells_.find(pid) == map_cells_.end()) continue;
         cells.add(map_cells_[pid], check_duplicates);
       }
 
@@ -1818,11 +3381,8 @@ void mpm::Mesh<Tdim>::inject_particles(double current_time) {
           // Iterate over each coordinate to generate material points
           for (const auto& coordinates : cpoints) {
             // Create particle
-            auto particle =
-                Factory<mpm::ParticleBase<Tdim>, mpm::Index,
-                        const Eigen::Matrix<double, Tdim, 1>&>::instance()
-                    ->create(injection.particle_type,
-                             static_cast<mpm::Index>(pid), coordinates);
+            auto particle = this->create_particle(injection.particle_type,
+                                                  pid, coordinates);
 
             // particle velocity
             Eigen::Matrix<double, Tdim, 1> pvelocity(injection.velocity.data());
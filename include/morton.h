@@ -0,0 +1,48 @@
+#ifndef MPM_MORTON_H_
+#define MPM_MORTON_H_
+
+#include <algorithm>
+#include <cstdint>
+#include <numeric>
+#include <vector>
+
+#include "Eigen/Dense"
+
+#include "data_types.h"
+
+namespace mpm {
+//! Morton (Z-order) space-filling curve
+//! \details Points are quantised on a uniform grid over their bounding box
+//! and the bits of the grid indices are interleaved, so points that are
+//! close in space have close keys
+namespace morton {
+//! Return the Morton key of each point
+//! \param[in] points Coordinates of points
+//! \tparam Tdim Dimension
+template <int Tdim>
+std::vector<std::uint64_t> keys(
+    const std::vector<Eigen::Matrix<double, Tdim, 1>>& points);
+
+//! Return the indices of points in order along the Morton curve
+//! \details Points with the same key keep their order
+//! \param[in] points Coordinates of points
+//! \tparam Tdim Dimension
+template <int Tdim>
+std::vector<mpm::Index> order(
+    const std::vector<Eigen::Matrix<double, Tdim, 1>>& points);
+
+//! Return the part of each point when points are split into parts of equal
+//! size along the Morton curve
+//! \param[in] points Coordinates of points
+//! \param[in] nparts Number of parts
+//! \tparam Tdim Dimension
+template <int Tdim>
+std::vector<unsigned> partition(
+    const std::vector<Eigen::Matrix<double, Tdim, 1>>& points,
+    unsigned nparts);
+}  // namespace morton
+}  // namespace mpm
+
+#include "morton.tcc"
+
+#endif  // MPM_MORTON_H_
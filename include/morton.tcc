@@ -0,0 +1,65 @@
+//! Return the Morton key of each point
+template <int Tdim>
+std::vector<std::uint64_t> mpm::morton::keys(
+    const std::vector<Eigen::Matrix<double, Tdim, 1>>& points) {
+  std::vector<std::uint64_t> keys(points.size(), 0);
+  if (points.empty()) return keys;
+
+  // Bounding box of points
+  Eigen::Matrix<double, Tdim, 1> min = points.front();
+  Eigen::Matrix<double, Tdim, 1> max = points.front();
+  for (const auto& point : points) {
+    min = min.cwiseMin(point);
+    max = max.cwiseMax(point);
+  }
+
+  // Bits of the grid index in each direction
+  const unsigned nbits = 63 / Tdim;
+  const double ncells = static_cast<double>((std::uint64_t(1) << nbits) - 1);
+
+#pragma omp parallel for schedule(runtime)
+  for (std::size_t p = 0; p < points.size(); ++p) {
+    // Grid index of the point in each direction
+    std::uint64_t index[Tdim];
+    for (unsigned i = 0; i < Tdim; ++i) {
+      const double length = max(i) - min(i);
+      index[i] = (length > 0.) ? static_cast<std::uint64_t>(
+                                     (points[p](i) - min(i)) / length * ncells)
+                               : 0;
+    }
+    // Interleave bits, most significant first
+    std::uint64_t key = 0;
+    for (int bit = nbits - 1; bit >= 0; --bit)
+      for (unsigned i = 0; i < Tdim; ++i)
+        key = (key << 1) | ((index[i] >> bit) & 1);
+    keys[p] = key;
+  }
+  return keys;
+}
+
+//! Return the indices of points in order along the Morton curve
+template <int Tdim>
+std::vector<mpm::Index> mpm::morton::order(
+    const std::vector<Eigen::Matrix<double, Tdim, 1>>& points) {
+  const auto keys = mpm::morton::keys<Tdim>(points);
+  std::vector<mpm::Index> order(points.size());
+  std::iota(order.begin(), order.end(), 0);
+  std::stable_sort(order.begin(), order.end(),
+                   [&keys](mpm::Index a, mpm::Index b) {
+                     return keys[a] < keys[b];
+                   });
+  return order;
+}
+
+//! Return the part of each point along the Morton curve
+template <int Tdim>
+std::vector<unsigned> mpm::morton::partition(
+    const std::vector<Eigen::Matrix<double, Tdim, 1>>& points,
+    unsigned nparts) {
+  const auto order = mpm::morton::order<Tdim>(points);
+  const mpm::Index npoints = points.size();
+  std::vector<unsigned> parts(npoints, 0);
+  for (mpm::Index i = 0; i < npoints; ++i)
+    parts[order[i]] = static_cast<unsigned>(i * nparts / npoints);
+  return parts;
+}
@@ -3,6 +3,8 @@
 
 #include <Eigen/Dense>
 #include <map>
+#include <string>
+#include <vector>
 
 namespace mpm {
 
@@ -11,7 +13,25 @@ typedef Eigen::Matrix<double, Eigen::Dynamic, 1> MatrixProperty;
 typedef Eigen::Map<const MatrixProperty> MapProperty;
 
 // \brief Multimaterial parameters on each node
+// \details Each property is a contiguous (nodes x nprops) x materials matrix
+// addressed by an integer handle. The properties of multimaterial contact
+// have fixed handles, other properties are assigned a handle when they are
+// created
 struct NodalProperties {
+  //! Handles of the properties of multimaterial contact
+  enum Property : unsigned {
+    Masses,
+    Momenta,
+    ChangeInMomenta,
+    Displacements,
+    SeparationVectors,
+    DomainGradients,
+    NormalUnitVectors,
+    NProperties
+  };
+
+  //! Constructor
+  NodalProperties();
 
   //! Function to create new property with given name and size (rows x cols)
   //! \param[in] property Property name
@@ -21,6 +41,11 @@ struct NodalProperties {
   bool create_property(const std::string& property, unsigned rows,
                        unsigned columns);
 
+  //! Return the handle of a property
+  //! \param[in] property Property name
+  //! \retval handle Handle of the property, throws if it is not created
+  unsigned handle(const std::string& property) const;
+
   //! Initialise all the nodal values for all properties in the property pool
   void initialise_nodal_properties();
 
@@ -52,9 +77,46 @@ struct NodalProperties {
                        unsigned mat_id, const Eigen::MatrixXd& property_value,
                        unsigned nprops = 1);
 
+  //! Return a map to the property value of a pair of node and material
+  //! \tparam Tprops Dimension of property (1 if scalar, Tdim if vector)
+  //! \param[in] handle Handle of the property
+  //! \param[in] node_id Id of the node within the property data
+  //! \param[in] mat_id Id of the material within the property data
+  template <unsigned Tprops>
+  Eigen::Map<Eigen::Matrix<double, Tprops, 1>> property(unsigned handle,
+                                                        unsigned node_id,
+                                                        unsigned mat_id);
+
+  //! Return a const map to the property value of a pair of node and material
+  //! \tparam Tprops Dimension of property (1 if scalar, Tdim if vector)
+  //! \param[in] handle Handle of the property
+  //! \param[in] node_id Id of the node within the property data
+  //! \param[in] mat_id Id of the material within the property data
+  template <unsigned Tprops>
+  Eigen::Map<const Eigen::Matrix<double, Tprops, 1>> property(
+      unsigned handle, unsigned node_id, unsigned mat_id) const;
+
+  //! Add to the property value of a pair of node and material in place
+  //! \details Each component is updated atomically, so concurrent updates
+  //! of the same node do not need a lock
+  //! \tparam Tprops Dimension of property (1 if scalar, Tdim if vector)
+  //! \param[in] handle Handle of the property
+  //! \param[in] node_id Id of the node within the property data
+  //! \param[in] mat_id Id of the material within the property data
+  //! \param[in] property_value Property value to be added
+  template <unsigned Tprops>
+  void update_property(unsigned handle, unsigned node_id, unsigned mat_id,
+                       const Eigen::Matrix<double, Tprops, 1>& property_value);
+
   // Map of properties and their nodal values
   std::map<std::string, Eigen::MatrixXd> properties_;
+  // Map of property names and their handles
+  std::map<std::string, unsigned> handles_;
+  // Pointers to the data of each property indexed by handle
+  std::vector<Eigen::MatrixXd*> data_;
 };  // NodalProperties struct
 }  // namespace mpm
 
+#include "nodal_properties.tcc"
+
 #endif  // MPM_NODAL_PROPERTIES_H_
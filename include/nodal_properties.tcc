@@ -0,0 +1,29 @@
+//! Return a map to the property value of a pair of node and material
+template <unsigned Tprops>
+inline Eigen::Map<Eigen::Matrix<double, Tprops, 1>>
+    mpm::NodalProperties::property(unsigned handle, unsigned node_id,
+                                   unsigned mat_id) {
+  return Eigen::Map<Eigen::Matrix<double, Tprops, 1>>(
+      &(*data_[handle])(node_id * Tprops, mat_id));
+}
+
+//! Return a const map to the property value of a pair of node and material
+template <unsigned Tprops>
+inline Eigen::Map<const Eigen::Matrix<double, Tprops, 1>>
+    mpm::NodalProperties::property(unsigned handle, unsigned node_id,
+                                   unsigned mat_id) const {
+  return Eigen::Map<const Eigen::Matrix<double, Tprops, 1>>(
+      &(*data_[handle])(node_id * Tprops, mat_id));
+}
+
+//! Add to the property value of a pair of node and material in place
+template <unsigned Tprops>
+inline void mpm::NodalProperties::update_property(
+    unsigned handle, unsigned node_id, unsigned mat_id,
+    const Eigen::Matrix<double, Tprops, 1>& property_value) {
+  double* value = &(*data_[handle])(node_id * Tprops, mat_id);
+  for (unsigned i = 0; i < Tprops; ++i) {
+#pragma omp atomic
+    value[i] += property_value(i);
+  }
+}
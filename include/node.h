@@ -26,7 +26,7 @@ class Node : public NodeBase<Tdim> {
   Node(Index id, const VectorDim& coord);
 
   //! Virtual destructor
-  ~Node() override{};
+  ~Node() override;
 
   //! Delete copy constructor
   Node(const Node<Tdim, Tdof, Tnphases>&) = delete;
@@ -37,6 +37,9 @@ class Node : public NodeBase<Tdim> {
   //! Initialise nodal properties
   void initialise() noexcept override;
 
+  //! Initialise nodal properties which are not held in the node store
+  void initialise_state() noexcept override;
+
   //! Return id of the nodebase
   Index id() const override { return id_; }
 
@@ -66,15 +69,44 @@ class Node : public NodeBase<Tdim> {
   //! Return status
   bool status() const override { return status_; }
 
+  //! Assign node store
+  //! \details Moves the nodal state from its current store into the given
+  //! store, e.g., the store of the mesh to which the node is added
+  //! \param[in] store Node store
+  void assign_node_store(
+      const std::shared_ptr<NodeStore<Tdim>>& store) override;
+
+  //! Return node store
+  std::shared_ptr<NodeStore<Tdim>> node_store() const override {
+    return store_;
+  }
+
+  //! Return index of the node in the node store
+  Index store_index() const override { return store_index_; }
+
+  //! Return true if velocity or friction constraints are applied at the node
+  bool constrained() const override {
+    return (!velocity_constraints_.empty() || friction_);
+  }
+
   //! Update mass at the nodes from particle
   //! \param[in] update A boolean to update (true) or assign (false)
   //! \param[in] phase Index corresponding to the phase
   //! \param[in] mass Mass from the particles in a cell
   void update_mass(bool update, unsigned phase, double mass) noexcept override;
 
+  //! Add mass at the node from particle without locking the node
+  //! \param[in] phase Index corresponding to the phase
+  //! \param[in] mass Mass from the particles in a cell
+  void update_mass_unlocked(unsigned phase, double mass) noexcept override {
+    store_->mass(store_index_, phase) += mass;
+  }
+
   //! Return mass at a given node for a given phase
   //! \param[in] phase Index corresponding to the phase
-  double mass(unsigned phase) const override { return mass_(phase); }
+  double mass(unsigned phase) const override {
+    return store_->mass(store_index_, phase);
+  }
 
   //! Update volume at the nodes from particle
   //! \param[in] update A boolean to update (true) or assign (false)
@@ -109,10 +141,18 @@ class Node : public NodeBase<Tdim> {
   void update_external_force(bool update, unsigned phase,
                              const VectorDim& force) noexcept override;
 
+  //! Add external force at the node without locking the node
+  //! \param[in] phase Index corresponding to the phase
+  //! \param[in] force External force from the particles in a cell
+  void update_external_force_unlocked(
+      unsigned phase, const VectorDim& force) noexcept override {
+    store_->external_force(store_index_, phase) += force;
+  }
+
   //! Return external force at a given node for a given phase
   //! \param[in] phase Index corresponding to the phase
   VectorDim external_force(unsigned phase) const override {
-    return external_force_.col(phase);
+    return store_->external_force(store_index_, phase);
   }
 
   //! Update internal force (body force / traction force)
@@ -122,10 +162,18 @@ class Node : public NodeBase<Tdim> {
   void update_internal_force(bool update, unsigned phase,
                              const VectorDim& force) noexcept override;
 
+  //! Add internal force at the node without locking the node
+  //! \param[in] phase Index corresponding to the phase
+  //! \param[in] force Internal force from the particles in a cell
+  void update_internal_force_unlocked(
+      unsigned phase, const VectorDim& force) noexcept override {
+    store_->internal_force(store_index_, phase) += force;
+  }
+
   //! Return internal force at a given node for a given phase
   //! \param[in] phase Index corresponding to the phase
   VectorDim internal_force(unsigned phase) const override {
-    return internal_force_.col(phase);
+    return store_->internal_force(store_index_, phase);
   }
 
   //! Update pressure at the nodes from particle
@@ -134,6 +182,12 @@ class Node : public NodeBase<Tdim> {
   void update_mass_pressure(unsigned phase,
                             double mass_pressure) noexcept override;
 
+  //! Update pressure at the node from particle without locking the node
+  //! \param[in] phase Index corresponding to the phase
+  //! \param[in] mass_pressure Product of mass x pressure of a particle
+  void update_mass_pressure_unlocked(
+      unsigned phase, double mass_pressure) noexcept override;
+
   //! Assign pressure at the nodes from particle
   //! \param[in] update A boolean to update (true) or assign (false)
   //! \param[in] phase Index corresponding to the phase
@@ -151,10 +205,18 @@ class Node : public NodeBase<Tdim> {
   void update_momentum(bool update, unsigned phase,
                        const VectorDim& momentum) noexcept override;
 
+  //! Add momentum at the node without locking the node
+  //! \param[in] phase Index corresponding to the phase
+  //! \param[in] momentum Momentum from the particles in a cell
+  void update_momentum_unlocked(
+      unsigned phase, const VectorDim& momentum) noexcept override {
+    store_->momentum(store_index_, phase) += momentum;
+  }
+
   //! Return momentum at a given node for a given phase
   //! \param[in] phase Index corresponding to the phase
   VectorDim momentum(unsigned phase) const override {
-    return momentum_.col(phase);
+    return store_->momentum(store_index_, phase);
   }
 
   //! Compute velocity from the momentum
@@ -163,7 +225,7 @@ class Node : public NodeBase<Tdim> {
   //! Return velocity at a given node for a given phase
   //! \param[in] phase Index corresponding to the phase
   VectorDim velocity(unsigned phase) const override {
-    return velocity_.col(phase);
+    return store_->velocity(store_index_, phase);
   }
 
   //! Update nodal acceleration
@@ -176,7 +238,7 @@ class Node : public NodeBase<Tdim> {
   //! Return acceleration at a given node for a given phase
   //! \param[in] phase Index corresponding to the phase
   VectorDim acceleration(unsigned phase) const override {
-    return acceleration_.col(phase);
+    return store_->acceleration(store_index_, phase);
   }
 
   //! Compute acceleration and velocity
@@ -198,6 +260,11 @@ class Node : public NodeBase<Tdim> {
   //! \param[in] velocity Applied velocity constraint
   bool assign_velocity_constraint(unsigned dir, double velocity) override;
 
+  //! Return velocity constraints of direction and velocity
+  std::map<unsigned, double> velocity_constraints() const override {
+    return velocity_constraints_;
+  }
+
   //! Apply velocity constraints
   void apply_velocity_constraints() override;
 
@@ -255,6 +322,25 @@ class Node : public NodeBase<Tdim> {
                        const Eigen::MatrixXd& property_value, unsigned mat_id,
                        unsigned nprops) noexcept override;
 
+  //! Update scalar nodal property at the nodes from particle
+  //! \details The property is updated in place without a lock
+  //! \param[in] update A boolean to update (true) or assign (false)
+  //! \param[in] handle Handle of the property in the nodal property pool
+  //! \param[in] property_value Property quantity from the particles in the cell
+  //! \param[in] mat_id Id of the material within the property data
+  void update_property(bool update, unsigned handle, double property_value,
+                       unsigned mat_id) noexcept override;
+
+  //! Update vector nodal property at the nodes from particle
+  //! \details The property is updated in place without a lock
+  //! \param[in] update A boolean to update (true) or assign (false)
+  //! \param[in] handle Handle of the property in the nodal property pool
+  //! \param[in] property_value Property quantity from the particles in the cell
+  //! \param[in] mat_id Id of the material within the property data
+  void update_property(bool update, unsigned handle,
+                       const VectorDim& property_value,
+                       unsigned mat_id) noexcept override;
+
   //! Compute multimaterial change in momentum
   void compute_multimaterial_change_in_momentum() override;
 
@@ -264,6 +350,56 @@ class Node : public NodeBase<Tdim> {
   //! Compute multimaterial normal unit vector
   void compute_multimaterial_normal_unit_vector() override;
 
+  //! Serialize id, coordinates and boundary conditions of the node
+  //! \retval buffer Serialized buffer data
+  std::vector<uint8_t> serialize() override;
+
+  //! Deserialize
+  //! \param[in] buffer Serialized buffer data
+  //! \param[in] functions Math functions of concentrated forces by their id
+  void deserialize(const std::vector<uint8_t>& buffer,
+                   const std::map<unsigned, std::shared_ptr<FunctionBase>>&
+                       functions) override;
+
+ private:
+  //! Compute pack size
+  //! \retval pack size of serialized object
+  int compute_pack_size() const;
+
+  //! Define a map of a nodal vector quantity of all phases in the node store
+  using MapDimPhases = Eigen::Map<Eigen::Matrix<double, Tdim, Tnphases>>;
+
+  //! Return mass of all phases in the node store
+  Eigen::Map<Eigen::Matrix<double, 1, Tnphases>> masses() {
+    return Eigen::Map<Eigen::Matrix<double, 1, Tnphases>>(
+        &store_->mass(store_index_, 0));
+  }
+
+  //! Return external force of all phases in the node store
+  MapDimPhases external_forces() {
+    return MapDimPhases(store_->external_force(store_index_, 0).data());
+  }
+
+  //! Return internal force of all phases in the node store
+  MapDimPhases internal_forces() {
+    return MapDimPhases(store_->internal_force(store_index_, 0).data());
+  }
+
+  //! Return momentum of all phases in the node store
+  MapDimPhases momenta() {
+    return MapDimPhases(store_->momentum(store_index_, 0).data());
+  }
+
+  //! Return velocity of all phases in the node store
+  MapDimPhases velocities() {
+    return MapDimPhases(store_->velocity(store_index_, 0).data());
+  }
+
+  //! Return acceleration of all phases in the node store
+  MapDimPhases accelerations() {
+    return MapDimPhases(store_->acceleration(store_index_, 0).data());
+  }
+
  private:
   //! Mutex
   SpinMutex node_mutex_;
@@ -279,24 +415,17 @@ class Node : public NodeBase<Tdim> {
   unsigned dof_{std::numeric_limits<unsigned>::max()};
   //! Status
   bool status_{false};
-  //! Mass
-  Eigen::Matrix<double, 1, Tnphases> mass_;
+  //! Node store which holds the mass, momentum, forces, velocity and
+  //! acceleration of the node
+  std::shared_ptr<NodeStore<Tdim>> store_;
+  //! Index of the node in the node store
+  Index store_index_{std::numeric_limits<Index>::max()};
   //! Volume
   Eigen::Matrix<double, 1, Tnphases> volume_;
-  //! External force
-  Eigen::Matrix<double, Tdim, Tnphases> external_force_;
-  //! Internal force
-  Eigen::Matrix<double, Tdim, Tnphases> internal_force_;
   //! Pressure
   Eigen::Matrix<double, 1, Tnphases> pressure_;
   //! Displacement
   Eigen::Matrix<double, Tdim, 1> contact_displacement_;
-  //! Velocity
-  Eigen::Matrix<double, Tdim, Tnphases> velocity_;
-  //! Momentum
-  Eigen::Matrix<double, Tdim, Tnphases> momentum_;
-  //! Acceleration
-  Eigen::Matrix<double, Tdim, Tnphases> acceleration_;
   //! Velocity constraints
   std::map<unsigned, double> velocity_constraints_;
   //! Rotation matrix for general velocity constraints
@@ -14,24 +14,46 @@ mpm::Node<Tdim, Tdof, Tnphases>::Node(
       "node" + std::to_string(Tdim) + "d::" + std::to_string(id);
   console_ = std::make_unique<spdlog::logger>(logger, mpm::stdout_sink);
 
+  // Nodal state is held in its own store until it is added to a mesh
+  store_ = std::make_shared<mpm::NodeStore<Tdim>>(Tnphases);
+  store_->add(&store_index_);
+
   // Clear any velocity constraints
   velocity_constraints_.clear();
   concentrated_force_.setZero();
   this->initialise();
 }
 
+//! Destructor
+template <unsigned Tdim, unsigned Tdof, unsigned Tnphases>
+mpm::Node<Tdim, Tdof, Tnphases>::~Node() {
+  // Release the slot in the node store
+  if (store_ != nullptr) store_->remove(store_index_);
+}
+
+//! Assign node store
+template <unsigned Tdim, unsigned Tdof, unsigned Tnphases>
+void mpm::Node<Tdim, Tdof, Tnphases>::assign_node_store(
+    const std::shared_ptr<mpm::NodeStore<Tdim>>& store) {
+  if (store != nullptr && store != store_) {
+    store->transfer(&store_index_, store_.get());
+    store_ = store;
+  }
+}
+
 //! Initialise nodal properties
 template <unsigned Tdim, unsigned Tdof, unsigned Tnphases>
 void mpm::Node<Tdim, Tdof, Tnphases>::initialise() noexcept {
-  mass_.setZero();
+  store_->initialise(store_index_);
+  this->initialise_state();
+}
+
+//! Initialise nodal properties which are not held in the node store
+template <unsigned Tdim, unsigned Tdof, unsigned Tnphases>
+void mpm::Node<Tdim, Tdof, Tnphases>::initialise_state() noexcept {
   volume_.setZero();
-  external_force_.setZero();
-  internal_force_.setZero();
   pressure_.setZero();
   contact_displacement_.setZero();
-  velocity_.setZero();
-  momentum_.setZero();
-  acceleration_.setZero();
   status_ = false;
   material_ids_.clear();
 }
@@ -55,7 +77,8 @@ void mpm::Node<Tdim, Tdof, Tnphases>::update_mass(bool update, unsigned phase,
 
   // Update/assign mass
   node_mutex_.lock();
-  mass_(phase) = (mass_(phase) * factor) + mass;
+  double& nodal_mass = store_->mass(store_index_, phase);
+  nodal_mass = (nodal_mass * factor) + mass;
   node_mutex_.unlock();
 }
 
@@ -118,7 +141,8 @@ void mpm::Node<Tdim, Tdof, Tnphases>::update_external_force(
 
   // Update/assign external force
   node_mutex_.lock();
-  external_force_.col(phase) = external_force_.col(phase) * factor + force;
+  auto external_force = store_->external_force(store_index_, phase);
+  external_force = external_force * factor + force;
   node_mutex_.unlock();
 }
 
@@ -135,7 +159,8 @@ void mpm::Node<Tdim, Tdof, Tnphases>::update_internal_force(
 
   // Update/assign internal force
   node_mutex_.lock();
-  internal_force_.col(phase) = internal_force_.col(phase) * factor + force;
+  auto internal_force = store_->internal_force(store_index_, phase);
+  internal_force = internal_force * factor + force;
   node_mutex_.unlock();
 }
 
@@ -152,7 +177,8 @@ void mpm::Node<Tdim, Tdof, Tnphases>::update_momentum(
 
   // Update/assign momentum
   node_mutex_.lock();
-  momentum_.col(phase) = momentum_.col(phase) * factor + momentum;
+  auto nodal_momentum = store_->momentum(store_index_, phase);
+  nodal_momentum = nodal_momentum * factor + momentum;
   node_mutex_.unlock();
 }
 
@@ -165,13 +191,27 @@ void mpm::Node<Tdim, Tdof, Tnphases>::update_mass_pressure(
 
   const double tolerance = 1.E-16;
   // Compute pressure from mass*pressure
-  if (mass_(phase) > tolerance) {
+  const double mass = store_->mass(store_index_, phase);
+  if (mass > tolerance) {
     node_mutex_.lock();
-    pressure_(phase) += mass_pressure / mass_(phase);
+    pressure_(phase) += mass_pressure / mass;
     node_mutex_.unlock();
   }
 }
 
+//! Update pressure at the nodes from particle without locking the node
+template <unsigned Tdim, unsigned Tdof, unsigned Tnphases>
+void mpm::Node<Tdim, Tdof, Tnphases>::update_mass_pressure_unlocked(
+    unsigned phase, double mass_pressure) noexcept {
+  // Assert
+  assert(phase < Tnphases);
+
+  const double tolerance = 1.E-16;
+  // Compute pressure from mass*pressure
+  const double mass = store_->mass(store_index_, phase);
+  if (mass > tolerance) pressure_(phase) += mass_pressure / mass;
+}
+
 //! Assign pressure at the nodes from particle
 template <unsigned Tdim, unsigned Tdof, unsigned Tnphases>
 void mpm::Node<Tdim, Tdof, Tnphases>::assign_pressure(unsigned phase,
@@ -188,13 +228,14 @@ template <unsigned Tdim, unsigned Tdof, unsigned Tnphases>
 void mpm::Node<Tdim, Tdof, Tnphases>::compute_velocity() {
   const double tolerance = 1.E-16;
   for (unsigned phase = 0; phase < Tnphases; ++phase) {
-    if (mass_(phase) > tolerance) {
-      velocity_.col(phase) = momentum_.col(phase) / mass_(phase);
+    const double mass = store_->mass(store_index_, phase);
+    if (mass > tolerance) {
+      auto velocity = store_->velocity(store_index_, phase);
+      velocity = store_->momentum(store_index_, phase) / mass;
 
       // Check to see if value is below threshold
-      for (unsigned i = 0; i < velocity_.rows(); ++i)
-        if (std::abs(velocity_.col(phase)(i)) < 1.E-15)
-          velocity_.col(phase)(i) = 0.;
+      for (unsigned i = 0; i < velocity.rows(); ++i)
+        if (std::abs(velocity(i)) < 1.E-15) velocity(i) = 0.;
     }
   }
 
@@ -215,7 +256,8 @@ void mpm::Node<Tdim, Tdof, Tnphases>::update_acceleration(
 
   //! Update/assign acceleration
   node_mutex_.lock();
-  acceleration_.col(phase) = acceleration_.col(phase) * factor + acceleration;
+  auto nodal_acceleration = store_->acceleration(store_index_, phase);
+  nodal_acceleration = nodal_acceleration * factor + acceleration;
   node_mutex_.unlock();
 }
 
@@ -225,28 +267,29 @@ bool mpm::Node<Tdim, Tdof, Tnphases>::compute_acceleration_velocity(
     unsigned phase, double dt) noexcept {
   bool status = false;
   const double tolerance = 1.0E-15;
-  if (mass_(phase) > tolerance) {
+  const double mass = store_->mass(store_index_, phase);
+  if (mass > tolerance) {
+    auto velocity = store_->velocity(store_index_, phase);
+    auto acceleration = store_->acceleration(store_index_, phase);
     // acceleration = (unbalaced force / mass)
-    this->acceleration_.col(phase) =
-        (this->external_force_.col(phase) + this->internal_force_.col(phase)) /
-        this->mass_(phase);
+    acceleration = (store_->external_force(store_index_, phase) +
+                    store_->internal_force(store_index_, phase)) /
+                   mass;
 
     // Apply friction constraints
     this->apply_friction_constraints(dt);
 
     // Velocity += acceleration * dt
-    this->velocity_.col(phase) += this->acceleration_.col(phase) * dt;
+    velocity += acceleration * dt;
     // Apply velocity constraints, which also sets acceleration to 0,
     // when velocity is set.
     this->apply_velocity_constraints();
 
     // Set a threshold
     for (unsigned i = 0; i < Tdim; ++i)
-      if (std::abs(velocity_.col(phase)(i)) < tolerance)
-        velocity_.col(phase)(i) = 0.;
+      if (std::abs(velocity(i)) < tolerance) velocity(i) = 0.;
     for (unsigned i = 0; i < Tdim; ++i)
-      if (std::abs(acceleration_.col(phase)(i)) < tolerance)
-        acceleration_.col(phase)(i) = 0.;
+      if (std::abs(acceleration(i)) < tolerance) acceleration(i) = 0.;
     status = true;
   }
   return status;
@@ -258,31 +301,32 @@ bool mpm::Node<Tdim, Tdof, Tnphases>::compute_acceleration_velocity_cundall(
     unsigned phase, double dt, double damping_factor) noexcept {
   bool status = false;
   const double tolerance = 1.0E-15;
-  if (mass_(phase) > tolerance) {
+  const double mass = store_->mass(store_index_, phase);
+  if (mass > tolerance) {
+    auto velocity = store_->velocity(store_index_, phase);
+    auto acceleration = store_->acceleration(store_index_, phase);
     // acceleration = (unbalaced force / mass)
-    auto unbalanced_force =
-        this->external_force_.col(phase) + this->internal_force_.col(phase);
-    this->acceleration_.col(phase) =
-        (unbalanced_force - damping_factor * unbalanced_force.norm() *
-                                this->velocity_.col(phase).cwiseSign()) /
-        this->mass_(phase);
+    auto unbalanced_force = store_->external_force(store_index_, phase) +
+                            store_->internal_force(store_index_, phase);
+    acceleration = (unbalanced_force - damping_factor *
+                                           unbalanced_force.norm() *
+                                           velocity.cwiseSign()) /
+                   mass;
 
     // Apply friction constraints
     this->apply_friction_constraints(dt);
 
     // Velocity += acceleration * dt
-    this->velocity_.col(phase) += this->acceleration_.col(phase) * dt;
+    velocity += acceleration * dt;
     // Apply velocity constraints, which also sets acceleration to 0,
     // when velocity is set.
     this->apply_velocity_constraints();
 
     // Set a threshold
     for (unsigned i = 0; i < Tdim; ++i)
-      if (std::abs(velocity_.col(phase)(i)) < tolerance)
-        velocity_.col(phase)(i) = 0.;
+      if (std::abs(velocity(i)) < tolerance) velocity(i) = 0.;
     for (unsigned i = 0; i < Tdim; ++i)
-      if (std::abs(acceleration_.col(phase)(i)) < tolerance)
-        acceleration_.col(phase)(i) = 0.;
+      if (std::abs(acceleration(i)) < tolerance) acceleration(i) = 0.;
     status = true;
   }
   return status;
@@ -323,9 +367,9 @@ void mpm::Node<Tdim, Tdof, Tnphases>::apply_velocity_constraints() {
 
     if (!generic_boundary_constraints_) {
       // Velocity constraints are applied on Cartesian boundaries
-      this->velocity_(direction, phase) = constraint.second;
+      this->velocities()(direction, phase) = constraint.second;
       // Set acceleration to 0 in direction of velocity constraint
-      this->acceleration_(direction, phase) = 0.;
+      this->accelerations()(direction, phase) = 0.;
     } else {
       // Velocity constraints on general boundaries
       // Compute inverse rotation matrix
@@ -333,15 +377,15 @@ void mpm::Node<Tdim, Tdof, Tnphases>::apply_velocity_constraints() {
           rotation_matrix_.inverse();
       // Transform to local coordinate
       Eigen::Matrix<double, Tdim, Tnphases> local_velocity =
-          inverse_rotation_matrix * this->velocity_;
+          inverse_rotation_matrix * this->velocities();
       Eigen::Matrix<double, Tdim, Tnphases> local_acceleration =
-          inverse_rotation_matrix * this->acceleration_;
+          inverse_rotation_matrix * this->accelerations();
       // Apply boundary condition in local coordinate
       local_velocity(direction, phase) = constraint.second;
       local_acceleration(direction, phase) = 0.;
       // Transform back to global coordinate
-      this->velocity_ = rotation_matrix_ * local_velocity;
-      this->acceleration_ = rotation_matrix_ * local_acceleration;
+      this->velocities() = rotation_matrix_ * local_velocity;
+      this->accelerations() = rotation_matrix_ * local_acceleration;
     }
   }
 }
@@ -397,10 +441,10 @@ void mpm::Node<Tdim, Tdof, Tnphases>::apply_friction_constraints(double dt) {
       if (!generic_boundary_constraints_) {
         // Cartesian case
         // Normal and tangential acceleration
-        acc_n = this->acceleration_(dir_n, phase);
-        acc_t = this->acceleration_(dir_t, phase);
+        acc_n = this->accelerations()(dir_n, phase);
+        acc_t = this->accelerations()(dir_t, phase);
         // Velocity tangential
-        vel_t = this->velocity_(dir_t, phase);
+        vel_t = this->velocities()(dir_t, phase);
       } else {
         // General case, transform to local coordinate
         // Compute inverse rotation matrix
@@ -408,9 +452,9 @@ void mpm::Node<Tdim, Tdof, Tnphases>::apply_friction_constraints(double dt) {
             rotation_matrix_.inverse();
         // Transform to local coordinate
         Eigen::Matrix<double, Tdim, Tnphases> local_acceleration =
-            inverse_rotation_matrix * this->acceleration_;
+            inverse_rotation_matrix * this->accelerations();
         Eigen::Matrix<double, Tdim, Tnphases> local_velocity =
-            inverse_rotation_matrix * this->velocity_;
+            inverse_rotation_matrix * this->velocities();
         // Normal and tangential acceleration
         acc_n = local_acceleration(dir_n, phase);
         acc_t = local_acceleration(dir_t, phase);
@@ -435,7 +479,7 @@ void mpm::Node<Tdim, Tdof, Tnphases>::apply_friction_constraints(double dt) {
 
         if (!generic_boundary_constraints_) {
           // Cartesian case
-          this->acceleration_(dir_t, phase) = acc_t;
+          this->accelerations()(dir_t, phase) = acc_t;
         } else {
           // Local acceleration in terms of tangential and normal
           Eigen::Matrix<double, Tdim, Tnphases> acc;
@@ -443,7 +487,7 @@ void mpm::Node<Tdim, Tdof, Tnphases>::apply_friction_constraints(double dt) {
           acc(dir_n, phase) = acc_n;
 
           // General case, transform to global coordinate
-          this->acceleration_.col(phase) = rotation_matrix_ * acc.col(phase);
+          this->accelerations().col(phase) = rotation_matrix_ * acc.col(phase);
         }
       }
     } else if (Tdim == 3) {
@@ -461,16 +505,16 @@ void mpm::Node<Tdim, Tdof, Tnphases>::apply_friction_constraints(double dt) {
       Eigen::Matrix<double, Tdim, 1> acc, vel;
       if (!generic_boundary_constraints_) {
         // Cartesian case
-        acc = this->acceleration_.col(phase);
-        vel = this->velocity_.col(phase);
+        acc = this->accelerations().col(phase);
+        vel = this->velocities().col(phase);
       } else {
         // General case, transform to local coordinate
         // Compute inverse rotation matrix
         const Eigen::Matrix<double, Tdim, Tdim> inverse_rotation_matrix =
             rotation_matrix_.inverse();
         // Transform to local coordinate
-        acc = inverse_rotation_matrix * this->acceleration_.col(phase);
-        vel = inverse_rotation_matrix * this->velocity_.col(phase);
+        acc = inverse_rotation_matrix * this->accelerations().col(phase);
+        vel = inverse_rotation_matrix * this->velocities().col(phase);
       }
 
       const auto acc_n = acc(dir_n);
@@ -510,10 +554,10 @@ void mpm::Node<Tdim, Tdof, Tnphases>::apply_friction_constraints(double dt) {
 
         if (!generic_boundary_constraints_) {
           // Cartesian case
-          this->acceleration_.col(phase) = acc;
+          this->accelerations().col(phase) = acc;
         } else {
           // General case, transform to global coordinate
-          this->acceleration_.col(phase) = rotation_matrix_ * acc;
+          this->accelerations().col(phase) = rotation_matrix_ * acc;
         }
       }
     }
@@ -550,22 +594,50 @@ void mpm::Node<Tdim, Tdof, Tnphases>::update_property(
   node_mutex_.unlock();
 }
 
+//! Update scalar nodal property at the nodes from particle
+template <unsigned Tdim, unsigned Tdof, unsigned Tnphases>
+void mpm::Node<Tdim, Tdof, Tnphases>::update_property(
+    bool update, unsigned handle, double property_value,
+    unsigned mat_id) noexcept {
+  // Update/assign property
+  if (update)
+    property_handle_->update_property<1>(
+        handle, prop_id_, mat_id,
+        Eigen::Matrix<double, 1, 1>::Constant(property_value));
+  else
+    property_handle_->property<1>(handle, prop_id_, mat_id)(0) =
+        property_value;
+}
+
+//! Update vector nodal property at the nodes from particle
+template <unsigned Tdim, unsigned Tdof, unsigned Tnphases>
+void mpm::Node<Tdim, Tdof, Tnphases>::update_property(
+    bool update, unsigned handle, const VectorDim& property_value,
+    unsigned mat_id) noexcept {
+  // Update/assign property
+  if (update)
+    property_handle_->update_property<Tdim>(handle, prop_id_, mat_id,
+                                            property_value);
+  else
+    property_handle_->property<Tdim>(handle, prop_id_, mat_id) =
+        property_value;
+}
+
 //! Compute multimaterial change in momentum
 template <unsigned Tdim, unsigned Tdof, unsigned Tnphases>
 void mpm::Node<Tdim, Tdof,
                Tnphases>::compute_multimaterial_change_in_momentum() {
+  auto& pool = *property_handle_;
   // iterate over all materials in the material_ids set and update the change in
   // momentum
   node_mutex_.lock();
   for (auto mitr = material_ids_.begin(); mitr != material_ids_.end(); ++mitr) {
-    const Eigen::Matrix<double, 1, 1> mass =
-        property_handle_->property("masses", prop_id_, *mitr);
-    const Eigen::Matrix<double, Tdim, 1> momentum =
-        property_handle_->property("momenta", prop_id_, *mitr, Tdim);
-    const Eigen::Matrix<double, Tdim, 1> change_in_momenta =
-        velocity_ * mass - momentum;
-    property_handle_->update_property("change_in_momenta", prop_id_, *mitr,
-                                      change_in_momenta, Tdim);
+    const double mass =
+        pool.property<1>(mpm::NodalProperties::Masses, prop_id_, *mitr)(0);
+    const auto momentum =
+        pool.property<Tdim>(mpm::NodalProperties::Momenta, prop_id_, *mitr);
+    pool.property<Tdim>(mpm::NodalProperties::ChangeInMomenta, prop_id_,
+                        *mitr) += this->velocities() * mass - momentum;
   }
   node_mutex_.unlock();
 }
@@ -574,39 +646,38 @@ void mpm::Node<Tdim, Tdof,
 template <unsigned Tdim, unsigned Tdof, unsigned Tnphases>
 void mpm::Node<Tdim, Tdof,
                Tnphases>::compute_multimaterial_separation_vector() {
+  auto& pool = *property_handle_;
+  const double mass = this->masses()(0, 0);
   // iterate over all materials in the material_ids set, update the
   // displacements and calculate the displacement of the center of mass for this
   // node
   node_mutex_.lock();
   for (auto mitr = material_ids_.begin(); mitr != material_ids_.end(); ++mitr) {
-    const auto& material_displacement =
-        property_handle_->property("displacements", prop_id_, *mitr, Tdim);
-    const auto& material_mass =
-        property_handle_->property("masses", prop_id_, *mitr);
+    auto material_displacement = pool.property<Tdim>(
+        mpm::NodalProperties::Displacements, prop_id_, *mitr);
+    const double material_mass =
+        pool.property<1>(mpm::NodalProperties::Masses, prop_id_, *mitr)(0);
 
     // displacement of the center of mass
-    contact_displacement_ += material_displacement / mass_(0, 0);
+    contact_displacement_ += material_displacement / mass;
     // assign nodal-multimaterial displacement by dividing it by this material's
     // mass
-    property_handle_->assign_property(
-        "displacements", prop_id_, *mitr,
-        material_displacement / material_mass(0, 0), Tdim);
+    material_displacement /= material_mass;
   }
 
   // iterate over all materials in the material_ids to compute the separation
   // vector
   for (auto mitr = material_ids_.begin(); mitr != material_ids_.end(); ++mitr) {
-    const Eigen::Matrix<double, Tdim, 1> material_displacement =
-        property_handle_->property("displacements", prop_id_, *mitr, Tdim);
-    const Eigen::Matrix<double, 1, 1> material_mass =
-        property_handle_->property("masses", prop_id_, *mitr);
+    const auto material_displacement = pool.property<Tdim>(
+        mpm::NodalProperties::Displacements, prop_id_, *mitr);
+    const double material_mass =
+        pool.property<1>(mpm::NodalProperties::Masses, prop_id_, *mitr)(0);
 
     // Update the separation vector property
-    const auto& separation_vector =
-        (contact_displacement_ - material_displacement) * mass_(0, 0) /
-        (mass_(0, 0) - material_mass(0, 0));
-    property_handle_->update_property("separation_vectors", prop_id_, *mitr,
-                                      separation_vector, Tdim);
+    pool.property<Tdim>(mpm::NodalProperties::SeparationVectors, prop_id_,
+                        *mitr) += (contact_displacement_ -
+                                   material_displacement) *
+                                  mass / (mass - material_mass);
   }
   node_mutex_.unlock();
 }
@@ -615,19 +686,214 @@ void mpm::Node<Tdim, Tdof,
 template <unsigned Tdim, unsigned Tdof, unsigned Tnphases>
 void mpm::Node<Tdim, Tdof,
                Tnphases>::compute_multimaterial_normal_unit_vector() {
+  auto& pool = *property_handle_;
   // Iterate over all materials in the material_ids set
   node_mutex_.lock();
   for (auto mitr = material_ids_.begin(); mitr != material_ids_.end(); ++mitr) {
     // calculte the normal unit vector
-    VectorDim domain_gradient =
-        property_handle_->property("domain_gradients", prop_id_, *mitr, Tdim);
-    VectorDim normal_unit_vector = VectorDim::Zero();
+    const auto domain_gradient = pool.property<Tdim>(
+        mpm::NodalProperties::DomainGradients, prop_id_, *mitr);
+    auto normal_unit_vector = pool.property<Tdim>(
+        mpm::NodalProperties::NormalUnitVectors, prop_id_, *mitr);
+    // assign nodal-multimaterial normal unit vector to property pool
     if (domain_gradient.norm() > std::numeric_limits<double>::epsilon())
       normal_unit_vector = domain_gradient.normalized();
-
-    // assign nodal-multimaterial normal unit vector to property pool
-    property_handle_->assign_property("normal_unit_vectors", prop_id_, *mitr,
-                                      normal_unit_vector, Tdim);
+    else
+      normal_unit_vector.setZero();
   }
   node_mutex_.unlock();
 }
+
+//! Compute pack size
+template <unsigned Tdim, unsigned Tdof, unsigned Tnphases>
+int mpm::Node<Tdim, Tdof, Tnphases>::compute_pack_size() const {
+  int total_size = 0;
+  int partial_size;
+#ifdef USE_MPI
+  // ID
+  MPI_Pack_size(1, MPI_UNSIGNED_LONG_LONG, MPI_COMM_WORLD, &partial_size);
+  total_size += partial_size;
+  // Coordinates
+  MPI_Pack_size(Tdim, MPI_DOUBLE, MPI_COMM_WORLD, &partial_size);
+  total_size += partial_size;
+
+  // Velocity constraints as directions and velocities
+  const int nconstraints = velocity_constraints_.size();
+  MPI_Pack_size(1 + nconstraints, MPI_UNSIGNED, MPI_COMM_WORLD, &partial_size);
+  total_size += partial_size;
+  MPI_Pack_size(nconstraints, MPI_DOUBLE, MPI_COMM_WORLD, &partial_size);
+  total_size += partial_size;
+
+  // Friction constraint as direction, sign and friction
+  MPI_Pack_size(1, MPI_C_BOOL, MPI_COMM_WORLD, &partial_size);
+  total_size += partial_size;
+  if (friction_) {
+    MPI_Pack_size(1, MPI_UNSIGNED, MPI_COMM_WORLD, &partial_size);
+    total_size += partial_size;
+    MPI_Pack_size(1, MPI_INT, MPI_COMM_WORLD, &partial_size);
+    total_size += partial_size;
+    MPI_Pack_size(1, MPI_DOUBLE, MPI_COMM_WORLD, &partial_size);
+    total_size += partial_size;
+  }
+
+  // Concentrated force and id of its math function
+  MPI_Pack_size(Tdim * Tnphases, MPI_DOUBLE, MPI_COMM_WORLD, &partial_size);
+  total_size += partial_size;
+  MPI_Pack_size(1, MPI_INT, MPI_COMM_WORLD, &partial_size);
+  total_size += partial_size;
+
+  // Rotation matrix
+  MPI_Pack_size(1, MPI_C_BOOL, MPI_COMM_WORLD, &partial_size);
+  total_size += partial_size;
+  if (generic_boundary_constraints_) {
+    MPI_Pack_size(Tdim * Tdim, MPI_DOUBLE, MPI_COMM_WORLD, &partial_size);
+    total_size += partial_size;
+  }
+#endif
+  return total_size;
+}
+
+//! Serialize id, coordinates and boundary conditions of the node
+template <unsigned Tdim, unsigned Tdof, unsigned Tnphases>
+std::vector<uint8_t> mpm::Node<Tdim, Tdof, Tnphases>::serialize() {
+  // Initialize data buffer
+  std::vector<uint8_t> data;
+  data.resize(this->compute_pack_size());
+  uint8_t* data_ptr = data.data();
+  int position = 0;
+
+#ifdef USE_MPI
+  // ID
+  MPI_Pack(&id_, 1, MPI_UNSIGNED_LONG_LONG, data_ptr, data.size(), &position,
+           MPI_COMM_WORLD);
+  // Coordinates
+  MPI_Pack(coordinates_.data(), Tdim, MPI_DOUBLE, data_ptr, data.size(),
+           &position, MPI_COMM_WORLD);
+
+  // Velocity constraints
+  unsigned nconstraints = velocity_constraints_.size();
+  MPI_Pack(&nconstraints, 1, MPI_UNSIGNED, data_ptr, data.size(), &position,
+           MPI_COMM_WORLD);
+  std::vector<unsigned> directions;
+  std::vector<double> velocities;
+  for (const auto& constraint : velocity_constraints_) {
+    directions.emplace_back(constraint.first);
+    velocities.emplace_back(constraint.second);
+  }
+  MPI_Pack(directions.data(), nconstraints, MPI_UNSIGNED, data_ptr,
+           data.size(), &position, MPI_COMM_WORLD);
+  MPI_Pack(velocities.data(), nconstraints, MPI_DOUBLE, data_ptr, data.size(),
+           &position, MPI_COMM_WORLD);
+
+  // Friction constraint
+  MPI_Pack(&friction_, 1, MPI_C_BOOL, data_ptr, data.size(), &position,
+           MPI_COMM_WORLD);
+  if (friction_) {
+    unsigned dir = std::get<0>(friction_constraint_);
+    int sign = std::get<1>(friction_constraint_);
+    double friction = std::get<2>(friction_constraint_);
+    MPI_Pack(&dir, 1, MPI_UNSIGNED, data_ptr, data.size(), &position,
+             MPI_COMM_WORLD);
+    MPI_Pack(&sign, 1, MPI_INT, data_ptr, data.size(), &position,
+             MPI_COMM_WORLD);
+    MPI_Pack(&friction, 1, MPI_DOUBLE, data_ptr, data.size(), &position,
+             MPI_COMM_WORLD);
+  }
+
+  // Concentrated force and id of its math function, -1 if there is none
+  MPI_Pack(concentrated_force_.data(), Tdim * Tnphases, MPI_DOUBLE, data_ptr,
+           data.size(), &position, MPI_COMM_WORLD);
+  int function_id =
+      (force_function_ != nullptr) ? static_cast<int>(force_function_->id())
+                                   : -1;
+  MPI_Pack(&function_id, 1, MPI_INT, data_ptr, data.size(), &position,
+           MPI_COMM_WORLD);
+
+  // Rotation matrix
+  MPI_Pack(&generic_boundary_constraints_, 1, MPI_C_BOOL, data_ptr,
+           data.size(), &position, MPI_COMM_WORLD);
+  if (generic_boundary_constraints_)
+    MPI_Pack(rotation_matrix_.data(), Tdim * Tdim, MPI_DOUBLE, data_ptr,
+             data.size(), &position, MPI_COMM_WORLD);
+#endif
+  return data;
+}
+
+//! Deserialize
+template <unsigned Tdim, unsigned Tdof, unsigned Tnphases>
+void mpm::Node<Tdim, Tdof, Tnphases>::deserialize(
+    const std::vector<uint8_t>& data,
+    const std::map<unsigned, std::shared_ptr<FunctionBase>>& functions) {
+  uint8_t* data_ptr = const_cast<uint8_t*>(data.data());
+  int position = 0;
+
+#ifdef USE_MPI
+  // ID
+  MPI_Unpack(data_ptr, data.size(), &position, &id_, 1, MPI_UNSIGNED_LONG_LONG,
+             MPI_COMM_WORLD);
+  // Coordinates
+  MPI_Unpack(data_ptr, data.size(), &position, coordinates_.data(), Tdim,
+             MPI_DOUBLE, MPI_COMM_WORLD);
+
+  // Velocity constraints
+  unsigned nconstraints = 0;
+  MPI_Unpack(data_ptr, data.size(), &position, &nconstraints, 1, MPI_UNSIGNED,
+             MPI_COMM_WORLD);
+  std::vector<unsigned> directions(nconstraints);
+  std::vector<double> velocities(nconstraints);
+  MPI_Unpack(data_ptr, data.size(), &position, directions.data(),
+             nconstraints, MPI_UNSIGNED, MPI_COMM_WORLD);
+  MPI_Unpack(data_ptr, data.size(), &position, velocities.data(),
+             nconstraints, MPI_DOUBLE, MPI_COMM_WORLD);
+  velocity_constraints_.clear();
+  for (unsigned i = 0; i < nconstraints; ++i)
+    if (!this->assign_velocity_constraint(directions[i], velocities[i]))
+      throw std::runtime_error("Velocity constraint of the node is invalid");
+
+  // Friction constraint
+  bool friction = false;
+  MPI_Unpack(data_ptr, data.size(), &position, &friction, 1, MPI_C_BOOL,
+             MPI_COMM_WORLD);
+  friction_ = false;
+  if (friction) {
+    unsigned dir;
+    int sign;
+    double friction_value;
+    MPI_Unpack(data_ptr, data.size(), &position, &dir, 1, MPI_UNSIGNED,
+               MPI_COMM_WORLD);
+    MPI_Unpack(data_ptr, data.size(), &position, &sign, 1, MPI_INT,
+               MPI_COMM_WORLD);
+    MPI_Unpack(data_ptr, data.size(), &position, &friction_value, 1,
+               MPI_DOUBLE, MPI_COMM_WORLD);
+    if (!this->assign_friction_constraint(dir, sign, friction_value))
+      throw std::runtime_error("Friction constraint of the node is invalid");
+  }
+
+  // Concentrated force and its math function
+  MPI_Unpack(data_ptr, data.size(), &position, concentrated_force_.data(),
+             Tdim * Tnphases, MPI_DOUBLE, MPI_COMM_WORLD);
+  int function_id = -1;
+  MPI_Unpack(data_ptr, data.size(), &position, &function_id, 1, MPI_INT,
+             MPI_COMM_WORLD);
+  force_function_ = nullptr;
+  if (function_id >= 0) {
+    const auto fitr = functions.find(function_id);
+    if (fitr == functions.end())
+      throw std::runtime_error(
+          "Math function of the nodal concentrated force is not found");
+    force_function_ = fitr->second;
+  }
+
+  // Rotation matrix
+  bool generic_boundary_constraints = false;
+  MPI_Unpack(data_ptr, data.size(), &position, &generic_boundary_constraints,
+             1, MPI_C_BOOL, MPI_COMM_WORLD);
+  generic_boundary_constraints_ = false;
+  if (generic_boundary_constraints) {
+    Eigen::Matrix<double, Tdim, Tdim> rotation_matrix;
+    MPI_Unpack(data_ptr, data.size(), &position, rotation_matrix.data(),
+               Tdim * Tdim, MPI_DOUBLE, MPI_COMM_WORLD);
+    this->assign_rotation_matrix(rotation_matrix);
+  }
+#endif
+}
@@ -1,6 +1,11 @@
 #ifndef MPM_NODE_BASE_H_
 #define MPM_NODE_BASE_H_
 
+// MPI
+#ifdef USE_MPI
+#include "mpi.h"
+#endif
+
 #include <array>
 #include <limits>
 #include <map>
@@ -14,6 +19,7 @@
 #include "data_types.h"
 #include "function_base.h"
 #include "nodal_properties.h"
+#include "node_store.h"
 
 namespace mpm {
 
@@ -61,6 +67,9 @@ class NodeBase {
   //! Initialise properties
   virtual void initialise() noexcept = 0;
 
+  //! Initialise properties which are not held in the node store
+  virtual void initialise_state() noexcept = 0;
+
   //! Return degrees of freedom
   virtual unsigned dof() const = 0;
 
@@ -70,6 +79,22 @@ class NodeBase {
   //! Return status
   virtual bool status() const = 0;
 
+  //! Assign node store
+  //! \details Moves the nodal state from its current store into the given
+  //! store, e.g., the store of the mesh to which the node is added
+  //! \param[in] store Node store
+  virtual void assign_node_store(
+      const std::shared_ptr<NodeStore<Tdim>>& store) = 0;
+
+  //! Return node store
+  virtual std::shared_ptr<NodeStore<Tdim>> node_store() const = 0;
+
+  //! Return index of the node in the node store
+  virtual Index store_index() const = 0;
+
+  //! Return true if velocity or friction constraints are applied at the node
+  virtual bool constrained() const = 0;
+
   //! Update mass at the nodes from particle
   //! \param[in] update A boolean to update (true) or assign (false)
   //! \param[in] phase Index corresponding to the phase
@@ -77,6 +102,12 @@ class NodeBase {
   virtual void update_mass(bool update, unsigned phase,
                            double mass) noexcept = 0;
 
+  //! Add mass at the node from particle without locking the node, only
+  //! called when no other thread updates the node, e.g., coloured scatter
+  //! \param[in] phase Index corresponding to the phase
+  //! \param[in] mass Mass from the particles in a cell
+  virtual void update_mass_unlocked(unsigned phase, double mass) noexcept = 0;
+
   //! Return mass at a given node for a given phase
   virtual double mass(unsigned phase) const = 0;
 
@@ -112,6 +143,12 @@ class NodeBase {
   virtual void update_external_force(bool update, unsigned phase,
                                      const VectorDim& force) noexcept = 0;
 
+  //! Add external force at the node without locking the node
+  //! \param[in] phase Index corresponding to the phase
+  //! \param[in] force External force from the particles in a cell
+  virtual void update_external_force_unlocked(
+      unsigned phase, const VectorDim& force) noexcept = 0;
+
   //! Return external force
   //! \param[in] phase Index corresponding to the phase
   virtual VectorDim external_force(unsigned phase) const = 0;
@@ -123,6 +160,12 @@ class NodeBase {
   virtual void update_internal_force(bool update, unsigned phase,
                                      const VectorDim& force) noexcept = 0;
 
+  //! Add internal force at the node without locking the node
+  //! \param[in] phase Index corresponding to the phase
+  //! \param[in] force Internal force from the particles in a cell
+  virtual void update_internal_force_unlocked(
+      unsigned phase, const VectorDim& force) noexcept = 0;
+
   //! Return internal force
   //! \param[in] phase Index corresponding to the phase
   virtual VectorDim internal_force(unsigned phase) const = 0;
@@ -133,6 +176,12 @@ class NodeBase {
   virtual void update_mass_pressure(unsigned phase,
                                     double mass_pressure) noexcept = 0;
 
+  //! Update pressure at the node from particle without locking the node
+  //! \param[in] phase Index corresponding to the phase
+  //! \param[in] mass_pressure Product of mass x pressure of a particle
+  virtual void update_mass_pressure_unlocked(
+      unsigned phase, double mass_pressure) noexcept = 0;
+
   //! Assign pressure at the nodes from particle
   //! \param[in] update A boolean to update (true) or assign (false)
   //! \param[in] phase Index corresponding to the phase
@@ -150,6 +199,12 @@ class NodeBase {
   virtual void update_momentum(bool update, unsigned phase,
                                const VectorDim& momentum) noexcept = 0;
 
+  //! Add momentum at the node without locking the node
+  //! \param[in] phase Index corresponding to the phase
+  //! \param[in] momentum Momentum from the particles in a cell
+  virtual void update_momentum_unlocked(
+      unsigned phase, const VectorDim& momentum) noexcept = 0;
+
   //! Return momentum
   //! \param[in] phase Index corresponding to the phase
   virtual VectorDim momentum(unsigned phase) const = 0;
@@ -190,6 +245,9 @@ class NodeBase {
   //! \param[in] velocity Applied velocity constraint
   virtual bool assign_velocity_constraint(unsigned dir, double velocity) = 0;
 
+  //! Return velocity constraints of direction and velocity
+  virtual std::map<unsigned, double> velocity_constraints() const = 0;
+
   //! Apply velocity constraints
   virtual void apply_velocity_constraints() = 0;
 
@@ -244,6 +302,24 @@ class NodeBase {
                                const Eigen::MatrixXd& property_value,
                                unsigned mat_id, unsigned nprops) noexcept = 0;
 
+  //! Update scalar nodal property at the nodes from particle
+  //! \param[in] update A boolean to update (true) or assign (false)
+  //! \param[in] handle Handle of the property in the nodal property pool
+  //! \param[in] property_value Property quantity from the particles in the cell
+  //! \param[in] mat_id Id of the material within the property data
+  virtual void update_property(bool update, unsigned handle,
+                               double property_value,
+                               unsigned mat_id) noexcept = 0;
+
+  //! Update vector nodal property at the nodes from particle
+  //! \param[in] update A boolean to update (true) or assign (false)
+  //! \param[in] handle Handle of the property in the nodal property pool
+  //! \param[in] property_value Property quantity from the particles in the cell
+  //! \param[in] mat_id Id of the material within the property data
+  virtual void update_property(bool update, unsigned handle,
+                               const VectorDim& property_value,
+                               unsigned mat_id) noexcept = 0;
+
   //! Compute multimaterial change in momentum
   virtual void compute_multimaterial_change_in_momentum() = 0;
 
@@ -253,6 +329,19 @@ class NodeBase {
   //! Compute multimaterial normal unit vector
   virtual void compute_multimaterial_normal_unit_vector() = 0;
 
+  //! Serialize id, coordinates and boundary conditions of the node
+  //! \details Boundary conditions are velocity and friction constraints,
+  //! concentrated forces and the rotation matrix
+  //! \retval buffer Serialized buffer data
+  virtual std::vector<uint8_t> serialize() = 0;
+
+  //! Deserialize
+  //! \param[in] buffer Serialized buffer data
+  //! \param[in] functions Math functions of concentrated forces by their id
+  virtual void deserialize(
+      const std::vector<uint8_t>& buffer,
+      const std::map<unsigned, std::shared_ptr<FunctionBase>>& functions) = 0;
+
 };  // NodeBase class
 }  // namespace mpm
 
@@ -0,0 +1,203 @@
+#ifndef MPM_NODE_STORE_H_
+#define MPM_NODE_STORE_H_
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <vector>
+
+#include "Eigen/Dense"
+
+#include "data_types.h"
+
+namespace mpm {
+
+//! NodeStore class
+//! \brief Structure-of-arrays storage of nodal state
+//! \details Nodal quantities updated every step (mass, momentum, external
+//! and internal force, velocity and acceleration) are stored in contiguous
+//! arrays indexed by a dense store index. Vector quantities of a node are
+//! stored as a column-major Tdim x nphases block. A node keeps a handle (its
+//! store index) to its slot, and the store updates the handle whenever a
+//! slot is moved during removal.
+//! \tparam Tdim Dimension
+template <unsigned Tdim>
+class NodeStore {
+ public:
+  //! Define a vector of size dimension
+  using VectorDim = Eigen::Matrix<double, Tdim, 1>;
+
+  //! Constructor with number of phases
+  //! \param[in] nphases Number of phases of a node
+  explicit NodeStore(unsigned nphases = 1) : nphases_{nphases} {}
+
+  //! Delete copy constructor
+  NodeStore(const NodeStore<Tdim>&) = delete;
+
+  //! Delete assignment operator
+  NodeStore& operator=(const NodeStore<Tdim>&) = delete;
+
+  //! Return the number of node slots in the store
+  Index size() const { return handles_.size(); }
+
+  //! Return the number of phases of a node
+  unsigned nphases() const { return nphases_; }
+
+  //! Reserve memory for a number of nodes
+  //! \param[in] nnodes Number of nodes
+  void reserve(Index nnodes);
+
+  //! Add a node slot with zero values
+  //! \param[in] handle Pointer to the store index of the node
+  //! \retval index Index of the new slot
+  Index add(Index* handle);
+
+  //! Remove a node slot by moving the last slot into its place
+  //! \param[in] index Index of the slot to be removed
+  void remove(Index index);
+
+  //! Move a node slot from another store into this store
+  //! \param[in] handle Pointer to the store index of the node
+  //! \param[in] store Store which currently holds the node
+  //! \retval index Index of the slot in this store
+  Index transfer(Index* handle, NodeStore<Tdim>* store);
+
+  //! Reorder the node slots, the handles of nodes are updated
+  //! \param[in] order Index of the slot to be placed at each position, a
+  //! permutation of all slots
+  void permute(const std::vector<Index>& order);
+
+  //! Set all values of a node slot to zero
+  //! \param[in] index Index of the slot
+  void initialise(Index index);
+
+  //! Set all values of all node slots to zero
+  void initialise();
+
+  //! Mass
+  double& mass(Index index, unsigned phase) {
+    return mass_[index * nphases_ + phase];
+  }
+  double mass(Index index, unsigned phase) const {
+    return mass_[index * nphases_ + phase];
+  }
+
+  //! Momentum
+  Eigen::Map<VectorDim> momentum(Index index, unsigned phase) {
+    return Eigen::Map<VectorDim>(&momentum_[this->offset(index, phase)]);
+  }
+  Eigen::Map<const VectorDim> momentum(Index index, unsigned phase) const {
+    return Eigen::Map<const VectorDim>(&momentum_[this->offset(index, phase)]);
+  }
+
+  //! External force
+  Eigen::Map<VectorDim> external_force(Index index, unsigned phase) {
+    return Eigen::Map<VectorDim>(&external_force_[this->offset(index, phase)]);
+  }
+  Eigen::Map<const VectorDim> external_force(Index index,
+                                             unsigned phase) const {
+    return Eigen::Map<const VectorDim>(
+        &external_force_[this->offset(index, phase)]);
+  }
+
+  //! Internal force
+  Eigen::Map<VectorDim> internal_force(Index index, unsigned phase) {
+    return Eigen::Map<VectorDim>(&internal_force_[this->offset(index, phase)]);
+  }
+  Eigen::Map<const VectorDim> internal_force(Index index,
+                                             unsigned phase) const {
+    return Eigen::Map<const VectorDim>(
+        &internal_force_[this->offset(index, phase)]);
+  }
+
+  //! Velocity
+  Eigen::Map<VectorDim> velocity(Index index, unsigned phase) {
+    return Eigen::Map<VectorDim>(&velocity_[this->offset(index, phase)]);
+  }
+  Eigen::Map<const VectorDim> velocity(Index index, unsigned phase) const {
+    return Eigen::Map<const VectorDim>(&velocity_[this->offset(index, phase)]);
+  }
+
+  //! Acceleration
+  Eigen::Map<VectorDim> acceleration(Index index, unsigned phase) {
+    return Eigen::Map<VectorDim>(&acceleration_[this->offset(index, phase)]);
+  }
+  Eigen::Map<const VectorDim> acceleration(Index index,
+                                           unsigned phase) const {
+    return Eigen::Map<const VectorDim>(
+        &acceleration_[this->offset(index, phase)]);
+  }
+
+  //! Return contiguous array of masses
+  const std::vector<double>& masses() const { return mass_; }
+
+  //! Return contiguous array of velocities
+  const std::vector<double>& velocities() const { return velocity_; }
+
+  //! Compute velocity from momentum of all phases of a list of nodes
+  //! \details Velocity constraints are not applied, the nodes are expected
+  //! to be free of constraints
+  //! \param[in] indices Store indices of the nodes
+  void compute_velocity(const std::vector<Index>& indices);
+
+  //! Compute acceleration and velocity of a list of nodes
+  //! \details Velocity and friction constraints are not applied, the nodes
+  //! are expected to be free of constraints
+  //! \param[in] indices Store indices of the nodes
+  //! \param[in] phase Index corresponding to the phase
+  //! \param[in] dt Timestep in analysis
+  void compute_acceleration_velocity(const std::vector<Index>& indices,
+                                     unsigned phase, double dt);
+
+  //! Compute acceleration and velocity with cundall damping factor of a list
+  //! of nodes
+  //! \details Velocity and friction constraints are not applied, the nodes
+  //! are expected to be free of constraints
+  //! \param[in] indices Store indices of the nodes
+  //! \param[in] phase Index corresponding to the phase
+  //! \param[in] dt Timestep in analysis
+  //! \param[in] damping_factor Damping factor
+  void compute_acceleration_velocity_cundall(
+      const std::vector<Index>& indices, unsigned phase, double dt,
+      double damping_factor);
+
+ private:
+  //! Return offset of a vector quantity of a phase in a node slot
+  //! \param[in] index Index of the slot
+  //! \param[in] phase Index corresponding to the phase
+  Index offset(Index index, unsigned phase) const {
+    return (index * nphases_ + phase) * Tdim;
+  }
+
+  //! Copy the values of a slot in another store to a slot in this store
+  //! \param[in] index Index of the slot in this store
+  //! \param[in] store Source store
+  //! \param[in] src Index of the slot in the source store
+  void copy(Index index, const NodeStore<Tdim>& store, Index src);
+
+  //! Remove the last slot
+  void pop_back();
+
+ private:
+  //! Number of phases of a node
+  unsigned nphases_{1};
+  //! Pointers to the store index held by each node
+  std::vector<Index*> handles_;
+  //! Mass
+  std::vector<double> mass_;
+  //! Momentum
+  std::vector<double> momentum_;
+  //! External force
+  std::vector<double> external_force_;
+  //! Internal force
+  std::vector<double> internal_force_;
+  //! Velocity
+  std::vector<double> velocity_;
+  //! Acceleration
+  std::vector<double> acceleration_;
+};  // NodeStore class
+}  // namespace mpm
+
+#include "node_store.tcc"
+
+#endif  // MPM_NODE_STORE_H_
@@ -0,0 +1,231 @@
+//! Reserve memory for a number of nodes
+template <unsigned Tdim>
+void mpm::NodeStore<Tdim>::reserve(Index nnodes) {
+  handles_.reserve(nnodes);
+  mass_.reserve(nnodes * nphases_);
+  momentum_.reserve(nnodes * nphases_ * Tdim);
+  external_force_.reserve(nnodes * nphases_ * Tdim);
+  internal_force_.reserve(nnodes * nphases_ * Tdim);
+  velocity_.reserve(nnodes * nphases_ * Tdim);
+  acceleration_.reserve(nnodes * nphases_ * Tdim);
+}
+
+//! Add a node slot with zero values
+template <unsigned Tdim>
+mpm::Index mpm::NodeStore<Tdim>::add(Index* handle) {
+  const Index index = handles_.size();
+  handles_.emplace_back(handle);
+  mass_.resize(mass_.size() + nphases_, 0.);
+  momentum_.resize(momentum_.size() + nphases_ * Tdim, 0.);
+  external_force_.resize(external_force_.size() + nphases_ * Tdim, 0.);
+  internal_force_.resize(internal_force_.size() + nphases_ * Tdim, 0.);
+  velocity_.resize(velocity_.size() + nphases_ * Tdim, 0.);
+  acceleration_.resize(acceleration_.size() + nphases_ * Tdim, 0.);
+  if (handle != nullptr) *handle = index;
+  return index;
+}
+
+//! Remove a node slot by moving the last slot into its place
+template <unsigned Tdim>
+void mpm::NodeStore<Tdim>::remove(Index index) {
+  const Index last = handles_.size() - 1;
+  if (index != last) {
+    this->copy(index, *this, last);
+    // Update the handle of the node that was moved
+    handles_[index] = handles_[last];
+    if (handles_[index] != nullptr) *handles_[index] = index;
+  }
+  this->pop_back();
+}
+
+//! Move a node slot from another store into this store
+template <unsigned Tdim>
+mpm::Index mpm::NodeStore<Tdim>::transfer(Index* handle,
+                                          NodeStore<Tdim>* store) {
+  if (store->nphases_ != nphases_)
+    throw std::runtime_error(
+        "Node store transfer failed: number of phases do not match");
+
+  const Index src = *handle;
+  const Index index = this->add(nullptr);
+  this->copy(index, *store, src);
+  store->remove(src);
+  handles_[index] = handle;
+  *handle = index;
+  return index;
+}
+
+//! Reorder the node slots
+template <unsigned Tdim>
+void mpm::NodeStore<Tdim>::permute(const std::vector<Index>& order) {
+  if (order.size() != handles_.size())
+    throw std::runtime_error(
+        "Node store permutation failed: number of slots do not match");
+
+  // Copy slots in the new order into a temporary store
+  NodeStore<Tdim> store(nphases_);
+  store.reserve(order.size());
+  for (Index index = 0; index < order.size(); ++index) {
+    store.add(nullptr);
+    store.copy(index, *this, order[index]);
+    store.handles_[index] = handles_[order[index]];
+  }
+
+  handles_.swap(store.handles_);
+  mass_.swap(store.mass_);
+  momentum_.swap(store.momentum_);
+  external_force_.swap(store.external_force_);
+  internal_force_.swap(store.internal_force_);
+  velocity_.swap(store.velocity_);
+  acceleration_.swap(store.acceleration_);
+
+  // Update the handles of all nodes
+  for (Index index = 0; index < handles_.size(); ++index)
+    if (handles_[index] != nullptr) *handles_[index] = index;
+}
+
+//! Set all values of a node slot to zero
+template <unsigned Tdim>
+void mpm::NodeStore<Tdim>::initialise(Index index) {
+  const auto begin = this->offset(index, 0);
+  const auto end = this->offset(index + 1, 0);
+  std::fill(mass_.begin() + index * nphases_,
+            mass_.begin() + (index + 1) * nphases_, 0.);
+  std::fill(momentum_.begin() + begin, momentum_.begin() + end, 0.);
+  std::fill(external_force_.begin() + begin, external_force_.begin() + end,
+            0.);
+  std::fill(internal_force_.begin() + begin, internal_force_.begin() + end,
+            0.);
+  std::fill(velocity_.begin() + begin, velocity_.begin() + end, 0.);
+  std::fill(acceleration_.begin() + begin, acceleration_.begin() + end, 0.);
+}
+
+//! Set all values of all node slots to zero
+template <unsigned Tdim>
+void mpm::NodeStore<Tdim>::initialise() {
+  std::fill(mass_.begin(), mass_.end(), 0.);
+  std::fill(momentum_.begin(), momentum_.end(), 0.);
+  std::fill(external_force_.begin(), external_force_.end(), 0.);
+  std::fill(internal_force_.begin(), internal_force_.end(), 0.);
+  std::fill(velocity_.begin(), velocity_.end(), 0.);
+  std::fill(acceleration_.begin(), acceleration_.end(), 0.);
+}
+
+//! Copy the values of a slot in another store to a slot in this store
+template <unsigned Tdim>
+void mpm::NodeStore<Tdim>::copy(Index index, const NodeStore<Tdim>& store,
+                                Index src) {
+  const auto begin = store.offset(src, 0);
+  const auto end = store.offset(src + 1, 0);
+  const auto dst = this->offset(index, 0);
+  std::copy(store.mass_.begin() + src * nphases_,
+            store.mass_.begin() + (src + 1) * nphases_,
+            mass_.begin() + index * nphases_);
+  std::copy(store.momentum_.begin() + begin, store.momentum_.begin() + end,
+            momentum_.begin() + dst);
+  std::copy(store.external_force_.begin() + begin,
+            store.external_force_.begin() + end,
+            external_force_.begin() + dst);
+  std::copy(store.internal_force_.begin() + begin,
+            store.internal_force_.begin() + end,
+            internal_force_.begin() + dst);
+  std::copy(store.velocity_.begin() + begin, store.velocity_.begin() + end,
+            velocity_.begin() + dst);
+  std::copy(store.acceleration_.begin() + begin,
+            store.acceleration_.begin() + end, acceleration_.begin() + dst);
+}
+
+//! Remove the last slot
+template <unsigned Tdim>
+void mpm::NodeStore<Tdim>::pop_back() {
+  handles_.pop_back();
+  mass_.resize(mass_.size() - nphases_);
+  momentum_.resize(momentum_.size() - nphases_ * Tdim);
+  external_force_.resize(external_force_.size() - nphases_ * Tdim);
+  internal_force_.resize(internal_force_.size() - nphases_ * Tdim);
+  velocity_.resize(velocity_.size() - nphases_ * Tdim);
+  acceleration_.resize(acceleration_.size() - nphases_ * Tdim);
+}
+
+//! Compute velocity from momentum of all phases of a list of nodes
+//! velocity = momentum / mass
+template <unsigned Tdim>
+void mpm::NodeStore<Tdim>::compute_velocity(
+    const std::vector<Index>& indices) {
+  const double tolerance = 1.E-16;
+#pragma omp parallel for schedule(runtime)
+  for (auto itr = indices.cbegin(); itr != indices.cend(); ++itr) {
+    for (unsigned phase = 0; phase < nphases_; ++phase) {
+      const double mass = this->mass(*itr, phase);
+      if (mass > tolerance) {
+        auto velocity = this->velocity(*itr, phase);
+        velocity = this->momentum(*itr, phase) / mass;
+
+        // Check to see if value is below threshold
+        for (unsigned i = 0; i < Tdim; ++i)
+          if (std::abs(velocity(i)) < 1.E-15) velocity(i) = 0.;
+      }
+    }
+  }
+}
+
+//! Compute acceleration and velocity of a list of nodes
+template <unsigned Tdim>
+void mpm::NodeStore<Tdim>::compute_acceleration_velocity(
+    const std::vector<Index>& indices, unsigned phase, double dt) {
+  const double tolerance = 1.0E-15;
+#pragma omp parallel for schedule(runtime)
+  for (auto itr = indices.cbegin(); itr != indices.cend(); ++itr) {
+    const double mass = this->mass(*itr, phase);
+    if (mass > tolerance) {
+      auto velocity = this->velocity(*itr, phase);
+      auto acceleration = this->acceleration(*itr, phase);
+      // acceleration = (unbalaced force / mass)
+      acceleration = (this->external_force(*itr, phase) +
+                      this->internal_force(*itr, phase)) /
+                     mass;
+
+      // Velocity += acceleration * dt
+      velocity += acceleration * dt;
+
+      // Set a threshold
+      for (unsigned i = 0; i < Tdim; ++i)
+        if (std::abs(velocity(i)) < tolerance) velocity(i) = 0.;
+      for (unsigned i = 0; i < Tdim; ++i)
+        if (std::abs(acceleration(i)) < tolerance) acceleration(i) = 0.;
+    }
+  }
+}
+
+//! Compute acceleration and velocity with cundall damping factor of a list
+//! of nodes
+template <unsigned Tdim>
+void mpm::NodeStore<Tdim>::compute_acceleration_velocity_cundall(
+    const std::vector<Index>& indices, unsigned phase, double dt,
+    double damping_factor) {
+  const double tolerance = 1.0E-15;
+#pragma omp parallel for schedule(runtime)
+  for (auto itr = indices.cbegin(); itr != indices.cend(); ++itr) {
+    const double mass = this->mass(*itr, phase);
+    if (mass > tolerance) {
+      auto velocity = this->velocity(*itr, phase);
+      auto acceleration = this->acceleration(*itr, phase);
+      // acceleration = (unbalaced force / mass)
+      const VectorDim unbalanced_force =
+          this->external_force(*itr, phase) + this->internal_force(*itr, phase);
+      acceleration = (unbalanced_force - damping_factor *
+                                             unbalanced_force.norm() *
+                                             velocity.cwiseSign()) /
+                     mass;
+
+      // Velocity += acceleration * dt
+      velocity += acceleration * dt;
+
+      // Set a threshold
+      for (unsigned i = 0; i < Tdim; ++i)
+        if (std::abs(velocity(i)) < tolerance) velocity(i) = 0.;
+      for (unsigned i = 0; i < Tdim; ++i)
+        if (std::abs(acceleration(i)) < tolerance) acceleration(i) = 0.;
+    }
+  }
+}
@@ -37,6 +37,13 @@ class Particle : public ParticleBase<Tdim> {
   //! \param[in] status Particle status (active / inactive)
   Particle(Index id, const VectorDim& coord, bool status);
 
+  //! Construct a particle with id and coordinates in a particle store
+  //! \param[in] id Particle id
+  //! \param[in] coord coordinates of the particle
+  //! \param[in] store Particle store which holds the particle state
+  Particle(Index id, const VectorDim& coord,
+           const std::shared_ptr<ParticleStore<Tdim>>& store);
+
   //! Destructor
   ~Particle() override{};
 
@@ -73,6 +80,12 @@ class Particle : public ParticleBase<Tdim> {
   //! \retval particle HDF5 data of the particle
   HDF5Particle hdf5() const override;
 
+  //! Write particle data to HDF5 columns
+  //! \param[in] columns HDF5 particle columns
+  //! \param[in] index Index of the particle in the columns
+  void hdf5_columns(mpm::hdf5::particle::Columns& columns,
+                    hsize_t index) const override;
+
   //! Initialise properties
   void initialise() override;
 
@@ -95,15 +108,18 @@ class Particle : public ParticleBase<Tdim> {
   //! valid in the old cell, if it is leave it as is. If not, set cell as null
   //! \param[in] cellptr Pointer to a cell
   //! \param[in] xi Local coordinates of the point in reference cell
+  //! \param[in] update_cell Move the particle id to the particle ids of the
+  //! cell, false if particle ids of cells are assigned in bulk
   bool assign_cell_xi(const std::shared_ptr<Cell<Tdim>>& cellptr,
-                      const Eigen::Matrix<double, Tdim, 1>& xi) override;
+                      const Eigen::Matrix<double, Tdim, 1>& xi,
+                      bool update_cell = true) override;
 
   //! Assign cell id
   //! \param[in] id Cell id
   bool assign_cell_id(Index id) override;
 
   //! Return cell id
-  Index cell_id() const override { return cell_id_; }
+  Index cell_id() const override { return store_->cell_id(store_index_); }
 
   //! Return cell ptr status
   bool cell_ptr() const override { return cell_ != nullptr; }
@@ -119,7 +135,7 @@ class Particle : public ParticleBase<Tdim> {
   bool assign_volume(double volume) override;
 
   //! Return volume
-  double volume() const override { return volume_; }
+  double volume() const override { return store_->volume(store_index_); }
 
   //! Return size of particle in natural coordinates
   VectorDim natural_size() const override { return natural_size_; }
@@ -132,13 +148,17 @@ class Particle : public ParticleBase<Tdim> {
 
   //! Return mass density
   //! \param[in] phase Index corresponding to the phase
-  double mass_density() const override { return mass_density_; }
+  double mass_density() const override {
+    return store_->mass_density(store_index_);
+  }
 
   //! Compute mass as volume * density
   void compute_mass() noexcept override;
 
   //! Map particle mass and momentum to nodes
-  void map_mass_momentum_to_nodes() noexcept override;
+  //! \param[in] lock Lock nodes while updating them, nodes are only updated
+  //! without locks when no other thread updates them, e.g., coloured scatter
+  void map_mass_momentum_to_nodes(bool lock = true) noexcept override;
 
   //! Map multimaterial properties to nodes
   void map_multimaterial_mass_momentum_to_nodes() noexcept override;
@@ -152,10 +172,10 @@ class Particle : public ParticleBase<Tdim> {
   //! Assign nodal mass to particles
   //! \param[in] mass Mass from the particles in a cell
   //! \retval status Assignment status
-  void assign_mass(double mass) override { mass_ = mass; }
+  void assign_mass(double mass) override { store_->mass(store_index_) = mass; }
 
   //! Return mass of the particles
-  double mass() const override { return mass_; }
+  double mass() const override { return store_->mass(store_index_); }
 
   //! Assign material
   //! \param[in] material Pointer to a material
@@ -168,41 +188,50 @@ class Particle : public ParticleBase<Tdim> {
   void compute_strain(double dt) noexcept override;
 
   //! Return strain of the particle
-  Eigen::Matrix<double, 6, 1> strain() const override { return strain_; }
+  Eigen::Matrix<double, 6, 1> strain() const override {
+    return store_->strain(store_index_);
+  }
 
   //! Return strain rate of the particle
   Eigen::Matrix<double, 6, 1> strain_rate() const override {
-    return strain_rate_;
+    return store_->strain_rate(store_index_);
   };
 
   //! Return dvolumetric strain of centroid
   //! \retval dvolumetric strain at centroid
-  double dvolumetric_strain() const override { return dvolumetric_strain_; }
+  double dvolumetric_strain() const override {
+    return store_->dvolumetric_strain(store_index_);
+  }
 
   //! Return volumetric strain of centroid
   //! \retval volumetric strain at centroid
   double volumetric_strain_centroid() const override {
-    return volumetric_strain_centroid_;
+    return store_->volumetric_strain_centroid(store_index_);
   }
 
   //! Initial stress
   //! \param[in] stress Initial sress
   void initial_stress(const Eigen::Matrix<double, 6, 1>& stress) override {
-    this->stress_ = stress;
+    store_->stress(store_index_) = stress;
   }
 
   //! Compute stress
   void compute_stress() noexcept override;
 
   //! Return stress of the particle
-  Eigen::Matrix<double, 6, 1> stress() const override { return stress_; }
+  Eigen::Matrix<double, 6, 1> stress() const override {
+    return store_->stress(store_index_);
+  }
 
   //! Map body force
   //! \param[in] pgravity Gravity of a particle
-  void map_body_force(const VectorDim& pgravity) noexcept override;
+  //! \param[in] lock Lock nodes while updating them
+  void map_body_force(const VectorDim& pgravity,
+                      bool lock = true) noexcept override;
 
   //! Map internal force
-  inline void map_internal_force() noexcept override;
+  //! \param[in] lock Lock nodes while updating them
+  inline void map_internal_force(bool lock = true) noexcept override;
 
   //! Assign velocity to the particle
   //! \param[in] velocity A vector of particle velocity
@@ -210,10 +239,14 @@ class Particle : public ParticleBase<Tdim> {
   bool assign_velocity(const VectorDim& velocity) override;
 
   //! Return velocity of the particle
-  VectorDim velocity() const override { return velocity_; }
+  VectorDim velocity() const override {
+    return store_->velocity(store_index_);
+  }
 
   //! Return displacement of the particle
-  VectorDim displacement() const override { return displacement_; }
+  VectorDim displacement() const override {
+    return store_->displacement(store_index_);
+  }
 
   //! Assign traction to the particle
   //! \param[in] direction Index corresponding to the direction of traction
@@ -248,8 +281,10 @@ class Particle : public ParticleBase<Tdim> {
   }
 
   //! Map particle pressure to nodes
-  bool map_pressure_to_nodes(
-      unsigned phase = mpm::ParticlePhase::Solid) noexcept override;
+  //! \param[in] phase Index corresponding to the phase
+  //! \param[in] lock Lock nodes while updating them
+  bool map_pressure_to_nodes(unsigned phase = mpm::ParticlePhase::Solid,
+                             bool lock = true) noexcept override;
 
   //! Compute pressure smoothing of the particle based on nodal pressure
   //! $$\hat{p}_p = \sum_{i = 1}^{n_n} N_i(x_p) p_i$$
@@ -336,14 +371,14 @@ class Particle : public ParticleBase<Tdim> {
  private:
   //! particle id
   using ParticleBase<Tdim>::id_;
-  //! coordinates
-  using ParticleBase<Tdim>::coordinates_;
+  //! Particle store
+  using ParticleBase<Tdim>::store_;
+  //! Index in particle store
+  using ParticleBase<Tdim>::store_index_;
   //! Reference coordinates (in a cell)
   using ParticleBase<Tdim>::xi_;
   //! Cell
   using ParticleBase<Tdim>::cell_;
-  //! Cell id
-  using ParticleBase<Tdim>::cell_id_;
   //! Nodes
   using ParticleBase<Tdim>::nodes_;
   //! Status
@@ -356,44 +391,20 @@ class Particle : public ParticleBase<Tdim> {
   using ParticleBase<Tdim>::state_variables_;
   //! Neighbour particles
   using ParticleBase<Tdim>::neighbours_;
-  //! Volumetric mass density (mass / volume)
-  double mass_density_{0.};
-  //! Mass
-  double mass_{0.};
-  //! Volume
-  double volume_{0.};
   //! Size of particle
   Eigen::Matrix<double, 1, Tdim> size_;
   //! Size of particle in natural coordinates
   Eigen::Matrix<double, 1, Tdim> natural_size_;
-  //! Stresses
-  Eigen::Matrix<double, 6, 1> stress_;
-  //! Strains
-  Eigen::Matrix<double, 6, 1> strain_;
-  //! dvolumetric strain
-  double dvolumetric_strain_{0.};
-  //! Volumetric strain at centroid
-  double volumetric_strain_centroid_{0.};
-  //! Strain rate
-  Eigen::Matrix<double, 6, 1> strain_rate_;
-  //! dstrains
-  Eigen::Matrix<double, 6, 1> dstrain_;
-  //! Velocity
-  Eigen::Matrix<double, Tdim, 1> velocity_;
-  //! Displacement
-  Eigen::Matrix<double, Tdim, 1> displacement_;
   //! Particle velocity constraints
   std::map<unsigned, double> particle_velocity_constraints_;
   //! Set traction
   bool set_traction_{false};
   //! Surface Traction (given as a stress; force/area)
   Eigen::Matrix<double, Tdim, 1> traction_;
-  //! Shape functions
+  //! Shape functions, sized by the element of the cell and reused
   Eigen::VectorXd shapefn_;
-  //! dN/dX
+  //! dN/dX, sized by the element of the cell and reused
   Eigen::MatrixXd dn_dx_;
-  //! dN/dX at cell centroid
-  Eigen::MatrixXd dn_dx_centroid_;
   //! Logger
   std::unique_ptr<spdlog::logger> console_;
   //! Map of scalar properties
@@ -30,6 +30,23 @@ mpm::Particle<Tdim>::Particle(Index id, const VectorDim& coord, bool status)
   console_ = std::make_unique<spdlog::logger>(logger, mpm::stdout_sink);
 }
 
+//! Construct a particle with id and coordinates in a particle store
+template <unsigned Tdim>
+mpm::Particle<Tdim>::Particle(
+    Index id, const VectorDim& coord,
+    const std::shared_ptr<mpm::ParticleStore<Tdim>>& store)
+    : mpm::ParticleBase<Tdim>(id, coord, store) {
+  this->initialise();
+  cell_ = nullptr;
+  nodes_.clear();
+  // Set material containers
+  this->initialise_material(1);
+  //! Logger
+  std::string logger =
+      "particle" + std::to_string(Tdim) + "d::" + std::to_string(id);
+  console_ = std::make_unique<spdlog::logger>(logger, mpm::stdout_sink);
+}
+
 //! Initialise particle data from HDF5
 template <unsigned Tdim>
 bool mpm::Particle<Tdim>::initialise_particle(const HDF5Particle& particle) {
@@ -37,11 +54,11 @@ bool mpm::Particle<Tdim>::initialise_particle(const HDF5Particle& particle) {
   // Assign id
   this->id_ = particle.id;
   // Mass
-  this->mass_ = particle.mass;
+  store_->mass(store_index_) = particle.mass;
   // Volume
-  this->volume_ = particle.volume;
+  store_->volume(store_index_) = particle.volume;
   // Mass Density
-  this->mass_density_ = particle.mass / particle.volume;
+  store_->mass_density(store_index_) = particle.mass / particle.volume;
   // Set local size of particle
   Eigen::Vector3d psize;
   psize << particle.nsize_x, particle.nsize_y, particle.nsize_z;
@@ -52,45 +69,50 @@ bool mpm::Particle<Tdim>::initialise_particle(const HDF5Particle& particle) {
   Eigen::Vector3d coordinates;
   coordinates << particle.coord_x, particle.coord_y, particle.coord_z;
   // Initialise coordinates
-  for (unsigned i = 0; i < Tdim; ++i) this->coordinates_(i) = coordinates(i);
+  for (unsigned i = 0; i < Tdim; ++i)
+    store_->coordinates(store_index_)(i) = coordinates(i);
 
   // Displacement
   Eigen::Vector3d displacement;
   displacement << particle.displacement_x, particle.displacement_y,
       particle.displacement_z;
   // Initialise displacement
-  for (unsigned i = 0; i < Tdim; ++i) this->displacement_(i) = displacement(i);
+  for (unsigned i = 0; i < Tdim; ++i)
+    store_->displacement(store_index_)(i) = displacement(i);
 
   // Velocity
   Eigen::Vector3d velocity;
   velocity << particle.velocity_x, particle.velocity_y, particle.velocity_z;
   // Initialise velocity
-  for (unsigned i = 0; i < Tdim; ++i) this->velocity_(i) = velocity(i);
+  for (unsigned i = 0; i < Tdim; ++i)
+    store_->velocity(store_index_)(i) = velocity(i);
 
   // Stress
-  this->stress_[0] = particle.stress_xx;
-  this->stress_[1] = particle.stress_yy;
-  this->stress_[2] = particle.stress_zz;
-  this->stress_[3] = particle.tau_xy;
-  this->stress_[4] = particle.tau_yz;
-  this->stress_[5] = particle.tau_xz;
+  auto& stress = store_->stress(store_index_);
+  stress[0] = particle.stress_xx;
+  stress[1] = particle.stress_yy;
+  stress[2] = particle.stress_zz;
+  stress[3] = particle.tau_xy;
+  stress[4] = particle.tau_yz;
+  stress[5] = particle.tau_xz;
 
   // Strain
-  this->strain_[0] = particle.strain_xx;
-  this->strain_[1] = particle.strain_yy;
-  this->strain_[2] = particle.strain_zz;
-  this->strain_[3] = particle.gamma_xy;
-  this->strain_[4] = particle.gamma_yz;
-  this->strain_[5] = particle.gamma_xz;
+  auto& strain = store_->strain(store_index_);
+  strain[0] = particle.strain_xx;
+  strain[1] = particle.strain_yy;
+  strain[2] = particle.strain_zz;
+  strain[3] = particle.gamma_xy;
+  strain[4] = particle.gamma_yz;
+  strain[5] = particle.gamma_xz;
 
   // Volumetric strain
-  this->volumetric_strain_centroid_ = particle.epsilon_v;
+  store_->volumetric_strain_centroid(store_index_) = particle.epsilon_v;
 
   // Status
   this->status_ = particle.status;
 
   // Cell id
-  this->cell_id_ = particle.cell_id;
+  store_->cell_id(store_index_) = particle.cell_id;
   this->cell_ = nullptr;
 
   // Clear nodes
@@ -116,13 +138,9 @@ bool mpm::Particle<Tdim>::initialise_particle(
       // Reinitialize state variables
       auto mat_state_vars = (this->material())->initialise_state_variables();
       if (mat_state_vars.size() == particle.nstate_vars) {
-        unsigned i = 0;
-        auto state_variables = (this->material())->state_variables();
-        for (const auto& state_var : state_variables) {
-          this->state_variables_[mpm::ParticlePhase::Solid].at(state_var) =
+        for (unsigned i = 0; i < particle.nstate_vars; ++i)
+          this->state_variables_[mpm::ParticlePhase::Solid][i] =
               particle.svars[i];
-          ++i;
-        }
       }
     } else {
       status = false;
@@ -141,15 +159,18 @@ mpm::HDF5Particle mpm::Particle<Tdim>::hdf5() const {
 
   Eigen::Vector3d coordinates;
   coordinates.setZero();
-  for (unsigned j = 0; j < Tdim; ++j) coordinates[j] = this->coordinates_[j];
+  for (unsigned j = 0; j < Tdim; ++j)
+    coordinates[j] = store_->coordinates(store_index_)[j];
 
   Eigen::Vector3d displacement;
   displacement.setZero();
-  for (unsigned j = 0; j < Tdim; ++j) displacement[j] = this->displacement_[j];
+  for (unsigned j = 0; j < Tdim; ++j)
+    displacement[j] = store_->displacement(store_index_)[j];
 
   Eigen::Vector3d velocity;
   velocity.setZero();
-  for (unsigned j = 0; j < Tdim; ++j) velocity[j] = this->velocity_[j];
+  for (unsigned j = 0; j < Tdim; ++j)
+    velocity[j] = store_->velocity(store_index_)[j];
 
   // Particle local size
   Eigen::Vector3d nsize;
@@ -157,9 +178,9 @@ mpm::HDF5Particle mpm::Particle<Tdim>::hdf5() const {
   Eigen::VectorXd size = this->natural_size();
   for (unsigned j = 0; j < Tdim; ++j) nsize[j] = size[j];
 
-  Eigen::Matrix<double, 6, 1> stress = this->stress_;
+  Eigen::Matrix<double, 6, 1> stress = store_->stress(store_index_);
 
-  Eigen::Matrix<double, 6, 1> strain = this->strain_;
+  Eigen::Matrix<double, 6, 1> strain = store_->strain(store_index_);
 
   particle_data.id = this->id();
   particle_data.mass = this->mass();
@@ -200,7 +221,7 @@ mpm::HDF5Particle mpm::Particle<Tdim>::hdf5() const {
   particle_data.gamma_yz = strain[4];
   particle_data.gamma_xz = strain[5];
 
-  particle_data.epsilon_v = this->volumetric_strain_centroid_;
+  particle_data.epsilon_v = store_->volumetric_strain_centroid(store_index_);
 
   particle_data.status = this->status();
 
@@ -214,34 +235,89 @@ mpm::HDF5Particle mpm::Particle<Tdim>::hdf5() const {
         state_variables_[mpm::ParticlePhase::Solid].size();
     if (state_variables_[mpm::ParticlePhase::Solid].size() > 20)
       throw std::runtime_error("# of state variables cannot be more than 20");
-    unsigned i = 0;
-    auto state_variables = (this->material())->state_variables();
-    for (const auto& state_var : state_variables) {
-      particle_data.svars[i] =
-          state_variables_[mpm::ParticlePhase::Solid].at(state_var);
-      ++i;
-    }
+    for (unsigned i = 0; i < particle_data.nstate_vars; ++i)
+      particle_data.svars[i] = state_variables_[mpm::ParticlePhase::Solid][i];
   }
 
   return particle_data;
 }
 
+//! Write particle data to HDF5 columns
+template <unsigned Tdim>
+void mpm::Particle<Tdim>::hdf5_columns(mpm::hdf5::particle::Columns& columns,
+                                       hsize_t index) const {
+  namespace field = mpm::hdf5::particle;
+  const auto& state_vars = state_variables_[mpm::ParticlePhase::Solid];
+
+  columns.assign(field::Id, index, this->id());
+  columns.assign(field::Mass, index, store_->mass(store_index_));
+  columns.assign(field::Volume, index, store_->volume(store_index_));
+  columns.assign(field::Pressure, index,
+                 (state_vars.find("pressure") != state_vars.end())
+                     ? state_vars.at("pressure")
+                     : 0.);
+
+  // Vector quantities, components beyond the dimension are zero
+  for (unsigned j = 0; j < Tdim; ++j) {
+    columns.assign(field::CoordX + j, index,
+                   store_->coordinates(store_index_)[j]);
+    columns.assign(field::DisplacementX + j, index,
+                   store_->displacement(store_index_)[j]);
+    columns.assign(field::NsizeX + j, index, natural_size_[j]);
+    columns.assign(field::VelocityX + j, index,
+                   store_->velocity(store_index_)[j]);
+  }
+  for (unsigned j = Tdim; j < 3; ++j) {
+    columns.assign(field::CoordX + j, index, 0.);
+    columns.assign(field::DisplacementX + j, index, 0.);
+    columns.assign(field::NsizeX + j, index, 0.);
+    columns.assign(field::VelocityX + j, index, 0.);
+  }
+
+  // Stress and strain in Voigt notation
+  const auto& stress = store_->stress(store_index_);
+  const auto& strain = store_->strain(store_index_);
+  for (unsigned j = 0; j < 6; ++j) {
+    columns.assign(field::StressXX + j, index, stress[j]);
+    columns.assign(field::StrainXX + j, index, strain[j]);
+  }
+
+  columns.assign(field::EpsilonV, index,
+                 store_->volumetric_strain_centroid(store_index_));
+  columns.assign(field::Status, index, this->status());
+  columns.assign(field::CellId, index, this->cell_id());
+  columns.assign(field::MaterialId, index, this->material_id());
+
+  // State variables of the material
+  unsigned nstate_vars = 0;
+  if (this->material() != nullptr) {
+    nstate_vars = state_vars.size();
+    if (nstate_vars > columns.nstate_vars())
+      throw std::runtime_error("HDF5 columns have fewer state variables");
+    for (unsigned i = 0; i < nstate_vars; ++i)
+      columns.assign(field::NFIELDS + i, index, state_vars[i]);
+  }
+  for (unsigned i = nstate_vars; i < columns.nstate_vars(); ++i)
+    columns.assign(field::NFIELDS + i, index, 0.);
+  columns.assign(field::NStateVars, index, nstate_vars);
+}
+
 // Initialise particle properties
 template <unsigned Tdim>
 void mpm::Particle<Tdim>::initialise() {
-  displacement_.setZero();
-  dstrain_.setZero();
-  mass_ = 0.;
+  store_->displacement(store_index_).setZero();
+  store_->dstrain(store_index_).setZero();
+  store_->mass(store_index_) = 0.;
   natural_size_.setZero();
   set_traction_ = false;
   size_.setZero();
-  strain_rate_.setZero();
-  strain_.setZero();
-  stress_.setZero();
+  store_->strain_rate(store_index_).setZero();
+  store_->strain(store_index_).setZero();
+  store_->stress(store_index_).setZero();
   traction_.setZero();
-  velocity_.setZero();
-  volume_ = std::numeric_limits<double>::max();
-  volumetric_strain_centroid_ = 0.;
+  store_->velocity(store_index_).setZero();
+  store_->volume(store_index_) = std::numeric_limits<double>::max();
+  store_->volumetric_strain_centroid(store_index_) = 0.;
 
   // Initialize scalar, vector, and tensor data properties
   this->scalar_properties_["mass"] = [&]() { return mass(); };
@@ -292,14 +368,12 @@ bool mpm::Particle<Tdim>::assign_cell(
   try {
     Eigen::Matrix<double, Tdim, 1> xi;
     // Assign cell to the new cell ptr, if point can be found in new cell
-    if (cellptr->is_point_in_cell(this->coordinates_, &xi)) {
+    if (cellptr->is_point_in_cell(store_->coordinates(store_index_), &xi)) {
       // if a cell already exists remove particle from that cell
       if (cell_ != nullptr) cell_->remove_particle_id(this->id_);
 
       cell_ = cellptr;
-      cell_id_ = cellptr->id();
-      // dn_dx centroid
-      dn_dx_centroid_ = cell_->dn_dx_centroid();
+      store_->cell_id(store_index_) = cellptr->id();
       // Copy nodal pointer to cell
       nodes_.clear();
       nodes_ = cell_->nodes();
@@ -322,18 +396,24 @@ bool mpm::Particle<Tdim>::assign_cell(
 template <unsigned Tdim>
 bool mpm::Particle<Tdim>::assign_cell_xi(
     const std::shared_ptr<Cell<Tdim>>& cellptr,
-    const Eigen::Matrix<double, Tdim, 1>& xi) {
+    const Eigen::Matrix<double, Tdim, 1>& xi, bool update_cell) {
   bool status = true;
   try {
     // Assign cell to the new cell ptr, if point can be found in new cell
     if (cellptr != nullptr) {
+      // Particle remains in the same cell, only update local coordinates
+      if (cellptr == cell_) {
+        for (unsigned i = 0; i < xi.size(); ++i)
+          if (xi(i) < -1. || xi(i) > 1. || std::isnan(xi(i))) return false;
+        this->xi_ = xi;
+        return true;
+      }
+
       // if a cell already exists remove particle from that cell
-      if (cell_ != nullptr) cell_->remove_particle_id(this->id_);
+      if (cell_ != nullptr && update_cell) cell_->remove_particle_id(this->id_);
 
       cell_ = cellptr;
-      cell_id_ = cellptr->id();
-      // dn_dx centroid
-      dn_dx_centroid_ = cell_->dn_dx_centroid();
+      store_->cell_id(store_index_) = cellptr->id();
       // Copy nodal pointer to cell
       nodes_.clear();
       nodes_ = cell_->nodes();
@@ -350,7 +430,7 @@ bool mpm::Particle<Tdim>::assign_cell_xi(
       else
         return false;
 
-      status = cell_->add_particle_id(this->id());
+      if (update_cell) status = cell_->add_particle_id(this->id());
     } else {
       throw std::runtime_error("Point cannot be found in cell!");
     }
@@ -368,7 +448,7 @@ bool mpm::Particle<Tdim>::assign_cell_id(mpm::Index id) {
   try {
     // if a cell ptr is null
     if (cell_ == nullptr && id != std::numeric_limits<Index>::max()) {
-      cell_id_ = id;
+      store_->cell_id(store_index_) = id;
       status = true;
     } else {
       throw std::runtime_error("Invalid cell id or cell is already assigned!");
@@ -385,7 +465,7 @@ template <unsigned Tdim>
 void mpm::Particle<Tdim>::remove_cell() {
   // if a cell is not nullptr
   if (cell_ != nullptr) cell_->remove_particle_id(this->id_);
-  cell_id_ = std::numeric_limits<Index>::max();
+  store_->cell_id(store_index_) = std::numeric_limits<Index>::max();
   // Clear all the nodes
   nodes_.clear();
 }
@@ -420,7 +500,8 @@ bool mpm::Particle<Tdim>::compute_reference_location() noexcept {
   // Compute local coordinates
   Eigen::Matrix<double, Tdim, 1> xi;
   // Check if the point is in cell
-  if (cell_ != nullptr && cell_->is_point_in_cell(this->coordinates_, &xi)) {
+  if (cell_ != nullptr &&
+      cell_->is_point_in_cell(store_->coordinates(store_index_), &xi)) {
     this->xi_ = xi;
     status = true;
   }
@@ -439,12 +520,11 @@ void mpm::Particle<Tdim>::compute_shapefn() noexcept {
   // Zero matrix
   Eigen::Matrix<double, Tdim, 1> zero = Eigen::Matrix<double, Tdim, 1>::Zero();
 
-  // Compute shape function of the particle
-  shapefn_ = element->shapefn(this->xi_, this->natural_size_, zero);
-
-  // Compute dN/dx
-  dn_dx_ = element->dn_dx(this->xi_, cell_->nodal_coordinates(),
-                          this->natural_size_, zero);
+  // Compute shape function and dN/dx of the particle in place
+  if (!element->shapefn_dn_dx(this->xi_, cell_->nodal_coordinates(),
+                              this->natural_size_, zero, &shapefn_, &dn_dx_))
+    console_->error("{} #{}: {}\n", __FILE__, __LINE__,
+                    "Incorrect dimension of xi and nodal coordinates");
 }
 
 // Assign volume to the particle
@@ -455,10 +535,10 @@ bool mpm::Particle<Tdim>::assign_volume(double volume) {
     if (volume <= 0.)
       throw std::runtime_error("Particle volume cannot be negative");
 
-    this->volume_ = volume;
+    store_->volume(store_index_) = volume;
     // Compute size of particle in each direction
     const double length =
-        std::pow(this->volume_, static_cast<double>(1. / Tdim));
+        std::pow(store_->volume(store_index_), static_cast<double>(1. / Tdim));
     // Set particle size as length on each side
     this->size_.fill(length);
 
@@ -492,88 +572,106 @@ void mpm::Particle<Tdim>::compute_volume() noexcept {
 template <unsigned Tdim>
 void mpm::Particle<Tdim>::update_volume() noexcept {
   // Check if particle has a valid cell ptr and a valid volume
-  assert(cell_ != nullptr && volume_ != std::numeric_limits<double>::max());
+  assert(cell_ != nullptr &&
+         store_->volume(store_index_) != std::numeric_limits<double>::max());
   // Compute at centroid
   // Strain rate for reduced integration
-  this->volume_ *= (1. + dvolumetric_strain_);
-  this->mass_density_ = this->mass_density_ / (1. + dvolumetric_strain_);
+  const double dvolumetric_strain = store_->dvolumetric_strain(store_index_);
+  store_->volume(store_index_) *= (1. + dvolumetric_strain);
+  store_->mass_density(store_index_) /= (1. + dvolumetric_strain);
 }
 
 // Compute mass of particle
 template <unsigned Tdim>
 void mpm::Particle<Tdim>::compute_mass() noexcept {
   // Check if particle volume is set and material ptr is valid
-  assert(volume_ != std::numeric_limits<double>::max() &&
+  assert(store_->volume(store_index_) != std::numeric_limits<double>::max() &&
          this->material() != nullptr);
   // Mass = volume of particle * mass_density
-  this->mass_density_ =
+  store_->mass_density(store_index_) =
       (this->material())->template property<double>(std::string("density"));
-  this->mass_ = volume_ * mass_density_;
+  store_->mass(store_index_) =
+      store_->volume(store_index_) * store_->mass_density(store_index_);
 }
 
 //! Map particle mass and momentum to nodes
 template <unsigned Tdim>
-void mpm::Particle<Tdim>::map_mass_momentum_to_nodes() noexcept {
+void mpm::Particle<Tdim>::map_mass_momentum_to_nodes(bool lock) noexcept {
+  const double mass = store_->mass(store_index_);
+  const auto& velocity = store_->velocity(store_index_);
   // Check if particle mass is set
-  assert(mass_ != std::numeric_limits<double>::max());
+  assert(mass != std::numeric_limits<double>::max());
 
   // Map mass and momentum to nodes
-  for (unsigned i = 0; i < nodes_.size(); ++i) {
-    nodes_[i]->update_mass(true, mpm::ParticlePhase::Solid,
-                           mass_ * shapefn_[i]);
-    nodes_[i]->update_momentum(true, mpm::ParticlePhase::Solid,
-                               mass_ * shapefn_[i] * velocity_);
+  if (lock) {
+    for (unsigned i = 0; i < nodes_.size(); ++i) {
+      nodes_[i]->update_mass(true, mpm::ParticlePhase::Solid,
+                             mass * shapefn_[i]);
+      nodes_[i]->update_momentum(true, mpm::ParticlePhase::Solid,
+                                 mass * shapefn_[i] * velocity);
+    }
+  } else {
+    for (unsigned i = 0; i < nodes_.size(); ++i) {
+      nodes_[i]->update_mass_unlocked(mpm::ParticlePhase::Solid,
+                                      mass * shapefn_[i]);
+      nodes_[i]->update_momentum_unlocked(mpm::ParticlePhase::Solid,
+                                          mass * shapefn_[i] * velocity);
+    }
   }
 }
 
 //! Map multimaterial properties to nodes
 template <unsigned Tdim>
 void mpm::Particle<Tdim>::map_multimaterial_mass_momentum_to_nodes() noexcept {
+  const double mass = store_->mass(store_index_);
   // Check if particle mass is set
-  assert(mass_ != std::numeric_limits<double>::max());
-
-  // Unit 1x1 Eigen matrix to be used with scalar quantities
-  Eigen::Matrix<double, 1, 1> nodal_mass;
+  assert(mass != std::numeric_limits<double>::max());
 
   // Map mass and momentum to nodal property taking into account the material id
+  const auto& velocity = store_->velocity(store_index_);
+  const unsigned mat_id = this->material_id();
   for (unsigned i = 0; i < nodes_.size(); ++i) {
-    nodal_mass(0, 0) = mass_ * shapefn_[i];
-    nodes_[i]->update_property(true, "masses", nodal_mass, this->material_id(),
-                               1);
-    nodes_[i]->update_property(true, "momenta", velocity_ * nodal_mass,
-                               this->material_id(), Tdim);
+    const double nodal_mass = mass * shapefn_[i];
+    nodes_[i]->update_property(true, mpm::NodalProperties::Masses, nodal_mass,
+                               mat_id);
+    nodes_[i]->update_property(true, mpm::NodalProperties::Momenta,
+                               VectorDim(velocity * nodal_mass), mat_id);
   }
 }
 
 //! Map multimaterial displacements to nodes
 template <unsigned Tdim>
 void mpm::Particle<Tdim>::map_multimaterial_displacements_to_nodes() noexcept {
+  const double mass = store_->mass(store_index_);
   // Check if particle mass is set
-  assert(mass_ != std::numeric_limits<double>::max());
+  assert(mass != std::numeric_limits<double>::max());
 
   // Map displacements to nodal property and divide it by the respective
   // nodal-material mass
-  for (unsigned i = 0; i < nodes_.size(); ++i) {
-    const auto& displacement = mass_ * shapefn_[i] * displacement_;
-    nodes_[i]->update_property(true, "displacements", displacement,
-                               this->material_id(), Tdim);
-  }
+  const auto& displacement = store_->displacement(store_index_);
+  const unsigned mat_id = this->material_id();
+  for (unsigned i = 0; i < nodes_.size(); ++i)
+    nodes_[i]->update_property(true, mpm::NodalProperties::Displacements,
+                               VectorDim(mass * shapefn_[i] * displacement),
+                               mat_id);
 }
 
 //! Map multimaterial domain gradients to nodes
 template <unsigned Tdim>
 void mpm::Particle<
     Tdim>::map_multimaterial_domain_gradients_to_nodes() noexcept {
+  const double volume = store_->volume(store_index_);
   // Check if particle volume is set
-  assert(volume_ != std::numeric_limits<double>::max());
+  assert(volume != std::numeric_limits<double>::max());
 
   // Map domain gradients to nodal property. The domain gradients is defined as
   // the gradient of the particle volume
+  const unsigned mat_id = this->material_id();
   for (unsigned i = 0; i < nodes_.size(); ++i) {
-    Eigen::Matrix<double, Tdim, 1> gradient;
-    for (unsigned j = 0; j < Tdim; ++j) gradient[j] = volume_ * dn_dx_(i, j);
-    nodes_[i]->update_property(true, "domain_gradients", gradient,
-                               this->material_id(), Tdim);
+    VectorDim gradient;
+    for (unsigned j = 0; j < Tdim; ++j) gradient[j] = volume * dn_dx_(i, j);
+    nodes_[i]->update_property(true, mpm::NodalProperties::DomainGradients,
+                               gradient, mat_id);
   }
 }
 
@@ -638,21 +736,25 @@ inline Eigen::Matrix<double, 6, 1> mpm::Particle<3>::compute_strain_rate(
 // Compute strain of the particle
 template <unsigned Tdim>
 void mpm::Particle<Tdim>::compute_strain(double dt) noexcept {
+  auto& strain_rate = store_->strain_rate(store_index_);
+  auto& dstrain = store_->dstrain(store_index_);
   // Assign strain rate
-  strain_rate_ = this->compute_strain_rate(dn_dx_, mpm::ParticlePhase::Solid);
+  strain_rate = this->compute_strain_rate(dn_dx_, mpm::ParticlePhase::Solid);
   // Update dstrain
-  dstrain_ = strain_rate_ * dt;
+  dstrain = strain_rate * dt;
   // Update strain
-  strain_ += dstrain_;
+  store_->strain(store_index_) += dstrain;
 
   // Compute at centroid
   // Strain rate for reduced integration
   const Eigen::Matrix<double, 6, 1> strain_rate_centroid =
-      this->compute_strain_rate(dn_dx_centroid_, mpm::ParticlePhase::Solid);
+      this->compute_strain_rate(cell_->dn_dx_centroid(),
+                                mpm::ParticlePhase::Solid);
 
   // Assign volumetric strain at centroid
-  dvolumetric_strain_ = dt * strain_rate_centroid.head(Tdim).sum();
-  volumetric_strain_centroid_ += dvolumetric_strain_;
+  const double dvolumetric_strain = dt * strain_rate_centroid.head(Tdim).sum();
+  store_->dvolumetric_strain(store_index_) = dvolumetric_strain;
+  store_->volumetric_strain_centroid(store_index_) += dvolumetric_strain;
 }
 
 // Compute stress
@@ -661,69 +763,94 @@ void mpm::Particle<Tdim>::compute_stress() noexcept {
   // Check if material ptr is valid
   assert(this->material() != nullptr);
   // Calculate stress
-  this->stress_ =
-      (this->material())
-          ->compute_stress(stress_, dstrain_, this,
-                           &state_variables_[mpm::ParticlePhase::Solid]);
+  auto& stress = store_->stress(store_index_);
+  stress = (this->material())
+               ->compute_stress(stress, store_->dstrain(store_index_), this,
+                                &state_variables_[mpm::ParticlePhase::Solid]);
 }
 
 //! Map body force
 template <unsigned Tdim>
-void mpm::Particle<Tdim>::map_body_force(const VectorDim& pgravity) noexcept {
+void mpm::Particle<Tdim>::map_body_force(const VectorDim& pgravity,
+                                         bool lock) noexcept {
+  const double mass = store_->mass(store_index_);
   // Compute nodal body forces
-  for (unsigned i = 0; i < nodes_.size(); ++i)
-    nodes_[i]->update_external_force(true, mpm::ParticlePhase::Solid,
-                                     (pgravity * mass_ * shapefn_(i)));
+  for (unsigned i = 0; i < nodes_.size(); ++i) {
+    if (lock)
+      nodes_[i]->update_external_force(true, mpm::ParticlePhase::Solid,
+                                       (pgravity * mass * shapefn_(i)));
+    else
+      nodes_[i]->update_external_force_unlocked(
+          mpm::ParticlePhase::Solid, (pgravity * mass * shapefn_(i)));
+  }
 }
 
 //! Map internal force
 template <>
-inline void mpm::Particle<1>::map_internal_force() noexcept {
+inline void mpm::Particle<1>::map_internal_force(bool lock) noexcept {
+  const auto& stress = store_->stress(store_index_);
+  const double volume = store_->volume(store_index_);
   // Compute nodal internal forces
   for (unsigned i = 0; i < nodes_.size(); ++i) {
     // Compute force: -pstress * volume
     Eigen::Matrix<double, 1, 1> force;
-    force[0] = -1. * dn_dx_(i, 0) * volume_ * stress_[0];
+    force[0] = -1. * dn_dx_(i, 0) * volume * stress[0];
 
-    nodes_[i]->update_internal_force(true, mpm::ParticlePhase::Solid, force);
+    if (lock)
+      nodes_[i]->update_internal_force(true, mpm::ParticlePhase::Solid, force);
+    else
+      nodes_[i]->update_internal_force_unlocked(mpm::ParticlePhase::Solid,
+                                                force);
   }
 }
 
 //! Map internal force
 template <>
-inline void mpm::Particle<2>::map_internal_force() noexcept {
+inline void mpm::Particle<2>::map_internal_force(bool lock) noexcept {
+  const auto& stress = store_->stress(store_index_);
+  const double volume = store_->volume(store_index_);
   // Compute nodal internal forces
   for (unsigned i = 0; i < nodes_.size(); ++i) {
     // Compute force: -pstress * volume
     Eigen::Matrix<double, 2, 1> force;
-    force[0] = dn_dx_(i, 0) * stress_[0] + dn_dx_(i, 1) * stress_[3];
-    force[1] = dn_dx_(i, 1) * stress_[1] + dn_dx_(i, 0) * stress_[3];
+    force[0] = dn_dx_(i, 0) * stress[0] + dn_dx_(i, 1) * stress[3];
+    force[1] = dn_dx_(i, 1) * stress[1] + dn_dx_(i, 0) * stress[3];
 
-    force *= -1. * this->volume_;
+    force *= -1. * volume;
 
-    nodes_[i]->update_internal_force(true, mpm::ParticlePhase::Solid, force);
+    if (lock)
+      nodes_[i]->update_internal_force(true, mpm::ParticlePhase::Solid, force);
+    else
+      nodes_[i]->update_internal_force_unlocked(mpm::ParticlePhase::Solid,
+                                                force);
   }
 }
 
 //! Map internal force
 template <>
-inline void mpm::Particle<3>::map_internal_force() noexcept {
+inline void mpm::Particle<3>::map_internal_force(bool lock) noexcept {
+  const auto& stress = store_->stress(store_index_);
+  const double volume = store_->volume(store_index_);
   // Compute nodal internal forces
   for (unsigned i = 0; i < nodes_.size(); ++i) {
     // Compute force: -pstress * volume
     Eigen::Matrix<double, 3, 1> force;
-    force[0] = dn_dx_(i, 0) * stress_[0] + dn_dx_(i, 1) * stress_[3] +
-               dn_dx_(i, 2) * stress_[5];
+    force[0] = dn_dx_(i, 0) * stress[0] + dn_dx_(i, 1) * stress[3] +
+               dn_dx_(i, 2) * stress[5];
 
-    force[1] = dn_dx_(i, 1) * stress_[1] + dn_dx_(i, 0) * stress_[3] +
-               dn_dx_(i, 2) * stress_[4];
+    force[1] = dn_dx_(i, 1) * stress[1] + dn_dx_(i, 0) * stress[3] +
+               dn_dx_(i, 2) * stress[4];
 
-    force[2] = dn_dx_(i, 2) * stress_[2] + dn_dx_(i, 1) * stress_[4] +
-               dn_dx_(i, 0) * stress_[5];
+    force[2] = dn_dx_(i, 2) * stress[2] + dn_dx_(i, 1) * stress[4] +
+               dn_dx_(i, 0) * stress[5];
 
-    force *= -1. * this->volume_;
+    force *= -1. * volume;
 
-    nodes_[i]->update_internal_force(true, mpm::ParticlePhase::Solid, force);
+    if (lock)
+      nodes_[i]->update_internal_force(true, mpm::ParticlePhase::Solid, force);
+    else
+      nodes_[i]->update_internal_force_unlocked(mpm::ParticlePhase::Solid,
+                                                force);
   }
 }
 
@@ -732,7 +859,7 @@ template <unsigned Tdim>
 bool mpm::Particle<Tdim>::assign_velocity(
     const Eigen::Matrix<double, Tdim, 1>& velocity) {
   // Assign velocity
-  velocity_ = velocity;
+  store_->velocity(store_index_) = velocity;
   return true;
 }
 
@@ -742,12 +869,13 @@ bool mpm::Particle<Tdim>::assign_traction(unsigned direction, double traction) {
   bool status = false;
   try {
     if (direction >= Tdim ||
-        this->volume_ == std::numeric_limits<double>::max()) {
+        store_->volume(store_index_) == std::numeric_limits<double>::max()) {
       throw std::runtime_error(
           "Particle traction property: volume / direction is invalid");
     }
     // Assign traction
-    traction_(direction) = traction * this->volume_ / this->size_(direction);
+    traction_(direction) =
+        traction * store_->volume(store_index_) / this->size_(direction);
     status = true;
     this->set_traction_ = true;
   } catch (std::exception& exception) {
@@ -792,33 +920,39 @@ void mpm::Particle<Tdim>::compute_updated_position(
           shapefn_[i] * nodes_[i]->acceleration(mpm::ParticlePhase::Solid);
 
     // Update particle velocity from interpolated nodal acceleration
-    this->velocity_ += nodal_acceleration * dt;
+    store_->velocity(store_index_) += nodal_acceleration * dt;
   }
   // Update particle velocity using interpolated nodal velocity
   else
-    this->velocity_ = nodal_velocity;
+    store_->velocity(store_index_) = nodal_velocity;
 
   // New position  current position + velocity * dt
-  this->coordinates_ += nodal_velocity * dt;
+  store_->coordinates(store_index_) += nodal_velocity * dt;
   // Update displacement (displacement is initialized from zero)
-  this->displacement_ += nodal_velocity * dt;
+  store_->displacement(store_index_) += nodal_velocity * dt;
 }
 
 //! Map particle pressure to nodes
 template <unsigned Tdim>
-bool mpm::Particle<Tdim>::map_pressure_to_nodes(unsigned phase) noexcept {
+bool mpm::Particle<Tdim>::map_pressure_to_nodes(unsigned phase,
+                                                bool lock) noexcept {
   // Mass is initialized
-  assert(mass_ != std::numeric_limits<double>::max());
+  assert(store_->mass(store_index_) != std::numeric_limits<double>::max());
 
   bool status = false;
   // Check if particle mass is set and state variable pressure is found
-  if (mass_ != std::numeric_limits<double>::max() &&
+  if (store_->mass(store_index_) != std::numeric_limits<double>::max() &&
       (state_variables_[phase].find("pressure") !=
        state_variables_[phase].end())) {
     // Map particle pressure to nodes
-    for (unsigned i = 0; i < nodes_.size(); ++i)
-      nodes_[i]->update_mass_pressure(
-          phase, shapefn_[i] * mass_ * state_variables_[phase]["pressure"]);
+    for (unsigned i = 0; i < nodes_.size(); ++i) {
+      const double mass_pressure = shapefn_[i] * store_->mass(store_index_) *
+                                   state_variables_[phase]["pressure"];
+      if (lock)
+        nodes_[i]->update_mass_pressure(phase, mass_pressure);
+      else
+        nodes_[i]->update_mass_pressure_unlocked(phase, mass_pressure);
+    }
 
     status = true;
   }
@@ -852,7 +986,7 @@ template <unsigned Tdim>
 void mpm::Particle<Tdim>::apply_particle_velocity_constraints(unsigned dir,
                                                               double velocity) {
   // Set particle velocity constraint
-  this->velocity_(dir) = velocity;
+  store_->velocity(store_index_)(dir) = velocity;
 }
 
 //! Return particle scalar data
@@ -984,11 +1118,11 @@ std::vector<uint8_t> mpm::Particle<Tdim>::serialize() {
   MPI_Pack(&id_, 1, MPI_UNSIGNED_LONG_LONG, data_ptr, data.size(), &position,
            MPI_COMM_WORLD);
   // Mass
-  MPI_Pack(&mass_, 1, MPI_DOUBLE, data_ptr, data.size(), &position,
-           MPI_COMM_WORLD);
+  MPI_Pack(&store_->mass(store_index_), 1, MPI_DOUBLE, data_ptr, data.size(),
+           &position, MPI_COMM_WORLD);
   // Volume
-  MPI_Pack(&volume_, 1, MPI_DOUBLE, data_ptr, data.size(), &position,
-           MPI_COMM_WORLD);
+  MPI_Pack(&store_->volume(store_index_), 1, MPI_DOUBLE, data_ptr, data.size(),
+           &position, MPI_COMM_WORLD);
   // Pressure
   double pressure =
       (state_variables_[mpm::ParticlePhase::Solid].find("pressure") !=
@@ -999,31 +1133,31 @@ std::vector<uint8_t> mpm::Particle<Tdim>::serialize() {
            MPI_COMM_WORLD);
 
   // Coordinates
-  MPI_Pack(coordinates_.data(), Tdim, MPI_DOUBLE, data_ptr, data.size(),
-           &position, MPI_COMM_WORLD);
+  MPI_Pack(store_->coordinates(store_index_).data(), Tdim, MPI_DOUBLE, data_ptr,
+           data.size(), &position, MPI_COMM_WORLD);
   // Displacement
-  MPI_Pack(displacement_.data(), Tdim, MPI_DOUBLE, data_ptr, data.size(),
-           &position, MPI_COMM_WORLD);
+  MPI_Pack(store_->displacement(store_index_).data(), Tdim, MPI_DOUBLE,
+           data_ptr, data.size(), &position, MPI_COMM_WORLD);
   // Natural size
   MPI_Pack(natural_size_.data(), Tdim, MPI_DOUBLE, data_ptr, data.size(),
            &position, MPI_COMM_WORLD);
   // Velocity
-  MPI_Pack(velocity_.data(), Tdim, MPI_DOUBLE, data_ptr, data.size(), &position,
-           MPI_COMM_WORLD);
+  MPI_Pack(store_->velocity(store_index_).data(), Tdim, MPI_DOUBLE, data_ptr,
+           data.size(), &position, MPI_COMM_WORLD);
   // Stress
-  MPI_Pack(stress_.data(), 6, MPI_DOUBLE, data_ptr, data.size(), &position,
-           MPI_COMM_WORLD);
+  MPI_Pack(store_->stress(store_index_).data(), 6, MPI_DOUBLE, data_ptr,
+           data.size(), &position, MPI_COMM_WORLD);
   // Strain
-  MPI_Pack(strain_.data(), 6, MPI_DOUBLE, data_ptr, data.size(), &position,
-           MPI_COMM_WORLD);
+  MPI_Pack(store_->strain(store_index_).data(), 6, MPI_DOUBLE, data_ptr,
+           data.size(), &position, MPI_COMM_WORLD);
 
   // epsv
-  MPI_Pack(&volumetric_strain_centroid_, 1, MPI_DOUBLE, data_ptr, data.size(),
-           &position, MPI_COMM_WORLD);
+  MPI_Pack(&store_->volumetric_strain_centroid(store_index_), 1, MPI_DOUBLE,
+           data_ptr, data.size(), &position, MPI_COMM_WORLD);
 
   // Cell id
-  MPI_Pack(&cell_id_, 1, MPI_UNSIGNED_LONG_LONG, data_ptr, data.size(),
-           &position, MPI_COMM_WORLD);
+  MPI_Pack(&store_->cell_id(store_index_), 1, MPI_UNSIGNED_LONG_LONG, data_ptr,
+           data.size(), &position, MPI_COMM_WORLD);
 
   // Status
   MPI_Pack(&status_, 1, MPI_C_BOOL, data_ptr, data.size(), &position,
@@ -1035,17 +1169,10 @@ std::vector<uint8_t> mpm::Particle<Tdim>::serialize() {
            MPI_COMM_WORLD);
 
   // state variables
-  if (this->material() != nullptr) {
-    std::vector<double> svars;
-    auto state_variables = (this->material())->state_variables();
-    for (const auto& state_var : state_variables)
-      svars.emplace_back(
-          state_variables_[mpm::ParticlePhase::Solid].at(state_var));
-
-    // Write state vars
-    MPI_Pack(&svars[0], nstate_vars, MPI_DOUBLE, data_ptr, data.size(),
-             &position, MPI_COMM_WORLD);
-  }
+  // State variables are contiguous in the order of the material layout
+  if (this->material() != nullptr)
+    MPI_Pack(state_variables_[mpm::ParticlePhase::Solid].data(), nstate_vars,
+             MPI_DOUBLE, data_ptr, data.size(), &position, MPI_COMM_WORLD);
 #endif
   return data;
 }
@@ -1077,13 +1204,14 @@ void mpm::Particle<Tdim>::deserialize(
   MPI_Unpack(data_ptr, data.size(), &position, &id_, 1, MPI_UNSIGNED_LONG_LONG,
              MPI_COMM_WORLD);
   // mass
-  MPI_Unpack(data_ptr, data.size(), &position, &mass_, 1, MPI_DOUBLE,
-             MPI_COMM_WORLD);
+  MPI_Unpack(data_ptr, data.size(), &position, &store_->mass(store_index_), 1,
+             MPI_DOUBLE, MPI_COMM_WORLD);
   // volume
-  MPI_Unpack(data_ptr, data.size(), &position, &volume_, 1, MPI_DOUBLE,
-             MPI_COMM_WORLD);
+  MPI_Unpack(data_ptr, data.size(), &position, &store_->volume(store_index_), 1,
+             MPI_DOUBLE, MPI_COMM_WORLD);
   // mass density
-  this->mass_density_ = mass_ / volume_;
+  store_->mass_density(store_index_) =
+      store_->mass(store_index_) / store_->volume(store_index_);
 
   // pressure
   double pressure;
@@ -1091,30 +1219,36 @@ void mpm::Particle<Tdim>::deserialize(
              MPI_COMM_WORLD);
 
   // Coordinates
-  MPI_Unpack(data_ptr, data.size(), &position, coordinates_.data(), Tdim,
-             MPI_DOUBLE, MPI_COMM_WORLD);
+  MPI_Unpack(data_ptr, data.size(), &position,
+             store_->coordinates(store_index_).data(), Tdim, MPI_DOUBLE,
+             MPI_COMM_WORLD);
   // Displacement
-  MPI_Unpack(data_ptr, data.size(), &position, displacement_.data(), Tdim,
-             MPI_DOUBLE, MPI_COMM_WORLD);
+  MPI_Unpack(data_ptr, data.size(), &position,
+             store_->displacement(store_index_).data(), Tdim, MPI_DOUBLE,
+             MPI_COMM_WORLD);
   // Natural size
   MPI_Unpack(data_ptr, data.size(), &position, natural_size_.data(), Tdim,
              MPI_DOUBLE, MPI_COMM_WORLD);
   // Velocity
-  MPI_Unpack(data_ptr, data.size(), &position, velocity_.data(), Tdim,
-             MPI_DOUBLE, MPI_COMM_WORLD);
+  MPI_Unpack(data_ptr, data.size(), &position,
+             store_->velocity(store_index_).data(), Tdim, MPI_DOUBLE,
+             MPI_COMM_WORLD);
   // Stress
-  MPI_Unpack(data_ptr, data.size(), &position, stress_.data(), 6, MPI_DOUBLE,
+  MPI_Unpack(data_ptr, data.size(), &position,
+             store_->stress(store_index_).data(), 6, MPI_DOUBLE,
              MPI_COMM_WORLD);
   // Strain
-  MPI_Unpack(data_ptr, data.size(), &position, strain_.data(), 6, MPI_DOUBLE,
+  MPI_Unpack(data_ptr, data.size(), &position,
+             store_->strain(store_index_).data(), 6, MPI_DOUBLE,
              MPI_COMM_WORLD);
 
   // epsv
-  MPI_Unpack(data_ptr, data.size(), &position, &volumetric_strain_centroid_, 1,
-             MPI_DOUBLE, MPI_COMM_WORLD);
+  MPI_Unpack(data_ptr, data.size(), &position,
+             &store_->volumetric_strain_centroid(store_index_), 1, MPI_DOUBLE,
+             MPI_COMM_WORLD);
   // cell id
-  MPI_Unpack(data_ptr, data.size(), &position, &cell_id_, 1,
-             MPI_UNSIGNED_LONG_LONG, MPI_COMM_WORLD);
+  MPI_Unpack(data_ptr, data.size(), &position, &store_->cell_id(store_index_),
+             1, MPI_UNSIGNED_LONG_LONG, MPI_COMM_WORLD);
   // status
   MPI_Unpack(data_ptr, data.size(), &position, &status_, 1, MPI_C_BOOL,
              MPI_COMM_WORLD);
@@ -1134,23 +1268,15 @@ void mpm::Particle<Tdim>::deserialize(
              MPI_COMM_WORLD);
 
   if (nstate_vars > 0) {
-    std::vector<double> svars;
-    svars.reserve(nstate_vars);
-    MPI_Unpack(data_ptr, data.size(), &position, &svars[0], nstate_vars,
-               MPI_DOUBLE, MPI_COMM_WORLD);
-
     // Reinitialize state variables
     auto mat_state_vars = (this->material())->initialise_state_variables();
     if (mat_state_vars.size() != nstate_vars)
       throw std::runtime_error(
           "Deserialize particle(): state_vars size mismatch");
-    unsigned i = 0;
-    auto state_variables = (this->material())->state_variables();
-    for (const auto& state_var : state_variables) {
-      this->state_variables_[mpm::ParticlePhase::Solid].at(state_var) =
-          svars[i];
-      ++i;
-    }
+    // State variables are contiguous in the order of the material layout
+    MPI_Unpack(data_ptr, data.size(), &position, mat_state_vars.data(),
+               nstate_vars, MPI_DOUBLE, MPI_COMM_WORLD);
+    this->state_variables_[mpm::ParticlePhase::Solid] = mat_state_vars;
   }
 
 #endif
@@ -16,6 +16,7 @@
 #include "function_base.h"
 #include "hdf5_particle.h"
 #include "material.h"
+#include "particle_store.h"
 
 namespace mpm {
 
@@ -51,8 +52,18 @@ class ParticleBase {
   //! \param[in] status Particle status (active / inactive)
   ParticleBase(Index id, const VectorDim& coord, bool status);
 
+  //! Constructor with id and coordinates in a particle store
+  //! \details The particle state is created directly in the given store,
+  //! e.g., the store of a mesh, a particle without a store holds its state
+  //! in a store of its own
+  //! \param[in] id Particle id
+  //! \param[in] coord coordinates of the particle
+  //! \param[in] store Particle store
+  ParticleBase(Index id, const VectorDim& coord,
+               const std::shared_ptr<ParticleStore<Tdim>>& store);
+
   //! Destructor
-  virtual ~ParticleBase(){};
+  virtual ~ParticleBase();
 
   //! Delete copy constructor
   ParticleBase(const ParticleBase<Tdim>&) = delete;
@@ -87,16 +98,41 @@ class ParticleBase {
   //! \retval particle HDF5 data of the particle
   virtual HDF5Particle hdf5() const = 0;
 
+  //! Write particle data to HDF5 columns
+  //! \details State variables of the material are written, the columns
+  //! need a state variable column for each of them
+  //! \param[in] columns HDF5 particle columns
+  //! \param[in] index Index of the particle in the columns
+  virtual void hdf5_columns(mpm::hdf5::particle::Columns& columns,
+                            hsize_t index) const = 0;
+
   //! Return id of the particleBase
   Index id() const { return id_; }
 
   //! Assign coordinates
   //! \param[in] coord Assign coord as coordinates of the particleBase
-  void assign_coordinates(const VectorDim& coord) { coordinates_ = coord; }
+  void assign_coordinates(const VectorDim& coord) {
+    store_->coordinates(store_index_) = coord;
+  }
 
   //! Return coordinates
-  //! \retval coordinates_ return coordinates of the particleBase
-  VectorDim coordinates() const { return coordinates_; }
+  //! \retval coordinates return coordinates of the particleBase
+  VectorDim coordinates() const { return store_->coordinates(store_index_); }
+
+  //! Assign particle store
+  //! \details Moves the particle state from its current store into the given
+  //! store, e.g., the store of the mesh to which the particle is added
+  //! \param[in] store Particle store
+  void assign_particle_store(
+      const std::shared_ptr<ParticleStore<Tdim>>& store);
+
+  //! Return particle store
+  std::shared_ptr<ParticleStore<Tdim>> particle_store() const {
+    return store_;
+  }
+
+  //! Return index of the particle in the particle store
+  Index store_index() const { return store_index_; }
 
   //! Compute reference coordinates in a cell
   virtual bool compute_reference_location() = 0;
@@ -108,8 +144,11 @@ class ParticleBase {
   virtual bool assign_cell(const std::shared_ptr<Cell<Tdim>>& cellptr) = 0;
 
   //! Assign cell and xi
+  //! \param[in] update_cell Move the particle id to the particle ids of the
+  //! cell, false if particle ids of cells are assigned in bulk
   virtual bool assign_cell_xi(const std::shared_ptr<Cell<Tdim>>& cellptr,
-                              const Eigen::Matrix<double, Tdim, 1>& xi) = 0;
+                              const Eigen::Matrix<double, Tdim, 1>& xi,
+                              bool update_cell = true) = 0;
 
   //! Assign cell id
   virtual bool assign_cell_id(Index id) = 0;
@@ -148,7 +187,9 @@ class ParticleBase {
   virtual void compute_mass() noexcept = 0;
 
   //! Map particle mass and momentum to nodes
-  virtual void map_mass_momentum_to_nodes() noexcept = 0;
+  //! \param[in] lock Lock nodes while updating them, nodes are only updated
+  //! without locks when no other thread updates them, e.g., coloured scatter
+  virtual void map_mass_momentum_to_nodes(bool lock = true) noexcept = 0;
 
   //! Map multimaterial properties to nodes
   virtual void map_multimaterial_mass_momentum_to_nodes() noexcept = 0;
@@ -183,6 +224,19 @@ class ParticleBase {
     return state_variables_[phase];
   }
 
+  //! Return number of state variables
+  //! \param[in] phase Index to indicate material phase
+  unsigned nstate_vars(unsigned phase = mpm::ParticlePhase::Solid) const {
+    return state_variables_[phase].size();
+  }
+
+  //! Return pointer to state variables to be updated in place
+  //! \param[in] phase Index to indicate material phase
+  mpm::dense_map* state_variables_ptr(
+      unsigned phase = mpm::ParticlePhase::Solid) {
+    return &state_variables_[phase];
+  }
+
   //! Assign status
   void assign_status(bool status) { status_ = status; }
 
@@ -226,14 +280,21 @@ class ParticleBase {
   virtual Eigen::Matrix<double, 6, 1> stress() const = 0;
 
   //! Map body force
-  virtual void map_body_force(const VectorDim& pgravity) noexcept = 0;
+  //! \param[in] pgravity Gravity of a particle
+  //! \param[in] lock Lock nodes while updating them
+  virtual void map_body_force(const VectorDim& pgravity,
+                              bool lock = true) noexcept = 0;
 
   //! Map internal force
-  virtual void map_internal_force() noexcept = 0;
+  //! \param[in] lock Lock nodes while updating them
+  virtual void map_internal_force(bool lock = true) noexcept = 0;
 
   //! Map particle pressure to nodes
+  //! \param[in] phase Index corresponding to the phase
+  //! \param[in] lock Lock nodes while updating them
   virtual bool map_pressure_to_nodes(
-      unsigned phase = mpm::ParticlePhase::Solid) noexcept = 0;
+      unsigned phase = mpm::ParticlePhase::Solid,
+      bool lock = true) noexcept = 0;
 
   //! Compute pressure smoothing of the particle based on nodal pressure
   virtual bool compute_pressure_smoothing(
@@ -318,10 +379,10 @@ class ParticleBase {
  protected:
   //! particleBase id
   Index id_{std::numeric_limits<Index>::max()};
-  //! coordinates
-  VectorDim coordinates_;
-  //! Cell id
-  Index cell_id_{std::numeric_limits<Index>::max()};
+  //! Particle store which holds the state of the particle
+  std::shared_ptr<ParticleStore<Tdim>> store_;
+  //! Index of the particle in the particle store
+  Index store_index_{std::numeric_limits<Index>::max()};
   //! Status
   bool status_{true};
   //! Reference coordinates (in a cell)
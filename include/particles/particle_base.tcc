@@ -1,12 +1,7 @@
 //! Constructor with id and coordinates
 template <unsigned Tdim>
 mpm::ParticleBase<Tdim>::ParticleBase(Index id, const VectorDim& coord)
-    : id_{id} {
-  // Check if the dimension is between 1 & 3
-  static_assert((Tdim >= 1 && Tdim <= 3), "Invalid global dimension");
-  coordinates_ = coord;
-  status_ = true;
-}
+    : mpm::ParticleBase<Tdim>::ParticleBase(id, coord, nullptr) {}
 
 //! Constructor with id, coordinates and status
 template <unsigned Tdim>
@@ -15,3 +10,35 @@ mpm::ParticleBase<Tdim>::ParticleBase(Index id, const VectorDim& coord,
     : mpm::ParticleBase<Tdim>::ParticleBase(id, coord) {
   status_ = status;
 }
+
+//! Constructor with id and coordinates in a particle store
+template <unsigned Tdim>
+mpm::ParticleBase<Tdim>::ParticleBase(
+    Index id, const VectorDim& coord,
+    const std::shared_ptr<mpm::ParticleStore<Tdim>>& store)
+    : id_{id}, store_{store} {
+  // Check if the dimension is between 1 & 3
+  static_assert((Tdim >= 1 && Tdim <= 3), "Invalid global dimension");
+  // Particle state is held in its own store until it is added to a mesh
+  if (store_ == nullptr) store_ = std::make_shared<mpm::ParticleStore<Tdim>>();
+  store_->add(&store_index_);
+  store_->coordinates(store_index_) = coord;
+  status_ = true;
+}
+
+//! Destructor
+template <unsigned Tdim>
+mpm::ParticleBase<Tdim>::~ParticleBase() {
+  // Release the slot in the particle store
+  if (store_ != nullptr) store_->remove(store_index_);
+}
+
+//! Assign particle store
+template <unsigned Tdim>
+void mpm::ParticleBase<Tdim>::assign_particle_store(
+    const std::shared_ptr<mpm::ParticleStore<Tdim>>& store) {
+  if (store != nullptr && store != store_) {
+    store->transfer(&store_index_, store_.get());
+    store_ = store;
+  }
+}
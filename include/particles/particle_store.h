@@ -0,0 +1,220 @@
+#ifndef MPM_PARTICLE_STORE_H_
+#define MPM_PARTICLE_STORE_H_
+
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+#include "Eigen/Dense"
+
+#include "data_types.h"
+
+namespace mpm {
+
+//! ParticleStore class
+//! \brief Structure-of-arrays storage of particle state
+//! \details Hot particle quantities (coordinates, mass, volume, velocity,
+//! stress, strain, ...) are stored in contiguous arrays indexed by a dense
+//! store index. A particle keeps a handle (its store index) to its slot, and
+//! the store updates the handle whenever a slot is moved during removal.
+//! \tparam Tdim Dimension
+template <unsigned Tdim>
+class ParticleStore {
+ public:
+  //! Define a vector of size dimension
+  using VectorDim = Eigen::Matrix<double, Tdim, 1>;
+  //! Define a vector of size 6 (Voigt notation)
+  using Vector6d = Eigen::Matrix<double, 6, 1>;
+
+  //! Default constructor
+  ParticleStore() = default;
+
+  //! Delete copy constructor
+  ParticleStore(const ParticleStore<Tdim>&) = delete;
+
+  //! Delete assignment operator
+  ParticleStore& operator=(const ParticleStore<Tdim>&) = delete;
+
+  //! Return the number of particle slots in the store
+  Index size() const { return handles_.size(); }
+
+  //! Reserve memory for a number of particles
+  //! \param[in] nparticles Number of particles
+  void reserve(Index nparticles);
+
+  //! Add a particle slot with default values
+  //! \param[in] handle Pointer to the store index of the particle
+  //! \retval index Index of the new slot
+  Index add(Index* handle);
+
+  //! Remove a particle slot by moving the last slot into its place
+  //! \param[in] index Index of the slot to be removed
+  void remove(Index index);
+
+  //! Move a particle slot from another store into this store
+  //! \param[in] handle Pointer to the store index of the particle
+  //! \param[in] store Store which currently holds the particle
+  //! \retval index Index of the slot in this store
+  Index transfer(Index* handle, ParticleStore<Tdim>* store);
+
+  //! Reorder the particle slots, the handles of particles are updated
+  //! \param[in] order Index of the slot to be placed at each position, a
+  //! permutation of all slots
+  void permute(const std::vector<Index>& order);
+
+  //! Coordinates
+  VectorDim& coordinates(Index index) { return coordinates_[index]; }
+  const VectorDim& coordinates(Index index) const {
+    return coordinates_[index];
+  }
+
+  //! Cell id
+  Index& cell_id(Index index) { return cell_id_[index]; }
+  Index cell_id(Index index) const { return cell_id_[index]; }
+
+  //! Mass
+  double& mass(Index index) { return mass_[index]; }
+  double mass(Index index) const { return mass_[index]; }
+
+  //! Volume
+  double& volume(Index index) { return volume_[index]; }
+  double volume(Index index) const { return volume_[index]; }
+
+  //! Mass density
+  double& mass_density(Index index) { return mass_density_[index]; }
+  double mass_density(Index index) const { return mass_density_[index]; }
+
+  //! Velocity
+  VectorDim& velocity(Index index) { return velocity_[index]; }
+  const VectorDim& velocity(Index index) const { return velocity_[index]; }
+
+  //! Displacement
+  VectorDim& displacement(Index index) { return displacement_[index]; }
+  const VectorDim& displacement(Index index) const {
+    return displacement_[index];
+  }
+
+  //! Stress
+  Vector6d& stress(Index index) { return stress_[index]; }
+  const Vector6d& stress(Index index) const { return stress_[index]; }
+
+  //! Strain
+  Vector6d& strain(Index index) { return strain_[index]; }
+  const Vector6d& strain(Index index) const { return strain_[index]; }
+
+  //! Strain rate
+  Vector6d& strain_rate(Index index) { return strain_rate_[index]; }
+  const Vector6d& strain_rate(Index index) const {
+    return strain_rate_[index];
+  }
+
+  //! Incremental strain
+  Vector6d& dstrain(Index index) { return dstrain_[index]; }
+  const Vector6d& dstrain(Index index) const { return dstrain_[index]; }
+
+  //! Incremental volumetric strain at centroid
+  double& dvolumetric_strain(Index index) {
+    return dvolumetric_strain_[index];
+  }
+  double dvolumetric_strain(Index index) const {
+    return dvolumetric_strain_[index];
+  }
+
+  //! Volumetric strain at centroid
+  double& volumetric_strain_centroid(Index index) {
+    return volumetric_strain_centroid_[index];
+  }
+  double volumetric_strain_centroid(Index index) const {
+    return volumetric_strain_centroid_[index];
+  }
+
+  //! Return contiguous array of masses
+  const std::vector<double>& masses() const { return mass_; }
+
+  //! Return contiguous array of volumes
+  const std::vector<double>& volumes() const { return volume_; }
+
+  //! Return contiguous array of cell ids
+  const std::vector<Index>& cell_ids() const { return cell_id_; }
+
+  //! Return contiguous array of coordinates
+  const std::vector<VectorDim, Eigen::aligned_allocator<VectorDim>>&
+      coordinates() const {
+    return coordinates_;
+  }
+
+  //! Return contiguous array of velocities
+  const std::vector<VectorDim, Eigen::aligned_allocator<VectorDim>>&
+      velocities() const {
+    return velocity_;
+  }
+
+  //! Return contiguous array of displacements
+  const std::vector<VectorDim, Eigen::aligned_allocator<VectorDim>>&
+      displacements() const {
+    return displacement_;
+  }
+
+  //! Return contiguous array of stresses
+  const std::vector<Vector6d, Eigen::aligned_allocator<Vector6d>>& stresses()
+      const {
+    return stress_;
+  }
+
+  //! Return contiguous array of strains
+  const std::vector<Vector6d, Eigen::aligned_allocator<Vector6d>>& strains()
+      const {
+    return strain_;
+  }
+
+ private:
+  //! Copy the values of a slot in another store to a slot in this store
+  //! \param[in] index Index of the slot in this store
+  //! \param[in] store Source store
+  //! \param[in] src Index of the slot in the source store
+  void copy(Index index, const ParticleStore<Tdim>& store, Index src);
+
+  //! Move the values of a slot to another slot in this store
+  //! \param[in] index Destination index
+  //! \param[in] src Source index
+  void move(Index index, Index src);
+
+  //! Remove the last slot
+  void pop_back();
+
+ private:
+  //! Pointers to the store index held by each particle
+  std::vector<Index*> handles_;
+  //! Coordinates
+  std::vector<VectorDim, Eigen::aligned_allocator<VectorDim>> coordinates_;
+  //! Cell ids
+  std::vector<Index> cell_id_;
+  //! Mass
+  std::vector<double> mass_;
+  //! Volume
+  std::vector<double> volume_;
+  //! Mass density
+  std::vector<double> mass_density_;
+  //! Velocity
+  std::vector<VectorDim, Eigen::aligned_allocator<VectorDim>> velocity_;
+  //! Displacement
+  std::vector<VectorDim, Eigen::aligned_allocator<VectorDim>> displacement_;
+  //! Stresses
+  std::vector<Vector6d, Eigen::aligned_allocator<Vector6d>> stress_;
+  //! Strains
+  std::vector<Vector6d, Eigen::aligned_allocator<Vector6d>> strain_;
+  //! Strain rate
+  std::vector<Vector6d, Eigen::aligned_allocator<Vector6d>> strain_rate_;
+  //! dstrains
+  std::vector<Vector6d, Eigen::aligned_allocator<Vector6d>> dstrain_;
+  //! dvolumetric strain
+  std::vector<double> dvolumetric_strain_;
+  //! Volumetric strain at centroid
+  std::vector<double> volumetric_strain_centroid_;
+};  // ParticleStore class
+}  // namespace mpm
+
+#include "particle_store.tcc"
+
+#endif  // MPM_PARTICLE_STORE_H_
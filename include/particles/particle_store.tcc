@@ -0,0 +1,147 @@
+//! Reserve memory for a number of particles
+template <unsigned Tdim>
+void mpm::ParticleStore<Tdim>::reserve(Index nparticles) {
+  handles_.reserve(nparticles);
+  coordinates_.reserve(nparticles);
+  cell_id_.reserve(nparticles);
+  mass_.reserve(nparticles);
+  volume_.reserve(nparticles);
+  mass_density_.reserve(nparticles);
+  velocity_.reserve(nparticles);
+  displacement_.reserve(nparticles);
+  stress_.reserve(nparticles);
+  strain_.reserve(nparticles);
+  strain_rate_.reserve(nparticles);
+  dstrain_.reserve(nparticles);
+  dvolumetric_strain_.reserve(nparticles);
+  volumetric_strain_centroid_.reserve(nparticles);
+}
+
+//! Add a particle slot with default values
+template <unsigned Tdim>
+mpm::Index mpm::ParticleStore<Tdim>::add(Index* handle) {
+  const Index index = handles_.size();
+  handles_.emplace_back(handle);
+  coordinates_.emplace_back(VectorDim::Zero());
+  cell_id_.emplace_back(std::numeric_limits<Index>::max());
+  mass_.emplace_back(0.);
+  volume_.emplace_back(std::numeric_limits<double>::max());
+  mass_density_.emplace_back(0.);
+  velocity_.emplace_back(VectorDim::Zero());
+  displacement_.emplace_back(VectorDim::Zero());
+  stress_.emplace_back(Vector6d::Zero());
+  strain_.emplace_back(Vector6d::Zero());
+  strain_rate_.emplace_back(Vector6d::Zero());
+  dstrain_.emplace_back(Vector6d::Zero());
+  dvolumetric_strain_.emplace_back(0.);
+  volumetric_strain_centroid_.emplace_back(0.);
+  if (handle != nullptr) *handle = index;
+  return index;
+}
+
+//! Remove a particle slot by moving the last slot into its place
+template <unsigned Tdim>
+void mpm::ParticleStore<Tdim>::remove(Index index) {
+  const Index last = handles_.size() - 1;
+  if (index != last) {
+    this->move(index, last);
+    // Update the handle of the particle that was moved
+    handles_[index] = handles_[last];
+    if (handles_[index] != nullptr) *handles_[index] = index;
+  }
+  this->pop_back();
+}
+
+//! Move a particle slot from another store into this store
+template <unsigned Tdim>
+mpm::Index mpm::ParticleStore<Tdim>::transfer(Index* handle,
+                                              ParticleStore<Tdim>* store) {
+  const Index src = *handle;
+  const Index index = this->add(nullptr);
+  this->copy(index, *store, src);
+  store->remove(src);
+  handles_[index] = handle;
+  *handle = index;
+  return index;
+}
+
+//! Reorder the particle slots
+template <unsigned Tdim>
+void mpm::ParticleStore<Tdim>::permute(const std::vector<Index>& order) {
+  if (order.size() != handles_.size())
+    throw std::runtime_error(
+        "Particle store permutation failed: number of slots do not match");
+
+  // Copy slots in the new order into a temporary store
+  ParticleStore<Tdim> store;
+  store.reserve(order.size());
+  for (Index index = 0; index < order.size(); ++index) {
+    store.add(nullptr);
+    store.copy(index, *this, order[index]);
+    store.handles_[index] = handles_[order[index]];
+  }
+
+  handles_.swap(store.handles_);
+  coordinates_.swap(store.coordinates_);
+  cell_id_.swap(store.cell_id_);
+  mass_.swap(store.mass_);
+  volume_.swap(store.volume_);
+  mass_density_.swap(store.mass_density_);
+  velocity_.swap(store.velocity_);
+  displacement_.swap(store.displacement_);
+  stress_.swap(store.stress_);
+  strain_.swap(store.strain_);
+  strain_rate_.swap(store.strain_rate_);
+  dstrain_.swap(store.dstrain_);
+  dvolumetric_strain_.swap(store.dvolumetric_strain_);
+  volumetric_strain_centroid_.swap(store.volumetric_strain_centroid_);
+
+  // Update the handles of all particles
+  for (Index index = 0; index < handles_.size(); ++index)
+    if (handles_[index] != nullptr) *handles_[index] = index;
+}
+
+//! Copy the values of a slot in another store to a slot in this store
+template <unsigned Tdim>
+void mpm::ParticleStore<Tdim>::copy(Index index,
+                                    const ParticleStore<Tdim>& store,
+                                    Index src) {
+  coordinates_[index] = store.coordinates_[src];
+  cell_id_[index] = store.cell_id_[src];
+  mass_[index] = store.mass_[src];
+  volume_[index] = store.volume_[src];
+  mass_density_[index] = store.mass_density_[src];
+  velocity_[index] = store.velocity_[src];
+  displacement_[index] = store.displacement_[src];
+  stress_[index] = store.stress_[src];
+  strain_[index] = store.strain_[src];
+  strain_rate_[index] = store.strain_rate_[src];
+  dstrain_[index] = store.dstrain_[src];
+  dvolumetric_strain_[index] = store.dvolumetric_strain_[src];
+  volumetric_strain_centroid_[index] = store.volumetric_strain_centroid_[src];
+}
+
+//! Move the values of a slot to another slot in this store
+template <unsigned Tdim>
+void mpm::ParticleStore<Tdim>::move(Index index, Index src) {
+  this->copy(index, *this, src);
+}
+
+//! Remove the last slot
+template <unsigned Tdim>
+void mpm::ParticleStore<Tdim>::pop_back() {
+  handles_.pop_back();
+  coordinates_.pop_back();
+  cell_id_.pop_back();
+  mass_.pop_back();
+  volume_.pop_back();
+  mass_density_.pop_back();
+  velocity_.pop_back();
+  displacement_.pop_back();
+  stress_.pop_back();
+  strain_.pop_back();
+  strain_rate_.pop_back();
+  dstrain_.pop_back();
+  dvolumetric_strain_.pop_back();
+  volumetric_strain_centroid_.pop_back();
+}
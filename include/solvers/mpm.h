@@ -15,6 +15,7 @@
 #include "io_mesh_ascii.h"
 #include "mesh.h"
 
+#include "vtp_writer.h"
 #ifdef USE_VTK
 #include "vtk_writer.h"
 #endif
@@ -67,6 +68,9 @@ class MPM {
   //! Write HDF5 files
   virtual void write_hdf5(mpm::Index step, mpm::Index max_steps) = 0;
 
+  //! Write all VTK attributes of a step to a single file per rank
+  virtual void write_vtp(mpm::Index step, mpm::Index max_steps) = 0;
+
 #ifdef USE_VTK
   //! Write VTK files
   virtual void write_vtk(mpm::Index step, mpm::Index max_steps) = 0;
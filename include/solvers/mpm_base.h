@@ -17,9 +17,11 @@
 #include "graph.h"
 #endif
 
+#include "async_writer.h"
 #include "constraints.h"
 #include "contact.h"
 #include "contact_friction.h"
+#include "load_balance.h"
 #include "mpm.h"
 #include "mpm_scheme.h"
 #include "mpm_scheme_usf.h"
@@ -71,6 +73,9 @@ class MPMBase : public MPM {
   //! Checkpoint resume
   bool checkpoint_resume() override;
 
+  //! Write all VTK attributes of a step to a single file per rank
+  void write_vtp(mpm::Index step, mpm::Index max_steps) override;
+
 #ifdef USE_VTK
   //! Write VTK files
   void write_vtk(mpm::Index step, mpm::Index max_steps) override;
@@ -88,15 +93,39 @@ class MPMBase : public MPM {
   //! \param[in] initial_step Start of simulation or later steps
   void mpi_domain_decompose(bool initial_step = false) override;
 
+  //! Diffusive load balance
+  //! \details Boundary cells are shifted to less loaded neighbour ranks if
+  //! the imbalance of measured loads exceeds the threshold
+  //! \param[in] load Measured load of the local rank (mean time of a step)
+  //! \retval balanced Load imbalance exceeded the threshold
+  bool mpi_diffusive_load_balance(double load);
+
   //! Pressure smoothing
   //! \param[in] phase Phase to smooth pressure
   void pressure_smoothing(unsigned phase);
 
+  //! Write output of a task on the background writer, or immediately if
+  //! output is synchronous
+  //! \param[in] task Output task which owns the data to be written
+  void write_output(std::function<void()> task);
+
  private:
   //! Return if a mesh will be isoparametric or not
   //! \retval isoparametric Status of mesh type
   bool is_isoparametric();
 
+  //! Create the cells of the local rank and a halo layer, and their nodes,
+  //! of a distributed mesh. Cells are partitioned along a Morton curve of
+  //! their centroids, and only the cells and nodes of the rank are kept.
+  //! \param[in] mesh_io Mesh IO handle
+  //! \param[in] mesh_file Mesh file name
+  //! \param[in] node_type Node type
+  //! \param[in] element Element of the cells
+  void create_distributed_mesh(
+      const std::shared_ptr<mpm::IOMesh<Tdim>>& mesh_io,
+      const std::string& mesh_file, const std::string& node_type,
+      const std::shared_ptr<mpm::Element<Tdim>>& element);
+
   //! Node entity sets
   //! \param[in] mesh_prop Mesh properties
   //! \param[in] check Check duplicates
@@ -190,6 +219,28 @@ class MPMBase : public MPM {
   std::shared_ptr<mpm::Contact<Tdim>> contact_{nullptr};
   //! velocity update
   bool velocity_update_{false};
+  //! Scatter particle quantities to nodes by cell colours
+  bool coloured_scatter_{false};
+  //! Overlap nodal halo exchange with particle to node scatter
+  bool overlap_halo_exchange_{false};
+  //! Fuse consecutive particle passes into single traversals
+  bool fused_kernels_{true};
+  //! Each rank only holds its partition and a layer of halo cells
+  bool distributed_mesh_{false};
+  //! Balance load by shifting boundary cells between neighbour ranks
+  bool diffusive_load_balance_{false};
+  //! Imbalance of measured loads which triggers diffusive load balance
+  double imbalance_threshold_{0.1};
+  //! Steps between reordering particles along a Morton curve (0 disables)
+  mpm::Index nreorder_steps_{0};
+  //! Compute the time increment of each step from the critical time step
+  bool adaptive_time_step_{false};
+  //! Fraction of the critical time step used with adaptive time step
+  double safety_factor_{0.5};
+  //! End time of the analysis with adaptive time step
+  double end_time_{std::numeric_limits<double>::max()};
+  //! Background writer of asynchronous output
+  std::unique_ptr<mpm::AsyncWriter> output_writer_{nullptr};
   //! Gravity
   Eigen::Matrix<double, Tdim, 1> gravity_;
   //! Mesh object
@@ -204,6 +255,10 @@ class MPMBase : public MPM {
   tsl::robin_map<mpm::VariableType, std::vector<std::string>> vtk_vars_;
   //! VTK state variables
   tsl::robin_map<unsigned, std::vector<std::string>> vtk_statevars_;
+  //! Write all VTK attributes of a step to a single file
+  bool vtk_single_file_{false};
+  //! Compress single VTK files
+  bool vtk_compression_{false};
   //! Set node concentrated force
   bool set_node_concentrated_force_{false};
   //! Damping type
@@ -38,14 +38,49 @@ mpm::MPMBase<Tdim>::MPMBase(const std::shared_ptr<IO>& io) : mpm::MPM(io) {
     analysis_ = io_->analysis();
     // Time-step size
     dt_ = analysis_["dt"].template get<double>();
-    // Number of time steps
-    nsteps_ = analysis_["nsteps"].template get<mpm::Index>();
+
+    // Adaptive time step, dt is the maximum time increment and the analysis
+    // runs until the end time
+    if (analysis_.find("adaptive_time_step") != analysis_.end()) {
+      const auto& adaptive = analysis_["adaptive_time_step"];
+      adaptive_time_step_ = true;
+      end_time_ = adaptive.at("end_time").template get<double>();
+      if (adaptive.find("safety_factor") != adaptive.end())
+        safety_factor_ = adaptive.at("safety_factor").template get<double>();
+      if (safety_factor_ <= 0. || safety_factor_ > 1.)
+        throw std::domain_error("Safety factor of adaptive time step is not "
+                                "in (0, 1]");
+    }
+
+    // Number of time steps, the maximum number of steps with adaptive time
+    // step
+    if (!adaptive_time_step_ || analysis_.find("nsteps") != analysis_.end())
+      nsteps_ = analysis_["nsteps"].template get<mpm::Index>();
+    else
+      nsteps_ = std::numeric_limits<unsigned>::max();
 
     // nload balance
     if (analysis_.find("nload_balance_steps") != analysis_.end())
       nload_balance_steps_ =
           analysis_["nload_balance_steps"].template get<mpm::Index>();
 
+    // Each rank only holds its partition and a layer of halo cells
+    if (analysis_.find("distributed_mesh") != analysis_.end())
+      distributed_mesh_ = analysis_["distributed_mesh"].template get<bool>();
+
+    // Diffusive load balance after the initial domain decomposition, the
+    // imbalance is checked every nload_balance_steps
+    if (analysis_.find("diffusive_load_balance") != analysis_.end()) {
+      const auto& balance = analysis_["diffusive_load_balance"];
+      diffusive_load_balance_ = true;
+      if (balance.find("imbalance_threshold") != balance.end())
+        imbalance_threshold_ =
+            balance.at("imbalance_threshold").template get<double>();
+      if (imbalance_threshold_ < 0.)
+        throw std::domain_error("Imbalance threshold of diffusive load "
+                                "balance is negative");
+    }
+
     // Locate particles
     if (analysis_.find("locate_particles") != analysis_.end())
       locate_particles_ = analysis_["locate_particles"].template get<bool>();
@@ -61,6 +96,27 @@ mpm::MPMBase<Tdim>::MPMBase(const std::shared_ptr<IO>& io) : mpm::MPM(io) {
           __FILE__, __LINE__, exception.what());
     }
 
+    // Particle to node scatter (mutex/coloured)
+    if (analysis_.find("scatter") != analysis_.end())
+      coloured_scatter_ =
+          (analysis_["scatter"].template get<std::string>() == "coloured");
+
+    // Nodal halo exchange (blocking/overlap)
+    if (analysis_.find("halo_exchange") != analysis_.end())
+      overlap_halo_exchange_ =
+          (analysis_["halo_exchange"].template get<std::string>() ==
+           "overlap");
+
+    // Particle kernels (fused/unfused)
+    if (analysis_.find("particle_kernels") != analysis_.end())
+      fused_kernels_ =
+          (analysis_["particle_kernels"].template get<std::string>() !=
+           "unfused");
+
+    // Spatial reordering of particles and mesh along a Morton curve
+    if (analysis_.find("nreorder_steps") != analysis_.end())
+      nreorder_steps_ = analysis_["nreorder_steps"].template get<mpm::Index>();
+
     // Velocity update
     try {
       velocity_update_ = analysis_["velocity_update"].template get<bool>();
@@ -98,6 +154,18 @@ mpm::MPMBase<Tdim>::MPMBase(const std::shared_ptr<IO>& io) : mpm::MPM(io) {
     // Output steps
     output_steps_ = post_process_["output_steps"].template get<mpm::Index>();
 
+    // Write output on a background thread, particle data of an output step
+    // is staged and the solver is blocked when two steps are pending
+    if (post_process_.find("async_output") != post_process_.end() &&
+        post_process_["async_output"].template get<bool>())
+      output_writer_ = std::make_unique<mpm::AsyncWriter>(2);
+
+    // Write all VTK attributes of a step to a single appended binary file
+    if (post_process_.find("vtk_single_file") != post_process_.end())
+      vtk_single_file_ = post_process_["vtk_single_file"].template get<bool>();
+    if (post_process_.find("vtk_compression") != post_process_.end())
+      vtk_compression_ = post_process_["vtk_compression"].template get<bool>();
+
   } catch (std::domain_error& domain_error) {
     console_->error("{} {} Get analysis object: {}", __FILE__, __LINE__,
                     domain_error.what());
@@ -207,16 +275,27 @@ void mpm::MPMBase<Tdim>::initialise_mesh() {
   std::string mesh_file =
       io_->file_name(mesh_props["mesh"].template get<std::string>());
 
-  // Create nodes from file
-  bool node_status =
-      mesh_->create_nodes(gid,                                  // global id
-                          node_type,                            // node type
-                          mesh_io->read_mesh_nodes(mesh_file),  // coordinates
-                          check_duplicates);                    // check dups
+  // Shape function name
+  const auto cell_type = mesh_props["cell_type"].template get<std::string>();
+  // Shape function
+  std::shared_ptr<mpm::Element<Tdim>> element =
+      Factory<mpm::Element<Tdim>>::instance()->create(cell_type);
 
-  if (!node_status)
-    throw std::runtime_error(
-        "mpm::base::init_mesh(): Addition of nodes to mesh failed");
+  if (distributed_mesh_ && mpi_size > 1) {
+    // Each rank only creates the nodes and cells of its partition and a halo
+    this->create_distributed_mesh(mesh_io, mesh_file, node_type, element);
+  } else {
+    // Create nodes from file
+    bool node_status = mesh_->create_nodes(
+        gid,                                  // global id
+        node_type,                            // node type
+        mesh_io->read_mesh_nodes(mesh_file),  // coordinates
+        check_duplicates);                    // check dups
+
+    if (!node_status)
+      throw std::runtime_error(
+          "mpm::base::init_mesh(): Addition of nodes to mesh failed");
+  }
 
   auto nodes_end = std::chrono::steady_clock::now();
   console_->info("Rank {} Read nodes: {} ms", mpi_rank,
@@ -238,25 +317,31 @@ void mpm::MPMBase<Tdim>::initialise_mesh() {
 
   // Initialise cell
   auto cells_begin = std::chrono::steady_clock::now();
-  // Shape function name
-  const auto cell_type = mesh_props["cell_type"].template get<std::string>();
-  // Shape function
-  std::shared_ptr<mpm::Element<Tdim>> element =
-      Factory<mpm::Element<Tdim>>::instance()->create(cell_type);
 
-  // Create cells from file
-  bool cell_status =
-      mesh_->create_cells(gid,                                  // global id
-                          element,                              // element tyep
-                          mesh_io->read_mesh_cells(mesh_file),  // Node ids
-                          check_duplicates);                    // Check dups
+  // Cells of a distributed mesh are created with its nodes
+  if (!mesh_->is_distributed()) {
+    // Create cells from file
+    bool cell_status = mesh_->create_cells(
+        gid,                                  // global id
+        element,                              // element tyep
+        mesh_io->read_mesh_cells(mesh_file),  // Node ids
+        check_duplicates);                    // Check dups
 
-  if (!cell_status)
-    throw std::runtime_error(
-        "mpm::base::init_mesh(): Addition of cells to mesh failed");
+    if (!cell_status)
+      throw std::runtime_error(
+          "mpm::base::init_mesh(): Addition of cells to mesh failed");
 
-  // Compute cell neighbours
-  mesh_->find_cell_neighbours();
+    // Compute cell neighbours
+    mesh_->find_cell_neighbours();
+  }
+
+  // Order cells and nodal state along a Morton curve
+  if (nreorder_steps_ > 0 && mesh_->reorder_mesh())
+    console_->info("Rank {} Mesh is reordered along a Morton curve", mpi_rank);
+
+  // Locate particles arithmetically in a structured cartesian mesh
+  if (!mesh_->is_isoparametric() && mesh_->compute_structured_grid())
+    console_->info("Rank {} Mesh is a structured grid", mpi_rank);
 
   // Read and assign cell sets
   this->cell_entity_sets(mesh_props, check_duplicates);
@@ -444,13 +529,13 @@ bool mpm::MPMBase<Tdim>::checkpoint_resume() {
     // Get step
     this->step_ = analysis_["resume"]["step"].template get<mpm::Index>();
 
-    // Input particle h5 file for resume
+    // Input particle h5 file for resume, shared by all MPI ranks
     std::string attribute = "particles";
     std::string extension = ".h5";
 
-    auto particles_file =
-        io_->output_file(attribute, extension, uuid_, step_, this->nsteps_)
-            .string();
+    auto particles_file = io_->output_file(attribute, extension, uuid_, step_,
+                                           this->nsteps_, false)
+                              .string();
 
     // Load particle information from file
     mesh_->read_particles_hdf5(phase, particles_file);
@@ -486,39 +571,51 @@ void mpm::MPMBase<Tdim>::write_hdf5(mpm::Index step, mpm::Index max_steps) {
   std::string attribute = "particles";
   std::string extension = ".h5";
 
+  // Particles of all MPI ranks are written to a single file
   auto particles_file =
-      io_->output_file(attribute, extension, uuid_, step, max_steps).string();
+      io_->output_file(attribute, extension, uuid_, step, max_steps, false)
+          .string();
 
-  const unsigned phase = 0;
-  mesh_->write_particles_hdf5(phase, particles_file);
-}
+  // Deflate level of compressed datasets
+  unsigned compression = 0;
+  if (post_process_.find("hdf5_compression") != post_process_.end())
+    compression = post_process_["hdf5_compression"].template get<unsigned>();
 
-#ifdef USE_VTK
-//! Write VTK files
-template <unsigned Tdim>
-void mpm::MPMBase<Tdim>::write_vtk(mpm::Index step, mpm::Index max_steps) {
-
-  // VTK PolyData writer
-  auto vtk_writer = std::make_unique<VtkWriter>(mesh_->particle_coordinates());
+  int mpi_size = 1;
+#ifdef USE_MPI
+  // Get number of MPI ranks
+  MPI_Comm_size(MPI_COMM_WORLD, &mpi_size);
+#endif
 
-  // Write mesh on step 0
-  // Get active node pairs use true
-  if (step % nload_balance_steps_ == 0)
-    vtk_writer->write_mesh(
-        io_->output_file("mesh", ".vtp", uuid_, step, max_steps).string(),
-        mesh_->nodal_coordinates(), mesh_->node_pairs(true));
+  // Writing a file shared by MPI ranks is collective, so only a single rank
+  // writes HDF5 in the background
+  if (output_writer_ != nullptr && mpi_size == 1) {
+    this->write_output([columns = mesh_->particles_hdf5_columns(),
+                        particles_file, compression]() {
+      mpm::hdf5::particle::write_process_columns(particles_file, columns,
+                                                 compression);
+    });
+  } else {
+    const unsigned phase = 0;
+    mesh_->write_particles_hdf5(phase, particles_file, compression);
+  }
+}
 
-  // Write input geometry to vtk file
-  const std::string extension = ".vtp";
-  const std::string attribute = "geometry";
-  auto meshfile =
-      io_->output_file(attribute, extension, uuid_, step, max_steps).string();
-  vtk_writer->write_geometry(meshfile);
+//! Write output of a task on the background writer
+template <unsigned Tdim>
+void mpm::MPMBase<Tdim>::write_output(std::function<void()> task) {
+  if (output_writer_ != nullptr)
+    output_writer_->push(std::move(task));
+  else
+    task();
+}
 
+//! Write all VTK attributes of a step to a single file per rank
+template <unsigned Tdim>
+void mpm::MPMBase<Tdim>::write_vtp(mpm::Index step, mpm::Index max_steps) {
   // MPI parallel vtk file
   int mpi_rank = 0;
   int mpi_size = 1;
-  bool write_mpi_rank = false;
 
 #ifdef USE_MPI
   // Get MPI rank
@@ -527,68 +624,158 @@ void mpm::MPMBase<Tdim>::write_vtk(mpm::Index step, mpm::Index max_steps) {
   MPI_Comm_size(MPI_COMM_WORLD, &mpi_size);
 #endif
 
-  //! VTK scalar variables
-  for (const auto& attribute : vtk_vars_.at(mpm::VariableType::Scalar)) {
-    // Write scalar
-    auto file =
-        io_->output_file(attribute, extension, uuid_, step, max_steps).string();
-    vtk_writer->write_scalar_point_data(
-        file, mesh_->particles_scalar_data(attribute), attribute);
-
-    // Write a parallel MPI VTK container file
-#ifdef USE_MPI
-    if (mpi_rank == 0 && mpi_size > 1) {
-      auto parallel_file = io_->output_file(attribute, ".pvtp", uuid_, step,
-                                            max_steps, write_mpi_rank)
-                               .string();
+  // Particle file of the rank
+  const std::string file =
+      io_->output_file("particles", ".vtp", uuid_, step, max_steps).string();
+  // Parallel MPI VTK container file and the particle files of all ranks
+  const std::string parallel_file =
+      io_->output_file("particles", ".pvtp", uuid_, step, max_steps, false)
+          .string();
+  std::vector<std::string> pieces;
+  if (mpi_rank == 0 && mpi_size > 1) {
+    for (int i = 0; i < mpi_size; ++i)
+      pieces.emplace_back(mpm::IO::output_file_name("particles", ".vtp", step,
+                                                    max_steps, i, mpi_size));
+  }
 
-      vtk_writer->write_parallel_vtk(parallel_file, attribute, mpi_size, step,
-                                     max_steps);
-    }
-#endif
+  // Write mesh on load balancing steps, get active node pairs use true
+  const bool write_mesh = (step % nload_balance_steps_ == 0);
+  std::vector<Eigen::Matrix<double, 3, 1>> nodal_coordinates;
+  std::vector<std::array<mpm::Index, 2>> node_pairs;
+  if (write_mesh) {
+    nodal_coordinates = mesh_->nodal_coordinates();
+    node_pairs = mesh_->node_pairs(true);
   }
+  const std::string mesh_file =
+      io_->output_file("mesh", ".vtp", uuid_, step, max_steps).string();
 
-  //! VTK vector variables
-  for (const auto& attribute : vtk_vars_.at(mpm::VariableType::Vector)) {
-    // Write vector
-    auto file =
-        io_->output_file(attribute, extension, uuid_, step, max_steps).string();
-    vtk_writer->write_vector_point_data(
-        file, mesh_->particles_vector_data(attribute), attribute);
+  // Stage the data of the step, the file is written by the output task
+  std::vector<std::pair<std::string, std::vector<double>>> scalars;
+  for (const auto& attribute : vtk_vars_.at(mpm::VariableType::Scalar))
+    scalars.emplace_back(attribute, mesh_->particles_scalar_data(attribute));
 
-    // Write a parallel MPI VTK container file
-#ifdef USE_MPI
-    if (mpi_rank == 0 && mpi_size > 1) {
-      auto parallel_file = io_->output_file(attribute, ".pvtp", uuid_, step,
-                                            max_steps, write_mpi_rank)
-                               .string();
+  std::vector<std::pair<std::string, std::vector<Eigen::Matrix<double, 3, 1>>>>
+      vectors;
+  for (const auto& attribute : vtk_vars_.at(mpm::VariableType::Vector))
+    vectors.emplace_back(attribute, mesh_->particles_vector_data(attribute));
 
-      vtk_writer->write_parallel_vtk(parallel_file, attribute, mpi_size, step,
-                                     max_steps);
-    }
-#endif
+  std::vector<std::pair<std::string, std::vector<Eigen::Matrix<double, 6, 1>>>>
+      tensors;
+  for (const auto& attribute : vtk_vars_.at(mpm::VariableType::Tensor))
+    tensors.emplace_back(attribute,
+                         mesh_->template particles_tensor_data<6>(attribute));
+
+  for (auto const& vtk_statevar : vtk_statevars_) {
+    unsigned phase_id = vtk_statevar.first;
+    for (const auto& attribute : vtk_statevar.second)
+      scalars.emplace_back(
+          "phase" + std::to_string(phase_id) + attribute,
+          mesh_->particles_statevars_data(attribute, phase_id));
   }
 
-  //! VTK tensor variables
-  for (const auto& attribute : vtk_vars_.at(mpm::VariableType::Tensor)) {
-    // Write vector
-    auto file =
-        io_->output_file(attribute, extension, uuid_, step, max_steps).string();
-    vtk_writer->write_tensor_point_data(
-        file, mesh_->template particles_tensor_data<6>(attribute), attribute);
+  this->write_output([
+    coordinates = mesh_->particle_coordinates(), scalars = std::move(scalars),
+    vectors = std::move(vectors), tensors = std::move(tensors), file,
+    parallel_file, pieces = std::move(pieces), write_mesh, mesh_file,
+    nodal_coordinates = std::move(nodal_coordinates),
+    node_pairs = std::move(node_pairs), compression = vtk_compression_
+  ]() {
+    // Particles and all their attributes
+    mpm::VtpWriter writer(coordinates, compression);
+    for (const auto& scalar : scalars)
+      writer.add_point_data(scalar.first, scalar.second);
+    for (const auto& vector : vectors)
+      writer.add_point_data(vector.first, vector.second);
+    for (const auto& tensor : tensors)
+      writer.add_point_data(tensor.first, tensor.second);
+    writer.write(file);
+    if (!pieces.empty()) writer.write_parallel(parallel_file, pieces);
+
+    // Mesh
+    if (write_mesh) {
+      mpm::VtpWriter mesh_writer(nodal_coordinates, compression);
+      mesh_writer.add_lines(node_pairs);
+      mesh_writer.write(mesh_file);
+    }
+  });
+}
 
-    // Write a parallel MPI VTK container file
-#ifdef USE_MPI
-    if (mpi_rank == 0 && mpi_size > 1) {
-      auto parallel_file = io_->output_file(attribute, ".pvtp", uuid_, step,
-                                            max_steps, write_mpi_rank)
-                               .string();
+#ifdef USE_VTK
+//! Write VTK files
+template <unsigned Tdim>
+void mpm::MPMBase<Tdim>::write_vtk(mpm::Index step, mpm::Index max_steps) {
+  const std::string extension = ".vtp";
 
-      vtk_writer->write_parallel_vtk(parallel_file, attribute, mpi_size, step,
-                                     max_steps, 9);
-    }
+  // MPI parallel vtk file
+  int mpi_rank = 0;
+  int mpi_size = 1;
+  bool write_mpi_rank = false;
+
+#ifdef USE_MPI
+  // Get MPI rank
+  MPI_Comm_rank(MPI_COMM_WORLD, &mpi_rank);
+  // Get number of MPI ranks
+  MPI_Comm_size(MPI_COMM_WORLD, &mpi_size);
 #endif
+
+  // Particle attribute and its files
+  struct Attribute {
+    // Attribute name
+    std::string name;
+    // Attribute file of the rank
+    std::string file;
+    // Parallel MPI VTK container file
+    std::string parallel_file;
+    // Number of components in the container file
+    unsigned ncomponents;
+  };
+  const auto attribute_files = [&](const std::string& name,
+                                   unsigned ncomponents) {
+    return Attribute{
+        name,
+        io_->output_file(name, extension, uuid_, step, max_steps).string(),
+        io_->output_file(name, ".pvtp", uuid_, step, max_steps,
+                         write_mpi_rank)
+            .string(),
+        ncomponents};
+  };
+
+  // Stage the data of the step, the files are written by the output task
+  // Write mesh on load balancing steps, get active node pairs use true
+  const bool write_mesh = (step % nload_balance_steps_ == 0);
+  std::vector<Eigen::Matrix<double, 3, 1>> nodal_coordinates;
+  std::vector<std::array<mpm::Index, 2>> node_pairs;
+  if (write_mesh) {
+    nodal_coordinates = mesh_->nodal_coordinates();
+    node_pairs = mesh_->node_pairs(true);
   }
+  const std::string mesh_file =
+      io_->output_file("mesh", ".vtp", uuid_, step, max_steps).string();
+  // Input geometry file
+  const std::string geometry_file =
+      io_->output_file("geometry", extension, uuid_, step, max_steps)
+          .string();
+
+  //! VTK scalar variables
+  std::vector<std::pair<Attribute, std::vector<double>>> scalars;
+  for (const auto& attribute : vtk_vars_.at(mpm::VariableType::Scalar))
+    scalars.emplace_back(attribute_files(attribute, 3),
+                         mesh_->particles_scalar_data(attribute));
+
+  //! VTK vector variables
+  std::vector<std::pair<Attribute, std::vector<Eigen::Matrix<double, 3, 1>>>>
+      vectors;
+  for (const auto& attribute : vtk_vars_.at(mpm::VariableType::Vector))
+    vectors.emplace_back(attribute_files(attribute, 3),
+                         mesh_->particles_vector_data(attribute));
+
+  //! VTK tensor variables
+  std::vector<std::pair<Attribute, std::vector<Eigen::Matrix<double, 6, 1>>>>
+      tensors;
+  for (const auto& attribute : vtk_vars_.at(mpm::VariableType::Tensor))
+    tensors.emplace_back(
+        attribute_files(attribute, 9),
+        mesh_->template particles_tensor_data<6>(attribute));
 
   // VTK state variables
   for (auto const& vtk_statevar : vtk_statevars_) {
@@ -596,26 +783,53 @@ void mpm::MPMBase<Tdim>::write_vtk(mpm::Index step, mpm::Index max_steps) {
     for (const auto& attribute : vtk_statevar.second) {
       std::string phase_attribute =
           "phase" + std::to_string(phase_id) + attribute;
-      // Write state variables
-      auto file =
-          io_->output_file(phase_attribute, extension, uuid_, step, max_steps)
-              .string();
-      vtk_writer->write_scalar_point_data(
-          file, mesh_->particles_statevars_data(attribute, phase_id),
-          phase_attribute);
-      // Write a parallel MPI VTK container file
-#ifdef USE_MPI
-      if (mpi_rank == 0 && mpi_size > 1) {
-        auto parallel_file = io_->output_file(phase_attribute, ".pvtp", uuid_,
-                                              step, max_steps, write_mpi_rank)
-                                 .string();
-        unsigned ncomponents = 1;
-        vtk_writer->write_parallel_vtk(parallel_file, phase_attribute, mpi_size,
-                                       step, max_steps, ncomponents);
-      }
-#endif
+      scalars.emplace_back(
+          attribute_files(phase_attribute, 1),
+          mesh_->particles_statevars_data(attribute, phase_id));
     }
   }
+
+  this->write_output([
+    coordinates = mesh_->particle_coordinates(), write_mesh, mesh_file,
+    nodal_coordinates = std::move(nodal_coordinates),
+    node_pairs = std::move(node_pairs), geometry_file,
+    scalars = std::move(scalars), vectors = std::move(vectors),
+    tensors = std::move(tensors), mpi_rank, mpi_size, step, max_steps
+  ]() {
+    // VTK PolyData writer
+    auto vtk_writer = std::make_unique<VtkWriter>(coordinates);
+
+    // Write mesh
+    if (write_mesh)
+      vtk_writer->write_mesh(mesh_file, nodal_coordinates, node_pairs);
+
+    // Write input geometry to vtk file
+    vtk_writer->write_geometry(geometry_file);
+
+    // Write a parallel MPI VTK container file
+    const auto write_parallel_vtk = [&](const Attribute& attribute) {
+      if (mpi_rank == 0 && mpi_size > 1)
+        vtk_writer->write_parallel_vtk(attribute.parallel_file,
+                                       attribute.name, mpi_size, step,
+                                       max_steps, attribute.ncomponents);
+    };
+
+    for (const auto& scalar : scalars) {
+      vtk_writer->write_scalar_point_data(scalar.first.file, scalar.second,
+                                          scalar.first.name);
+      write_parallel_vtk(scalar.first);
+    }
+    for (const auto& vector : vectors) {
+      vtk_writer->write_vector_point_data(vector.first.file, vector.second,
+                                          vector.first.name);
+      write_parallel_vtk(vector.first);
+    }
+    for (const auto& tensor : tensors) {
+      vtk_writer->write_tensor_point_data(tensor.first.file, tensor.second,
+                                          tensor.first.name);
+      write_parallel_vtk(tensor.first);
+    }
+  });
 }
 #endif
 
@@ -641,7 +855,9 @@ void mpm::MPMBase<Tdim>::write_partio(mpm::Index step, mpm::Index max_steps) {
   auto file =
       io_->output_file(attribute, extension, uuid_, step, max_steps).string();
   // Write partio file
-  mpm::partio::write_particles(file, mesh_->particles_hdf5());
+  this->write_output([file, particles = mesh_->particles_hdf5()]() {
+    mpm::partio::write_particles(file, particles);
+  });
 }
 #endif  // USE_PARTIO
 
@@ -786,6 +1002,69 @@ bool mpm::MPMBase<Tdim>::initialise_math_functions(const Json& math_functions) {
   return status;
 }
 
+//! Create the local rank cells and a halo layer of a distributed mesh
+template <unsigned Tdim>
+void mpm::MPMBase<Tdim>::create_distributed_mesh(
+    const std::shared_ptr<mpm::IOMesh<Tdim>>& mesh_io,
+    const std::string& mesh_file, const std::string& node_type,
+    const std::shared_ptr<mpm::Element<Tdim>>& element) {
+  int mpi_rank = 0;
+  int mpi_size = 1;
+#ifdef USE_MPI
+  MPI_Comm_rank(MPI_COMM_WORLD, &mpi_rank);
+  MPI_Comm_size(MPI_COMM_WORLD, &mpi_size);
+#endif
+
+  // Rank of each cell, only the centroids of cells are held to partition
+  std::vector<unsigned> ranks = mpm::morton::partition<Tdim>(
+      mesh_io->read_mesh_cell_centroids(mesh_file), mpi_size);
+  if (ranks.empty())
+    throw std::runtime_error(
+        "mpm::base::init_mesh(): Reading cells of distributed mesh failed");
+
+  // Nodes of cells in the local rank
+  tsl::robin_set<mpm::Index> rank_nodes;
+  mesh_io->iterate_over_mesh_cells(
+      mesh_file,
+      [&](mpm::Index cid, const std::vector<mpm::Index>& nodes) {
+        if (static_cast<int>(ranks.at(cid)) == mpi_rank)
+          rank_nodes.insert(nodes.cbegin(), nodes.cend());
+      });
+
+  // Cells of the local rank and halo cells sharing a node with them
+  std::vector<mpm::Index> cell_ids;
+  std::vector<std::vector<mpm::Index>> cells;
+  std::vector<unsigned> cell_ranks;
+  tsl::robin_set<mpm::Index> mesh_nodes;
+  mesh_io->iterate_over_mesh_cells(
+      mesh_file,
+      [&](mpm::Index cid, const std::vector<mpm::Index>& nodes) {
+        bool keep = (static_cast<int>(ranks.at(cid)) == mpi_rank);
+        for (auto nitr = nodes.cbegin(); !keep && nitr != nodes.cend(); ++nitr)
+          if (rank_nodes.find(*nitr) != rank_nodes.end()) keep = true;
+        if (keep) {
+          cell_ids.emplace_back(cid);
+          cells.emplace_back(nodes);
+          cell_ranks.emplace_back(ranks[cid]);
+          mesh_nodes.insert(nodes.cbegin(), nodes.cend());
+        }
+      });
+  ranks.clear();
+  ranks.shrink_to_fit();
+
+  // Coordinates of nodes of the local cells, sorted by id
+  std::vector<mpm::Index> node_ids(mesh_nodes.begin(), mesh_nodes.end());
+  std::sort(node_ids.begin(), node_ids.end());
+  const auto coordinates =
+      mesh_io->read_mesh_node_coordinates(mesh_file, node_ids);
+
+  bool mesh_status = mesh_->create_distributed_mesh(
+      node_type, node_ids, coordinates, element, cell_ids, cells, cell_ranks);
+  if (!mesh_status)
+    throw std::runtime_error(
+        "mpm::base::init_mesh(): Creation of distributed mesh failed");
+}
+
 //! Node entity sets
 template <unsigned Tdim>
 void mpm::MPMBase<Tdim>::node_entity_sets(const Json& mesh_props,
@@ -1158,34 +1437,74 @@ void mpm::MPMBase<Tdim>::mpi_domain_decompose(bool initial_step) {
       throw std::runtime_error("Container of cells is empty");
 
 #ifdef USE_GRAPH_PARTITIONING
-    // Create graph object if empty
-    if (initial_step || graph_ == nullptr)
+    // Duration of a phase of the domain decomposition in ms
+    auto phase_begin = std::chrono::steady_clock::now();
+    const auto phase_duration = [&phase_begin]() {
+      const auto phase_end = std::chrono::steady_clock::now();
+      const auto duration =
+          std::chrono::duration_cast<std::chrono::milliseconds>(phase_end -
+                                                                phase_begin)
+              .count();
+      phase_begin = phase_end;
+      return duration;
+    };
+
+    // Create graph object if empty, the cells of a distributed mesh change
+    // in every decomposition
+    if (initial_step || graph_ == nullptr || mesh_->is_distributed())
       graph_ = std::make_shared<Graph<Tdim>>(mesh_->cells());
 
     // Find number of particles in each cell across MPI ranks
     mesh_->find_nglobal_particles_cells();
+    const auto weights_duration = phase_duration();
 
     // Construct a weighted DAG
-    graph_->construct_graph(mpi_size, mpi_rank);
+    if (mesh_->is_distributed())
+      graph_->construct_distributed_graph(mpi_size, mpi_rank, &comm);
+    else
+      graph_->construct_graph(mpi_size, mpi_rank);
+    const auto graph_duration = phase_duration();
 
     // Graph partitioning mode
     int mode = 4;  // FAST
     // Create graph partition
     graph_->create_partitions(&comm, mode);
-    // Collect the partitions
-    auto exchange_cells = graph_->collect_partitions(mpi_size, mpi_rank, &comm);
+    const auto partition_duration = phase_duration();
+
+    // Collect the partitions, cells and nodes of a distributed mesh are
+    // transferred to the ranks which hold them in the new partition
+    std::vector<mpm::Index> exchange_cells;
+    if (mesh_->is_distributed()) {
+      exchange_cells = graph_->collect_distributed_partitions(mpi_rank);
+      mesh_->transfer_nonrank_cells(exchange_cells);
+    } else
+      exchange_cells = graph_->collect_partitions(mpi_size, mpi_rank, &comm);
+    const auto collect_duration = phase_duration();
 
     // Identify shared nodes across MPI domains
     mesh_->find_domain_shared_nodes();
     // Identify ghost boundary cells
     mesh_->find_ghost_boundary_cells();
+    const auto shared_duration = phase_duration();
 
-    // Delete all the particles which is not in local task parititon
-    if (initial_step) mesh_->remove_all_nonrank_particles();
+    // Delete all the particles which is not in local task parititon, a
+    // distributed mesh only holds the particles of the local rank
+    if (initial_step && !mesh_->is_distributed())
+      mesh_->remove_all_nonrank_particles();
     // Transfer non-rank particles to appropriate cells
     else
       mesh_->transfer_nonrank_particles(exchange_cells);
 
+    // Remove cells and nodes outside the partition and its halo layer
+    if (distributed_mesh_) mesh_->remove_all_nonrank_cells();
+    const auto transfer_duration = phase_duration();
+
+    console_->info(
+        "Rank {}, Domain decomposition phases, cell weights: {} ms, graph: {} "
+        "ms, partition: {} ms, collect partitions: {} ms, shared nodes: {} "
+        "ms, transfer: {} ms",
+        mpi_rank, weights_duration, graph_duration, partition_duration,
+        collect_duration, shared_duration, transfer_duration);
 #endif
     auto mpi_domain_end = std::chrono::steady_clock::now();
     console_->info("Rank {}, Domain decomposition: {} ms", mpi_rank,
@@ -1196,13 +1515,76 @@ void mpm::MPMBase<Tdim>::mpi_domain_decompose(bool initial_step) {
 #endif  // MPI
 }
 
+//! Diffusive load balance
+template <unsigned Tdim>
+bool mpm::MPMBase<Tdim>::mpi_diffusive_load_balance(double load) {
+  bool balanced = false;
+#ifdef USE_MPI
+  // Initialise MPI rank and size
+  int mpi_rank = 0;
+  int mpi_size = 1;
+
+  // Get MPI rank
+  MPI_Comm_rank(MPI_COMM_WORLD, &mpi_rank);
+  // Get number of MPI ranks
+  MPI_Comm_size(MPI_COMM_WORLD, &mpi_size);
+
+  if (mpi_size > 1) {
+    auto balance_begin = std::chrono::steady_clock::now();
+
+    // Measured loads of all ranks
+    std::vector<double> loads(mpi_size, 0.);
+    MPI_Allgather(&load, 1, MPI_DOUBLE, loads.data(), 1, MPI_DOUBLE,
+                  MPI_COMM_WORLD);
+    const double imbalance = mpm::load_balance::imbalance(loads);
+    if (imbalance <= imbalance_threshold_) return balanced;
+    balanced = true;
+
+    // Number of neighbour ranks of all ranks
+    const auto neighbours = mesh_->neighbour_ranks();
+    unsigned nneighbours = neighbours.size();
+    std::vector<unsigned> degrees(mpi_size, 0);
+    MPI_Allgather(&nneighbours, 1, MPI_UNSIGNED, degrees.data(), 1,
+                  MPI_UNSIGNED, MPI_COMM_WORLD);
+
+    // Particles to send to each less loaded neighbour rank, the load of a
+    // rank is shared equally by its particles
+    std::map<unsigned, double> nparticles;
+    if (load > 0.) {
+      const double nrank_particles = mesh_->nparticles();
+      for (const auto& flow : mpm::load_balance::diffusive_flows(
+               mpi_rank, neighbours, loads, degrees))
+        nparticles[flow.first] = flow.second / load * nrank_particles;
+    }
+
+    // Shift boundary cells and transfer their particles
+    auto exchange_cells = mesh_->shift_boundary_cells(nparticles);
+    if (mesh_->is_distributed()) mesh_->transfer_nonrank_cells(exchange_cells);
+    mesh_->find_domain_shared_nodes();
+    mesh_->find_ghost_boundary_cells();
+    mesh_->transfer_nonrank_particles(exchange_cells);
+    if (mesh_->is_distributed()) mesh_->remove_all_nonrank_cells();
+
+    auto balance_end = std::chrono::steady_clock::now();
+    console_->info(
+        "Rank {}, Diffusive load balance, imbalance: {}, exchanged cells: {}, "
+        "duration: {} ms",
+        mpi_rank, imbalance, exchange_cells.size(),
+        std::chrono::duration_cast<std::chrono::milliseconds>(balance_end -
+                                                              balance_begin)
+            .count());
+  }
+#endif  // MPI
+  return balanced;
+}
+
 //! MPM pressure smoothing
 template <unsigned Tdim>
 void mpm::MPMBase<Tdim>::pressure_smoothing(unsigned phase) {
   // Assign pressure to nodes
   mesh_->iterate_over_particles(
       std::bind(&mpm::ParticleBase<Tdim>::map_pressure_to_nodes,
-                std::placeholders::_1, phase));
+                std::placeholders::_1, phase, true));
 
 #ifdef USE_MPI
   int mpi_size = 1;
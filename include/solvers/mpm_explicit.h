@@ -61,6 +61,26 @@ class MPMExplicit : public MPMBase<Tdim> {
 
   //! velocity update
   using mpm::MPMBase<Tdim>::velocity_update_;
+  //! Scatter particle quantities to nodes by cell colours
+  using mpm::MPMBase<Tdim>::coloured_scatter_;
+  //! Overlap nodal halo exchange with particle to node scatter
+  using mpm::MPMBase<Tdim>::overlap_halo_exchange_;
+  //! Fuse consecutive particle passes into single traversals
+  using mpm::MPMBase<Tdim>::fused_kernels_;
+  //! Steps between reordering particles along a Morton curve
+  using mpm::MPMBase<Tdim>::nreorder_steps_;
+  //! Balance load by shifting boundary cells between neighbour ranks
+  using mpm::MPMBase<Tdim>::diffusive_load_balance_;
+  //! Compute the time increment of each step from the critical time step
+  using mpm::MPMBase<Tdim>::adaptive_time_step_;
+  //! Fraction of the critical time step used with adaptive time step
+  using mpm::MPMBase<Tdim>::safety_factor_;
+  //! End time of the analysis with adaptive time step
+  using mpm::MPMBase<Tdim>::end_time_;
+  //! Background writer of asynchronous output
+  using mpm::MPMBase<Tdim>::output_writer_;
+  //! Write all VTK attributes of a step to a single file
+  using mpm::MPMBase<Tdim>::vtk_single_file_;
   //! Gravity
   using mpm::MPMBase<Tdim>::gravity_;
   //! Mesh object
@@ -31,9 +31,8 @@ void mpm::MPMExplicit<Tdim>::compute_stress_strain(unsigned phase) {
   // Pressure smoothing
   if (pressure_smoothing_) this->pressure_smoothing(phase);
 
-  // Iterate over each particle to compute stress
-  mesh_->iterate_over_particles(std::bind(
-      &mpm::ParticleBase<Tdim>::compute_stress, std::placeholders::_1));
+  // Compute stress of particles in batches of the same material
+  mesh_->compute_stress_batched(phase);
 }
 
 //! MPM Explicit solver
@@ -83,6 +82,13 @@ bool mpm::MPMExplicit<Tdim>::solve() {
   // Create nodal properties
   if (interface_) mesh_->create_nodal_properties();
 
+  // Colour cells for particle to node scatter
+  if (coloured_scatter_) {
+    if (!mesh_->compute_cell_colours())
+      throw std::runtime_error("Colouring of cells failed");
+    mpm_scheme_->coloured_scatter(true);
+  }
+
   // Compute mass
   mesh_->iterate_over_particles(
       std::bind(&mpm::ParticleBase<Tdim>::compute_mass, std::placeholders::_1));
@@ -90,26 +96,71 @@ bool mpm::MPMExplicit<Tdim>::solve() {
   // Check point resume
   if (resume) this->checkpoint_resume();
 
-  // Domain decompose
-  bool initial_step = (resume == true) ? false : true;
+  // Domain decompose, on resume every rank reads all particles of the
+  // checkpoint so the particles are distributed as in the initial step
+  bool initial_step = true;
   this->mpi_domain_decompose(initial_step);
 
+  // Overlap halo exchange with the scatter of interior particles
+  mpm_scheme_->overlap_halo_exchange(overlap_halo_exchange_);
+
+  // Fuse consecutive particle passes, unfused passes are the reference
+  mpm_scheme_->fused_kernels(fused_kernels_);
+
+  // Maximum time increment and analysis time
+  const double dt_max = dt_;
+  double time = step_ * dt_;
+  if (adaptive_time_step_ && resume && mpi_rank == 0)
+    console_->warn("Analysis time on resume with adaptive time step is "
+                   "estimated with the maximum time increment");
+
+  // Time of steps since the last load balance in seconds
+  double balance_time = 0.;
+  mpm::Index nbalance_steps = 0;
+
   auto solver_begin = std::chrono::steady_clock::now();
   // Main loop
   for (; step_ < nsteps_; ++step_) {
 
-    if (mpi_rank == 0) console_->info("Step: {} of {}.\n", step_, nsteps_);
+    if (adaptive_time_step_) {
+      if (time >= end_time_ * (1. - std::numeric_limits<double>::epsilon()))
+        break;
+      // Critical time step of all ranks
+      double dt_critical = mesh_->critical_time_step(phase);
+#ifdef USE_MPI
+      MPI_Allreduce(MPI_IN_PLACE, &dt_critical, 1, MPI_DOUBLE, MPI_MIN,
+                    MPI_COMM_WORLD);
+#endif
+      dt_ = std::min({dt_max, safety_factor_ * dt_critical, end_time_ - time});
+      mpm_scheme_->time_increment(dt_, time);
+      if (mpi_rank == 0)
+        console_->info("Step: {}, time: {}, dt: {}.\n", step_, time, dt_);
+    } else if (mpi_rank == 0)
+      console_->info("Step: {} of {}.\n", step_, nsteps_);
 
 #ifdef USE_MPI
 #ifdef USE_GRAPH_PARTITIONING
-    // Run load balancer at a specified frequency
-    if (step_ % nload_balance_steps_ == 0 && step_ != 0)
-      this->mpi_domain_decompose(false);
+    // Run load balancer at a specified frequency, the diffusive load balancer
+    // uses the mean time of the steps since the last check
+    if (step_ % nload_balance_steps_ == 0 && step_ != 0) {
+      if (diffusive_load_balance_) {
+        this->mpi_diffusive_load_balance(
+            nbalance_steps > 0 ? balance_time / nbalance_steps : 0.);
+        balance_time = 0.;
+        nbalance_steps = 0;
+      } else
+        this->mpi_domain_decompose(false);
+    }
 #endif
 #endif
+    auto step_begin = std::chrono::steady_clock::now();
 
     // Inject particles
-    mesh_->inject_particles(step_ * dt_);
+    mesh_->inject_particles(adaptive_time_step_ ? time : step_ * dt_);
+
+    // Reorder particles along a Morton curve at a specified frequency
+    if (nreorder_steps_ > 0 && step_ % nreorder_steps_ == 0)
+      mesh_->reorder_particles();
 
     // Initialise nodes, cells and shape functions
     mpm_scheme_->initialise();
@@ -140,6 +191,15 @@ bool mpm::MPMExplicit<Tdim>::solve() {
     // Locate particles
     mpm_scheme_->locate_particles(this->locate_particles_);
 
+    // Analysis time at the end of the step
+    time += dt_;
+
+    // Time of the step on the local rank before waiting for other ranks
+    balance_time += std::chrono::duration<double>(
+                        std::chrono::steady_clock::now() - step_begin)
+                        .count();
+    ++nbalance_steps;
+
 #ifdef USE_MPI
 #ifdef USE_GRAPH_PARTITIONING
     mesh_->transfer_halo_particles();
@@ -150,9 +210,11 @@ bool mpm::MPMExplicit<Tdim>::solve() {
     if (step_ % output_steps_ == 0) {
       // HDF5 outputs
       this->write_hdf5(this->step_, this->nsteps_);
-#ifdef USE_VTK
       // VTK outputs
-      this->write_vtk(this->step_, this->nsteps_);
+      if (vtk_single_file_) this->write_vtp(this->step_, this->nsteps_);
+#ifdef USE_VTK
+      else
+        this->write_vtk(this->step_, this->nsteps_);
 #endif
 #ifdef USE_PARTIO
       // Partio outputs
@@ -160,6 +222,9 @@ bool mpm::MPMExplicit<Tdim>::solve() {
 #endif
     }
   }
+  // Wait for asynchronous output of the last steps
+  if (output_writer_ != nullptr) output_writer_->wait();
+
   auto solver_end = std::chrono::steady_clock::now();
   console_->info("Rank {}, Explicit {} solver duration: {} ms", mpi_rank,
                  mpm_scheme_->scheme(),
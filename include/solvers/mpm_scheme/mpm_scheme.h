@@ -1,6 +1,8 @@
 #ifndef MPM_MPM_SCHEME_H_
 #define MPM_MPM_SCHEME_H_
 
+#include <functional>
+
 #ifdef USE_GRAPH_PARTITIONING
 #include "graph.h"
 #endif
@@ -75,15 +77,116 @@ class MPMScheme {
   //! \retval scheme Stress update scheme
   virtual inline std::string scheme() const = 0;
 
+  //! Assign particle to node scatter by cell colours
+  //! \param[in] coloured Enable or disable coloured scatter, cell colours
+  //! must be computed in the mesh before enabling
+  void coloured_scatter(bool coloured) { coloured_scatter_ = coloured; }
+
+  //! Return the status of coloured particle to node scatter
+  bool coloured_scatter() const { return coloured_scatter_; }
+
+  //! Overlap the nodal halo exchange with the particle to node scatter.
+  //! Particles in halo cells are mapped first, the exchange is posted and
+  //! interior particles are mapped while messages are in flight. Only
+  //! enabled with more than one MPI rank.
+  //! \param[in] overlap Enable or disable the overlap, domain shared nodes
+  //! must be found in the mesh before enabling
+  void overlap_halo_exchange(bool overlap) {
+    overlap_halo_exchange_ = overlap && (mpi_size_ > 1);
+  }
+
+  //! Return the status of the halo exchange overlap
+  bool overlap_halo_exchange() const { return overlap_halo_exchange_; }
+
+  //! Fuse consecutive particle passes of a step into single traversals, the
+  //! unfused passes are kept as a reference
+  //! \param[in] fused Enable or disable fused particle kernels
+  void fused_kernels(bool fused) { fused_kernels_ = fused; }
+
+  //! Return the status of fused particle kernels
+  bool fused_kernels() const { return fused_kernels_; }
+
+  //! Assign time increment and analysis time of the current step, used when
+  //! the time increment varies between steps
+  //! \param[in] dt Time increment of the current step
+  //! \param[in] time Analysis time at the start of the current step
+  void time_increment(double dt, double time) {
+    dt_ = dt;
+    time_ = time;
+    adaptive_time_ = true;
+  }
+
+  //! Return the time increment
+  double time_increment() const { return dt_; }
+
+ protected:
+  //! Compute acceleration and velocity of active nodes
+  //! \param[in] phase Phase of nodes
+  //! \param[in] damping_type Type of damping
+  //! \param[in] damping_factor Value of critical damping
+  inline void compute_nodal_acceleration_velocity(
+      unsigned phase, const std::string& damping_type, double damping_factor);
+
+  //! Return the analysis time of a step
+  //! \param[in] step Number of step in solver
+  double current_time(unsigned step) const {
+    return adaptive_time_ ? time_ : step * dt_;
+  }
+
+  //! Update particle stress after the strain and volume are computed
+  //! \param[in] phase Phase to smooth pressure
+  //! \param[in] pressure_smoothing Enable or disable pressure smoothing
+  inline void update_stress(unsigned phase, bool pressure_smoothing);
+
+  //! Iterate over particles to scatter particle quantities to nodes
+  //! \tparam Toper Callable object typically a baseclass functor
+  //! \param[in] oper Operation on a particle and a flag to lock nodes
+  template <typename Toper>
+  inline void scatter_particles(Toper oper);
+
+  //! Compute forces, mapping particles in halo cells first and interior
+  //! particles while the halo exchange is in flight
+  //! \param[in] gravity Acceleration due to gravity
+  //! \param[in] step Number of step in solver
+  //! \param[in] concentrated_nodal_forces Boolean for if a concentrated force
+  //! is applied or not
+  inline void compute_forces_overlapped(
+      const Eigen::Matrix<double, Tdim, 1>& gravity, unsigned phase,
+      unsigned step, bool concentrated_nodal_forces);
+
+#ifdef USE_MPI
+  //! Getter of nodal external and internal force for the halo exchange
+  //! \param[in] phase Phase of nodal forces
+  inline std::function<Eigen::Matrix<double, 2 * Tdim, 1>(
+      const std::shared_ptr<mpm::NodeBase<Tdim>>&)>
+      force_getter(unsigned phase) const;
+
+  //! Setter of nodal external and internal force for the halo exchange
+  //! \param[in] phase Phase of nodal forces
+  inline std::function<void(const std::shared_ptr<mpm::NodeBase<Tdim>>&,
+                            const Eigen::Matrix<double, 2 * Tdim, 1>&)>
+      force_setter(unsigned phase) const;
+#endif
+
  protected:
   //! Mesh object
   std::shared_ptr<mpm::Mesh<Tdim>> mesh_;
   //! Time increment
   double dt_;
+  //! Analysis time at the start of the current step
+  double time_{0.};
+  //! Time increment and analysis time are assigned every step
+  bool adaptive_time_{false};
   //! MPI Size
   int mpi_size_ = 1;
   //! MPI rank
   int mpi_rank_ = 0;
+  //! Scatter particle quantities by cell colours
+  bool coloured_scatter_{false};
+  //! Overlap nodal halo exchange with particle to node scatter
+  bool overlap_halo_exchange_{false};
+  //! Fuse consecutive particle passes into single traversals
+  bool fused_kernels_{true};
 };  // MPMScheme class
 }  // namespace mpm
 
@@ -22,51 +22,95 @@ inline void mpm::MPMScheme<Tdim>::initialise() {
     // Spawn a task for initialising nodes and cells
 #pragma omp section
     {
-      // Initialise nodes
-      mesh_->iterate_over_nodes(
-          std::bind(&mpm::NodeBase<Tdim>::initialise, std::placeholders::_1));
+      // Initialise nodes which were modified in the last step
+      mesh_->initialise_nodes();
 
       mesh_->iterate_over_cells(
           std::bind(&mpm::Cell<Tdim>::activate_nodes, std::placeholders::_1));
+
+      // Create a list of active nodes
+      mesh_->find_active_nodes();
     }
     // Spawn a task for particles
 #pragma omp section
     {
-      // Iterate over each particle to compute shapefn
-      mesh_->iterate_over_particles(std::bind(
-          &mpm::ParticleBase<Tdim>::compute_shapefn, std::placeholders::_1));
+      // Iterate over each particle to compute shapefn, which is done in the
+      // mass and momentum pass when particle kernels are fused
+      if (!fused_kernels_)
+        mesh_->iterate_over_particles(std::bind(
+            &mpm::ParticleBase<Tdim>::compute_shapefn, std::placeholders::_1));
     }
   }  // Wait to complete
 }
 
+//! Iterate over particles to scatter particle quantities to nodes
+template <unsigned Tdim>
+template <typename Toper>
+inline void mpm::MPMScheme<Tdim>::scatter_particles(Toper oper) {
+  // Cells of a colour do not share nodes, so nodal updates are uncontended
+  // and nodes are not locked
+  if (coloured_scatter_)
+    mesh_->iterate_over_particles_coloured(oper);
+  else
+    mesh_->iterate_over_particles(
+        [&oper](const std::shared_ptr<mpm::ParticleBase<Tdim>>& particle) {
+          oper(particle, true);
+        });
+}
+
 //! Compute nodal kinematics - map mass and momentum to nodes
 template <unsigned Tdim>
 inline void mpm::MPMScheme<Tdim>::compute_nodal_kinematics(unsigned phase) {
+  // Shape functions are computed in the same pass with fused kernels
+  const bool fused = fused_kernels_;
+  const auto map_mass_momentum =
+      [fused](const std::shared_ptr<mpm::ParticleBase<Tdim>>& particle,
+              bool lock) {
+        if (fused) particle->compute_shapefn();
+        particle->map_mass_momentum_to_nodes(lock);
+      };
+
   // Assign mass and momentum to nodes
-  mesh_->iterate_over_particles(
-      std::bind(&mpm::ParticleBase<Tdim>::map_mass_momentum_to_nodes,
-                std::placeholders::_1));
+  if (!overlap_halo_exchange_) this->scatter_particles(map_mass_momentum);
 
 #ifdef USE_MPI
   // Run if there is more than a single MPI task
   if (mpi_size_ > 1) {
-    // MPI all reduce nodal mass
-    mesh_->template nodal_halo_exchange<double, 1>(
-        std::bind(&mpm::NodeBase<Tdim>::mass, std::placeholders::_1, phase),
-        std::bind(&mpm::NodeBase<Tdim>::update_mass, std::placeholders::_1,
-                  false, phase, std::placeholders::_2));
-    // MPI all reduce nodal momentum
-    mesh_->template nodal_halo_exchange<Eigen::Matrix<double, Tdim, 1>, Tdim>(
-        std::bind(&mpm::NodeBase<Tdim>::momentum, std::placeholders::_1, phase),
-        std::bind(&mpm::NodeBase<Tdim>::update_momentum, std::placeholders::_1,
-                  false, phase, std::placeholders::_2));
+    // Exchange nodal mass and momentum in a single message
+    using MassMomentum = Eigen::Matrix<double, Tdim + 1, 1>;
+    const auto getter =
+        [phase](const std::shared_ptr<mpm::NodeBase<Tdim>>& node) {
+          MassMomentum value;
+          value(0) = node->mass(phase);
+          value.template tail<Tdim>() = node->momentum(phase);
+          return value;
+        };
+    const auto setter = [phase](
+                            const std::shared_ptr<mpm::NodeBase<Tdim>>& node,
+                            const MassMomentum& value) {
+      node->update_mass(false, phase, value(0));
+      node->update_momentum(false, phase, value.template tail<Tdim>());
+    };
+
+    if (overlap_halo_exchange_) {
+      // Map halo particles and post the exchange, interior particles are
+      // mapped while the messages are in flight
+      const auto map_locked = std::bind(map_mass_momentum,
+                                        std::placeholders::_1, true);
+      mesh_->iterate_over_halo_particles(map_locked, true);
+      mesh_->template begin_nodal_halo_exchange<MassMomentum, Tdim + 1>(
+          getter);
+      mesh_->iterate_over_halo_particles(map_locked, false);
+      mesh_->template end_nodal_halo_exchange<MassMomentum, Tdim + 1>(getter,
+                                                                      setter);
+    } else
+      mesh_->template nodal_halo_exchange<MassMomentum, Tdim + 1>(getter,
+                                                                  setter);
   }
 #endif
 
   // Compute nodal velocity
-  mesh_->iterate_over_nodes_predicate(
-      std::bind(&mpm::NodeBase<Tdim>::compute_velocity, std::placeholders::_1),
-      std::bind(&mpm::NodeBase<Tdim>::status, std::placeholders::_1));
+  mesh_->compute_nodal_velocity();
 }
 
 //! Initialize nodes, cells and shape functions
@@ -74,29 +118,46 @@ template <unsigned Tdim>
 inline void mpm::MPMScheme<Tdim>::compute_stress_strain(
     unsigned phase, bool pressure_smoothing) {
 
-  // Iterate over each particle to calculate strain
-  mesh_->iterate_over_particles(std::bind(
-      &mpm::ParticleBase<Tdim>::compute_strain, std::placeholders::_1, dt_));
+  if (fused_kernels_) {
+    // Iterate over each particle to calculate strain and update particle
+    // volume in a single pass
+    const double dt = dt_;
+    mesh_->iterate_over_particles(
+        [dt](const std::shared_ptr<mpm::ParticleBase<Tdim>>& particle) {
+          particle->compute_strain(dt);
+          particle->update_volume();
+        });
+  } else {
+    // Iterate over each particle to calculate strain
+    mesh_->iterate_over_particles(std::bind(
+        &mpm::ParticleBase<Tdim>::compute_strain, std::placeholders::_1, dt_));
+
+    // Iterate over each particle to update particle volume
+    mesh_->iterate_over_particles(std::bind(
+        &mpm::ParticleBase<Tdim>::update_volume, std::placeholders::_1));
+  }
 
-  // Iterate over each particle to update particle volume
-  mesh_->iterate_over_particles(std::bind(
-      &mpm::ParticleBase<Tdim>::update_volume, std::placeholders::_1));
+  this->update_stress(phase, pressure_smoothing);
+}
 
+//! Update particle stress after the strain and volume are computed
+template <unsigned Tdim>
+inline void mpm::MPMScheme<Tdim>::update_stress(unsigned phase,
+                                                bool pressure_smoothing) {
   // Pressure smoothing
   if (pressure_smoothing) this->pressure_smoothing(phase);
 
-  // Iterate over each particle to compute stress
-  mesh_->iterate_over_particles(std::bind(
-      &mpm::ParticleBase<Tdim>::compute_stress, std::placeholders::_1));
+  // Compute stress of particles in batches of the same material
+  mesh_->compute_stress_batched(phase);
 }
 
 //! Pressure smoothing
 template <unsigned Tdim>
 inline void mpm::MPMScheme<Tdim>::pressure_smoothing(unsigned phase) {
   // Assign pressure to nodes
-  mesh_->iterate_over_particles(
+  this->scatter_particles(
       std::bind(&mpm::ParticleBase<Tdim>::map_pressure_to_nodes,
-                std::placeholders::_1, phase));
+                std::placeholders::_1, phase, std::placeholders::_2));
 
 #ifdef USE_MPI
   // Run if there is more than a single MPI task
@@ -119,73 +180,145 @@ template <unsigned Tdim>
 inline void mpm::MPMScheme<Tdim>::compute_forces(
     const Eigen::Matrix<double, Tdim, 1>& gravity, unsigned phase,
     unsigned step, bool concentrated_nodal_forces) {
-  // Spawn a task for external force
+  if (overlap_halo_exchange_) {
+    this->compute_forces_overlapped(gravity, phase, step,
+                                    concentrated_nodal_forces);
+    return;
+  }
+
+  if (fused_kernels_) {
+    // Iterate over each particle to compute nodal body and internal force in
+    // a single pass
+    this->scatter_particles(
+        [&gravity](const std::shared_ptr<mpm::ParticleBase<Tdim>>& particle,
+                   bool lock) {
+          particle->map_body_force(gravity, lock);
+          particle->map_internal_force(lock);
+        });
+
+    // Apply particle traction and map to nodes
+    mesh_->apply_traction_on_particles(this->current_time(step));
+
+    // Iterate over each node to add concentrated force to external
+    // force
+    if (concentrated_nodal_forces)
+      mesh_->iterate_over_nodes(
+          std::bind(&mpm::NodeBase<Tdim>::apply_concentrated_force,
+                    std::placeholders::_1, phase, this->current_time(step)));
+  } else {
+    // Spawn a task for external force
 #pragma omp parallel sections
-  {
-#pragma omp section
     {
-      // Iterate over each particle to compute nodal body force
-      mesh_->iterate_over_particles(
-          std::bind(&mpm::ParticleBase<Tdim>::map_body_force,
-                    std::placeholders::_1, gravity));
-
-      // Apply particle traction and map to nodes
-      mesh_->apply_traction_on_particles(step * dt_);
-
-      // Iterate over each node to add concentrated node force to external
-      // force
-      if (concentrated_nodal_forces)
-        mesh_->iterate_over_nodes(
-            std::bind(&mpm::NodeBase<Tdim>::apply_concentrated_force,
-                      std::placeholders::_1, phase, (step * dt_)));
-    }
+#pragma omp section
+      {
+        // Iterate over each particle to compute nodal body force
+        this->scatter_particles(
+            std::bind(&mpm::ParticleBase<Tdim>::map_body_force,
+                      std::placeholders::_1, gravity, std::placeholders::_2));
+
+        // Apply particle traction and map to nodes
+        mesh_->apply_traction_on_particles(this->current_time(step));
+
+        // Iterate over each node to add concentrated node force to
+        // external force
+        if (concentrated_nodal_forces)
+          mesh_->iterate_over_nodes(
+              std::bind(&mpm::NodeBase<Tdim>::apply_concentrated_force,
+                        std::placeholders::_1, phase,
+                        this->current_time(step)));
+      }
 
 #pragma omp section
-    {
-      // Spawn a task for internal force
-      // Iterate over each particle to compute nodal internal force
-      mesh_->iterate_over_particles(std::bind(
-          &mpm::ParticleBase<Tdim>::map_internal_force, std::placeholders::_1));
-    }
-  }  // Wait for tasks to finish
+      {
+        // Spawn a task for internal force
+        // Iterate over each particle to compute nodal internal force
+        this->scatter_particles(
+            std::bind(&mpm::ParticleBase<Tdim>::map_internal_force,
+                      std::placeholders::_1, std::placeholders::_2));
+      }
+    }  // Wait for tasks to finish
+  }
 
 #ifdef USE_MPI
   // Run if there is more than a single MPI task
-  if (mpi_size_ > 1) {
-    // MPI all reduce external force
-    mesh_->template nodal_halo_exchange<Eigen::Matrix<double, Tdim, 1>, Tdim>(
-        std::bind(&mpm::NodeBase<Tdim>::external_force, std::placeholders::_1,
-                  phase),
-        std::bind(&mpm::NodeBase<Tdim>::update_external_force,
-                  std::placeholders::_1, false, phase, std::placeholders::_2));
-    // MPI all reduce internal force
-    mesh_->template nodal_halo_exchange<Eigen::Matrix<double, Tdim, 1>, Tdim>(
-        std::bind(&mpm::NodeBase<Tdim>::internal_force, std::placeholders::_1,
-                  phase),
-        std::bind(&mpm::NodeBase<Tdim>::update_internal_force,
-                  std::placeholders::_1, false, phase, std::placeholders::_2));
-  }
+  if (mpi_size_ > 1)
+    // Exchange external and internal force in a single message
+    mesh_->template nodal_halo_exchange<Eigen::Matrix<double, 2 * Tdim, 1>,
+                                        2 * Tdim>(this->force_getter(phase),
+                                                  this->force_setter(phase));
+#endif
+}
+
+//! Compute forces overlapping the halo exchange with interior particles
+template <unsigned Tdim>
+inline void mpm::MPMScheme<Tdim>::compute_forces_overlapped(
+    const Eigen::Matrix<double, Tdim, 1>& gravity, unsigned phase,
+    unsigned step, bool concentrated_nodal_forces) {
+#ifdef USE_MPI
+  // Apply particle traction and map to nodes
+  mesh_->apply_traction_on_particles(this->current_time(step));
+
+  // Iterate over each node to add concentrated force to external force
+  if (concentrated_nodal_forces)
+    mesh_->iterate_over_nodes(
+        std::bind(&mpm::NodeBase<Tdim>::apply_concentrated_force,
+                  std::placeholders::_1, phase, this->current_time(step)));
+
+  // Map body and internal force of a particle
+  const auto map_forces =
+      [&gravity](const std::shared_ptr<mpm::ParticleBase<Tdim>>& particle) {
+        particle->map_body_force(gravity);
+        particle->map_internal_force();
+      };
+
+  // Map halo particles and post the exchange, interior particles are mapped
+  // while the messages are in flight
+  using Forces = Eigen::Matrix<double, 2 * Tdim, 1>;
+  mesh_->iterate_over_halo_particles(map_forces, true);
+  mesh_->template begin_nodal_halo_exchange<Forces, 2 * Tdim>(
+      this->force_getter(phase));
+  mesh_->iterate_over_halo_particles(map_forces, false);
+  mesh_->template end_nodal_halo_exchange<Forces, 2 * Tdim>(
+      this->force_getter(phase), this->force_setter(phase));
 #endif
 }
 
+#ifdef USE_MPI
+//! Getter of nodal external and internal force packed in a single vector
+template <unsigned Tdim>
+inline std::function<Eigen::Matrix<double, 2 * Tdim, 1>(
+    const std::shared_ptr<mpm::NodeBase<Tdim>>&)>
+    mpm::MPMScheme<Tdim>::force_getter(unsigned phase) const {
+  return [phase](const std::shared_ptr<mpm::NodeBase<Tdim>>& node) {
+    Eigen::Matrix<double, 2 * Tdim, 1> value;
+    value.template head<Tdim>() = node->external_force(phase);
+    value.template tail<Tdim>() = node->internal_force(phase);
+    return value;
+  };
+}
+
+//! Setter of nodal external and internal force packed in a single vector
+template <unsigned Tdim>
+inline std::function<void(const std::shared_ptr<mpm::NodeBase<Tdim>>&,
+                          const Eigen::Matrix<double, 2 * Tdim, 1>&)>
+    mpm::MPMScheme<Tdim>::force_setter(unsigned phase) const {
+  return [phase](const std::shared_ptr<mpm::NodeBase<Tdim>>& node,
+                 const Eigen::Matrix<double, 2 * Tdim, 1>& value) {
+    node->update_external_force(false, phase, value.template head<Tdim>());
+    node->update_internal_force(false, phase, value.template tail<Tdim>());
+  };
+}
+#endif
+
 // Compute particle kinematics
 template <unsigned Tdim>
 inline void mpm::MPMScheme<Tdim>::compute_particle_kinematics(
     bool velocity_update, unsigned phase, const std::string& damping_type,
     double damping_factor) {
 
-  // Check if damping has been specified and accordingly Iterate over
-  // active nodes to compute acceleratation and velocity
-  if (damping_type == "Cundall")
-    mesh_->iterate_over_nodes_predicate(
-        std::bind(&mpm::NodeBase<Tdim>::compute_acceleration_velocity_cundall,
-                  std::placeholders::_1, phase, dt_, damping_factor),
-        std::bind(&mpm::NodeBase<Tdim>::status, std::placeholders::_1));
-  else
-    mesh_->iterate_over_nodes_predicate(
-        std::bind(&mpm::NodeBase<Tdim>::compute_acceleration_velocity,
-                  std::placeholders::_1, phase, dt_),
-        std::bind(&mpm::NodeBase<Tdim>::status, std::placeholders::_1));
+  // Compute acceleration and velocity of active nodes
+  this->compute_nodal_acceleration_velocity(phase, damping_type,
+                                            damping_factor);
 
   // Iterate over each particle to compute updated position
   mesh_->iterate_over_particles(
@@ -196,6 +329,19 @@ inline void mpm::MPMScheme<Tdim>::compute_particle_kinematics(
   mesh_->apply_particle_velocity_constraints();
 }
 
+//! Compute acceleration and velocity of active nodes
+template <unsigned Tdim>
+inline void mpm::MPMScheme<Tdim>::compute_nodal_acceleration_velocity(
+    unsigned phase, const std::string& damping_type, double damping_factor) {
+  // Check if damping has been specified and accordingly Iterate over
+  // active nodes to compute acceleratation and velocity
+  if (damping_type == "Cundall")
+    mesh_->compute_nodal_acceleration_velocity_cundall(phase, dt_,
+                                                       damping_factor);
+  else
+    mesh_->compute_nodal_acceleration_velocity(phase, dt_);
+}
+
 // Locate particles
 template <unsigned Tdim>
 inline void mpm::MPMScheme<Tdim>::locate_particles(bool locate_particles) {
@@ -204,8 +350,12 @@ inline void mpm::MPMScheme<Tdim>::locate_particles(bool locate_particles) {
 
   if (!unlocatable_particles.empty() && locate_particles)
     throw std::runtime_error("Particle outside the mesh domain");
-  // If unable to locate particles remove particles
-  if (!unlocatable_particles.empty() && !locate_particles)
+  // If unable to locate particles remove particles in a single pass
+  if (!unlocatable_particles.empty() && !locate_particles) {
+    std::vector<mpm::Index> remove_pids;
+    remove_pids.reserve(unlocatable_particles.size());
     for (const auto& remove_particle : unlocatable_particles)
-      mesh_->remove_particle(remove_particle);
+      remove_pids.emplace_back(remove_particle->id());
+    mesh_->remove_particles(remove_pids);
+  }
 }
@@ -29,6 +29,17 @@ class MPMSchemeUSL : public MPMScheme<Tdim> {
   virtual inline void postcompute_stress_strain(
       unsigned phase, bool pressure_smoothing) override;
 
+  //! Compute acceleration velocity position
+  //! \details With fused particle kernels, the strain and volume of a
+  //! particle are updated in the same pass as its position
+  //! \param[in] velocity_update Velocity or acceleration update flag
+  //! \param[in] phase Phase of particle
+  //! \param[in] damping_type Type of damping
+  //! \param[in] damping_factor Value of critical damping
+  virtual inline void compute_particle_kinematics(
+      bool velocity_update, unsigned phase, const std::string& damping_type,
+      double damping_factor) override;
+
   //! Stress update scheme
   //! \retval scheme Stress update scheme
   virtual inline std::string scheme() const override;
@@ -42,6 +53,8 @@ class MPMSchemeUSL : public MPMScheme<Tdim> {
   using mpm::MPMScheme<Tdim>::mpi_rank_;
   //! Time increment
   using mpm::MPMScheme<Tdim>::dt_;
+  //! Fuse consecutive particle passes into single traversals
+  using mpm::MPMScheme<Tdim>::fused_kernels_;
 
 };  // MPMSchemeUSL class
 }  // namespace mpm
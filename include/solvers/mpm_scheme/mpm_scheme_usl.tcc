@@ -13,7 +13,42 @@ inline void mpm::MPMSchemeUSL<Tdim>::precompute_stress_strain(
 template <unsigned Tdim>
 inline void mpm::MPMSchemeUSL<Tdim>::postcompute_stress_strain(
     unsigned phase, bool pressure_smoothing) {
-  mpm::MPMScheme<Tdim>::compute_stress_strain(phase, pressure_smoothing);
+  // Strain and volume are updated with the particle position when particle
+  // kernels are fused
+  if (fused_kernels_)
+    this->update_stress(phase, pressure_smoothing);
+  else
+    mpm::MPMScheme<Tdim>::compute_stress_strain(phase, pressure_smoothing);
+}
+
+//! Compute particle kinematics
+template <unsigned Tdim>
+inline void mpm::MPMSchemeUSL<Tdim>::compute_particle_kinematics(
+    bool velocity_update, unsigned phase, const std::string& damping_type,
+    double damping_factor) {
+  if (!fused_kernels_) {
+    mpm::MPMScheme<Tdim>::compute_particle_kinematics(
+        velocity_update, phase, damping_type, damping_factor);
+    return;
+  }
+
+  // Compute acceleration and velocity of active nodes
+  this->compute_nodal_acceleration_velocity(phase, damping_type,
+                                            damping_factor);
+
+  // Iterate over each particle to compute updated position, strain and
+  // volume in a single pass, strain only depends on the nodal velocity
+  const double dt = dt_;
+  mesh_->iterate_over_particles(
+      [dt, velocity_update](
+          const std::shared_ptr<mpm::ParticleBase<Tdim>>& particle) {
+        particle->compute_updated_position(dt, velocity_update);
+        particle->compute_strain(dt);
+        particle->update_volume();
+      });
+
+  // Apply particle velocity constraints
+  mesh_->apply_particle_velocity_constraints();
 }
 
 //! Stress update scheme
@@ -0,0 +1,74 @@
+#include <fstream>
+#include <iostream>
+#include <string>
+
+#include "io_mesh_ascii.h"
+#include "io_mesh_binary.h"
+
+//! Convert an ascii input file to a binary input file
+//! \tparam Tdim Dimension
+//! \param[in] type Type of data in the input file
+//! \param[in] input Ascii input file
+//! \param[in] output Binary output file
+//! \retval status Return true if the file is converted
+template <unsigned Tdim>
+bool convert(const std::string& type, const std::string& input,
+             const std::string& output) {
+  auto ascii = std::make_unique<mpm::IOMeshAscii<Tdim>>();
+  auto binary = std::make_unique<mpm::IOMeshBinary<Tdim>>();
+
+  if (type == "mesh")
+    return binary->write_mesh(output, ascii->read_mesh_nodes(input),
+                              ascii->read_mesh_cells(input));
+  if (type == "particles")
+    return binary->write_particles(output, ascii->read_particles(input));
+  if (type == "particles_stresses")
+    return binary->write_particles_stresses(
+        output, ascii->read_particles_stresses(input));
+  if (type == "particles_volumes")
+    return binary->write_particles_volumes(
+        output, ascii->read_particles_volumes(input));
+  if (type == "particles_cells") {
+    binary->write_particles_cells(output, ascii->read_particles_cells(input));
+    return true;
+  }
+  if (type == "velocity_constraints")
+    return binary->write_velocity_constraints(
+        output, ascii->read_velocity_constraints(input));
+  if (type == "friction_constraints")
+    return binary->write_friction_constraints(
+        output, ascii->read_friction_constraints(input));
+  if (type == "forces")
+    return binary->write_forces(output, ascii->read_forces(input));
+  if (type == "euler_angles")
+    return binary->write_euler_angles(output, ascii->read_euler_angles(input));
+
+  std::cerr << "Invalid type of data: " << type << std::endl;
+  return false;
+}
+
+int main(int argc, char** argv) {
+  if (argc != 5) {
+    std::cerr << "Convert an ascii mesh or particle input file to the binary "
+                 "input format (io_type Binary2D / Binary3D)\n"
+              << "Usage: " << argv[0] << " <dim> <type> <input> <output>\n"
+              << "type: mesh, particles, particles_stresses, "
+                 "particles_volumes, particles_cells, velocity_constraints, "
+                 "friction_constraints, forces, euler_angles"
+              << std::endl;
+    return 1;
+  }
+
+  const std::string dim = argv[1];
+  bool status = false;
+  if (!std::ifstream(argv[3]).good())
+    std::cerr << "Unable to open file: " << argv[3] << std::endl;
+  else if (dim == "2")
+    status = convert<2>(argv[2], argv[3], argv[4]);
+  else if (dim == "3")
+    status = convert<3>(argv[2], argv[3], argv[4]);
+  else
+    std::cerr << "Invalid dimension: " << dim << std::endl;
+
+  return status ? 0 : 1;
+}
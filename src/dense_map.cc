@@ -0,0 +1,55 @@
+#include "dense_map.h"
+
+#include <stdexcept>
+
+// Construct from name and value pairs in index order
+mpm::DenseMap::DenseMap(
+    std::initializer_list<std::pair<const std::string, double>> list) {
+  auto layout = std::make_shared<Layout>();
+  layout->reserve(list.size());
+  values_.reserve(list.size());
+  for (const auto& item : list) {
+    layout->emplace_back(item.first);
+    values_.emplace_back(item.second);
+  }
+  layout_ = layout;
+}
+
+// Return value of a name, which is appended if absent
+double& mpm::DenseMap::operator[](const std::string& name) {
+  const unsigned idx = this->index(name);
+  if (idx == values_.size()) {
+    // Copy the shared layout before appending a name
+    auto layout = layout_ ? std::make_shared<Layout>(*layout_)
+                          : std::make_shared<Layout>();
+    layout->emplace_back(name);
+    layout_ = layout;
+    values_.emplace_back(0.);
+  }
+  return values_[idx];
+}
+
+// Return value of a name
+double& mpm::DenseMap::at(const std::string& name) {
+  const unsigned idx = this->index(name);
+  if (idx == values_.size())
+    throw std::out_of_range("DenseMap: no value named " + name);
+  return values_[idx];
+}
+
+// Return value of a name
+double mpm::DenseMap::at(const std::string& name) const {
+  const unsigned idx = this->index(name);
+  if (idx == values_.size())
+    throw std::out_of_range("DenseMap: no value named " + name);
+  return values_[idx];
+}
+
+// Return index of a name or size() if absent
+unsigned mpm::DenseMap::index(const std::string& name) const {
+  unsigned idx = 0;
+  if (layout_)
+    for (; idx < values_.size(); ++idx)
+      if ((*layout_)[idx] == name) break;
+  return idx;
+}
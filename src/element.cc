@@ -6,6 +6,16 @@
 #include "quadrilateral_gimp_element.h"
 #include "triangle_element.h"
 
+namespace mpm {
+// ElementType
+std::map<std::string, int> ElementType = {
+    {"ED2T3", 0}, {"ED2T6", 1}, {"ED2Q4", 2}, {"ED2Q8", 3}, {"ED2Q9", 4},
+    {"ED2Q16G", 5}, {"ED3H8", 6}, {"ED3H20", 7}, {"ED3H64G", 8}};
+std::map<int, std::string> ElementTypeName = {
+    {0, "ED2T3"}, {1, "ED2T6"}, {2, "ED2Q4"}, {3, "ED2Q8"}, {4, "ED2Q9"},
+    {5, "ED2Q16G"}, {6, "ED3H8"}, {7, "ED3H20"}, {8, "ED3H64G"}};
+}  // namespace mpm
+
 // Triangle 3-noded element
 static Register<mpm::Element<2>, mpm::TriangleElement<2, 3>> tri3("ED2T3");
 
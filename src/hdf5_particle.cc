@@ -1,4 +1,13 @@
 #include "hdf5_particle.h"
+
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+
+#ifdef USE_MPI
+#include "mpi.h"
+#endif
+
 namespace mpm {
 namespace hdf5 {
 namespace particle {
@@ -36,26 +45,6 @@ const size_t dst_offset[NFIELDS] = {
     HOFFSET(HDF5Particle, cell_id),
     HOFFSET(HDF5Particle, material_id),
     HOFFSET(HDF5Particle, nstate_vars),
-    HOFFSET(HDF5Particle, svars[0]),
-    HOFFSET(HDF5Particle, svars[1]),
-    HOFFSET(HDF5Particle, svars[2]),
-    HOFFSET(HDF5Particle, svars[3]),
-    HOFFSET(HDF5Particle, svars[4]),
-    HOFFSET(HDF5Particle, svars[5]),
-    HOFFSET(HDF5Particle, svars[6]),
-    HOFFSET(HDF5Particle, svars[7]),
-    HOFFSET(HDF5Particle, svars[8]),
-    HOFFSET(HDF5Particle, svars[9]),
-    HOFFSET(HDF5Particle, svars[10]),
-    HOFFSET(HDF5Particle, svars[11]),
-    HOFFSET(HDF5Particle, svars[12]),
-    HOFFSET(HDF5Particle, svars[13]),
-    HOFFSET(HDF5Particle, svars[14]),
-    HOFFSET(HDF5Particle, svars[15]),
-    HOFFSET(HDF5Particle, svars[16]),
-    HOFFSET(HDF5Particle, svars[17]),
-    HOFFSET(HDF5Particle, svars[18]),
-    HOFFSET(HDF5Particle, svars[19]),
 };
 
 // Get size of particle
@@ -94,26 +83,6 @@ const size_t dst_sizes[NFIELDS] = {
     sizeof(particle.cell_id),
     sizeof(particle.material_id),
     sizeof(particle.nstate_vars),
-    sizeof(particle.svars[0]),
-    sizeof(particle.svars[1]),
-    sizeof(particle.svars[2]),
-    sizeof(particle.svars[3]),
-    sizeof(particle.svars[4]),
-    sizeof(particle.svars[5]),
-    sizeof(particle.svars[6]),
-    sizeof(particle.svars[7]),
-    sizeof(particle.svars[8]),
-    sizeof(particle.svars[9]),
-    sizeof(particle.svars[10]),
-    sizeof(particle.svars[11]),
-    sizeof(particle.svars[12]),
-    sizeof(particle.svars[13]),
-    sizeof(particle.svars[14]),
-    sizeof(particle.svars[15]),
-    sizeof(particle.svars[16]),
-    sizeof(particle.svars[17]),
-    sizeof(particle.svars[18]),
-    sizeof(particle.svars[19]),
 };
 
 // Define particle field information
@@ -151,26 +120,6 @@ const char* field_names[NFIELDS] = {
     "cell_id",
     "material_id",
     "nstate_vars",
-    "svars_0",
-    "svars_1",
-    "svars_2",
-    "svars_3",
-    "svars_4",
-    "svars_5",
-    "svars_6",
-    "svars_7",
-    "svars_8",
-    "svars_9",
-    "svars_10",
-    "svars_11",
-    "svars_12",
-    "svars_13",
-    "svars_14",
-    "svars_15",
-    "svars_16",
-    "svars_17",
-    "svars_18",
-    "svars_19",
 };
 
 // Initialize field types
@@ -183,12 +132,300 @@ const hid_t field_type[NFIELDS] = {
     H5T_NATIVE_DOUBLE, H5T_NATIVE_DOUBLE, H5T_NATIVE_DOUBLE, H5T_NATIVE_DOUBLE,
     H5T_NATIVE_DOUBLE, H5T_NATIVE_DOUBLE, H5T_NATIVE_DOUBLE, H5T_NATIVE_DOUBLE,
     H5T_NATIVE_DOUBLE, H5T_NATIVE_HBOOL,  H5T_NATIVE_LLONG,  H5T_NATIVE_UINT,
-    H5T_NATIVE_UINT,   H5T_NATIVE_DOUBLE, H5T_NATIVE_DOUBLE, H5T_NATIVE_DOUBLE,
-    H5T_NATIVE_DOUBLE, H5T_NATIVE_DOUBLE, H5T_NATIVE_DOUBLE, H5T_NATIVE_DOUBLE,
-    H5T_NATIVE_DOUBLE, H5T_NATIVE_DOUBLE, H5T_NATIVE_DOUBLE, H5T_NATIVE_DOUBLE,
-    H5T_NATIVE_DOUBLE, H5T_NATIVE_DOUBLE, H5T_NATIVE_DOUBLE, H5T_NATIVE_DOUBLE,
-    H5T_NATIVE_DOUBLE, H5T_NATIVE_DOUBLE, H5T_NATIVE_DOUBLE, H5T_NATIVE_DOUBLE,
-    H5T_NATIVE_DOUBLE};
+    H5T_NATIVE_UINT};
 }  // namespace particle
 }  // namespace hdf5
 }  // namespace mpm
+
+//! Constructor with number of particles and state variables
+mpm::hdf5::particle::Columns::Columns(hsize_t nparticles, unsigned nstate_vars)
+    : nparticles_{nparticles}, nstate_vars_{nstate_vars} {
+  data_.reserve(NFIELDS + nstate_vars);
+  for (unsigned field = 0; field < NFIELDS + nstate_vars; ++field)
+    data_.emplace_back(nparticles * this->size(field));
+}
+
+//! Return the name of a field
+std::string mpm::hdf5::particle::Columns::name(unsigned field) const {
+  return (field < NFIELDS) ? field_names[field]
+                           : "svars_" + std::to_string(field - NFIELDS);
+}
+
+//! Return the HDF5 type of a field
+hid_t mpm::hdf5::particle::Columns::type(unsigned field) const {
+  return (field < NFIELDS) ? field_type[field] : H5T_NATIVE_DOUBLE;
+}
+
+//! Return the size of a value of a field
+size_t mpm::hdf5::particle::Columns::size(unsigned field) const {
+  return (field < NFIELDS) ? dst_sizes[field] : sizeof(double);
+}
+
+//! Copy the fields of a particle to the columns
+void mpm::hdf5::particle::Columns::pack(hsize_t index,
+                                        const HDF5Particle& particle) {
+  const char* src = reinterpret_cast<const char*>(&particle);
+  for (unsigned field = 0; field < NFIELDS; ++field)
+    std::memcpy(&data_[field][index * dst_sizes[field]],
+                src + dst_offset[field], dst_sizes[field]);
+  for (unsigned i = 0; i < std::min(nstate_vars_, NSVARS); ++i)
+    this->assign(NFIELDS + i, index, particle.svars[i]);
+}
+
+//! Return the fields of a particle in the columns
+mpm::HDF5Particle mpm::hdf5::particle::Columns::unpack(hsize_t index) const {
+  HDF5Particle particle;
+  char* dst = reinterpret_cast<char*>(&particle);
+  for (unsigned field = 0; field < NFIELDS; ++field)
+    std::memcpy(dst + dst_offset[field],
+                &data_[field][index * dst_sizes[field]], dst_sizes[field]);
+  if (particle.nstate_vars > std::min(nstate_vars_, NSVARS))
+    throw std::runtime_error(
+        "HDF5 particle has more state variables than can be read");
+  for (unsigned i = 0; i < particle.nstate_vars; ++i)
+    std::memcpy(&particle.svars[i],
+                &data_[NFIELDS + i][index * sizeof(double)], sizeof(double));
+  return particle;
+}
+
+//! Return the columns of a list of particles
+mpm::hdf5::particle::Columns mpm::hdf5::particle::Columns::select(
+    const std::vector<hsize_t>& indices) const {
+  Columns columns(indices.size(), nstate_vars_);
+  for (unsigned field = 0; field < this->nfields(); ++field) {
+    const size_t size = this->size(field);
+    for (hsize_t i = 0; i < indices.size(); ++i)
+      std::memcpy(&columns.data_[field][i * size],
+                  &data_[field][indices[i] * size], size);
+  }
+  return columns;
+}
+
+namespace {
+//! Create a dataset for each field of the particles of all ranks
+//! \param[in] file_id File to create the datasets in
+//! \param[in] columns Particle columns with the fields of the datasets
+//! \param[in] nglobal Number of particles of all ranks
+//! \param[in] compression Deflate level of chunked datasets (0 disables)
+void create_datasets(hid_t file_id,
+                     const mpm::hdf5::particle::Columns& columns,
+                     hsize_t nglobal, unsigned compression) {
+  // Chunk size of compressed datasets
+  const hsize_t chunk_size = 10000;
+
+  hid_t plist_id = H5Pcreate(H5P_DATASET_CREATE);
+  if (compression > 0 && nglobal > 0) {
+    const hsize_t chunk = std::min(nglobal, chunk_size);
+    H5Pset_chunk(plist_id, 1, &chunk);
+    H5Pset_deflate(plist_id, compression);
+  }
+
+  hid_t space_id = H5Screate_simple(1, &nglobal, NULL);
+  for (unsigned field = 0; field < columns.nfields(); ++field) {
+    hid_t dset_id =
+        H5Dcreate(file_id, columns.name(field).c_str(), columns.type(field),
+                  space_id, H5P_DEFAULT, plist_id, H5P_DEFAULT);
+    H5Dclose(dset_id);
+  }
+  H5Sclose(space_id);
+  H5Pclose(plist_id);
+}
+
+//! Write the columns of a rank to the datasets at an offset
+//! \param[in] file_id File with the datasets
+//! \param[in] columns Particle columns of this rank
+//! \param[in] offset Offset of the particles of this rank
+void write_datasets(hid_t file_id,
+                    const mpm::hdf5::particle::Columns& columns,
+                    hsize_t offset) {
+  hsize_t count = columns.nparticles();
+  hid_t memspace_id = H5Screate_simple(1, &count, NULL);
+  for (unsigned field = 0; field < columns.nfields(); ++field) {
+    hid_t dset_id =
+        H5Dopen(file_id, columns.name(field).c_str(), H5P_DEFAULT);
+    hid_t filespace_id = H5Dget_space(dset_id);
+    H5Sselect_hyperslab(filespace_id, H5S_SELECT_SET, &offset, NULL, &count,
+                        NULL);
+    H5Dwrite(dset_id, columns.type(field), memspace_id, filespace_id,
+             H5P_DEFAULT, columns.data(field));
+    H5Sclose(filespace_id);
+    H5Dclose(dset_id);
+  }
+  H5Sclose(memspace_id);
+}
+}  // namespace
+
+//! Write the particle columns of all MPI ranks to a single file
+bool mpm::hdf5::particle::write_columns(const std::string& filename,
+                                        const Columns& columns,
+                                        unsigned compression) {
+  // Number of particles of this rank, of lower ranks and of all ranks
+  unsigned long long nlocal = columns.nparticles();
+  unsigned long long offset = 0;
+  unsigned long long nglobal = nlocal;
+  int mpi_rank = 0;
+  int mpi_size = 1;
+#ifdef USE_MPI
+  MPI_Comm_rank(MPI_COMM_WORLD, &mpi_rank);
+  MPI_Comm_size(MPI_COMM_WORLD, &mpi_size);
+  MPI_Exscan(&nlocal, &offset, 1, MPI_UNSIGNED_LONG_LONG, MPI_SUM,
+             MPI_COMM_WORLD);
+  if (mpi_rank == 0) offset = 0;
+  MPI_Allreduce(&nlocal, &nglobal, 1, MPI_UNSIGNED_LONG_LONG, MPI_SUM,
+                MPI_COMM_WORLD);
+#endif
+
+  // The first rank creates the file and the ranks write their hyperslabs in
+  // turn
+  int token = 1;
+#ifdef USE_MPI
+  if (mpi_rank > 0)
+    MPI_Recv(&token, 1, MPI_INT, mpi_rank - 1, 0, MPI_COMM_WORLD,
+             MPI_STATUS_IGNORE);
+#endif
+  if (token) {
+    hid_t file_id =
+        (mpi_rank == 0)
+            ? H5Fcreate(filename.c_str(), H5F_ACC_TRUNC, H5P_DEFAULT,
+                        H5P_DEFAULT)
+            : H5Fopen(filename.c_str(), H5F_ACC_RDWR, H5P_DEFAULT);
+    if (file_id >= 0) {
+      if (mpi_rank == 0)
+        create_datasets(file_id, columns, nglobal, compression);
+      if (nlocal > 0) write_datasets(file_id, columns, offset);
+      H5Fclose(file_id);
+    } else
+      token = 0;
+  }
+  bool status = (token != 0);
+#ifdef USE_MPI
+  if (mpi_rank < mpi_size - 1)
+    MPI_Send(&token, 1, MPI_INT, mpi_rank + 1, 0, MPI_COMM_WORLD);
+
+  // File is complete when every rank has written its particles
+  int local_status = status;
+  int global_status = 1;
+  MPI_Allreduce(&local_status, &global_status, 1, MPI_INT, MPI_MIN,
+                MPI_COMM_WORLD);
+  status = (global_status != 0);
+#endif
+  return status;
+}
+
+//! Write the particle columns of a single process to a file
+bool mpm::hdf5::particle::write_process_columns(const std::string& filename,
+                                                const Columns& columns,
+                                                unsigned compression) {
+  hid_t file_id =
+      H5Fcreate(filename.c_str(), H5F_ACC_TRUNC, H5P_DEFAULT, H5P_DEFAULT);
+  if (file_id < 0) return false;
+  create_datasets(file_id, columns, columns.nparticles(), compression);
+  if (columns.nparticles() > 0) write_datasets(file_id, columns, 0);
+  H5Fclose(file_id);
+  return true;
+}
+
+//! Return the number of particles in a file
+hsize_t mpm::hdf5::particle::read_nparticles(const std::string& filename) {
+  hid_t file_id = H5Fopen(filename.c_str(), H5F_ACC_RDONLY, H5P_DEFAULT);
+  // Throw an error if file can't be found
+  if (file_id < 0) throw std::runtime_error("HDF5 particle file is not found");
+
+  // Number of particles from the first field
+  hsize_t nparticles = 0;
+  if (H5Lexists(file_id, field_names[0], H5P_DEFAULT) > 0) {
+    hid_t dset_id = H5Dopen(file_id, field_names[0], H5P_DEFAULT);
+    hid_t space_id = H5Dget_space(dset_id);
+    H5Sget_simple_extent_dims(space_id, &nparticles, NULL);
+    H5Sclose(space_id);
+    H5Dclose(dset_id);
+  }
+  H5Fclose(file_id);
+  return nparticles;
+}
+
+//! Read the particle columns of all particles in a file
+mpm::hdf5::particle::Columns mpm::hdf5::particle::read_columns(
+    const std::string& filename) {
+  return read_columns(filename, 0, read_nparticles(filename));
+}
+
+//! Read the particle columns of a contiguous range of particles in a file
+mpm::hdf5::particle::Columns mpm::hdf5::particle::read_columns(
+    const std::string& filename, hsize_t offset, hsize_t count) {
+  hid_t file_id = H5Fopen(filename.c_str(), H5F_ACC_RDONLY, H5P_DEFAULT);
+  // Throw an error if file can't be found
+  if (file_id < 0) throw std::runtime_error("HDF5 particle file is not found");
+
+  // State variables written to the file
+  unsigned nstate_vars = 0;
+  while (H5Lexists(file_id, ("svars_" + std::to_string(nstate_vars)).c_str(),
+                   H5P_DEFAULT) > 0)
+    ++nstate_vars;
+
+  Columns columns(count, nstate_vars);
+  hid_t memspace_id = H5Screate_simple(1, &count, NULL);
+  for (unsigned field = 0; field < columns.nfields(); ++field) {
+    const std::string name = columns.name(field);
+    if (H5Lexists(file_id, name.c_str(), H5P_DEFAULT) <= 0) {
+      H5Sclose(memspace_id);
+      H5Fclose(file_id);
+      throw std::runtime_error("HDF5 particle file has no dataset " + name);
+    }
+    hid_t dset_id = H5Dopen(file_id, name.c_str(), H5P_DEFAULT);
+    hid_t filespace_id = H5Dget_space(dset_id);
+    hsize_t nparticles = 0;
+    H5Sget_simple_extent_dims(filespace_id, &nparticles, NULL);
+    if (offset + count > nparticles) {
+      H5Sclose(filespace_id);
+      H5Dclose(dset_id);
+      H5Sclose(memspace_id);
+      H5Fclose(file_id);
+      throw std::runtime_error("HDF5 particle file has fewer particles");
+    }
+    if (count > 0) {
+      H5Sselect_hyperslab(filespace_id, H5S_SELECT_SET, &offset, NULL,
+                          &count, NULL);
+      H5Dread(dset_id, columns.type(field), memspace_id, filespace_id,
+              H5P_DEFAULT, columns.data(field));
+    }
+    H5Sclose(filespace_id);
+    H5Dclose(dset_id);
+  }
+  H5Sclose(memspace_id);
+  H5Fclose(file_id);
+  return columns;
+}
+
+//! Send particle columns to the next MPI rank and receive the columns of the
+//! previous rank
+mpm::hdf5::particle::Columns mpm::hdf5::particle::shift_columns(
+    const Columns& columns) {
+#ifdef USE_MPI
+  int mpi_rank = 0;
+  int mpi_size = 1;
+  MPI_Comm_rank(MPI_COMM_WORLD, &mpi_rank);
+  MPI_Comm_size(MPI_COMM_WORLD, &mpi_size);
+  if (mpi_size > 1) {
+    const int next = (mpi_rank + 1) % mpi_size;
+    const int previous = (mpi_rank + mpi_size - 1) % mpi_size;
+
+    unsigned long long nsend = columns.nparticles();
+    unsigned long long nreceive = 0;
+    MPI_Sendrecv(&nsend, 1, MPI_UNSIGNED_LONG_LONG, next, 0, &nreceive, 1,
+                 MPI_UNSIGNED_LONG_LONG, previous, 0, MPI_COMM_WORLD,
+                 MPI_STATUS_IGNORE);
+
+    Columns received(nreceive, columns.nstate_vars());
+    for (unsigned field = 0; field < columns.nfields(); ++field) {
+      const size_t size = columns.size(field);
+      MPI_Sendrecv(columns.data(field), static_cast<int>(nsend * size),
+                   MPI_BYTE, next, 1, received.data(field),
+                   static_cast<int>(nreceive * size), MPI_BYTE, previous, 1,
+                   MPI_COMM_WORLD, MPI_STATUS_IGNORE);
+    }
+    return received;
+  }
+#endif
+  return columns;
+}
@@ -0,0 +1,210 @@
+#include "ascii_parser.h"
+
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <stdexcept>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace {
+//! Return if a character is whitespace
+inline bool whitespace(char c) {
+  return c == ' ' || c == '\t' || c == '\r' || c == '\n' || c == '\v' ||
+         c == '\f';
+}
+
+//! Return if a character is a decimal digit
+inline bool digit(char c) { return c >= '0' && c <= '9'; }
+
+//! Return the end of a token of non whitespace characters
+//! \param[in,out] pos Position in line, moved to the start of the token
+//! \param[in] end End of line
+inline const char* token(const char*& pos, const char* end) {
+  while (pos < end && whitespace(*pos)) ++pos;
+  const char* token_end = pos;
+  while (token_end < end && !whitespace(*token_end)) ++token_end;
+  return token_end;
+}
+
+//! Parse an integer and move past it
+template <typename Tint>
+bool parse_integer(const char*& pos, const char* end, Tint& value) {
+  token(pos, end);
+  const char* p = pos;
+  bool negative = false;
+  if (p < end && (*p == '-' || *p == '+')) negative = (*p++ == '-');
+
+  const char* digits = p;
+  unsigned long long result = 0;
+  for (; p < end && digit(*p); ++p) result = result * 10 + (*p - '0');
+  if (p == digits) return false;
+
+  // Negative values wrap around as in formatted stream input
+  value = static_cast<Tint>(negative ? 0ULL - result : result);
+  pos = p;
+  return true;
+}
+
+//! Exactly representable powers of 10
+const double powers_of_10[] = {1e0,  1e1,  1e2,  1e3,  1e4,  1e5,
+                               1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+                               1e12, 1e13, 1e14, 1e15, 1e16, 1e17,
+                               1e18, 1e19, 1e20, 1e21, 1e22};
+}  // namespace
+
+//! Map a text file
+mpm::ascii::MappedText::MappedText(const std::string& filename) {
+  const int fd = ::open(filename.c_str(), O_RDONLY);
+  if (fd < 0) throw std::runtime_error("Unable to open file: " + filename);
+
+  struct stat status;
+  if (::fstat(fd, &status) != 0) {
+    ::close(fd);
+    throw std::runtime_error("Unable to read file: " + filename);
+  }
+  size_ = status.st_size;
+
+  // An empty file has no mapping
+  if (size_ > 0) {
+    void* data = ::mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (data == MAP_FAILED) {
+      ::close(fd);
+      throw std::runtime_error("Unable to map file: " + filename);
+    }
+    data_ = reinterpret_cast<char*>(data);
+    // Chunks of the file are read concurrently
+    ::madvise(data, size_, MADV_WILLNEED);
+  }
+  // The mapping stays valid after the file is closed
+  ::close(fd);
+}
+
+//! Unmap the file
+mpm::ascii::MappedText::~MappedText() {
+  if (data_ != nullptr) ::munmap(data_, size_);
+}
+
+//! Split text into chunks of whole lines
+std::vector<std::pair<const char*, const char*>> mpm::ascii::split_lines(
+    const char* begin, const char* end, std::size_t chunk_size) {
+  std::vector<std::pair<const char*, const char*>> chunks;
+  const char* pos = begin;
+  while (pos < end) {
+    const char* stop = end;
+    if (static_cast<std::size_t>(end - pos) > chunk_size) {
+      // Extend chunk to the end of the line
+      const void* newline =
+          std::memchr(pos + chunk_size, '\n', end - (pos + chunk_size));
+      if (newline != nullptr)
+        stop = reinterpret_cast<const char*>(newline) + 1;
+    }
+    chunks.emplace_back(pos, stop);
+    pos = stop;
+  }
+  return chunks;
+}
+
+//! Find the next data line and move past it
+bool mpm::ascii::next_line(const char*& pos, const char* end,
+                           const char*& line_begin, const char*& line_end) {
+  while (pos < end) {
+    line_begin = pos;
+    const void* newline = std::memchr(pos, '\n', end - pos);
+    line_end = (newline != nullptr) ? reinterpret_cast<const char*>(newline)
+                                    : end;
+    pos = (newline != nullptr) ? line_end + 1 : end;
+
+    // Trim whitespace
+    while (line_begin < line_end && whitespace(*line_begin)) ++line_begin;
+    while (line_end > line_begin && whitespace(*(line_end - 1))) --line_end;
+
+    // Ignore comment lines (# or !) or blank lines
+    const std::size_t length = line_end - line_begin;
+    if (length > 0 && std::memchr(line_begin, '#', length) == nullptr &&
+        std::memchr(line_begin, '!', length) == nullptr)
+      return true;
+  }
+  return false;
+}
+
+//! Parse a real number and move past it
+bool mpm::ascii::parse(const char*& pos, const char* end, double& value) {
+  const char* token_end = token(pos, end);
+  if (pos == token_end) return false;
+
+  // Decimal mantissa and exponent
+  const char* p = pos;
+  bool negative = false;
+  if (*p == '-' || *p == '+') negative = (*p++ == '-');
+  std::uint64_t mantissa = 0;
+  int nsignificant = 0, exponent = 0;
+  bool digits = false;
+  for (; p < token_end && digit(*p); ++p, digits = true) {
+    mantissa = mantissa * 10 + (*p - '0');
+    if (mantissa != 0) ++nsignificant;
+    if (nsignificant > 19) break;
+  }
+  if (p < token_end && *p == '.' && nsignificant <= 19) {
+    for (++p; p < token_end && digit(*p); ++p, digits = true) {
+      mantissa = mantissa * 10 + (*p - '0');
+      --exponent;
+      if (mantissa != 0) ++nsignificant;
+      if (nsignificant > 19) break;
+    }
+  }
+  if (p < token_end && (*p == 'e' || *p == 'E') && digits) {
+    ++p;
+    bool negative_exponent = false;
+    if (p < token_end && (*p == '-' || *p == '+'))
+      negative_exponent = (*p++ == '-');
+    int power = 0;
+    const char* exponent_digits = p;
+    for (; p < token_end && digit(*p); ++p)
+      if (power < 10000) power = power * 10 + (*p - '0');
+    if (p == exponent_digits) digits = false;
+    exponent += negative_exponent ? -power : power;
+  }
+
+  // A mantissa and a power of 10 that are exact give a correctly rounded
+  // result with a single multiplication or division
+  if (digits && p == token_end && nsignificant <= 19 &&
+      mantissa <= (std::uint64_t(1) << 53) && exponent >= -22 &&
+      exponent <= 22) {
+    value = static_cast<double>(mantissa);
+    if (exponent < 0)
+      value /= powers_of_10[-exponent];
+    else
+      value *= powers_of_10[exponent];
+    if (negative) value = -value;
+    pos = token_end;
+    return true;
+  }
+
+  // Other numbers are converted by strtod
+  const std::string number(pos, token_end);
+  char* number_end = nullptr;
+  const double result = std::strtod(number.c_str(), &number_end);
+  if (number_end == number.c_str()) return false;
+  value = result;
+  pos += (number_end - number.c_str());
+  return true;
+}
+
+//! Parse an index and move past it
+bool mpm::ascii::parse(const char*& pos, const char* end, mpm::Index& value) {
+  return parse_integer(pos, end, value);
+}
+
+//! Parse an unsigned integer and move past it
+bool mpm::ascii::parse(const char*& pos, const char* end, unsigned& value) {
+  return parse_integer(pos, end, value);
+}
+
+//! Parse an integer and move past it
+bool mpm::ascii::parse(const char*& pos, const char* end, int& value) {
+  return parse_integer(pos, end, value);
+}
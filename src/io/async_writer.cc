@@ -0,0 +1,76 @@
+#include "async_writer.h"
+
+#include <algorithm>
+
+#include "logger.h"
+
+//! Constructor with capacity
+mpm::AsyncWriter::AsyncWriter(unsigned capacity)
+    : capacity_{std::max(capacity, 1u)} {
+  // Logger
+  console_ = std::make_unique<spdlog::logger>("AsyncWriter", mpm::stdout_sink);
+  // Start the writer thread after the queue is initialised
+  thread_ = std::thread(&mpm::AsyncWriter::run, this);
+}
+
+//! Destructor writes pending tasks and stops the writer thread
+mpm::AsyncWriter::~AsyncWriter() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stop_ = true;
+  }
+  task_added_.notify_one();
+  thread_.join();
+}
+
+//! Add an output task, blocks while the queue is full
+void mpm::AsyncWriter::push(std::function<void()> task) {
+  std::unique_lock<std::mutex> lock(mutex_);
+  // Back-pressure: wait for the writer to finish a pending task
+  task_done_.wait(lock, [this]() {
+    return (tasks_.size() + (running_ ? 1 : 0)) < capacity_;
+  });
+  tasks_.emplace_back(std::move(task));
+  lock.unlock();
+  task_added_.notify_one();
+}
+
+//! Wait until all pending tasks are written
+void mpm::AsyncWriter::wait() {
+  std::unique_lock<std::mutex> lock(mutex_);
+  task_done_.wait(lock, [this]() { return tasks_.empty() && !running_; });
+}
+
+//! Return number of pending (queued or running) tasks
+unsigned mpm::AsyncWriter::npending() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return tasks_.size() + (running_ ? 1 : 0);
+}
+
+//! Run output tasks until the writer is stopped
+void mpm::AsyncWriter::run() {
+  while (true) {
+    std::function<void()> task;
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+      task_added_.wait(lock, [this]() { return stop_ || !tasks_.empty(); });
+      // Pending tasks are written before the writer stops
+      if (tasks_.empty()) break;
+      task = std::move(tasks_.front());
+      tasks_.pop_front();
+      running_ = true;
+    }
+
+    try {
+      task();
+    } catch (std::exception& exception) {
+      console_->error("{} #{}: {}\n", __FILE__, __LINE__, exception.what());
+    }
+
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      running_ = false;
+    }
+    task_done_.notify_all();
+  }
+}
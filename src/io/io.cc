@@ -96,31 +96,19 @@ boost::filesystem::path mpm::IO::output_file(const std::string& attribute,
                                              const std::string& analysis_id,
                                              unsigned step, unsigned max_steps,
                                              bool parallel) {
-  std::stringstream file_name;
   std::string path = this->output_folder();
 
-  file_name.str(std::string());
-  file_name << attribute;
-
+  int mpi_rank = 0;
+  int mpi_size = 1;
 #ifdef USE_MPI
-  int mpi_rank;
-  MPI_Comm_rank(MPI_COMM_WORLD, &mpi_rank);
-  // Get number of MPI ranks
-  int mpi_size;
-  MPI_Comm_size(MPI_COMM_WORLD, &mpi_size);
-
-  if (mpi_size > 1 && parallel) {
-    const std::string rank_size =
-        "-" + std::to_string(mpi_rank) + "_" + std::to_string(mpi_size) + "-";
-    file_name << rank_size;
+  if (parallel) {
+    MPI_Comm_rank(MPI_COMM_WORLD, &mpi_rank);
+    // Get number of MPI ranks
+    MPI_Comm_size(MPI_COMM_WORLD, &mpi_size);
   }
 #endif
-
-  file_name.fill('0');
-  int digits = log10(max_steps) + 1;
-  file_name.width(digits);
-  file_name << step;
-  file_name << file_extension;
+  const std::string file_name = output_file_name(
+      attribute, file_extension, step, max_steps, mpi_rank, mpi_size);
 
   // Include path
   if (!path.empty()) path = working_dir_ + path;
@@ -134,10 +122,29 @@ boost::filesystem::path mpm::IO::output_file(const std::string& attribute,
   dir = path;
   if (!boost::filesystem::exists(dir)) boost::filesystem::create_directory(dir);
 
-  boost::filesystem::path file_path(path + file_name.str().c_str());
+  boost::filesystem::path file_path(path + file_name);
   return file_path;
 }
 
+//! Return output file name of a step without its path
+std::string mpm::IO::output_file_name(const std::string& attribute,
+                                      const std::string& file_extension,
+                                      unsigned step, unsigned max_steps,
+                                      int mpi_rank, int mpi_size) {
+  std::stringstream file_name;
+  file_name << attribute;
+
+  if (mpi_size > 1)
+    file_name << "-" << mpi_rank << "_" << mpi_size << "-";
+
+  file_name.fill('0');
+  int digits = log10(max_steps) + 1;
+  file_name.width(digits);
+  file_name << step;
+  file_name << file_extension;
+  return file_name.str();
+}
+
 //! Return output folder
 std::string mpm::IO::output_folder() const {
   std::string path{"results/"};
@@ -1,9 +1,18 @@
 #include "io_mesh.h"
 #include "factory.h"
 #include "io_mesh_ascii.h"
+#include "io_mesh_binary.h"
 
 // IOMeshAscii
 static Register<mpm::IOMesh<2>, mpm::IOMeshAscii<2>> iomesh_ascii_2d("Ascii2D");
 
 // IOMeshAscii
 static Register<mpm::IOMesh<3>, mpm::IOMeshAscii<3>> iomesh_ascii_3d("Ascii3D");
+
+// IOMeshBinary
+static Register<mpm::IOMesh<2>, mpm::IOMeshBinary<2>> iomesh_binary_2d(
+    "Binary2D");
+
+// IOMeshBinary
+static Register<mpm::IOMesh<3>, mpm::IOMeshBinary<3>> iomesh_binary_3d(
+    "Binary3D");
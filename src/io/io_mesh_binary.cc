@@ -0,0 +1,136 @@
+#include "io_mesh_binary.h"
+
+#include <fstream>
+#include <stdexcept>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace {
+// Signature of binary input files
+const char signature[8] = {'M', 'P', 'M', 'B', 'I', 'N', '\0', '\0'};
+// Version of the layout
+const std::uint32_t version = 1;
+
+static_assert(sizeof(mpm::binary::Header) == 40,
+              "Header of binary input files is not packed");
+static_assert(sizeof(mpm::Index) == sizeof(std::uint64_t),
+              "Ids of binary input files are not 64 bit");
+
+//! Return if the host is little-endian
+bool little_endian() {
+  const std::uint16_t one = 1;
+  return *reinterpret_cast<const char*>(&one) == 1;
+}
+}  // namespace
+
+//! Return header of a binary input file
+mpm::binary::Header mpm::binary::header(FileType type, unsigned dim,
+                                        std::uint64_t nrecords,
+                                        std::uint64_t ncells,
+                                        unsigned nnodes_per_cell) {
+  Header header;
+  std::memcpy(header.signature, signature, sizeof(signature));
+  header.version = version;
+  header.type = static_cast<std::uint32_t>(type);
+  header.dim = dim;
+  header.nnodes_per_cell = nnodes_per_cell;
+  header.nrecords = nrecords;
+  header.ncells = ncells;
+  return header;
+}
+
+//! Map a binary input file
+mpm::binary::MappedFile::MappedFile(const std::string& filename,
+                                    FileType type, unsigned dim) {
+  if (!little_endian())
+    throw std::runtime_error("Binary input files are little-endian");
+
+  const int fd = ::open(filename.c_str(), O_RDONLY);
+  if (fd < 0) throw std::runtime_error("Unable to open file: " + filename);
+
+  struct stat status;
+  if (::fstat(fd, &status) != 0 ||
+      static_cast<std::size_t>(status.st_size) < sizeof(Header)) {
+    ::close(fd);
+    throw std::runtime_error("Invalid binary input file: " + filename);
+  }
+  size_ = status.st_size;
+
+  data_ = ::mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+  // The mapping stays valid after the file is closed
+  ::close(fd);
+  if (data_ == MAP_FAILED) {
+    data_ = nullptr;
+    throw std::runtime_error("Unable to map file: " + filename);
+  }
+  // Blocks are read once in order
+  ::madvise(data_, size_, MADV_SEQUENTIAL);
+
+  const auto& header = this->header();
+  std::string error;
+  if (std::memcmp(header.signature, signature, sizeof(signature)) != 0 ||
+      header.version != version)
+    error = "Invalid binary input file: ";
+  else if (header.type != static_cast<std::uint32_t>(type))
+    error = "Invalid type of data in binary input file: ";
+  else if (header.dim != dim)
+    error = "Invalid dimension of binary input file: ";
+  if (!error.empty()) {
+    ::munmap(data_, size_);
+    data_ = nullptr;
+    throw std::runtime_error(error + filename);
+  }
+}
+
+//! Unmap the file
+mpm::binary::MappedFile::~MappedFile() {
+  if (data_ != nullptr) ::munmap(data_, size_);
+}
+
+//! Return header
+const mpm::binary::Header& mpm::binary::MappedFile::header() const {
+  return *reinterpret_cast<const Header*>(data_);
+}
+
+//! Return a block of data
+const char* mpm::binary::MappedFile::data(std::size_t offset,
+                                          std::size_t nbytes) const {
+  // Size of the file after the header, compared without overflow
+  const std::size_t size = size_ - sizeof(Header);
+  if (offset > size || nbytes > size - offset)
+    throw std::runtime_error("Binary input file is truncated");
+  return reinterpret_cast<const char*>(data_) + sizeof(Header) + offset;
+}
+
+//! Return size in bytes of a block of records
+std::size_t mpm::binary::MappedFile::nbytes(std::size_t offset,
+                                            std::uint64_t nrecords,
+                                            std::size_t record_size) const {
+  const std::size_t size = size_ - sizeof(Header);
+  if (offset > size ||
+      (record_size != 0 && nrecords > (size - offset) / record_size))
+    throw std::runtime_error("Binary input file is truncated");
+  return static_cast<std::size_t>(nrecords) * record_size;
+}
+
+//! Write a binary input file
+void mpm::binary::write(
+    const std::string& filename, const Header& header,
+    const std::vector<std::pair<const void*, std::size_t>>& blocks) {
+  if (!little_endian())
+    throw std::runtime_error("Binary input files are little-endian");
+
+  std::ofstream file(filename, std::ios::binary);
+  if (!file.is_open())
+    throw std::runtime_error("Unable to open file: " + filename);
+
+  file.write(reinterpret_cast<const char*>(&header), sizeof(Header));
+  for (const auto& block : blocks)
+    file.write(reinterpret_cast<const char*>(block.first), block.second);
+
+  file.close();
+  if (!file) throw std::runtime_error("Failed to write file: " + filename);
+}
@@ -0,0 +1,258 @@
+#include "vtp_writer.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+
+#ifdef USE_ZLIB
+#include <zlib.h>
+#endif
+
+#include "logger.h"
+
+namespace {
+// Size of the uncompressed blocks, as used by vtkZLibDataCompressor
+const std::size_t block_size = 32768;
+
+//! Return byte order of the host
+std::string byte_order() {
+  const std::uint16_t one = 1;
+  return (*reinterpret_cast<const char*>(&one) == 1) ? "LittleEndian"
+                                                      : "BigEndian";
+}
+
+//! Append a header value to an encoded array
+void append_header(std::vector<char>* encoded, std::uint64_t value) {
+  const char* bytes = reinterpret_cast<const char*>(&value);
+  encoded->insert(encoded->end(), bytes, bytes + sizeof(value));
+}
+}  // namespace
+
+//! Constructor with point coordinates
+mpm::VtpWriter::VtpWriter(
+    const std::vector<Eigen::Matrix<double, 3, 1>>& coordinates,
+    bool compression)
+    : npoints_{coordinates.size()}, compression_{compression} {
+  // Logger
+  console_ = std::make_unique<spdlog::logger>("VtpWriter", mpm::stdout_sink);
+
+  if (compression_ && !compression_available()) {
+    console_->warn("zlib is not available, arrays are written uncompressed");
+    compression_ = false;
+  }
+
+  points_ = DataArray{"Points", "Float64", 3,
+                      reinterpret_cast<const char*>(coordinates.data()),
+                      coordinates.size() * 3 * sizeof(double)};
+}
+
+//! Return if zlib compression is available
+bool mpm::VtpWriter::compression_available() {
+#ifdef USE_ZLIB
+  return true;
+#else
+  return false;
+#endif
+}
+
+//! Add scalar point data
+bool mpm::VtpWriter::add_point_data(const std::string& name,
+                                    const std::vector<double>& data) {
+  return this->add_point_data(name, data.data(), data.size(), 1);
+}
+
+//! Add point data from a contiguous buffer
+bool mpm::VtpWriter::add_point_data(const std::string& name,
+                                    const double* data, std::size_t size,
+                                    unsigned ncomponents) {
+  bool status = true;
+  try {
+    if (size != npoints_)
+      throw std::runtime_error("Size of point data '" + name +
+                               "' does not match the number of points");
+
+    point_data_.emplace_back(
+        DataArray{name, "Float64", ncomponents,
+                  reinterpret_cast<const char*>(data),
+                  size * ncomponents * sizeof(double)});
+  } catch (std::exception& exception) {
+    console_->error("{} #{}: {}\n", __FILE__, __LINE__, exception.what());
+    status = false;
+  }
+  return status;
+}
+
+//! Add lines between pairs of points
+void mpm::VtpWriter::add_lines(
+    const std::vector<std::array<mpm::Index, 2>>& pairs) {
+  static_assert(sizeof(mpm::Index) == sizeof(std::int64_t),
+                "Line connectivity is not written as Int64");
+
+  // Each line ends two points after the previous one
+  line_offsets_.resize(pairs.size());
+  for (std::size_t i = 0; i < pairs.size(); ++i)
+    line_offsets_[i] = 2 * (i + 1);
+
+  lines_.clear();
+  lines_.emplace_back(DataArray{"connectivity", "Int64", 1,
+                                reinterpret_cast<const char*>(pairs.data()),
+                                pairs.size() * 2 * sizeof(mpm::Index)});
+  lines_.emplace_back(
+      DataArray{"offsets", "Int64", 1,
+                reinterpret_cast<const char*>(line_offsets_.data()),
+                line_offsets_.size() * sizeof(mpm::Index)});
+}
+
+//! Return name and number of components of each point data attribute
+std::vector<std::pair<std::string, unsigned>> mpm::VtpWriter::point_data()
+    const {
+  std::vector<std::pair<std::string, unsigned>> attributes;
+  for (const auto& array : point_data_)
+    attributes.emplace_back(array.name, array.ncomponents);
+  return attributes;
+}
+
+//! Compress an array as written to the appended data section
+std::vector<char> mpm::VtpWriter::compress(const DataArray& array) const {
+  std::vector<char> encoded;
+#ifdef USE_ZLIB
+  // Compress each block of the data
+  const std::size_t nblocks = (array.nbytes + block_size - 1) / block_size;
+  std::vector<std::vector<char>> blocks(nblocks);
+  for (std::size_t i = 0; i < nblocks; ++i) {
+    const std::size_t offset = i * block_size;
+    const std::size_t size = std::min(block_size, array.nbytes - offset);
+    uLongf compressed_size = compressBound(size);
+    blocks[i].resize(compressed_size);
+    if (compress2(reinterpret_cast<Bytef*>(blocks[i].data()),
+                  &compressed_size,
+                  reinterpret_cast<const Bytef*>(array.data + offset), size,
+                  Z_DEFAULT_COMPRESSION) != Z_OK)
+      throw std::runtime_error("Compression of '" + array.name + "' failed");
+    blocks[i].resize(compressed_size);
+  }
+
+  // Number of blocks, block size, size of the last partial block (0 if the
+  // last block is full) and compressed size of each block
+  append_header(&encoded, nblocks);
+  append_header(&encoded, block_size);
+  append_header(&encoded, array.nbytes % block_size);
+  for (const auto& block : blocks) append_header(&encoded, block.size());
+  for (const auto& block : blocks)
+    encoded.insert(encoded.end(), block.begin(), block.end());
+#endif
+  return encoded;
+}
+
+//! Write PolyData (.vtp) file
+bool mpm::VtpWriter::write(const std::string& filename) const {
+  bool status = true;
+  try {
+    // Arrays in the order they are appended
+    std::vector<const DataArray*> arrays;
+    for (const auto& array : point_data_) arrays.emplace_back(&array);
+    arrays.emplace_back(&points_);
+    for (const auto& array : lines_) arrays.emplace_back(&array);
+
+    // Find offsets of the arrays in the appended data, an uncompressed array
+    // is its size followed by the data and is written from its buffer
+    std::vector<std::vector<char>> compressed;
+    std::vector<std::size_t> offsets;
+    std::size_t offset = 0;
+    for (const auto* array : arrays) {
+      offsets.emplace_back(offset);
+      if (compression_) {
+        compressed.emplace_back(this->compress(*array));
+        offset += compressed.back().size();
+      } else
+        offset += sizeof(std::uint64_t) + array->nbytes;
+    }
+
+    // Data array element referring to the appended data
+    const auto data_array = [&](unsigned i) {
+      std::string element = "<DataArray type=\"" + arrays[i]->type +
+                            "\" Name=\"" + arrays[i]->name + "\"";
+      if (arrays[i]->ncomponents != 1)
+        element += " NumberOfComponents=\"" +
+                   std::to_string(arrays[i]->ncomponents) + "\"";
+      element += " format=\"appended\" offset=\"" +
+                 std::to_string(offsets[i]) + "\"/>\n";
+      return element;
+    };
+
+    std::stringstream header;
+    header << "<?xml version=\"1.0\"?>\n<VTKFile type=\"PolyData\" "
+           << "version=\"1.0\" byte_order=\"" << byte_order()
+           << "\" header_type=\"UInt64\"";
+    if (compression_) header << " compressor=\"vtkZLibDataCompressor\"";
+    header << ">\n<PolyData>\n<Piece NumberOfPoints=\"" << npoints_
+           << "\" NumberOfVerts=\"0\" NumberOfLines=\"" << line_offsets_.size()
+           << "\" NumberOfStrips=\"0\" NumberOfPolys=\"0\">\n<PointData>\n";
+    unsigned i = 0;
+    for (; i < point_data_.size(); ++i) header << data_array(i);
+    header << "</PointData>\n<Points>\n" << data_array(i++) << "</Points>\n";
+    if (!lines_.empty()) {
+      header << "<Lines>\n";
+      for (; i < arrays.size(); ++i) header << data_array(i);
+      header << "</Lines>\n";
+    }
+    header << "</Piece>\n</PolyData>\n<AppendedData encoding=\"raw\">\n_";
+
+    std::ofstream file(filename, std::ios::binary);
+    if (!file.is_open())
+      throw std::runtime_error("Unable to open file: " + filename);
+    file << header.str();
+    for (unsigned j = 0; j < arrays.size(); ++j) {
+      if (compression_)
+        file.write(compressed[j].data(), compressed[j].size());
+      else {
+        const std::uint64_t nbytes = arrays[j]->nbytes;
+        file.write(reinterpret_cast<const char*>(&nbytes), sizeof(nbytes));
+        file.write(arrays[j]->data, nbytes);
+      }
+    }
+    file << "\n</AppendedData>\n</VTKFile>\n";
+    file.close();
+    if (!file) throw std::runtime_error("Failed to write file: " + filename);
+  } catch (std::exception& exception) {
+    console_->error("{} #{}: {}\n", __FILE__, __LINE__, exception.what());
+    status = false;
+  }
+  return status;
+}
+
+//! Write parallel PolyData (.pvtp) container file of the pieces of all ranks
+bool mpm::VtpWriter::write_parallel(
+    const std::string& filename, const std::vector<std::string>& pieces) const {
+  bool status = true;
+  try {
+    std::stringstream pvtp;
+    pvtp << "<?xml version=\"1.0\"?>\n<VTKFile type=\"PPolyData\" "
+         << "version=\"1.0\" byte_order=\"" << byte_order()
+         << "\" header_type=\"UInt64\">\n<PPolyData GhostLevel=\"0\">\n"
+         << "<PPointData>\n";
+    for (const auto& array : point_data_) {
+      pvtp << "<PDataArray type=\"" << array.type << "\" Name=\""
+           << array.name << "\"";
+      if (array.ncomponents != 1)
+        pvtp << " NumberOfComponents=\"" << array.ncomponents << "\"";
+      pvtp << "/>\n";
+    }
+    pvtp << "</PPointData>\n<PPoints>\n<PDataArray type=\"" << points_.type
+         << "\" Name=\"Points\" NumberOfComponents=\"3\"/>\n</PPoints>\n";
+    for (const auto& piece : pieces)
+      pvtp << "<Piece Source=\"" << piece << "\"/>\n";
+    pvtp << "</PPolyData>\n</VTKFile>\n";
+
+    std::ofstream file(filename);
+    if (!file.is_open())
+      throw std::runtime_error("Unable to open file: " + filename);
+    file << pvtp.str();
+  } catch (std::exception& exception) {
+    console_->error("{} #{}: {}\n", __FILE__, __LINE__, exception.what());
+    status = false;
+  }
+  return status;
+}
@@ -0,0 +1,28 @@
+#include "load_balance.h"
+
+#include <algorithm>
+#include <numeric>
+
+//! Return the imbalance of loads
+double mpm::load_balance::imbalance(const std::vector<double>& loads) {
+  if (loads.empty()) return 0.;
+  const double mean =
+      std::accumulate(loads.begin(), loads.end(), 0.) / loads.size();
+  if (mean <= 0.) return 0.;
+  return *std::max_element(loads.begin(), loads.end()) / mean - 1.;
+}
+
+//! Return the load to send from a rank to each of its neighbour ranks
+std::map<unsigned, double> mpm::load_balance::diffusive_flows(
+    unsigned rank, const std::set<unsigned>& neighbours,
+    const std::vector<double>& loads, const std::vector<unsigned>& degrees) {
+  std::map<unsigned, double> flows;
+  for (const auto neighbour : neighbours) {
+    if (neighbour == rank || neighbour >= loads.size()) continue;
+    const double difference = loads[rank] - loads[neighbour];
+    if (difference <= 0.) continue;
+    flows[neighbour] =
+        difference / (std::max(degrees[rank], degrees[neighbour]) + 1);
+  }
+  return flows;
+}
@@ -19,13 +19,6 @@ int main(int argc, char** argv) {
   // Get number of MPI ranks
   int mpi_size;
   MPI_Comm_size(MPI_COMM_WORLD, &mpi_size);
-
-  // Allocate enough space to issue the buffered send
-  int mpi_buffer_size = 2000000000;
-  void* mpi_buffer = malloc(mpi_buffer_size);
-  // Pass the buffer allocated to MPI so it uses it when we issue MPI_Bsend
-  MPI_Buffer_attach(mpi_buffer, mpi_buffer_size);
-
 #endif
 
   try {
@@ -57,16 +50,12 @@ int main(int argc, char** argv) {
   } catch (std::exception& exception) {
     std::cerr << "MPM main: " << exception.what() << std::endl;
 #ifdef USE_MPI
-    free(mpi_buffer);
-    MPI_Buffer_detach(&mpi_buffer, &mpi_buffer_size);
     MPI_Abort(MPI_COMM_WORLD, 1);
 #endif
     std::terminate();
   }
 
 #ifdef USE_MPI
-  free(mpi_buffer);
-  MPI_Buffer_detach(&mpi_buffer, &mpi_buffer_size);
   MPI_Finalize();
 #endif
 }
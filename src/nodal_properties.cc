@@ -1,5 +1,19 @@
 #include "nodal_properties.h"
 
+#include <stdexcept>
+
+// Constructor
+mpm::NodalProperties::NodalProperties() {
+  // Handles of the properties of multimaterial contact are reserved
+  const std::vector<std::string> names = {
+      "masses",          "momenta",            "change_in_momenta",
+      "displacements",   "separation_vectors", "domain_gradients",
+      "normal_unit_vectors"};
+  for (unsigned handle = 0; handle < names.size(); ++handle)
+    handles_.emplace(names[handle], handle);
+  data_.resize(NProperties, nullptr);
+}
+
 // Function to create new property with given name and size (rows x cols)
 bool mpm::NodalProperties::create_property(const std::string& property,
                                            unsigned rows, unsigned columns) {
@@ -9,9 +23,29 @@ bool mpm::NodalProperties::create_property(const std::string& property,
   std::pair<std::map<std::string, Eigen::MatrixXd>::iterator, bool> status =
       properties_.insert(
           std::pair<std::string, Eigen::MatrixXd>(property, property_data));
+
+  if (status.second) {
+    // Assign a handle to a property which is not reserved, the data of an
+    // element of the map is not moved on insertion
+    auto handle = handles_.find(property);
+    if (handle == handles_.end()) {
+      handle = handles_.emplace(property, data_.size()).first;
+      data_.emplace_back(nullptr);
+    }
+    data_[handle->second] = &status.first->second;
+  }
   return status.second;
 }
 
+// Return the handle of a property
+unsigned mpm::NodalProperties::handle(const std::string& property) const {
+  const auto handle = handles_.find(property);
+  if (handle == handles_.end() || data_[handle->second] == nullptr)
+    throw std::out_of_range("Nodal property " + property +
+                            " has not been created");
+  return handle->second;
+}
+
 // Return data in the nodal properties map at a specific index
 Eigen::MatrixXd mpm::NodalProperties::property(const std::string& property,
                                                unsigned node_id,
@@ -40,22 +74,15 @@ void mpm::NodalProperties::update_property(
     const Eigen::MatrixXd& property_value, unsigned nprops) {
   // Update a property value matrix with dimensions nprops x 1 considering its
   // proper location in the properties_ matrix that stores all nodal properties
-  properties_.at(property).block(node_id * nprops, mat_id, nprops, 1) =
-      property_value + this->property(property, node_id, mat_id, nprops);
+  properties_.at(property).block(node_id * nprops, mat_id, nprops, 1) +=
+      property_value;
 }
 
 // Initialise all the nodal values for all properties in the property pool
 void mpm::NodalProperties::initialise_nodal_properties() {
-  // Iterate over all properties in the property map
+  // Iterate over all properties in the property map and set the values of
+  // all nodes and materials to zero in place
   for (auto prop_itr = properties_.begin(); prop_itr != properties_.end();
-       ++prop_itr) {
-    // Create Matrix with zero values that has same size of the current property
-    // in the iteration. The referred size is equal to rows * cols, where:
-    // rows = number of nodes * size of property (1 if property is scalar, Tdim
-    // if property is vector)
-    // cols = number of materials
-    Eigen::MatrixXd zeroed_property =
-        Eigen::MatrixXd::Zero(prop_itr->second.rows(), prop_itr->second.cols());
-    this->assign_property(prop_itr->first, 0, 0, zeroed_property);
-  }
+       ++prop_itr)
+    prop_itr->second.setZero();
 }
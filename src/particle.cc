@@ -17,3 +17,15 @@ static Register<mpm::ParticleBase<2>, mpm::Particle<2>, mpm::Index,
 static Register<mpm::ParticleBase<3>, mpm::Particle<3>, mpm::Index,
                 const Eigen::Matrix<double, 3, 1>&>
     particle3d("P3D");
+
+// Particle2D (2 Dim) in a particle store
+static Register<mpm::ParticleBase<2>, mpm::Particle<2>, mpm::Index,
+                const Eigen::Matrix<double, 2, 1>&,
+                const std::shared_ptr<mpm::ParticleStore<2>>&>
+    particle2d_store("P2D");
+
+// Particle3D (3 Dim) in a particle store
+static Register<mpm::ParticleBase<3>, mpm::Particle<3>, mpm::Index,
+                const Eigen::Matrix<double, 3, 1>&,
+                const std::shared_ptr<mpm::ParticleStore<3>>&>
+    particle3d_store("P3D");
@@ -0,0 +1,146 @@
+#include <array>
+#include <atomic>
+#include <cstdlib>
+#include <memory>
+#include <new>
+#include <vector>
+
+#include "Eigen/Dense"
+#include "catch.hpp"
+
+#include "cell.h"
+#include "element.h"
+#include "hexahedron_element.h"
+#include "node.h"
+#include "particle.h"
+#include "quadrilateral_element.h"
+
+namespace mpm_test {
+//! Count heap allocations while enabled
+std::atomic<bool> count_allocations{false};
+//! Number of heap allocations
+std::atomic<std::size_t> nallocations{0};
+}  // namespace mpm_test
+
+//! Replace global operator new to count heap allocations, this executable is
+//! kept apart from mpmtest so that other tests use the default allocator
+void* operator new(std::size_t size) {
+  if (mpm_test::count_allocations) ++mpm_test::nallocations;
+  if (void* ptr = std::malloc(size ? size : 1)) return ptr;
+  throw std::bad_alloc();
+}
+
+void operator delete(void* ptr) noexcept { std::free(ptr); }
+
+void operator delete(void* ptr, std::size_t) noexcept { std::free(ptr); }
+
+//! \brief Check particle kernels do not allocate for 2D case
+TEST_CASE("Particle kernels are checked for allocation for 2D case",
+          "[particle][allocation][2D]") {
+  // Dimension
+  const unsigned Dim = 2;
+  // Degree of freedom
+  const unsigned Dof = 2;
+  // Number of phases
+  const unsigned Nphases = 1;
+  // Number of nodes per cell
+  const unsigned Nnodes = 4;
+  // Time step
+  const double dt = 0.01;
+
+  // Element
+  std::shared_ptr<mpm::Element<Dim>> element =
+      std::make_shared<mpm::QuadrilateralElement<Dim, 4>>();
+
+  // Create a distorted cell
+  auto cell = std::make_shared<mpm::Cell<Dim>>(10, Nnodes, element);
+  Eigen::Vector2d coords;
+  std::vector<std::shared_ptr<mpm::NodeBase<Dim>>> nodes;
+  const std::vector<std::array<double, Dim>> ncoords = {
+      {0.5, 0.5}, {1.75, 0.5}, {1.5, 1.75}, {0.5, 1.5}};
+  for (unsigned i = 0; i < Nnodes; ++i) {
+    coords << ncoords[i][0], ncoords[i][1];
+    nodes.emplace_back(
+        std::make_shared<mpm::Node<Dim, Dof, Nphases>>(i, coords));
+    cell->add_node(i, nodes.back());
+  }
+  REQUIRE(cell->initialise() == true);
+
+  // Particle
+  coords << 0.9, 0.8;
+  std::shared_ptr<mpm::ParticleBase<Dim>> particle =
+      std::make_shared<mpm::Particle<Dim>>(0, coords);
+  REQUIRE(particle->assign_cell(cell) == true);
+  REQUIRE(particle->assign_volume(1.0) == true);
+  particle->assign_mass(1000.);
+
+  // Shape function buffers are sized by the element on the first step
+  particle->compute_shapefn();
+
+  SECTION("Check shape functions and mapping do not allocate") {
+    mpm_test::nallocations = 0;
+    mpm_test::count_allocations = true;
+    particle->compute_shapefn();
+    particle->map_mass_momentum_to_nodes();
+    particle->compute_strain(dt);
+    particle->map_internal_force();
+    mpm_test::count_allocations = false;
+    REQUIRE(mpm_test::nallocations == 0);
+  }
+}
+
+//! \brief Check particle kernels do not allocate for 3D case
+TEST_CASE("Particle kernels are checked for allocation for 3D case",
+          "[particle][allocation][3D]") {
+  // Dimension
+  const unsigned Dim = 3;
+  // Degree of freedom
+  const unsigned Dof = 3;
+  // Number of phases
+  const unsigned Nphases = 1;
+  // Number of nodes per cell
+  const unsigned Nnodes = 8;
+  // Time step
+  const double dt = 0.01;
+
+  // Element
+  std::shared_ptr<mpm::Element<Dim>> element =
+      std::make_shared<mpm::HexahedronElement<Dim, 8>>();
+
+  // Create a unit cell
+  auto cell = std::make_shared<mpm::Cell<Dim>>(10, Nnodes, element);
+  Eigen::Vector3d coords;
+  std::vector<std::shared_ptr<mpm::NodeBase<Dim>>> nodes;
+  const std::vector<std::array<double, Dim>> ncoords = {
+      {0., 0., 0.}, {1., 0., 0.}, {1., 1., 0.}, {0., 1., 0.},
+      {0., 0., 1.}, {1., 0., 1.}, {1., 1., 1.}, {0., 1., 1.}};
+  for (unsigned i = 0; i < Nnodes; ++i) {
+    coords << ncoords[i][0], ncoords[i][1], ncoords[i][2];
+    nodes.emplace_back(
+        std::make_shared<mpm::Node<Dim, Dof, Nphases>>(i, coords));
+    cell->add_node(i, nodes.back());
+  }
+  REQUIRE(cell->initialise() == true);
+
+  // Particle
+  coords << 0.4, 0.3, 0.6;
+  std::shared_ptr<mpm::ParticleBase<Dim>> particle =
+      std::make_shared<mpm::Particle<Dim>>(0, coords);
+  REQUIRE(particle->assign_cell(cell) == true);
+  REQUIRE(particle->assign_volume(1.0) == true);
+  particle->assign_mass(1000.);
+
+  // Shape function buffers are sized by the element on the first step
+  particle->compute_shapefn();
+
+  SECTION("Check shape functions and mapping do not allocate") {
+    mpm_test::nallocations = 0;
+    mpm_test::count_allocations = true;
+    particle->compute_shapefn();
+    particle->map_mass_momentum_to_nodes();
+    particle->compute_strain(dt);
+    particle->map_internal_force();
+    mpm_test::count_allocations = false;
+    REQUIRE(mpm_test::nallocations == 0);
+  }
+}
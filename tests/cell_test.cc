@@ -546,6 +546,14 @@ TEST_CASE("Cell is checked for 2D case", "[cell][2D]") {
     REQUIRE(cell->status() == false);
     REQUIRE(cell->nparticles() == 0);
     REQUIRE(cell->particles().size() == 0);
+
+    // Assign particle ids in bulk
+    const std::vector<mpm::Index> pids{4, 2, 7};
+    cell->add_particle_id(pid);
+    cell->assign_particle_ids(pids.cbegin() + 1, pids.cend());
+    REQUIRE(cell->nparticles() == 2);
+    REQUIRE(cell->particles().at(0) == 2);
+    REQUIRE(cell->particles().at(1) == 7);
   }
 
   SECTION("Test node status") {
@@ -591,6 +599,9 @@ TEST_CASE("Cell is checked for 2D case", "[cell][2D]") {
     REQUIRE(cell->nglobal_particles() == 0);
     cell->nglobal_particles(5);
     REQUIRE(cell->nglobal_particles() == 5);
+    REQUIRE(cell->particles_cost() == 0);
+    cell->particles_cost(12);
+    REQUIRE(cell->particles_cost() == 12);
   }
 }
 
@@ -1553,5 +1564,8 @@ TEST_CASE("Cell is checked for 3D case", "[cell][3D]") {
     REQUIRE(cell->nglobal_particles() == 0);
     cell->nglobal_particles(5);
     REQUIRE(cell->nglobal_particles() == 5);
+    REQUIRE(cell->particles_cost() == 0);
+    cell->particles_cost(12);
+    REQUIRE(cell->particles_cost() == 12);
   }
 }
@@ -66,6 +66,25 @@ TEST_CASE("Cell vector is checked for 2D case", "[cellvector][2D]") {
     REQUIRE(cellvector->size() == 0);
   }
 
+  // Check batched removal
+  SECTION("Check remove cells with a predicate") {
+    // Cell 3
+    auto cell3 = std::make_shared<mpm::Cell<Dim>>(2, Nnodes, element);
+    cellvector->add(cell1);
+    cellvector->add(cell2);
+    cellvector->add(cell3);
+
+    // Remove cells with an even id
+    const auto even = [](const std::shared_ptr<mpm::Cell<Dim>>& cell) {
+      return cell->id() % 2 == 0;
+    };
+    REQUIRE(cellvector->remove_if(even) == 2);
+    REQUIRE(cellvector->size() == 1);
+    REQUIRE((*cellvector)[0]->id() == id2);
+    REQUIRE(cellvector->remove_if(even) == 0);
+    REQUIRE(cellvector->size() == 1);
+  }
+
   // Check iterator
   SECTION("Check cell range iterator") {
     // Add cell 1
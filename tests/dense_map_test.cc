@@ -0,0 +1,77 @@
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "catch.hpp"
+
+#include "map.h"
+
+//! \brief Check dense map of named state variables
+TEST_CASE("Dense map is checked", "[densemap]") {
+  // Tolerance
+  const double Tolerance = 1.E-7;
+
+  SECTION("Check dense map from name and value pairs") {
+    mpm::dense_map state_vars = {{"phi", 0.5}, {"psi", 0.1}, {"pdstrain", 0.}};
+    REQUIRE(state_vars.size() == 3);
+    REQUIRE(state_vars.empty() == false);
+
+    // Values are in the order of insertion
+    REQUIRE(state_vars.name(0) == "phi");
+    REQUIRE(state_vars.name(2) == "pdstrain");
+    REQUIRE(state_vars.index("psi") == 1);
+    REQUIRE(state_vars[1] == Approx(0.1).epsilon(Tolerance));
+    REQUIRE(state_vars.data()[0] == Approx(0.5).epsilon(Tolerance));
+
+    // Access by name and index refer to the same value
+    state_vars.at("pdstrain") = 0.25;
+    REQUIRE(state_vars[2] == Approx(0.25).epsilon(Tolerance));
+    state_vars[0] = 0.75;
+    REQUIRE(state_vars.at("phi") == Approx(0.75).epsilon(Tolerance));
+
+    // Find
+    REQUIRE(state_vars.find("psi") != state_vars.end());
+    REQUIRE(*state_vars.find("psi") == Approx(0.1).epsilon(Tolerance));
+    REQUIRE(state_vars.find("pressure") == state_vars.end());
+    REQUIRE(state_vars.index("pressure") == state_vars.size());
+
+    // Access of an absent name throws
+    REQUIRE_THROWS_AS(state_vars.at("pressure"), std::out_of_range);
+
+    // Operator [] appends an absent name
+    state_vars["pressure"] = 10.;
+    REQUIRE(state_vars.size() == 4);
+    REQUIRE(state_vars.name(3) == "pressure");
+    REQUIRE(state_vars.at("pressure") == Approx(10.).epsilon(Tolerance));
+  }
+
+  SECTION("Check dense maps sharing a layout") {
+    const auto layout = std::make_shared<const mpm::dense_map::Layout>(
+        std::vector<std::string>{"pressure", "theta"});
+    mpm::dense_map state_vars(layout);
+    REQUIRE(state_vars.size() == 2);
+    REQUIRE(state_vars.at("pressure") == Approx(0.).epsilon(Tolerance));
+    REQUIRE(state_vars.at("theta") == Approx(0.).epsilon(Tolerance));
+
+    // Copies share names but not values
+    mpm::dense_map copy = state_vars;
+    copy[1] = 2.;
+    REQUIRE(copy.at("theta") == Approx(2.).epsilon(Tolerance));
+    REQUIRE(state_vars.at("theta") == Approx(0.).epsilon(Tolerance));
+
+    // Appending a name to a copy leaves the shared layout unchanged
+    copy["pdstrain"] = 1.;
+    REQUIRE(copy.size() == 3);
+    REQUIRE(layout->size() == 2);
+    REQUIRE(state_vars.find("pdstrain") == state_vars.end());
+  }
+
+  SECTION("Check empty dense map") {
+    mpm::dense_map state_vars;
+    REQUIRE(state_vars.size() == 0);
+    REQUIRE(state_vars.empty() == true);
+    REQUIRE(state_vars.find("pressure") == state_vars.end());
+    REQUIRE_THROWS_AS(state_vars.at("pressure"), std::out_of_range);
+  }
+}
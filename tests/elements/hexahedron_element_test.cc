@@ -18,6 +18,7 @@ TEST_CASE("Hexahedron elements are checked", "[hex][element][3D]") {
 
     // Check degree
     REQUIRE(hex->degree() == mpm::ElementDegree::Linear);
+    REQUIRE(hex->type() == "ED3H8");
 
     // Coordinates is (0, 0, 0)
     SECTION("Eight noded hexahedron element for coordinates(0, 0, 0)") {
@@ -984,6 +985,7 @@ TEST_CASE("Hexahedron elements are checked", "[hex][element][3D]") {
 
     // Check degree
     REQUIRE(hex->degree() == mpm::ElementDegree::Quadratic);
+    REQUIRE(hex->type() == "ED3H20");
 
     // Coordinates is (0, 0, 0)
     SECTION("Twenty noded hexahedron element for coordinates(0, 0, 0)") {
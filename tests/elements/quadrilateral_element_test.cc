@@ -18,6 +18,7 @@ TEST_CASE("Quadrilateral elements are checked", "[quad][element][2D]") {
 
     // Check degree
     REQUIRE(quad->degree() == mpm::ElementDegree::Linear);
+    REQUIRE(quad->type() == "ED2Q4");
 
     // Coordinates is (0,0)
     SECTION("Four noded quadrilateral element for coordinates(0,0)") {
@@ -360,6 +361,51 @@ TEST_CASE("Quadrilateral elements are checked", "[quad][element][2D]") {
       }
     }
 
+    // In-place shape functions and dN/dx
+    SECTION("Four noded quadrilateral in-place shape functions and dN/dx") {
+      // Reference coordinates
+      Eigen::Matrix<double, Dim, 1> xi;
+      xi << 0.25, -0.5;
+
+      // Nodal coordinates of a distorted cell
+      Eigen::Matrix<double, 4, Dim> coords;
+      // clang-format off
+      coords << 0., 0.,
+                2., 0.25,
+                2.5, 1.5,
+                -0.25, 1.;
+      // clang-format on
+
+      Eigen::VectorXd shapefn;
+      Eigen::MatrixXd dn_dx;
+      REQUIRE(quad->shapefn_dn_dx(xi, coords, Eigen::Vector2d::Zero(),
+                                  Eigen::Vector2d::Zero(), &shapefn,
+                                  &dn_dx) == true);
+
+      // Compare against the dynamically sized interface
+      const auto sf = quad->shapefn(xi, Eigen::Vector2d::Zero(),
+                                    Eigen::Vector2d::Zero());
+      const auto dndx = quad->dn_dx(xi, coords, Eigen::Vector2d::Zero(),
+                                    Eigen::Vector2d::Zero());
+      REQUIRE(shapefn.size() == nfunctions);
+      REQUIRE(dn_dx.rows() == nfunctions);
+      REQUIRE(dn_dx.cols() == Dim);
+      for (unsigned i = 0; i < nfunctions; ++i) {
+        REQUIRE(shapefn(i) == Approx(sf(i)).epsilon(Tolerance));
+        REQUIRE(dn_dx(i, 0) == Approx(dndx(i, 0)).epsilon(Tolerance));
+        REQUIRE(dn_dx(i, 1) == Approx(dndx(i, 1)).epsilon(Tolerance));
+      }
+
+      // Incorrect dimension of nodal coordinates
+      const Eigen::MatrixXd coords3 = coords.topRows(3);
+      REQUIRE(quad->shapefn_dn_dx(xi, coords3, Eigen::Vector2d::Zero(),
+                                  Eigen::Vector2d::Zero(), &shapefn,
+                                  &dn_dx) == false);
+      REQUIRE(shapefn.size() == nfunctions);
+      REQUIRE(dn_dx.rows() == nfunctions);
+      REQUIRE(dn_dx.norm() == Approx(0.).epsilon(Tolerance));
+    }
+
     // Coordinates is (-0.5,-0.5)
     SECTION(
         "Four noded quadrilateral B-matrix cell for coordinates(-0.5,-0.5)") {
@@ -689,6 +735,7 @@ TEST_CASE("Quadrilateral elements are checked", "[quad][element][2D]") {
 
     // Check degree
     REQUIRE(quad->degree() == mpm::ElementDegree::Quadratic);
+    REQUIRE(quad->type() == "ED2Q8");
 
     // Coordinates is (0,0)
     SECTION("Eight noded quadrilateral element for coordinates(0,0)") {
@@ -1488,6 +1535,7 @@ TEST_CASE("Quadrilateral elements are checked", "[quad][element][2D]") {
 
     // Check degree
     REQUIRE(quad->degree() == mpm::ElementDegree::Quadratic);
+    REQUIRE(quad->type() == "ED2Q9");
 
     // Coordinates is (0,0)
     SECTION("Nine noded quadrilateral element for coordinates(0,0)") {
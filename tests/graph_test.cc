@@ -291,6 +291,11 @@ TEST_CASE("Graph is checked for 2D case", "[graph][2D]") {
     REQUIRE(graph3.adjncy()[10] == 14);
     REQUIRE(graph3.adjncy()[11] == 9);
     REQUIRE(graph3.adjncy()[12] == 13);
+
+    // Cells without nodes and particles have unit edge and zero vertex weights
+    REQUIRE(graph1.adjwgt().size() == graph1.adjncy().size());
+    for (const auto weight : graph1.adjwgt()) REQUIRE(weight == 1);
+    for (const auto weight : graph1.vwgt()) REQUIRE(weight == 0);
   }
 }
 
@@ -0,0 +1,173 @@
+#include <string>
+#include <vector>
+
+#include "catch.hpp"
+
+#include "data_types.h"
+#include "hdf5_particle.h"
+
+#ifdef USE_MPI
+#include "mpi.h"
+#endif
+
+//! \brief Check HDF5 particle columns written to a file shared by all ranks
+TEST_CASE("HDF5 particle columns are checked", "[hdf5][mpi]") {
+  // Tolerance
+  const double Tolerance = 1.E-7;
+
+  // Get MPI rank and number of ranks
+  int mpi_rank = 0;
+  int mpi_size = 1;
+#ifdef USE_MPI
+  MPI_Comm_rank(MPI_COMM_WORLD, &mpi_rank);
+  MPI_Comm_size(MPI_COMM_WORLD, &mpi_size);
+#endif
+
+  // HDF5 data of a particle
+  const auto particle_data = [](mpm::Index id) {
+    mpm::HDF5Particle particle;
+    particle.id = id;
+    particle.mass = 1.5 * id;
+    particle.volume = 0.25;
+    particle.pressure = 0.;
+    particle.coord_x = 0.5 * id;
+    particle.coord_y = -0.5 * id;
+    particle.coord_z = 0.;
+    particle.stress_xx = -100. * id;
+    particle.cell_id = id / 4;
+    particle.status = (id % 2 == 0);
+    particle.material_id = 1;
+    particle.nstate_vars = 1;
+    particle.svars[0] = 2. * id;
+    return particle;
+  };
+
+  // Each rank has rank + 2 particles
+  const unsigned nlocal = mpi_rank + 2;
+  mpm::Index first = 0;
+  for (int rank = 0; rank < mpi_rank; ++rank) first += rank + 2;
+  unsigned nglobal = 0;
+  for (int rank = 0; rank < mpi_size; ++rank) nglobal += rank + 2;
+
+  // Columns with a single state variable
+  mpm::hdf5::particle::Columns columns(nlocal, 1);
+  for (unsigned i = 0; i < nlocal; ++i)
+    columns.pack(i, particle_data(first + i));
+
+  SECTION("Check pack and unpack") {
+    const auto particle = columns.unpack(1);
+    REQUIRE(particle.id == first + 1);
+    REQUIRE(particle.mass == Approx(1.5 * (first + 1)).epsilon(Tolerance));
+    REQUIRE(particle.cell_id == (first + 1) / 4);
+    REQUIRE(particle.status == ((first + 1) % 2 == 0));
+    REQUIRE(particle.svars[0] == Approx(2. * (first + 1)).epsilon(Tolerance));
+
+    // Fields are followed by a column of each state variable
+    REQUIRE(columns.nstate_vars() == 1);
+    REQUIRE(columns.nfields() == mpm::hdf5::particle::NFIELDS + 1);
+    REQUIRE(columns.name(mpm::hdf5::particle::CellId) == "cell_id");
+    REQUIRE(columns.name(mpm::hdf5::particle::NFIELDS) == "svars_0");
+
+    // Assign fields of a particle
+    columns.assign(mpm::hdf5::particle::Mass, 1, 7.5);
+    columns.assign(mpm::hdf5::particle::NFIELDS, 1, -3.);
+    REQUIRE(columns.unpack(1).mass == Approx(7.5).epsilon(Tolerance));
+    REQUIRE(columns.unpack(1).svars[0] == Approx(-3.).epsilon(Tolerance));
+
+    // Select particles
+    const auto selected = columns.select({1});
+    REQUIRE(selected.nparticles() == 1);
+    REQUIRE(selected.nstate_vars() == 1);
+    REQUIRE(selected.unpack(0).id == first + 1);
+    REQUIRE(selected.unpack(0).mass == Approx(7.5).epsilon(Tolerance));
+
+    // Particles with more state variables than the columns
+    mpm::hdf5::particle::Columns empty(1);
+    REQUIRE(empty.nfields() == mpm::hdf5::particle::NFIELDS);
+    empty.pack(0, particle_data(first));
+    REQUIRE_THROWS(empty.unpack(0));
+  }
+
+  SECTION("Check single file of all ranks") {
+    for (const unsigned compression : {0, 4}) {
+      const std::string filename =
+          "particles-columns-" + std::to_string(compression) + ".h5";
+      REQUIRE(mpm::hdf5::particle::write_columns(filename, columns,
+                                                 compression) == true);
+
+      // Every rank reads the particles of all ranks in rank order
+      const auto read = mpm::hdf5::particle::read_columns(filename);
+      REQUIRE(read.nparticles() == nglobal);
+      for (unsigned i = 0; i < nglobal; ++i) {
+        const auto particle = read.unpack(i);
+        const auto reference = particle_data(i);
+        REQUIRE(particle.id == reference.id);
+        REQUIRE(particle.mass == Approx(reference.mass).epsilon(Tolerance));
+        REQUIRE(particle.coord_y ==
+                Approx(reference.coord_y).epsilon(Tolerance));
+        REQUIRE(particle.stress_xx ==
+                Approx(reference.stress_xx).epsilon(Tolerance));
+        REQUIRE(particle.cell_id == reference.cell_id);
+        REQUIRE(particle.status == reference.status);
+        REQUIRE(particle.material_id == reference.material_id);
+        REQUIRE(particle.svars[0] ==
+                Approx(reference.svars[0]).epsilon(Tolerance));
+      }
+    }
+
+    // Each rank reads a slice of the particles
+    const std::string filename = "particles-columns-0.h5";
+    REQUIRE(mpm::hdf5::particle::read_nparticles(filename) == nglobal);
+    const auto slice =
+        mpm::hdf5::particle::read_columns(filename, first, nlocal);
+    REQUIRE(slice.nparticles() == nlocal);
+    REQUIRE(slice.nstate_vars() == 1);
+    for (unsigned i = 0; i < nlocal; ++i) {
+      REQUIRE(slice.unpack(i).id == first + i);
+      REQUIRE(slice.unpack(i).svars[0] ==
+              Approx(2. * (first + i)).epsilon(Tolerance));
+    }
+    REQUIRE_THROWS(
+        mpm::hdf5::particle::read_columns(filename, nglobal - 1, 2));
+
+    // Missing file
+    REQUIRE_THROWS(mpm::hdf5::particle::read_columns("missing-particles.h5"));
+    REQUIRE_THROWS(
+        mpm::hdf5::particle::read_nparticles("missing-particles.h5"));
+  }
+
+  SECTION("Check columns without state variables") {
+    mpm::hdf5::particle::Columns fields(nlocal);
+    for (unsigned i = 0; i < nlocal; ++i) {
+      auto particle = particle_data(first + i);
+      particle.nstate_vars = 0;
+      fields.pack(i, particle);
+    }
+    const std::string filename = "particles-columns-fields.h5";
+    REQUIRE(mpm::hdf5::particle::write_columns(filename, fields) == true);
+
+    const auto read = mpm::hdf5::particle::read_columns(filename);
+    REQUIRE(read.nparticles() == nglobal);
+    REQUIRE(read.nstate_vars() == 0);
+    REQUIRE(read.unpack(nglobal - 1).id == nglobal - 1);
+    REQUIRE(read.unpack(nglobal - 1).svars[0] ==
+            Approx(0.).epsilon(Tolerance));
+  }
+
+  SECTION("Check columns passed around the ranks") {
+    // Columns of the previous rank in a ring
+    const int previous = (mpi_rank + mpi_size - 1) % mpi_size;
+    mpm::Index previous_first = 0;
+    for (int rank = 0; rank < previous; ++rank) previous_first += rank + 2;
+
+    const auto shifted = mpm::hdf5::particle::shift_columns(columns);
+    REQUIRE(shifted.nparticles() == static_cast<hsize_t>(previous + 2));
+    REQUIRE(shifted.nstate_vars() == 1);
+    for (unsigned i = 0; i < shifted.nparticles(); ++i) {
+      const auto particle = shifted.unpack(i);
+      REQUIRE(particle.id == previous_first + i);
+      REQUIRE(particle.svars[0] ==
+              Approx(2. * (previous_first + i)).epsilon(Tolerance));
+    }
+  }
+}
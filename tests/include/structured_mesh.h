@@ -0,0 +1,19 @@
+#ifndef MPM_TEST_STRUCTURED_MESH_H_
+#define MPM_TEST_STRUCTURED_MESH_H_
+
+#include <memory>
+
+#include "mesh.h"
+
+namespace mpm_test {
+
+// Create a structured mesh of unit quadrilateral cells in 2D with particles
+// of linear elastic material 0 at the Gauss points of each cell
+// \param[in] ncells Number of cells in each direction
+// \param[in] nquadratures Number of particles in each direction per cell
+std::shared_ptr<mpm::Mesh<2>> structured_mesh_2d(unsigned ncells,
+                                                 unsigned nquadratures);
+
+}  // namespace mpm_test
+
+#endif  // MPM_TEST_STRUCTURED_MESH_H_
@@ -0,0 +1,203 @@
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+
+#include "catch.hpp"
+
+#include "ascii_parser.h"
+#include "io_mesh_ascii.h"
+
+// Check ascii parser
+TEST_CASE("Ascii parser is checked", "[IOMesh][ascii]") {
+
+  SECTION("Check numbers") {
+    const std::string text = " 12 -3.5 1.25e-3 +7 0.1 1E+2 3.14159265358979 ";
+    const char* pos = text.data();
+    const char* end = text.data() + text.size();
+
+    mpm::Index id;
+    double value;
+    REQUIRE(mpm::ascii::parse(pos, end, id) == true);
+    REQUIRE(id == 12);
+    REQUIRE(mpm::ascii::parse(pos, end, value) == true);
+    REQUIRE(value == -3.5);
+    REQUIRE(mpm::ascii::parse(pos, end, value) == true);
+    REQUIRE(value == std::strtod("1.25e-3", nullptr));
+    REQUIRE(mpm::ascii::parse(pos, end, value) == true);
+    REQUIRE(value == 7.);
+    REQUIRE(mpm::ascii::parse(pos, end, value) == true);
+    REQUIRE(value == 0.1);
+    REQUIRE(mpm::ascii::parse(pos, end, value) == true);
+    REQUIRE(value == 100.);
+    REQUIRE(mpm::ascii::parse(pos, end, value) == true);
+    REQUIRE(value == std::strtod("3.14159265358979", nullptr));
+    // No more numbers
+    REQUIRE(mpm::ascii::parse(pos, end, value) == false);
+
+    // Numbers beyond the exact range are converted by strtod
+    const std::string large = "1.2345678901234567890123e-300 -2.5e308";
+    pos = large.data();
+    end = large.data() + large.size();
+    REQUIRE(mpm::ascii::parse(pos, end, value) == true);
+    REQUIRE(value == std::strtod("1.2345678901234567890123e-300", nullptr));
+    REQUIRE(mpm::ascii::parse(pos, end, value) == true);
+    REQUIRE(value == std::strtod("-2.5e308", nullptr));
+
+    // Text is not a number
+    const std::string word = "abc";
+    pos = word.data();
+    end = word.data() + word.size();
+    REQUIRE(mpm::ascii::parse(pos, end, value) == false);
+    REQUIRE(mpm::ascii::parse(pos, end, id) == false);
+  }
+
+  SECTION("Check data lines") {
+    const std::string text = "! comment\n\n  1 2  \r\n# comment\n3 4";
+    const char* pos = text.data();
+    const char* end = text.data() + text.size();
+    const char *line, *line_end;
+
+    REQUIRE(mpm::ascii::next_line(pos, end, line, line_end) == true);
+    REQUIRE(std::string(line, line_end) == "1 2");
+    REQUIRE(mpm::ascii::next_line(pos, end, line, line_end) == true);
+    REQUIRE(std::string(line, line_end) == "3 4");
+    REQUIRE(mpm::ascii::next_line(pos, end, line, line_end) == false);
+  }
+
+  SECTION("Check chunks and merge order") {
+    // Lines of two values
+    std::ostringstream stream;
+    const mpm::Index nlines = 100000;
+    for (mpm::Index i = 0; i < nlines; ++i)
+      stream << i << "\t" << i * 2 << "\n";
+    const std::string text = stream.str();
+    const char* begin = text.data();
+    const char* end = text.data() + text.size();
+
+    // Chunks are whole lines covering the text
+    const auto chunks = mpm::ascii::split_lines(begin, end, 1000);
+    REQUIRE(chunks.size() > 1);
+    REQUIRE(chunks.front().first == begin);
+    REQUIRE(chunks.back().second == end);
+    for (unsigned i = 0; i < chunks.size() - 1; ++i) {
+      REQUIRE(*(chunks[i].second - 1) == '\n');
+      REQUIRE(chunks[i].second == chunks[i + 1].first);
+    }
+
+    // Records and line numbers are in order of the text
+    const auto records = mpm::ascii::parse_lines<std::array<mpm::Index, 3>>(
+        begin, end,
+        [](mpm::Index index, const char* begin, const char* end,
+           std::vector<std::array<mpm::Index, 3>>& records) {
+          std::array<mpm::Index, 3> record{{index, 0, 0}};
+          mpm::ascii::parse(begin, end, record[1]);
+          mpm::ascii::parse(begin, end, record[2]);
+          records.emplace_back(record);
+        });
+    REQUIRE(records.size() == nlines);
+    for (mpm::Index i = 0; i < nlines; ++i) {
+      REQUIRE(records[i][0] == i);
+      REQUIRE(records[i][1] == i);
+      REQUIRE(records[i][2] == i * 2);
+    }
+  }
+
+  SECTION("Check missing file") {
+    REQUIRE_THROWS(mpm::ascii::MappedText("missing-ascii-file.txt"));
+  }
+}
+
+//! \brief Benchmark parallel ascii mesh reading against stream parsing
+//! Run with: ./mpmtest "[benchmark][ascii]"
+TEST_CASE("Ascii mesh reading is benchmarked", "[.][benchmark][ascii][3D]") {
+  // Dimension
+  const unsigned Dim = 3;
+  // Number of cells in each direction
+  const unsigned ncells = 100;
+  const unsigned nnodes_dir = ncells + 1;
+  const unsigned nnodes = nnodes_dir * nnodes_dir * nnodes_dir;
+
+  // Generate a structured hexahedral mesh
+  const std::string filename = "mesh-ascii-benchmark.txt";
+  {
+    std::ofstream file(filename);
+    file.precision(12);
+    file << "! elementShape hexahedron\n";
+    file << nnodes << "\t" << ncells * ncells * ncells << "\n";
+    for (unsigned k = 0; k < nnodes_dir; ++k)
+      for (unsigned j = 0; j < nnodes_dir; ++j)
+        for (unsigned i = 0; i < nnodes_dir; ++i)
+          file << i * 0.013 << "\t" << j * 0.017 << "\t" << k * 0.019 << "\n";
+    const auto nid = [nnodes_dir](unsigned i, unsigned j, unsigned k) {
+      return (k * nnodes_dir + j) * nnodes_dir + i;
+    };
+    for (unsigned k = 0; k < ncells; ++k)
+      for (unsigned j = 0; j < ncells; ++j)
+        for (unsigned i = 0; i < ncells; ++i)
+          file << nid(i, j, k) << "\t" << nid(i + 1, j, k) << "\t"
+               << nid(i + 1, j + 1, k) << "\t" << nid(i, j + 1, k) << "\t"
+               << nid(i, j, k + 1) << "\t" << nid(i + 1, j, k + 1) << "\t"
+               << nid(i + 1, j + 1, k + 1) << "\t" << nid(i, j + 1, k + 1)
+               << "\n";
+  }
+
+  // Stream based reading of nodes and cells
+  const auto read_stream = [&filename, nnodes]() {
+    std::vector<Eigen::Matrix<double, Dim, 1>> coordinates;
+    std::vector<std::vector<mpm::Index>> cells;
+    std::ifstream file(filename);
+    std::string line;
+    bool read_first_line = false;
+    mpm::Index nlines = 0;
+    while (std::getline(file, line)) {
+      if (line.find('#') != std::string::npos ||
+          line.find('!') != std::string::npos || line.empty())
+        continue;
+      std::istringstream istream(line);
+      if (!read_first_line) {
+        read_first_line = true;
+        continue;
+      }
+      if (nlines < nnodes) {
+        Eigen::Matrix<double, Dim, 1> coords;
+        for (unsigned i = 0; i < Dim; ++i) istream >> coords[i];
+        coordinates.emplace_back(coords);
+      } else {
+        std::vector<mpm::Index> nodes;
+        mpm::Index nid;
+        while (istream >> nid) nodes.emplace_back(nid);
+        cells.emplace_back(nodes);
+      }
+      ++nlines;
+    }
+    return std::make_pair(coordinates.size(), cells.size());
+  };
+
+  auto io_mesh = std::make_unique<mpm::IOMeshAscii<Dim>>();
+  const auto read_parallel = [&filename, &io_mesh]() {
+    const auto coordinates = io_mesh->read_mesh_nodes(filename);
+    const auto cells = io_mesh->read_mesh_cells(filename);
+    return std::make_pair(coordinates.size(), cells.size());
+  };
+
+  auto start = std::chrono::steady_clock::now();
+  const auto stream_sizes = read_stream();
+  auto end = std::chrono::steady_clock::now();
+  const double stream_time =
+      std::chrono::duration<double, std::milli>(end - start).count();
+
+  start = std::chrono::steady_clock::now();
+  const auto parallel_sizes = read_parallel();
+  end = std::chrono::steady_clock::now();
+  const double parallel_time =
+      std::chrono::duration<double, std::milli>(end - start).count();
+
+  REQUIRE(stream_sizes == parallel_sizes);
+  REQUIRE(parallel_sizes.first == nnodes);
+  std::cout << "Ascii mesh of " << nnodes << " nodes and "
+            << parallel_sizes.second << " cells, stream: " << stream_time
+            << " ms, parallel: " << parallel_time << " ms\n";
+  std::remove(filename.c_str());
+}
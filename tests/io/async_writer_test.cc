@@ -0,0 +1,84 @@
+#include <atomic>
+#include <chrono>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "catch.hpp"
+
+#include "async_writer.h"
+
+//! \brief Check asynchronous writer
+TEST_CASE("Async writer is checked", "[IO][async]") {
+  // Capacity
+  const unsigned capacity = 2;
+
+  SECTION("Check tasks are written in order") {
+    std::vector<unsigned> written;
+    {
+      mpm::AsyncWriter writer(capacity);
+      REQUIRE(writer.capacity() == capacity);
+      for (unsigned i = 0; i < 10; ++i) {
+        // Each task owns a copy of its data
+        std::vector<unsigned> data(3, i);
+        writer.push([&written, data]() { written.emplace_back(data.at(0)); });
+        // Queue is bounded
+        REQUIRE(writer.npending() <= capacity);
+      }
+      writer.wait();
+      REQUIRE(writer.npending() == 0);
+      REQUIRE(written.size() == 10);
+    }
+    for (unsigned i = 0; i < written.size(); ++i) REQUIRE(written.at(i) == i);
+  }
+
+  SECTION("Check back-pressure") {
+    std::atomic<bool> release{false};
+    std::atomic<unsigned> nwritten{0};
+    mpm::AsyncWriter writer(capacity);
+
+    // Block the writer until released
+    writer.push([&]() {
+      while (!release)
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+      ++nwritten;
+    });
+    writer.push([&]() { ++nwritten; });
+    REQUIRE(writer.npending() == capacity);
+
+    // Push blocks until a pending task is written
+    std::atomic<bool> pushed{false};
+    std::thread solver([&]() {
+      writer.push([&]() { ++nwritten; });
+      pushed = true;
+    });
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    REQUIRE(pushed == false);
+
+    release = true;
+    solver.join();
+    REQUIRE(pushed == true);
+    writer.wait();
+    REQUIRE(nwritten == 3);
+  }
+
+  SECTION("Check failed task") {
+    unsigned nwritten = 0;
+    mpm::AsyncWriter writer(capacity);
+    writer.push([]() { throw std::runtime_error("Output failed"); });
+    writer.push([&nwritten]() { ++nwritten; });
+    // Writer continues after a failed task
+    writer.wait();
+    REQUIRE(nwritten == 1);
+  }
+
+  SECTION("Check pending tasks are written on destruction") {
+    unsigned nwritten = 0;
+    {
+      mpm::AsyncWriter writer(1);
+      for (unsigned i = 0; i < 4; ++i)
+        writer.push([&nwritten]() { ++nwritten; });
+    }
+    REQUIRE(nwritten == 4);
+  }
+}
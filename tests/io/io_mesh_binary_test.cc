@@ -0,0 +1,294 @@
+#include <fstream>
+
+#include "catch.hpp"
+
+#include "factory.h"
+#include "io_mesh_ascii.h"
+#include "io_mesh_binary.h"
+
+// Check IOMeshBinary
+TEST_CASE("IOMeshBinary is checked for 2D", "[IOMesh][IOMeshBinary][2D]") {
+
+  // Dimension
+  const unsigned dim = 2;
+  // Tolerance
+  const double Tolerance = 1.E-7;
+
+  // Create a io_mesh object
+  auto io_mesh = std::make_unique<mpm::IOMeshBinary<dim>>();
+
+  // Binary reader is selected by io_type
+  REQUIRE_NOTHROW(Factory<mpm::IOMesh<dim>>::instance()->create("Binary2D"));
+
+  SECTION("Check mesh file") {
+    // Nodal coordinates
+    std::vector<Eigen::Matrix<double, dim, 1>> coordinates;
+    Eigen::Matrix<double, dim, 1> node;
+    node << 0., 0.;
+    coordinates.emplace_back(node);
+    node << 0.5, 0.;
+    coordinates.emplace_back(node);
+    node << 0.5, 0.5;
+    coordinates.emplace_back(node);
+    node << 0., 0.5;
+    coordinates.emplace_back(node);
+    node << 1.0, 0.;
+    coordinates.emplace_back(node);
+    node << 1.0, 0.5;
+    coordinates.emplace_back(node);
+
+    // Cell with node ids
+    std::vector<std::vector<mpm::Index>> cells{// cell #0
+                                               {0, 1, 2, 3},
+                                               // cell #1
+                                               {1, 4, 5, 2}};
+
+    REQUIRE(io_mesh->write_mesh("mesh-2d.bin", coordinates, cells) == true);
+
+    // Check read mesh nodes
+    auto check_coords = io_mesh->read_mesh_nodes("mesh-2d.bin");
+    REQUIRE(check_coords.size() == coordinates.size());
+    for (unsigned i = 0; i < coordinates.size(); ++i)
+      for (unsigned j = 0; j < dim; ++j)
+        REQUIRE(check_coords[i][j] ==
+                Approx(coordinates[i][j]).epsilon(Tolerance));
+
+    // Check read mesh cells
+    auto check_cells = io_mesh->read_mesh_cells("mesh-2d.bin");
+    REQUIRE(check_cells.size() == cells.size());
+    for (unsigned i = 0; i < cells.size(); ++i)
+      for (unsigned j = 0; j < cells[i].size(); ++j)
+        REQUIRE(check_cells[i][j] == cells[i][j]);
+
+    // Check read mesh cell centroids
+    auto centroids = io_mesh->read_mesh_cell_centroids("mesh-2d.bin");
+    REQUIRE(centroids.size() == cells.size());
+    REQUIRE(centroids[0][0] == Approx(0.25).epsilon(Tolerance));
+    REQUIRE(centroids[0][1] == Approx(0.25).epsilon(Tolerance));
+    REQUIRE(centroids[1][0] == Approx(0.75).epsilon(Tolerance));
+    REQUIRE(centroids[1][1] == Approx(0.25).epsilon(Tolerance));
+
+    // Check iterate over mesh cells
+    std::vector<std::vector<mpm::Index>> iterated_cells;
+    io_mesh->iterate_over_mesh_cells(
+        "mesh-2d.bin",
+        [&](mpm::Index cid, const std::vector<mpm::Index>& nodes) {
+          REQUIRE(cid == iterated_cells.size());
+          iterated_cells.emplace_back(nodes);
+        });
+    REQUIRE(iterated_cells == cells);
+
+    // Check read coordinates of some nodes
+    const std::vector<mpm::Index> node_ids{5, 1};
+    check_coords = io_mesh->read_mesh_node_coordinates("mesh-2d.bin", node_ids);
+    REQUIRE(check_coords.size() == node_ids.size());
+    for (unsigned i = 0; i < node_ids.size(); ++i)
+      for (unsigned j = 0; j < dim; ++j)
+        REQUIRE(check_coords[i][j] ==
+                Approx(coordinates[node_ids[i]][j]).epsilon(Tolerance));
+    REQUIRE(io_mesh->read_mesh_node_coordinates("mesh-2d.bin", {6}).size() ==
+            0);
+
+    // Cells with different number of nodes
+    cells.emplace_back(std::vector<mpm::Index>{0, 1, 2});
+    REQUIRE(io_mesh->write_mesh("mesh-mixed-2d.bin", coordinates, cells) ==
+            false);
+
+    // Missing file
+    REQUIRE(io_mesh->read_mesh_nodes("mesh-missing.bin").size() == 0);
+    // Other type of data
+    REQUIRE(io_mesh->read_particles("mesh-2d.bin").size() == 0);
+    // Other dimension
+    auto io_mesh_3d = std::make_unique<mpm::IOMeshBinary<3>>();
+    REQUIRE(io_mesh_3d->read_mesh_nodes("mesh-2d.bin").size() == 0);
+
+    // Truncated file
+    std::ifstream input("mesh-2d.bin", std::ios::binary);
+    std::string data((std::istreambuf_iterator<char>(input)),
+                     std::istreambuf_iterator<char>());
+    std::ofstream output("mesh-truncated-2d.bin", std::ios::binary);
+    output.write(data.data(), data.size() - 8);
+    output.close();
+    REQUIRE(io_mesh->read_mesh_nodes("mesh-truncated-2d.bin").size() ==
+            coordinates.size());
+    REQUIRE(io_mesh->read_mesh_cells("mesh-truncated-2d.bin").size() == 0);
+
+    // Ascii text is not a binary input file
+    std::ofstream ascii("mesh-ascii-2d.txt");
+    ascii << "6\t2\n0.\t0.\n0.5\t0.\n0.5\t0.5\n0.\t0.5\n1.\t0.\n1.\t0.5\n"
+          << "0\t1\t2\t3\n1\t4\t5\t2\n";
+    ascii.close();
+    REQUIRE(io_mesh->read_mesh_nodes("mesh-ascii-2d.txt").size() == 0);
+
+    // Convert ascii mesh
+    auto io_ascii = std::make_unique<mpm::IOMeshAscii<dim>>();
+    REQUIRE(io_mesh->write_mesh("mesh-converted-2d.bin",
+                                io_ascii->read_mesh_nodes("mesh-ascii-2d.txt"),
+                                io_ascii->read_mesh_cells(
+                                    "mesh-ascii-2d.txt")) == true);
+    check_coords = io_mesh->read_mesh_nodes("mesh-converted-2d.bin");
+    check_cells = io_mesh->read_mesh_cells("mesh-converted-2d.bin");
+    REQUIRE(check_coords.size() == coordinates.size());
+    REQUIRE(check_cells.size() == 2);
+    for (unsigned i = 0; i < coordinates.size(); ++i)
+      for (unsigned j = 0; j < dim; ++j)
+        REQUIRE(check_coords[i][j] ==
+                Approx(coordinates[i][j]).epsilon(Tolerance));
+    for (unsigned i = 0; i < check_cells.size(); ++i)
+      for (unsigned j = 0; j < check_cells[i].size(); ++j)
+        REQUIRE(check_cells[i][j] == cells[i][j]);
+
+    // Ascii reader reads the whole mesh for partial reads
+    std::unique_ptr<mpm::IOMesh<dim>> io_base = std::move(io_ascii);
+    centroids = io_base->read_mesh_cell_centroids("mesh-ascii-2d.txt");
+    REQUIRE(centroids.size() == 2);
+    REQUIRE(centroids[1][0] == Approx(0.75).epsilon(Tolerance));
+    check_coords =
+        io_base->read_mesh_node_coordinates("mesh-ascii-2d.txt", node_ids);
+    REQUIRE(check_coords.size() == node_ids.size());
+    REQUIRE(check_coords[0][0] == Approx(1.0).epsilon(Tolerance));
+    unsigned ncells = 0;
+    io_base->iterate_over_mesh_cells(
+        "mesh-ascii-2d.txt",
+        [&](mpm::Index cid, const std::vector<mpm::Index>& nodes) {
+          REQUIRE(nodes == cells[cid]);
+          ++ncells;
+        });
+    REQUIRE(ncells == 2);
+  }
+
+  SECTION("Check particles and stresses files") {
+    std::vector<Eigen::Matrix<double, dim, 1>> coordinates;
+    std::vector<Eigen::Matrix<double, 6, 1>> stresses;
+    for (unsigned i = 0; i < 10; ++i) {
+      coordinates.emplace_back(Eigen::Vector2d(0.1 * i, -0.2 * i));
+      Eigen::Matrix<double, 6, 1> stress;
+      stress << i, -1. * i, 2. * i, 0.5 * i, 0., 0.;
+      stresses.emplace_back(stress);
+    }
+
+    REQUIRE(io_mesh->write_particles("particles-2d.bin", coordinates) ==
+            true);
+    REQUIRE(io_mesh->write_particles_stresses("particles-stresses-2d.bin",
+                                              stresses) == true);
+
+    auto check_coords = io_mesh->read_particles("particles-2d.bin");
+    auto check_stresses =
+        io_mesh->read_particles_stresses("particles-stresses-2d.bin");
+    REQUIRE(check_coords.size() == coordinates.size());
+    REQUIRE(check_stresses.size() == stresses.size());
+    for (unsigned i = 0; i < coordinates.size(); ++i) {
+      for (unsigned j = 0; j < dim; ++j)
+        REQUIRE(check_coords[i][j] ==
+                Approx(coordinates[i][j]).epsilon(Tolerance));
+      for (unsigned j = 0; j < 6; ++j)
+        REQUIRE(check_stresses[i][j] ==
+                Approx(stresses[i][j]).epsilon(Tolerance));
+    }
+
+    // Number of records in the header exceeds the file
+    mpm::binary::write(
+        "particles-corrupt-2d.bin",
+        mpm::binary::header(mpm::binary::FileType::Particles, dim, 11),
+        {{coordinates.data(), coordinates.size() * 2 * sizeof(double)}});
+    REQUIRE(io_mesh->read_particles("particles-corrupt-2d.bin").size() == 0);
+    // Size of the records in the header overflows
+    mpm::binary::write(
+        "particles-corrupt-2d.bin",
+        mpm::binary::header(mpm::binary::FileType::ParticlesStresses, dim,
+                            std::uint64_t(1) << 60),
+        {{stresses.data(), stresses.size() * 6 * sizeof(double)}});
+    REQUIRE(io_mesh->read_particles_stresses("particles-corrupt-2d.bin")
+                .size() == 0);
+    mpm::binary::write(
+        "particles-corrupt-2d.bin",
+        mpm::binary::header(mpm::binary::FileType::ParticlesVolumes, dim,
+                            std::uint64_t(1) << 61),
+        {{stresses.data(), stresses.size() * 6 * sizeof(double)}});
+    REQUIRE(io_mesh->read_particles_volumes("particles-corrupt-2d.bin")
+                .size() == 0);
+    mpm::binary::write(
+        "particles-corrupt-2d.bin",
+        mpm::binary::header(mpm::binary::FileType::Mesh, dim, 10,
+                            std::uint64_t(1) << 62, 4),
+        {{coordinates.data(), coordinates.size() * 2 * sizeof(double)}});
+    REQUIRE(io_mesh->read_mesh_nodes("particles-corrupt-2d.bin").size() == 10);
+    REQUIRE(io_mesh->read_mesh_cells("particles-corrupt-2d.bin").size() == 0);
+  }
+
+  SECTION("Check particles volumes and cells files") {
+    std::vector<std::tuple<mpm::Index, double>> volumes{
+        {0, 1.5}, {1, 2.5}, {5, 0.25}};
+    std::vector<std::array<mpm::Index, 2>> particles_cells{
+        {0, 3}, {1, 3}, {5, 7}};
+
+    REQUIRE(io_mesh->write_particles_volumes("particles-volumes-2d.bin",
+                                             volumes) == true);
+    io_mesh->write_particles_cells("particles-cells-2d.bin", particles_cells);
+
+    auto check_volumes =
+        io_mesh->read_particles_volumes("particles-volumes-2d.bin");
+    auto check_cells = io_mesh->read_particles_cells("particles-cells-2d.bin");
+    REQUIRE(check_volumes.size() == volumes.size());
+    REQUIRE(check_cells.size() == particles_cells.size());
+    for (unsigned i = 0; i < volumes.size(); ++i) {
+      REQUIRE(std::get<0>(check_volumes[i]) == std::get<0>(volumes[i]));
+      REQUIRE(std::get<1>(check_volumes[i]) ==
+              Approx(std::get<1>(volumes[i])).epsilon(Tolerance));
+      REQUIRE(check_cells[i][0] == particles_cells[i][0]);
+      REQUIRE(check_cells[i][1] == particles_cells[i][1]);
+    }
+  }
+
+  SECTION("Check constraints, forces and euler angles files") {
+    std::vector<std::tuple<mpm::Index, unsigned, double>> constraints{
+        {0, 0, 10.5}, {1, 1, -12.5}, {5, 0, 0.}};
+    std::vector<std::tuple<mpm::Index, unsigned, int, double>> frictions{
+        {0, 0, -1, 0.5}, {3, 1, 1, 0.25}};
+    std::map<mpm::Index, Eigen::Matrix<double, dim, 1>> euler_angles;
+    euler_angles.emplace(2, Eigen::Vector2d(0.5, 0.));
+    euler_angles.emplace(4, Eigen::Vector2d(-0.25, 1.));
+
+    REQUIRE(io_mesh->write_velocity_constraints("velocity-2d.bin",
+                                                constraints) == true);
+    REQUIRE(io_mesh->write_forces("forces-2d.bin", constraints) == true);
+    REQUIRE(io_mesh->write_friction_constraints("friction-2d.bin",
+                                                frictions) == true);
+    REQUIRE(io_mesh->write_euler_angles("euler-angles-2d.bin",
+                                        euler_angles) == true);
+
+    auto check_constraints =
+        io_mesh->read_velocity_constraints("velocity-2d.bin");
+    auto check_forces = io_mesh->read_forces("forces-2d.bin");
+    REQUIRE(check_constraints.size() == constraints.size());
+    REQUIRE(check_forces.size() == constraints.size());
+    for (unsigned i = 0; i < constraints.size(); ++i) {
+      for (const auto& check : {check_constraints[i], check_forces[i]}) {
+        REQUIRE(std::get<0>(check) == std::get<0>(constraints[i]));
+        REQUIRE(std::get<1>(check) == std::get<1>(constraints[i]));
+        REQUIRE(std::get<2>(check) ==
+                Approx(std::get<2>(constraints[i])).epsilon(Tolerance));
+      }
+    }
+    // Velocity constraints are not forces
+    REQUIRE(io_mesh->read_forces("velocity-2d.bin").size() == 0);
+
+    auto check_frictions =
+        io_mesh->read_friction_constraints("friction-2d.bin");
+    REQUIRE(check_frictions.size() == frictions.size());
+    for (unsigned i = 0; i < frictions.size(); ++i) {
+      REQUIRE(std::get<0>(check_frictions[i]) == std::get<0>(frictions[i]));
+      REQUIRE(std::get<1>(check_frictions[i]) == std::get<1>(frictions[i]));
+      REQUIRE(std::get<2>(check_frictions[i]) == std::get<2>(frictions[i]));
+      REQUIRE(std::get<3>(check_frictions[i]) ==
+              Approx(std::get<3>(frictions[i])).epsilon(Tolerance));
+    }
+
+    auto check_angles = io_mesh->read_euler_angles("euler-angles-2d.bin");
+    REQUIRE(check_angles.size() == euler_angles.size());
+    for (const auto& angles : euler_angles)
+      for (unsigned j = 0; j < dim; ++j)
+        REQUIRE(check_angles.at(angles.first)[j] ==
+                Approx(angles.second[j]).epsilon(Tolerance));
+  }
+}
@@ -138,6 +138,11 @@ TEST_CASE("IO is checked for input parsing", "[IO][JSON]") {
     auto meshfile =
         io->output_file(attribute, extension, uuid_, step, max_steps).string();
     REQUIRE(meshfile == "./results/MPM/geometry057.vtp");
+    // Check file names of the ranks
+    REQUIRE(mpm::IO::output_file_name(attribute, extension, step, max_steps) ==
+            "geometry057.vtp");
+    REQUIRE(mpm::IO::output_file_name(attribute, extension, step, max_steps,
+                                      2, 4) == "geometry-2_4-057.vtp");
     // Check output folder
     REQUIRE(io->output_folder() == "results/");
 
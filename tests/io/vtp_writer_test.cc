@@ -0,0 +1,208 @@
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#ifdef USE_ZLIB
+#include <zlib.h>
+#endif
+
+#include "catch.hpp"
+
+#include "vtp_writer.h"
+
+namespace {
+//! Read a file
+std::string read_file(const std::string& filename) {
+  std::ifstream file(filename, std::ios::binary);
+  std::stringstream buffer;
+  buffer << file.rdbuf();
+  return buffer.str();
+}
+
+//! Read an array from the appended data of a VTP file
+std::vector<char> read_array(const std::string& vtp, const std::string& name,
+                             bool compression) {
+  // Offset of the array in the appended data
+  const auto attribute = vtp.find("Name=\"" + name + "\"");
+  const auto offset_begin = vtp.find("offset=\"", attribute) + 8;
+  const std::size_t offset =
+      std::stoull(vtp.substr(offset_begin, vtp.find('"', offset_begin) -
+                                               offset_begin));
+  const char* data = vtp.data() + vtp.find('_', vtp.find("<AppendedData")) +
+                     1 + offset;
+
+  // Read header values
+  const auto header = [&data]() {
+    std::uint64_t value;
+    std::memcpy(&value, data, sizeof(value));
+    data += sizeof(value);
+    return value;
+  };
+
+  std::vector<char> array;
+  if (!compression) {
+    const auto nbytes = header();
+    array.assign(data, data + nbytes);
+    return array;
+  }
+
+#ifdef USE_ZLIB
+  const auto nblocks = header();
+  const auto block_size = header();
+  const auto last_block_size = header();
+  std::vector<std::uint64_t> compressed_sizes;
+  for (unsigned i = 0; i < nblocks; ++i)
+    compressed_sizes.emplace_back(header());
+  for (unsigned i = 0; i < nblocks; ++i) {
+    uLongf size =
+        (i + 1 == nblocks && last_block_size != 0) ? last_block_size
+                                                   : block_size;
+    std::vector<char> block(size);
+    REQUIRE(uncompress(reinterpret_cast<Bytef*>(block.data()), &size,
+                       reinterpret_cast<const Bytef*>(data),
+                       compressed_sizes[i]) == Z_OK);
+    array.insert(array.end(), block.begin(), block.begin() + size);
+    data += compressed_sizes[i];
+  }
+#endif
+  return array;
+}
+
+//! Return values of an array
+template <typename T>
+std::vector<T> values(const std::vector<char>& array) {
+  std::vector<T> data(array.size() / sizeof(T));
+  std::memcpy(data.data(), array.data(), array.size());
+  return data;
+}
+}  // namespace
+
+//! \brief Check VTP writer
+TEST_CASE("VTP writer is checked", "[vtp][writer]") {
+  // Tolerance
+  const double Tolerance = 1.E-10;
+
+  // Points and their attributes
+  const unsigned npoints = 5000;
+  std::vector<Eigen::Matrix<double, 3, 1>> coordinates;
+  std::vector<double> scalars;
+  std::vector<Eigen::Matrix<double, 3, 1>> vectors;
+  std::vector<Eigen::Matrix<double, 6, 1>> tensors;
+  for (unsigned i = 0; i < npoints; ++i) {
+    coordinates.emplace_back(Eigen::Vector3d(i * 0.5, -1. * i, 0.));
+    scalars.emplace_back(i * 0.25);
+    vectors.emplace_back(Eigen::Vector3d(i, 2. * i, 3. * i));
+    Eigen::Matrix<double, 6, 1> tensor;
+    tensor << i, i + 1., i + 2., i + 3., i + 4., i + 5.;
+    tensors.emplace_back(tensor);
+  }
+
+  // Check data of a written file
+  const auto check_file = [&](const std::string& filename, bool compression) {
+    const std::string vtp = read_file(filename);
+    REQUIRE(vtp.find("<VTKFile type=\"PolyData\"") != std::string::npos);
+    REQUIRE(vtp.find("NumberOfPoints=\"5000\"") != std::string::npos);
+    REQUIRE((vtp.find("vtkZLibDataCompressor") != std::string::npos) ==
+            compression);
+    REQUIRE(vtp.find("Name=\"stresses\" NumberOfComponents=\"6\"") !=
+            std::string::npos);
+
+    // Geometry is written once
+    REQUIRE(vtp.find("Name=\"Points\"") == vtp.rfind("Name=\"Points\""));
+
+    const auto points = values<double>(read_array(vtp, "Points", compression));
+    const auto pdstrain =
+        values<double>(read_array(vtp, "pdstrain", compression));
+    const auto velocities =
+        values<double>(read_array(vtp, "velocities", compression));
+    const auto stresses =
+        values<double>(read_array(vtp, "stresses", compression));
+    REQUIRE(points.size() == npoints * 3);
+    REQUIRE(pdstrain.size() == npoints);
+    REQUIRE(velocities.size() == npoints * 3);
+    REQUIRE(stresses.size() == npoints * 6);
+    for (unsigned i = 0; i < npoints; ++i) {
+      REQUIRE(pdstrain[i] == Approx(scalars[i]).epsilon(Tolerance));
+      for (unsigned j = 0; j < 3; ++j) {
+        REQUIRE(points[i * 3 + j] ==
+                Approx(coordinates[i](j)).epsilon(Tolerance));
+        REQUIRE(velocities[i * 3 + j] ==
+                Approx(vectors[i](j)).epsilon(Tolerance));
+      }
+      for (unsigned j = 0; j < 6; ++j)
+        REQUIRE(stresses[i * 6 + j] ==
+                Approx(tensors[i](j)).epsilon(Tolerance));
+    }
+  };
+
+  SECTION("Check single file of all attributes") {
+    mpm::VtpWriter writer(coordinates);
+    REQUIRE(writer.add_point_data("pdstrain", scalars) == true);
+    REQUIRE(writer.add_point_data("velocities", vectors) == true);
+    REQUIRE(writer.add_point_data("stresses", tensors) == true);
+
+    // Data of all points is required
+    std::vector<double> data(npoints - 1, 0.);
+    REQUIRE(writer.add_point_data("volumes", data) == false);
+
+    const auto attributes = writer.point_data();
+    REQUIRE(attributes.size() == 3);
+    REQUIRE(attributes.at(0).first == "pdstrain");
+    REQUIRE(attributes.at(0).second == 1);
+    REQUIRE(attributes.at(1).second == 3);
+    REQUIRE(attributes.at(2).second == 6);
+
+    REQUIRE(writer.write("particles_vtp.vtp") == true);
+    check_file("particles_vtp.vtp", false);
+
+    // Parallel container file
+    REQUIRE(writer.write_parallel("particles_vtp.pvtp",
+                                  {"particles-0_2-10.vtp",
+                                   "particles-1_2-10.vtp"}) == true);
+    const std::string pvtp = read_file("particles_vtp.pvtp");
+    REQUIRE(pvtp.find("<VTKFile type=\"PPolyData\"") != std::string::npos);
+    REQUIRE(pvtp.find("Name=\"velocities\" NumberOfComponents=\"3\"") !=
+            std::string::npos);
+    REQUIRE(pvtp.find("<Piece Source=\"particles-0_2-10.vtp\"/>") !=
+            std::string::npos);
+    REQUIRE(pvtp.find("<Piece Source=\"particles-1_2-10.vtp\"/>") !=
+            std::string::npos);
+
+    // Invalid file
+    REQUIRE(writer.write("missing/particles_vtp.vtp") == false);
+  }
+
+  SECTION("Check compressed file") {
+    mpm::VtpWriter writer(coordinates, true);
+    writer.add_point_data("pdstrain", scalars);
+    writer.add_point_data("velocities", vectors);
+    writer.add_point_data("stresses", tensors);
+    REQUIRE(writer.write("particles_zlib_vtp.vtp") == true);
+    check_file("particles_zlib_vtp.vtp",
+               mpm::VtpWriter::compression_available());
+  }
+
+  SECTION("Check lines") {
+    std::vector<std::array<mpm::Index, 2>> pairs{{0, 1}, {1, 2}, {2, 0}};
+    mpm::VtpWriter writer(coordinates);
+    writer.add_lines(pairs);
+    REQUIRE(writer.write("mesh_vtp.vtp") == true);
+
+    const std::string vtp = read_file("mesh_vtp.vtp");
+    REQUIRE(vtp.find("NumberOfLines=\"3\"") != std::string::npos);
+    const auto connectivity =
+        values<mpm::Index>(read_array(vtp, "connectivity", false));
+    const auto offsets = values<mpm::Index>(read_array(vtp, "offsets", false));
+    REQUIRE(connectivity.size() == 6);
+    REQUIRE(offsets.size() == 3);
+    for (unsigned i = 0; i < pairs.size(); ++i) {
+      REQUIRE(connectivity[i * 2] == pairs[i][0]);
+      REQUIRE(connectivity[i * 2 + 1] == pairs[i][1]);
+      REQUIRE(offsets[i] == 2 * (i + 1));
+    }
+  }
+}
@@ -0,0 +1,243 @@
+#include <map>
+#include <memory>
+#include <set>
+#include <vector>
+
+#include "catch.hpp"
+// MPI
+#ifdef USE_MPI
+#include "mpi.h"
+#endif
+
+#include "factory.h"
+#include "load_balance.h"
+#include "material.h"
+#include "mesh.h"
+#include "structured_mesh.h"
+
+// Check diffusive load balance
+TEST_CASE("Diffusive load balance is checked", "[load_balance]") {
+  // Tolerance
+  const double Tolerance = 1.E-12;
+
+  SECTION("Check imbalance") {
+    REQUIRE(mpm::load_balance::imbalance({}) == Approx(0.).epsilon(Tolerance));
+    REQUIRE(mpm::load_balance::imbalance({0., 0.}) ==
+            Approx(0.).epsilon(Tolerance));
+    REQUIRE(mpm::load_balance::imbalance({2., 2., 2.}) ==
+            Approx(0.).epsilon(Tolerance));
+    REQUIRE(mpm::load_balance::imbalance({1., 2., 3.}) ==
+            Approx(0.5).epsilon(Tolerance));
+  }
+
+  SECTION("Check flows on a chain of ranks") {
+    // Ranks 0 - 1 - 2 - 3
+    const std::vector<double> loads{4., 1., 3., 3.};
+    const std::vector<unsigned> degrees{1, 2, 2, 1};
+
+    // Rank 0 sends to rank 1 only
+    auto flows = mpm::load_balance::diffusive_flows(0, {1}, loads, degrees);
+    REQUIRE(flows.size() == 1);
+    REQUIRE(flows.at(1) == Approx(1.).epsilon(Tolerance));
+
+    // The least loaded rank sends nothing
+    flows = mpm::load_balance::diffusive_flows(1, {0, 2}, loads, degrees);
+    REQUIRE(flows.empty());
+
+    // Equally loaded ranks exchange nothing
+    flows = mpm::load_balance::diffusive_flows(2, {1, 3}, loads, degrees);
+    REQUIRE(flows.size() == 1);
+    REQUIRE(flows.at(1) == Approx(2. / 3.).epsilon(Tolerance));
+    flows = mpm::load_balance::diffusive_flows(3, {2}, loads, degrees);
+    REQUIRE(flows.empty());
+
+    // Total load is conserved and rank 1 is less loaded than others
+    std::vector<double> balanced(loads);
+    for (unsigned rank = 0; rank < loads.size(); ++rank) {
+      std::set<unsigned> neighbours;
+      if (rank > 0) neighbours.insert(rank - 1);
+      if (rank + 1 < loads.size()) neighbours.insert(rank + 1);
+      for (const auto& flow : mpm::load_balance::diffusive_flows(
+               rank, neighbours, loads, degrees)) {
+        balanced[rank] -= flow.second;
+        balanced[flow.first] += flow.second;
+      }
+    }
+    REQUIRE(balanced[0] + balanced[1] + balanced[2] + balanced[3] ==
+            Approx(11.).epsilon(Tolerance));
+    REQUIRE(mpm::load_balance::imbalance(balanced) <
+            mpm::load_balance::imbalance(loads));
+  }
+}
+
+#ifdef USE_MPI
+// Check shift of boundary cells for diffusive load balance
+TEST_CASE("Boundary cells are shifted for 2D case",
+          "[mesh][load_balance][2D]") {
+  // Dimension
+  const unsigned Dim = 2;
+  // Number of cells in each direction
+  const unsigned ncells = 4;
+
+  int mpi_size;
+  MPI_Comm_size(MPI_COMM_WORLD, &mpi_size);
+  int mpi_rank;
+  MPI_Comm_rank(MPI_COMM_WORLD, &mpi_rank);
+
+  // Column of a cell
+  const auto column = [](const std::shared_ptr<mpm::Cell<Dim>> cell) {
+    return static_cast<unsigned>(cell->nodal_coordinates().col(0).minCoeff() +
+                                 0.5);
+  };
+
+  // Rank of each cell
+  const auto cell_ranks = [](const std::shared_ptr<mpm::Mesh<Dim>>& mesh) {
+    std::map<mpm::Index, unsigned> ranks;
+    const auto cells = mesh->cells();
+    for (auto citr = cells.cbegin(); citr != cells.cend(); ++citr)
+      ranks[(*citr)->id()] = (*citr)->rank();
+    return ranks;
+  };
+
+  // Run on a single rank, the right half of the mesh belongs to rank 1
+  if (mpi_size == 1) {
+    auto mesh = mpm_test::structured_mesh_2d(ncells, 2);
+    mesh->find_cell_neighbours();
+    mesh->iterate_over_cells(
+        [&column](std::shared_ptr<mpm::Cell<Dim>> cell) {
+          if (column(cell) >= 2) cell->rank(1);
+        });
+    mesh->remove_all_nonrank_particles();
+    REQUIRE(mesh->neighbour_ranks() == std::set<unsigned>{1});
+
+    // Nothing to send or no neighbour rank
+    REQUIRE(mesh->shift_boundary_cells({}).empty());
+    REQUIRE(mesh->shift_boundary_cells({{2, 100.}}).empty());
+
+    // Middle cells of the boundary column have the most neighbours in rank 1,
+    // a cell which overshoots the remaining particles is not shifted
+    auto exchange_cells = mesh->shift_boundary_cells({{1, 6.}});
+    REQUIRE(exchange_cells == std::vector<mpm::Index>{5});
+    exchange_cells = mesh->shift_boundary_cells({{1, 4.}});
+    REQUIRE(exchange_cells == std::vector<mpm::Index>{9});
+    auto ranks = cell_ranks(mesh);
+    REQUIRE(ranks.at(5) == 1);
+    REQUIRE(ranks.at(9) == 1);
+    REQUIRE(mesh->ncells_rank() == 6);
+
+    // Boundary cells are shifted until the rank keeps a single cell
+    exchange_cells = mesh->shift_boundary_cells({{1, 1000.}});
+    REQUIRE(exchange_cells == (std::vector<mpm::Index>{1, 13, 4, 8, 0}));
+    REQUIRE(mesh->ncells_rank() == 1);
+    REQUIRE(cell_ranks(mesh).at(12) == 0);
+  }
+
+  // Run on four ranks, each rank owns a column of cells and sends particles
+  // to the rank on the right
+  if (mpi_size == 4) {
+    auto mesh = mpm_test::structured_mesh_2d(ncells, 2);
+    mesh->find_cell_neighbours();
+    mesh->iterate_over_cells(
+        [&column](std::shared_ptr<mpm::Cell<Dim>> cell) {
+          cell->rank(column(cell));
+        });
+    mesh->find_domain_shared_nodes();
+    mesh->find_ghost_boundary_cells();
+    mesh->remove_all_nonrank_particles();
+
+    std::set<unsigned> neighbours;
+    if (mpi_rank > 0) neighbours.insert(mpi_rank - 1);
+    if (mpi_rank < 3) neighbours.insert(mpi_rank + 1);
+    REQUIRE(mesh->neighbour_ranks() == neighbours);
+
+    std::map<unsigned, double> nparticles;
+    if (mpi_rank < 3) nparticles[mpi_rank + 1] = 6.;
+    auto exchange_cells = mesh->shift_boundary_cells(nparticles);
+
+    // Shifted cells and their ranks are the same on all ranks
+    REQUIRE(exchange_cells == (std::vector<mpm::Index>{4, 5, 6}));
+    const auto ranks = cell_ranks(mesh);
+    for (unsigned i = 0; i < 3; ++i) REQUIRE(ranks.at(4 + i) == i + 1);
+
+    // Particles of shifted cells
+    mesh->find_domain_shared_nodes();
+    mesh->find_ghost_boundary_cells();
+    mesh->transfer_nonrank_particles(exchange_cells);
+    const unsigned nrank_cells =
+        (mpi_rank == 0) ? ncells - 1 : (mpi_rank == 3 ? ncells + 1 : ncells);
+    REQUIRE(mesh->ncells_rank() == nrank_cells);
+    REQUIRE(mesh->nparticles() == nrank_cells * 4);
+  }
+}
+#endif
+
+#ifdef USE_MPI
+// Check cost of particles of cells from measured stress update costs
+TEST_CASE("Cell particle cost is checked for 2D case", "[mesh][cost][2D]") {
+  // Dimension
+  const unsigned Dim = 2;
+  // Phase
+  const unsigned phase = 0;
+  // Tolerance
+  const double Tolerance = 1.E-7;
+  // Number of cells in each direction
+  const unsigned ncells = 4;
+
+  int mpi_size;
+  MPI_Comm_size(MPI_COMM_WORLD, &mpi_size);
+
+  // Column of a cell
+  const auto column = [](const std::shared_ptr<mpm::Cell<Dim>> cell) {
+    return static_cast<unsigned>(cell->nodal_coordinates().col(0).minCoeff() +
+                                 0.5);
+  };
+
+  // Two materials, particles in the first column of cells have material 1
+  Json jmaterial;
+  jmaterial["density"] = 1000.;
+  jmaterial["youngs_modulus"] = 1.0E+7;
+  jmaterial["poisson_ratio"] = 0.3;
+  std::map<unsigned, std::shared_ptr<mpm::Material<Dim>>> materials;
+  for (unsigned id = 0; id < 2; ++id)
+    materials[id] =
+        Factory<mpm::Material<Dim>, unsigned, const Json&>::instance()->create(
+            "LinearElastic2D", std::move(id), jmaterial);
+
+  auto mesh = mpm_test::structured_mesh_2d(ncells, 2);
+  mesh->initialise_material_models(materials);
+  mesh->iterate_over_particles(
+      [&materials](std::shared_ptr<mpm::ParticleBase<Dim>> ptr) {
+        const unsigned mid = (ptr->coordinates()(0) < 1.) ? 1 : 0;
+        ptr->assign_material(materials.at(mid));
+      });
+  const auto cells = mesh->cells();
+
+  SECTION("Check recorded stress cost") {
+    REQUIRE(materials.at(0)->stress_cost().second == 0);
+    mesh->compute_stress_batched(phase);
+    REQUIRE(materials.at(0)->stress_cost().second == 3 * ncells * 4);
+    REQUIRE(materials.at(1)->stress_cost().second == ncells * 4);
+    REQUIRE(materials.at(0)->stress_cost().first >= 0.);
+  }
+
+  SECTION("Check cell cost weights") {
+    // Without recorded costs particles cost the same
+    auto costs = mesh->relative_material_costs();
+    REQUIRE(costs.at(0) == Approx(1.).epsilon(Tolerance));
+    REQUIRE(costs.at(1) == Approx(1.).epsilon(Tolerance));
+
+    // Particles of material 1 are three times as expensive
+    materials.at(0)->record_stress_cost(1., 100);
+    materials.at(1)->record_stress_cost(3., 100);
+    costs = mesh->relative_material_costs();
+    REQUIRE(costs.at(0) == Approx(1.).epsilon(Tolerance));
+    REQUIRE(costs.at(1) == Approx(3.).epsilon(Tolerance));
+
+    mesh->find_nglobal_particles_cells();
+    for (auto citr = cells.cbegin(); citr != cells.cend(); ++citr) {
+      REQUIRE((*citr)->nglobal_particles() == 4);
+      REQUIRE((*citr)->particles_cost() == (column(*citr) == 0 ? 12 : 4));
+    }
+  }
+}
+#endif
@@ -1,3 +1,4 @@
+#include <cmath>
 #include <limits>
 
 #include "Eigen/Dense"
@@ -82,6 +83,14 @@ TEST_CASE("LinearElastic is checked in 2D", "[material][linear_elastic][2D]") {
       auto state_vars_test = material->state_variables();
       REQUIRE(state_vars == state_vars_test);
     }
+
+    // Check elastic wave speed
+    SECTION("Wave speed is computed") {
+      // Constrained modulus
+      const double modulus = 1.0E+7 * (1. - 0.3) / ((1. + 0.3) * (1. - 0.6));
+      REQUIRE(material->wave_speed() ==
+              Approx(std::sqrt(modulus / 1000.)).epsilon(Tolerance));
+    }
   }
 
   SECTION("LinearElastic check stresses") {
@@ -8,6 +8,7 @@
 
 #include "cell.h"
 #include "material.h"
+#include "modified_cam_clay.h"
 #include "node.h"
 #include "particle.h"
 
@@ -138,6 +139,13 @@ TEST_CASE("Modified cam clay undrained condition is checked in 3D",
                                                    "subloading_r"};
       auto state_vars_test = material->state_variables();
       REQUIRE(state_vars == state_vars_test);
+
+      // State variables are indexed in the order of their names
+      REQUIRE(state_variables.index("bulk_modulus") ==
+              mpm::ModifiedCamClay<Dim>::BulkModulus);
+      REQUIRE(state_variables.index("p") == mpm::ModifiedCamClay<Dim>::P);
+      REQUIRE(state_variables.index("subloading_r") ==
+              mpm::ModifiedCamClay<Dim>::SubloadingR);
     }
   }
 
@@ -121,6 +121,12 @@ TEST_CASE("MohrCoulomb is checked in 2D (cohesion only, without softening)",
           "phi", "psi", "cohesion", "epsilon", "rho", "theta", "pdstrain"};
       auto state_vars_test = material->state_variables();
       REQUIRE(state_vars == state_vars_test);
+
+      // State variables are indexed in the order of their names
+      REQUIRE(state_variables.index("phi") == mpm::MohrCoulomb<Dim>::Phi);
+      REQUIRE(state_variables.index("theta") == mpm::MohrCoulomb<Dim>::Theta);
+      REQUIRE(state_variables.index("pdstrain") ==
+              mpm::MohrCoulomb<Dim>::PDStrain);
     }
   }
 
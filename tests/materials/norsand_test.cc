@@ -8,6 +8,7 @@
 
 #include "cell.h"
 #include "material.h"
+#include "norsand.h"
 #include "node.h"
 #include "particle.h"
 
@@ -134,6 +135,12 @@ TEST_CASE("NorSand is checked in 3D non-bonded model",
           "plastic_strain5"};
       auto state_vars_test = material->state_variables();
       REQUIRE(state_vars == state_vars_test);
+
+      // State variables are indexed in the order of their names
+      REQUIRE(state_variables.index("M_theta") == mpm::NorSand<Dim>::MTheta);
+      REQUIRE(state_variables.index("pdstrain") == mpm::NorSand<Dim>::PDStrain);
+      REQUIRE(state_variables.index("plastic_strain5") ==
+              mpm::NorSand<Dim>::PlasticStrain5);
     }
   }
 
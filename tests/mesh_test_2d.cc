@@ -1,6 +1,12 @@
+#include <chrono>
 #include <cmath>
+#include <functional>
+#include <iostream>
 #include <limits>
+#include <map>
 #include <memory>
+#include <numeric>
+#include <set>
 
 #include <Eigen/Dense>
 #include <boost/filesystem.hpp>
@@ -16,10 +22,13 @@
 #include "function_base.h"
 #include "hexahedron_element.h"
 #include "linear_function.h"
+#include "material.h"
 #include "mesh.h"
+#include "mpm_scheme_usf.h"
 #include "node.h"
 #include "partio_writer.h"
 #include "quadrilateral_element.h"
+#include "structured_mesh.h"
 
 //! Check mesh class for 2D case
 TEST_CASE("Mesh is checked for 2D case", "[mesh][2D]") {
@@ -902,6 +911,30 @@ TEST_CASE("Mesh is checked for 2D case", "[mesh][2D]") {
               particles = mesh->locate_particles_mesh();
               // Should miss particle100
               REQUIRE(particles.size() == 0);
+
+              // Check cell bucket grid is built
+              REQUIRE(mesh->ncell_buckets() > 0);
+
+              // Create particle 101 in cell 1
+              coords << 0.9, 0.4;
+              std::shared_ptr<mpm::ParticleBase<Dim>> particle101 =
+                  std::make_shared<mpm::Particle<Dim>>(101, coords);
+              REQUIRE(mesh->add_particle(particle101) == true);
+              REQUIRE(particle101->cell_id() == 1);
+
+              // Move particle 101 to cell 0 and locate using buckets
+              coords << 0.1, 0.4;
+              particle101->assign_coordinates(coords);
+              particles = mesh->locate_particles_mesh();
+              REQUIRE(particles.size() == 0);
+              REQUIRE(particle101->cell_id() == 0);
+
+              // Move particle 101 outside the mesh
+              coords << 2.0, 0.25;
+              particle101->assign_coordinates(coords);
+              particles = mesh->locate_particles_mesh();
+              REQUIRE(particles.size() == 1);
+              REQUIRE(particles.at(0)->id() == 101);
             }
 
             // Test HDF5
@@ -911,6 +944,20 @@ TEST_CASE("Mesh is checked for 2D case", "[mesh][2D]") {
               auto phdf5 = mesh->particles_hdf5();
               REQUIRE(phdf5.size() == mesh->nparticles());
 
+              // Columns are written from the particles directly
+              const auto columns = mesh->particles_hdf5_columns();
+              REQUIRE(columns.nparticles() == mesh->nparticles());
+              for (unsigned i = 0; i < phdf5.size(); ++i) {
+                const auto particle = columns.unpack(i);
+                REQUIRE(particle.id == phdf5[i].id);
+                REQUIRE(particle.mass == Approx(phdf5[i].mass));
+                REQUIRE(particle.coord_y == Approx(phdf5[i].coord_y));
+                REQUIRE(particle.coord_z == Approx(0.));
+                REQUIRE(particle.cell_id == phdf5[i].cell_id);
+                REQUIRE(particle.nstate_vars == phdf5[i].nstate_vars);
+                REQUIRE(columns.nstate_vars() >= particle.nstate_vars);
+              }
+
 #ifdef USE_PARTIO
               REQUIRE_NOTHROW(mpm::partio::write_particles(
                   "partio-2d.bgeo", mesh->particles_hdf5()));
@@ -1267,6 +1314,88 @@ TEST_CASE("Mesh is checked for 2D case", "[mesh][2D]") {
     }
   }
 
+  //! Check structured grid of a cartesian mesh
+  SECTION("Check structured grid") {
+    // Nodal coordinates of a 3 x 2 grid of 0.5 x 0.5 cells
+    std::vector<Eigen::Matrix<double, Dim, 1>> coordinates;
+    for (unsigned j = 0; j < 3; ++j)
+      for (unsigned i = 0; i < 4; ++i)
+        coordinates.emplace_back(Eigen::Vector2d(0.5 * i, 0.5 * j));
+
+    // Cells
+    std::vector<std::vector<mpm::Index>> cells{{0, 1, 5, 4},  {1, 2, 6, 5},
+                                               {2, 3, 7, 6},  {4, 5, 9, 8},
+                                               {5, 6, 10, 9}, {6, 7, 11, 10}};
+    std::shared_ptr<mpm::Element<Dim>> element =
+        Factory<mpm::Element<Dim>>::instance()->create("ED2Q4");
+
+    SECTION("Check isoparametric mesh") {
+      auto mesh = std::make_shared<mpm::Mesh<Dim>>(0, true);
+      REQUIRE(mesh->create_nodes(0, "N2D", coordinates, false) == true);
+      REQUIRE(mesh->create_cells(0, element, cells, false) == true);
+      // Isoparametric mesh is not structured
+      REQUIRE(mesh->compute_structured_grid() == false);
+      REQUIRE(mesh->is_structured() == false);
+    }
+
+    SECTION("Check non-uniform mesh") {
+      coordinates.at(1)(0) = 0.4;
+      coordinates.at(5)(0) = 0.4;
+      coordinates.at(9)(0) = 0.4;
+      auto mesh = std::make_shared<mpm::Mesh<Dim>>(0, false);
+      REQUIRE(mesh->create_nodes(0, "N2D", coordinates, false) == true);
+      REQUIRE(mesh->create_cells(0, element, cells, false) == true);
+      REQUIRE(mesh->compute_structured_grid() == false);
+      REQUIRE(mesh->is_structured() == false);
+    }
+
+    SECTION("Check cartesian mesh") {
+      auto mesh = std::make_shared<mpm::Mesh<Dim>>(0, false);
+      REQUIRE(mesh->create_nodes(0, "N2D", coordinates, false) == true);
+      REQUIRE(mesh->create_cells(0, element, cells, false) == true);
+      REQUIRE(mesh->compute_structured_grid() == true);
+      REQUIRE(mesh->is_structured() == true);
+
+      // Particle in cell 4
+      Eigen::Vector2d coords;
+      coords << 0.75, 0.625;
+      std::shared_ptr<mpm::ParticleBase<Dim>> particle =
+          std::make_shared<mpm::Particle<Dim>>(0, coords);
+      REQUIRE(mesh->add_particle(particle) == true);
+      REQUIRE(particle->cell_id() == 4);
+      REQUIRE(particle->reference_location()(0) ==
+              Approx(0.).epsilon(Tolerance));
+      REQUIRE(particle->reference_location()(1) ==
+              Approx(-0.5).epsilon(Tolerance));
+
+      // Move particle within cell 4
+      coords << 0.625, 0.875;
+      particle->assign_coordinates(coords);
+      REQUIRE(mesh->locate_particles_mesh().size() == 0);
+      REQUIRE(particle->cell_id() == 4);
+      REQUIRE(particle->reference_location()(0) ==
+              Approx(-0.5).epsilon(Tolerance));
+      REQUIRE(particle->reference_location()(1) ==
+              Approx(0.5).epsilon(Tolerance));
+
+      // Move particle to the corner of the mesh
+      coords << 1.5, 1.0;
+      particle->assign_coordinates(coords);
+      REQUIRE(mesh->locate_particles_mesh().size() == 0);
+      REQUIRE(particle->cell_id() == 5);
+
+      // Move particle outside the mesh
+      coords << 1.6, 0.5;
+      particle->assign_coordinates(coords);
+      REQUIRE(mesh->locate_particles_mesh().size() == 1);
+
+      // Adding a cell invalidates the structured grid
+      auto cell = std::make_shared<mpm::Cell<Dim>>(10, 4, element, false);
+      REQUIRE(mesh->add_cell(cell) == true);
+      REQUIRE(mesh->is_structured() == false);
+    }
+  }
+
   //! Check if nodal properties is initialised
   SECTION("Check nodal properties initialisation") {
     // Create the different meshes
@@ -1306,3 +1435,927 @@ TEST_CASE("Mesh is checked for 2D case", "[mesh][2D]") {
     REQUIRE_NOTHROW(mesh->initialise_nodal_properties());
   }
 }
+
+//! \brief Check coloured particle to node scatter for 2D case
+TEST_CASE("Coloured particle scatter is checked for 2D case",
+          "[mesh][scatter][2D]") {
+  // Dimension
+  const unsigned Dim = 2;
+  // Phase
+  const unsigned phase = 0;
+  // Tolerance
+  const double Tolerance = 1.E-7;
+  // Number of cells in each direction
+  const unsigned ncells = 8;
+
+  auto mesh = mpm_test::structured_mesh_2d(ncells, 2);
+  REQUIRE(mesh->ncells() == ncells * ncells);
+  REQUIRE(mesh->nparticles() == 4 * ncells * ncells);
+
+  SECTION("Check cell colours") {
+    REQUIRE(mesh->ncell_colours() == 0);
+    REQUIRE(mesh->compute_cell_colours() == true);
+    // A structured quadrilateral mesh needs 4 colours
+    REQUIRE(mesh->ncell_colours() == 4);
+
+    unsigned ncoloured = 0;
+    for (unsigned colour = 0; colour < mesh->ncell_colours(); ++colour) {
+      const auto& cells = mesh->cell_colour(colour);
+      ncoloured += cells.size();
+      // Cells of a colour do not share a node
+      std::set<mpm::Index> node_ids;
+      for (auto citr = cells.cbegin(); citr != cells.cend(); ++citr)
+        for (const auto& node : (*citr)->nodes())
+          REQUIRE(node_ids.insert(node->id()).second == true);
+    }
+    REQUIRE(ncoloured == mesh->ncells());
+  }
+
+  SECTION("Check coloured scatter matches mutex scatter") {
+    // Mutex scatter
+    mesh->iterate_over_particles(
+        std::bind(&mpm::ParticleBase<Dim>::map_mass_momentum_to_nodes,
+                  std::placeholders::_1, true));
+
+    std::vector<double> masses;
+    std::vector<Eigen::Vector2d> momenta;
+    for (mpm::Index id = 0; id < mesh->nnodes(); ++id) {
+      masses.emplace_back(mesh->node(id)->mass(phase));
+      momenta.emplace_back(mesh->node(id)->momentum(phase));
+    }
+
+    // Coloured scatter updates nodes without locks
+    mesh->iterate_over_nodes(
+        std::bind(&mpm::NodeBase<Dim>::initialise, std::placeholders::_1));
+    REQUIRE(mesh->compute_cell_colours() == true);
+    unsigned nlocked = 0;
+    mesh->iterate_over_particles_coloured(
+        [&nlocked](const std::shared_ptr<mpm::ParticleBase<Dim>>& particle,
+                   bool lock) {
+          if (lock) {
+#pragma omp atomic
+            ++nlocked;
+          }
+          particle->map_mass_momentum_to_nodes(lock);
+        });
+    REQUIRE(nlocked == 0);
+
+    double total_mass = 0.;
+    for (mpm::Index id = 0; id < mesh->nnodes(); ++id) {
+      REQUIRE(mesh->node(id)->mass(phase) ==
+              Approx(masses.at(id)).epsilon(Tolerance));
+      for (unsigned i = 0; i < Dim; ++i)
+        REQUIRE(mesh->node(id)->momentum(phase)(i) ==
+                Approx(momenta.at(id)(i)).epsilon(Tolerance));
+      total_mass += mesh->node(id)->mass(phase);
+    }
+    // Total nodal mass is the mass of the particles
+    REQUIRE(total_mass == Approx(1000. * ncells * ncells).epsilon(Tolerance));
+  }
+}
+
+//! \brief Benchmark coloured and mutex particle to node scatter
+//! Run with: ./mpmtest "[benchmark][scatter]"
+TEST_CASE("Coloured and mutex particle scatter are benchmarked",
+          "[.][benchmark][scatter][2D]") {
+  // Dimension
+  const unsigned Dim = 2;
+  // Number of cells in each direction
+  const unsigned ncells = 200;
+  // Number of repetitions
+  const unsigned nrepeats = 20;
+
+  auto mesh = mpm_test::structured_mesh_2d(ncells, 2);
+  REQUIRE(mesh->compute_cell_colours() == true);
+
+  const auto scatter = [&mesh](bool coloured) {
+    const auto start = std::chrono::steady_clock::now();
+    for (unsigned i = 0; i < nrepeats; ++i) {
+      mesh->iterate_over_nodes(
+          std::bind(&mpm::NodeBase<Dim>::initialise, std::placeholders::_1));
+      const auto map = std::bind(
+          &mpm::ParticleBase<Dim>::map_mass_momentum_to_nodes,
+          std::placeholders::_1, std::placeholders::_2);
+      if (coloured)
+        mesh->iterate_over_particles_coloured(map);
+      else
+        mesh->iterate_over_particles(std::bind(map, std::placeholders::_1,
+                                               true));
+    }
+    const auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::milli>(end - start).count() /
+           nrepeats;
+  };
+
+  const double mutex_time = scatter(false);
+  const double coloured_time = scatter(true);
+  std::cout << "Particle scatter of " << mesh->nparticles()
+            << " particles, mutex: " << mutex_time
+            << " ms, coloured: " << coloured_time << " ms\n";
+}
+
+#ifdef USE_MPI
+//! \brief Check neighbour halo exchange for 2D case
+TEST_CASE("Nodal halo exchange is checked for 2D case", "[mesh][halo][2D]") {
+  // Dimension
+  const unsigned Dim = 2;
+  // Phase
+  const unsigned phase = 0;
+  // Tolerance
+  const double Tolerance = 1.E-7;
+  // Number of cells in each direction
+  const unsigned ncells = 4;
+
+  int mpi_size;
+  MPI_Comm_size(MPI_COMM_WORLD, &mpi_size);
+
+  // Run on a single rank, the right half of the mesh belongs to rank 1
+  if (mpi_size == 1) {
+    auto mesh = mpm_test::structured_mesh_2d(ncells, 2);
+    mesh->iterate_over_cells([](std::shared_ptr<mpm::Cell<Dim>> cell) {
+      if (cell->nodal_coordinates().col(0).minCoeff() >= 2.) cell->rank(1);
+    });
+    mesh->find_domain_shared_nodes();
+
+    // Nodes on x = 2 are shared, but rank 1 is not in the communicator
+    REQUIRE(mesh->nshared_nodes() == ncells + 1);
+    REQUIRE(mesh->nhalo_neighbours() == 0);
+
+    // Local cells touching x = 2 are halo cells
+    REQUIRE(mesh->nhalo_cells() == ncells);
+    REQUIRE(mesh->ninterior_cells() == ncells);
+
+    // Map halo and interior particles of the local cells
+    unsigned nhalo_particles = 0;
+    mesh->iterate_over_halo_particles(
+        [&nhalo_particles](std::shared_ptr<mpm::ParticleBase<Dim>> ptr) {
+          ptr->map_mass_momentum_to_nodes();
+#pragma omp atomic
+          ++nhalo_particles;
+        },
+        true);
+    REQUIRE(nhalo_particles == 4 * ncells);
+    mesh->iterate_over_halo_particles(
+        std::bind(&mpm::ParticleBase<Dim>::map_mass_momentum_to_nodes,
+                  std::placeholders::_1, true),
+        false);
+    std::vector<double> masses;
+    std::vector<Eigen::Vector2d> momenta;
+    for (mpm::Index id = 0; id < mesh->nnodes(); ++id) {
+      masses.emplace_back(mesh->node(id)->mass(phase));
+      momenta.emplace_back(mesh->node(id)->momentum(phase));
+    }
+
+    // Exchange mass and momentum in a single message
+    using MassMomentum = Eigen::Matrix<double, Dim + 1, 1>;
+    const auto getter =
+        [phase](const std::shared_ptr<mpm::NodeBase<Dim>>& node) {
+          MassMomentum value;
+          value(0) = node->mass(phase);
+          value.tail<Dim>() = node->momentum(phase);
+          return value;
+        };
+    const auto setter = [phase](
+                            const std::shared_ptr<mpm::NodeBase<Dim>>& node,
+                            const MassMomentum& value) {
+      node->update_mass(false, phase, value(0));
+      node->update_momentum(false, phase, value.tail<Dim>());
+    };
+    mesh->template nodal_halo_exchange<MassMomentum, Dim + 1>(getter, setter);
+
+    // Split exchange
+    mesh->template begin_nodal_halo_exchange<MassMomentum, Dim + 1>(getter);
+    mesh->template end_nodal_halo_exchange<MassMomentum, Dim + 1>(getter,
+                                                                  setter);
+
+    // Local contributions are preserved
+    for (mpm::Index id = 0; id < mesh->nnodes(); ++id) {
+      REQUIRE(mesh->node(id)->mass(phase) ==
+              Approx(masses.at(id)).epsilon(Tolerance));
+      for (unsigned i = 0; i < Dim; ++i)
+        REQUIRE(mesh->node(id)->momentum(phase)(i) ==
+                Approx(momenta.at(id)(i)).epsilon(Tolerance));
+    }
+  }
+}
+#endif
+
+//! \brief Check batched particle stress for 2D case
+TEST_CASE("Batched particle stress is checked for 2D case",
+          "[mesh][stress][2D]") {
+  // Dimension
+  const unsigned Dim = 2;
+  // Phase
+  const unsigned phase = 0;
+  // Tolerance
+  const double Tolerance = 1.E-7;
+  // Time step
+  const double dt = 0.01;
+  // Number of cells in each direction
+  const unsigned ncells = 8;
+
+  // Material properties
+  Json jmaterial;
+  jmaterial["density"] = 1000.;
+  jmaterial["youngs_modulus"] = 1.0E+7;
+  jmaterial["poisson_ratio"] = 0.3;
+  jmaterial["bulk_modulus"] = 1.0E+7;
+  jmaterial["dynamic_viscosity"] = 8.9E-4;
+  jmaterial["softening"] = false;
+  jmaterial["friction"] = 30.;
+  jmaterial["dilation"] = 0.;
+  jmaterial["cohesion"] = 1000.;
+  jmaterial["residual_friction"] = 30.;
+  jmaterial["residual_dilation"] = 0.;
+  jmaterial["residual_cohesion"] = 0.;
+  jmaterial["peak_pdstrain"] = 0.;
+  jmaterial["residual_pdstrain"] = 0.;
+  jmaterial["tension_cutoff"] = 0.;
+
+  const std::vector<std::string> materials = {"LinearElastic2D",
+                                              "MohrCoulomb2D", "Newtonian2D"};
+  for (const auto& material_type : materials) {
+    auto mesh = mpm_test::structured_mesh_2d(ncells, 2);
+    auto material =
+        Factory<mpm::Material<Dim>, unsigned, const Json&>::instance()->create(
+            material_type, 0, jmaterial);
+
+    // Compute strain increments from a non-uniform velocity field
+    mesh->iterate_over_particles(
+        [&material](std::shared_ptr<mpm::ParticleBase<Dim>> ptr) {
+          ptr->assign_material(material);
+          ptr->map_mass_momentum_to_nodes();
+        });
+    mesh->iterate_over_nodes([](std::shared_ptr<mpm::NodeBase<Dim>> node) {
+      node->compute_velocity();
+    });
+    mesh->iterate_over_particles(
+        [dt](std::shared_ptr<mpm::ParticleBase<Dim>> ptr) {
+          ptr->compute_strain(dt);
+        });
+
+    // Particles in a fixed order
+    std::vector<std::shared_ptr<mpm::ParticleBase<Dim>>> particles;
+    mesh->iterate_over_particles(
+        [&particles](std::shared_ptr<mpm::ParticleBase<Dim>> ptr) {
+#pragma omp critical
+          particles.emplace_back(ptr);
+        });
+    REQUIRE(particles.size() == mesh->nparticles());
+
+    // Initial state
+    std::vector<Eigen::Matrix<double, 6, 1>> initial_stresses;
+    std::vector<mpm::dense_map> initial_state_vars;
+    for (mpm::Index id = 0; id < mesh->nparticles(); ++id) {
+      auto particle = particles.at(id);
+      Eigen::Matrix<double, 6, 1> stress;
+      stress << -2000. - id, -1000., -1500., 100. * (id % 7), 0., 0.;
+      particle->initial_stress(stress);
+      initial_stresses.emplace_back(stress);
+      initial_state_vars.emplace_back(particle->state_variables(phase));
+    }
+
+    // Stresses of each particle
+    mesh->iterate_over_particles(
+        std::bind(&mpm::ParticleBase<Dim>::compute_stress,
+                  std::placeholders::_1));
+    std::vector<Eigen::Matrix<double, 6, 1>> stresses;
+    std::vector<mpm::dense_map> state_vars;
+    for (mpm::Index id = 0; id < mesh->nparticles(); ++id) {
+      auto particle = particles.at(id);
+      stresses.emplace_back(particle->stress());
+      state_vars.emplace_back(particle->state_variables(phase));
+      // Reset state
+      particle->initial_stress(initial_stresses.at(id));
+      REQUIRE(particle->assign_material_state_vars(
+                  initial_state_vars.at(id), material, phase) == true);
+    }
+
+    // Batched stresses match the stresses of each particle
+    mesh->compute_stress_batched(phase);
+    for (mpm::Index id = 0; id < mesh->nparticles(); ++id) {
+      auto particle = particles.at(id);
+      for (unsigned i = 0; i < 6; ++i)
+        REQUIRE(particle->stress()(i) ==
+                Approx(stresses.at(id)(i)).epsilon(Tolerance));
+      const auto particle_state_vars = particle->state_variables(phase);
+      REQUIRE(particle_state_vars.size() == state_vars.at(id).size());
+      for (unsigned i = 0; i < particle_state_vars.size(); ++i)
+        REQUIRE(particle_state_vars[i] ==
+                Approx(state_vars.at(id)[i]).epsilon(Tolerance));
+    }
+  }
+}
+
+//! \brief Benchmark batched and per particle stress update
+//! Run with: ./mpmtest "[benchmark][stress]"
+TEST_CASE("Batched particle stress is benchmarked",
+          "[.][benchmark][stress][2D]") {
+  // Dimension
+  const unsigned Dim = 2;
+  // Phase
+  const unsigned phase = 0;
+  // Number of cells in each direction
+  const unsigned ncells = 200;
+  // Number of repetitions
+  const unsigned nrepeats = 20;
+
+  auto mesh = mpm_test::structured_mesh_2d(ncells, 2);
+
+  const auto update = [&mesh, phase](bool batched) {
+    const auto start = std::chrono::steady_clock::now();
+    for (unsigned i = 0; i < nrepeats; ++i) {
+      if (batched)
+        mesh->compute_stress_batched(phase);
+      else
+        mesh->iterate_over_particles(
+            std::bind(&mpm::ParticleBase<Dim>::compute_stress,
+                      std::placeholders::_1));
+    }
+    const auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::milli>(end - start).count() /
+           nrepeats;
+  };
+
+  const double particle_time = update(false);
+  const double batched_time = update(true);
+  std::cout << "Linear elastic stress of " << mesh->nparticles()
+            << " particles, per particle: " << particle_time
+            << " ms, batched: " << batched_time << " ms\n";
+}
+
+//! \brief Check spatial reordering of particles and nodes for 2D case
+TEST_CASE("Spatial reordering is checked for 2D case", "[mesh][reorder][2D]") {
+  // Dimension
+  const unsigned Dim = 2;
+  // Phase
+  const unsigned phase = 0;
+  // Tolerance
+  const double Tolerance = 1.E-7;
+  // Time step
+  const double dt = 0.001;
+  // Number of steps
+  const unsigned nsteps = 3;
+  // Gravity
+  Eigen::Matrix<double, Dim, 1> gravity;
+  gravity << 0., -9.81;
+
+  // Particles of a mesh ordered by id
+  const auto ordered_particles = [](
+      const std::shared_ptr<mpm::Mesh<Dim>>& mesh) {
+    std::map<mpm::Index, std::shared_ptr<mpm::ParticleBase<Dim>>> particles;
+    mesh->iterate_over_particles(
+        [&particles](std::shared_ptr<mpm::ParticleBase<Dim>> ptr) {
+#pragma omp critical
+          particles.emplace(ptr->id(), ptr);
+        });
+    return particles;
+  };
+
+  SECTION("Check Morton order") {
+    // Points of a 4 x 4 grid in row major order
+    std::vector<Eigen::Matrix<double, Dim, 1>> points;
+    for (unsigned j = 0; j < 4; ++j)
+      for (unsigned i = 0; i < 4; ++i) points.emplace_back(i * 1., j * 1.);
+    const auto order = mpm::morton::order<Dim>(points);
+    // Z-order visits each 2 x 2 block in turn
+    const std::vector<mpm::Index> expected = {0, 4, 1, 5, 8,  12, 9,  13,
+                                              2, 6, 3, 7, 10, 14, 11, 15};
+    REQUIRE(order == expected);
+
+    // Each 2 x 2 block is a part
+    const auto parts = mpm::morton::partition<Dim>(points, 4);
+    for (unsigned i = 0; i < expected.size(); ++i)
+      REQUIRE(parts[expected[i]] == i / 4);
+  }
+
+  SECTION("Check reordered mesh") {
+    // Reordered and reference meshes
+    auto mesh = mpm_test::structured_mesh_2d(8, 2);
+    auto reference = mpm_test::structured_mesh_2d(8, 2);
+
+    // Particle set of every other particle
+    tsl::robin_map<mpm::Index, std::vector<mpm::Index>> psets;
+    for (mpm::Index i = 0; i < mesh->nparticles(); i += 2)
+      psets[1].emplace_back(i);
+    REQUIRE(mesh->create_particle_sets(psets, false) == true);
+
+    REQUIRE(mesh->reorder_mesh() == true);
+    REQUIRE(mesh->compute_cell_colours() == true);
+
+    // Nodal state is moved with the store slots
+    const auto node_store = mesh->node_store();
+    for (mpm::Index i = 0; i < mesh->nnodes(); ++i) {
+      const auto node = mesh->node(i);
+      REQUIRE(node->node_store() == node_store);
+      REQUIRE(node->coordinates()(0) ==
+              Approx(reference->node(i)->coordinates()(0)).epsilon(Tolerance));
+    }
+
+    const auto scheme = std::make_shared<mpm::MPMSchemeUSF<Dim>>(mesh, dt);
+    const auto reference_scheme =
+        std::make_shared<mpm::MPMSchemeUSF<Dim>>(reference, dt);
+    for (unsigned step = 0; step < nsteps; ++step) {
+      mesh->reorder_particles();
+      for (auto& mpm_scheme : {scheme, reference_scheme}) {
+        mpm_scheme->initialise();
+        mpm_scheme->compute_nodal_kinematics(phase);
+        mpm_scheme->precompute_stress_strain(phase, false);
+        mpm_scheme->compute_forces(gravity, phase, step, false);
+        mpm_scheme->compute_particle_kinematics(false, phase, "Cundall",
+                                                0.02);
+        mpm_scheme->postcompute_stress_strain(phase, false);
+        mpm_scheme->locate_particles(true);
+      }
+    }
+    mesh->reorder_particles();
+
+    // Particle store slots follow the particles in cell order
+    const auto particles = mesh->particle_store()->cell_ids();
+    REQUIRE(particles.size() == mesh->nparticles());
+    std::set<mpm::Index> cells_visited;
+    mpm::Index last_cell = std::numeric_limits<mpm::Index>::max();
+    for (const auto cell_id : particles) {
+      if (cell_id != last_cell) {
+        // Particles of a cell are contiguous
+        REQUIRE(cells_visited.insert(cell_id).second == true);
+        last_cell = cell_id;
+      }
+    }
+
+    // Cell particle lists are consistent with the particles
+    mpm::Index ncell_particles = 0;
+    auto cells = mesh->cells();
+    for (auto citr = cells.cbegin(); citr != cells.cend(); ++citr) {
+      for (const auto pid : (*citr)->particles()) {
+        REQUIRE(ordered_particles(mesh).at(pid)->cell_id() == (*citr)->id());
+        ++ncell_particles;
+      }
+    }
+    REQUIRE(ncell_particles == mesh->nparticles());
+
+    // Particle set keeps its particles
+    std::set<mpm::Index> set_particles;
+    mesh->iterate_over_particle_set(
+        1, [&set_particles](std::shared_ptr<mpm::ParticleBase<Dim>> ptr) {
+#pragma omp critical
+          set_particles.insert(ptr->id());
+        });
+    REQUIRE(set_particles.size() == psets[1].size());
+    for (const auto pid : psets[1]) REQUIRE(set_particles.count(pid) == 1);
+
+    // Reordering does not change the solution
+    const auto reordered = ordered_particles(mesh);
+    const auto unordered = ordered_particles(reference);
+    REQUIRE(reordered.size() == unordered.size());
+    for (const auto& particle : reordered) {
+      const auto& ref = unordered.at(particle.first);
+      for (unsigned i = 0; i < Dim; ++i) {
+        REQUIRE(particle.second->coordinates()(i) ==
+                Approx(ref->coordinates()(i)).epsilon(Tolerance));
+        REQUIRE(particle.second->velocity()(i) ==
+                Approx(ref->velocity()(i)).epsilon(Tolerance));
+      }
+      for (unsigned i = 0; i < 6; ++i)
+        REQUIRE(particle.second->stress()(i) ==
+                Approx(ref->stress()(i)).epsilon(Tolerance));
+    }
+  }
+}
+
+//! \brief Check critical time step of particles for 2D case
+TEST_CASE("Critical time step is checked for 2D case", "[mesh][dt][2D]") {
+  // Dimension
+  const unsigned Dim = 2;
+  // Phase
+  const unsigned phase = 0;
+  // Tolerance
+  const double Tolerance = 1.E-7;
+  // Number of cells in each direction
+  const unsigned ncells = 4;
+
+  auto mesh = mpm_test::structured_mesh_2d(ncells, 2);
+
+  // Elastic wave speed from the constrained modulus
+  const double modulus = 1.0E+7 * (1. - 0.3) / ((1. + 0.3) * (1. - 0.6));
+  const double wave_speed = std::sqrt(modulus / 1000.);
+
+  SECTION("Check fastest particle") {
+    // Unit cells and particle velocity equal to its coordinates
+    double speed = 0.;
+    mesh->iterate_over_particles(
+        [&speed](std::shared_ptr<mpm::ParticleBase<Dim>> ptr) {
+#pragma omp critical
+          speed = std::max(speed, ptr->velocity().norm());
+        });
+    REQUIRE(speed > 0.);
+    REQUIRE(mesh->critical_time_step(phase) ==
+            Approx(1. / (wave_speed + speed)).epsilon(Tolerance));
+  }
+
+  SECTION("Check particles at rest") {
+    mesh->iterate_over_particles(
+        [](std::shared_ptr<mpm::ParticleBase<Dim>> ptr) {
+          ptr->assign_velocity(Eigen::Matrix<double, Dim, 1>::Zero());
+        });
+    REQUIRE(mesh->critical_time_step(phase) ==
+            Approx(1. / wave_speed).epsilon(Tolerance));
+  }
+
+  SECTION("Check mesh without particles") {
+    auto empty = std::make_shared<mpm::Mesh<Dim>>(1);
+    REQUIRE(empty->critical_time_step(phase) ==
+            std::numeric_limits<double>::max());
+  }
+}
+
+//! \brief Check bulk assignment of cell particle ids for 2D case
+TEST_CASE("Cell particle ids are checked for 2D case", "[mesh][locate][2D]") {
+  // Dimension
+  const unsigned Dim = 2;
+  // Number of cells in each direction
+  const unsigned ncells = 4;
+
+  auto mesh = mpm_test::structured_mesh_2d(ncells, 2);
+  REQUIRE(mesh->nparticles() == 64);
+
+  // Check particle ids of cells follow the order of particles
+  const auto check_cells = [](const std::shared_ptr<mpm::Mesh<Dim>>& mesh) {
+    // Position of each particle in the container of particles
+    std::map<mpm::Index, mpm::Index> positions;
+    std::map<mpm::Index, mpm::Index> particle_cells;
+    for (const auto& particle_cell : mesh->particles_cells()) {
+      positions.emplace(particle_cell[0], positions.size());
+      particle_cells.emplace(particle_cell[0], particle_cell[1]);
+    }
+
+    mpm::Index nparticles = 0;
+    auto cells = mesh->cells();
+    for (auto citr = cells.cbegin(); citr != cells.cend(); ++citr) {
+      const auto& pids = (*citr)->particles();
+      nparticles += pids.size();
+      for (unsigned i = 0; i < pids.size(); ++i) {
+        REQUIRE(particle_cells.at(pids[i]) == (*citr)->id());
+        if (i > 0) REQUIRE(positions.at(pids[i - 1]) < positions.at(pids[i]));
+      }
+    }
+    return nparticles;
+  };
+
+  // Particle ids in the order of the container of particles
+  std::vector<mpm::Index> order;
+  for (const auto& particle_cell : mesh->particles_cells())
+    order.emplace_back(particle_cell[0]);
+
+  // Shift particles by half a cell, the last column leaves the mesh
+  mesh->iterate_over_particles(
+      [](std::shared_ptr<mpm::ParticleBase<Dim>> ptr) {
+        Eigen::Matrix<double, Dim, 1> coordinates = ptr->coordinates();
+        coordinates(0) += 0.5;
+        ptr->assign_coordinates(coordinates);
+      });
+
+  SECTION("Check located particles") {
+    const auto unlocatable = mesh->locate_particles_mesh();
+    REQUIRE(unlocatable.size() == 8);
+    REQUIRE(check_cells(mesh) == 64);
+
+    // Remove unlocatable particles
+    std::vector<mpm::Index> pids;
+    for (const auto& particle : unlocatable) pids.emplace_back(particle->id());
+    mesh->remove_particles(pids);
+    REQUIRE(mesh->nparticles() == 56);
+    REQUIRE(check_cells(mesh) == 56);
+
+    // Order of the remaining particles is kept
+    const std::set<mpm::Index> removed(pids.begin(), pids.end());
+    std::vector<mpm::Index> remaining;
+    for (const auto id : order)
+      if (removed.find(id) == removed.end()) remaining.emplace_back(id);
+    std::vector<mpm::Index> current;
+    for (const auto& particle_cell : mesh->particles_cells())
+      current.emplace_back(particle_cell[0]);
+    REQUIRE(current == remaining);
+  }
+}
+
+#ifdef USE_MPI
+//! \brief Check distributed mesh of a partition and a halo layer for 2D case
+TEST_CASE("Distributed mesh is checked for 2D case",
+          "[mesh][distributed][2D]") {
+  // Dimension
+  const unsigned Dim = 2;
+  // Number of cells in each direction
+  const unsigned ncells = 4;
+  // Maximum index of cells and nodes not in the mesh
+  const mpm::Index max_index = std::numeric_limits<mpm::Index>::max();
+
+  int mpi_size;
+  MPI_Comm_size(MPI_COMM_WORLD, &mpi_size);
+  int mpi_rank;
+  MPI_Comm_rank(MPI_COMM_WORLD, &mpi_rank);
+
+  // Column of a cell
+  const auto column = [](const std::shared_ptr<mpm::Cell<Dim>>& cell) {
+    return static_cast<unsigned>(cell->nodal_coordinates().col(0).minCoeff() +
+                                 0.5);
+  };
+
+  // Neighbours of cells are in the mesh
+  const auto check_neighbours = [mpi_rank, max_index](
+                                    const std::shared_ptr<mpm::Mesh<Dim>>&
+                                        mesh) {
+    const auto cells = mesh->cells();
+    for (auto citr = cells.cbegin(); citr != cells.cend(); ++citr) {
+      for (const auto neighbour : (*citr)->neighbours())
+        REQUIRE(mesh->local_cell_index(neighbour) != max_index);
+      if ((*citr)->rank() == mpi_rank) REQUIRE((*citr)->nneighbours() > 0);
+    }
+  };
+
+  // Run on a single rank, the right half of the mesh belongs to rank 1
+  if (mpi_size == 1) {
+    auto mesh = mpm_test::structured_mesh_2d(ncells, 2);
+    mesh->find_cell_neighbours();
+    mesh->iterate_over_cells(
+        [&column](std::shared_ptr<mpm::Cell<Dim>> cell) {
+          if (column(cell) >= 2) cell->rank(1);
+        });
+    REQUIRE(mesh->is_distributed() == false);
+    REQUIRE(mesh->compute_cell_colours() == true);
+
+    mesh->remove_all_nonrank_particles();
+    mesh->remove_all_nonrank_cells();
+    REQUIRE(mesh->is_distributed() == true);
+
+    // Remaining cells are coloured again
+    REQUIRE(mesh->ncell_colours() > 0);
+    mpm::Index ncoloured = 0;
+    for (unsigned i = 0; i < mesh->ncell_colours(); ++i)
+      ncoloured += mesh->cell_colour(i).size();
+    REQUIRE(ncoloured == mesh->ncells());
+
+    // Two local columns and a halo column of cells
+    REQUIRE(mesh->ncells() == 3 * ncells);
+    REQUIRE(mesh->nnodes() == 4 * (ncells + 1));
+    REQUIRE(mesh->nparticles() == 2 * ncells * 4);
+    REQUIRE(mesh->nshared_nodes() == ncells + 1);
+
+    // Cells and nodes are indexed in the order of ids
+    REQUIRE(mesh->local_cell_index(0) == 0);
+    REQUIRE(mesh->local_cell_index(2) == 2);
+    REQUIRE(mesh->local_cell_index(3) == max_index);
+    REQUIRE(mesh->local_cell_index(4) == 3);
+    REQUIRE(mesh->local_node_index(3) == 3);
+    REQUIRE(mesh->local_node_index(4) == max_index);
+    REQUIRE(mesh->local_node_index(5) == 4);
+    check_neighbours(mesh);
+
+    // Particle weights of local cells
+    mesh->find_nglobal_particles_cells();
+    const auto cells = mesh->cells();
+    for (auto citr = cells.cbegin(); citr != cells.cend(); ++citr)
+      if ((*citr)->rank() == 0) REQUIRE((*citr)->nglobal_particles() == 4);
+  }
+
+  // Run on four ranks, each rank owns a column of cells
+  if (mpi_size == 4) {
+    auto mesh = mpm_test::structured_mesh_2d(ncells, 2);
+    mesh->find_cell_neighbours();
+    mesh->iterate_over_cells(
+        [&column](std::shared_ptr<mpm::Cell<Dim>> cell) {
+          cell->rank(column(cell));
+        });
+    // Nodes and cells at the bottom of the mesh are in set 0
+    tsl::robin_map<mpm::Index, std::vector<mpm::Index>> node_sets, cell_sets;
+    for (mpm::Index i = 0; i <= ncells; ++i) node_sets[0].emplace_back(i);
+    for (mpm::Index i = 0; i < ncells; ++i) cell_sets[0].emplace_back(i);
+    REQUIRE(mesh->create_node_sets(node_sets, false) == true);
+    REQUIRE(mesh->create_cell_sets(cell_sets, false) == true);
+
+    // Boundary conditions at the bottom of the mesh
+    Json jfunction;
+    jfunction["xvalues"] = std::vector<double>{0.0, 1.0};
+    jfunction["fxvalues"] = std::vector<double>{0.0, 2.0};
+    std::shared_ptr<mpm::FunctionBase> mfunction =
+        std::make_shared<mpm::LinearFunction>(1, jfunction);
+    REQUIRE(mesh->assign_nodal_concentrated_forces(mfunction, 0, 0, 10.) ==
+            true);
+    Eigen::Matrix2d rotation_matrix;
+    rotation_matrix << 0., -1., 1., 0.;
+    const auto assign_constraints =
+        [&rotation_matrix](const std::shared_ptr<mpm::NodeBase<Dim>>& node) {
+          node->assign_velocity_constraint(1, 0.);
+          node->assign_friction_constraint(1, -1, 0.25);
+          node->assign_rotation_matrix(rotation_matrix);
+        };
+    mesh->iterate_over_nodes(
+        [&assign_constraints](std::shared_ptr<mpm::NodeBase<Dim>> node) {
+          if (node->coordinates()(1) < 1.E-7) assign_constraints(node);
+        });
+    mesh->find_domain_shared_nodes();
+    mesh->remove_all_nonrank_particles();
+    mesh->remove_all_nonrank_cells();
+
+    // A local column and the halo columns of cells
+    const unsigned ncolumns = (mpi_rank == 0 || mpi_rank == 3) ? 2 : 3;
+    REQUIRE(mesh->ncells() == ncolumns * ncells);
+    REQUIRE(mesh->nparticles() == ncells * 4);
+    REQUIRE(mesh->nhalo_neighbours() == ncolumns - 1);
+    check_neighbours(mesh);
+
+    // Bottom cell of a column moves to the rank on the right
+    std::vector<mpm::Index> exchange_cells;
+    if (mpi_rank < 3) {
+      auto cell = mesh->cells()[mesh->local_cell_index(mpi_rank)];
+      cell->rank(mpi_rank + 1);
+      exchange_cells.emplace_back(cell->id());
+    }
+    mesh->transfer_nonrank_cells(exchange_cells);
+
+    // Moved cell and its neighbours are in the receiving rank
+    if (mpi_rank > 0) {
+      REQUIRE(std::find(exchange_cells.begin(), exchange_cells.end(),
+                        mpi_rank - 1) != exchange_cells.end());
+      const auto cell = mesh->cells()[mesh->local_cell_index(mpi_rank - 1)];
+      REQUIRE(cell->rank() == mpi_rank);
+      for (const auto neighbour : cell->neighbours())
+        REQUIRE(mesh->local_cell_index(neighbour) != max_index);
+    }
+    // Transferred nodes hold boundary conditions, and transferred nodes and
+    // cells are in their sets
+    if (mpi_rank > 1) {
+      const mpm::Index id = mpi_rank - 2;
+      REQUIRE(mesh->local_node_index(id) != max_index);
+      const auto node = mesh->node(id);
+      std::shared_ptr<mpm::NodeBase<Dim>> reference =
+          std::make_shared<mpm::Node<Dim, Dim, 1>>(id, node->coordinates());
+      assign_constraints(reference);
+      reference->assign_concentrated_force(0, 0, 10., mfunction);
+      REQUIRE(node->serialize() == reference->serialize());
+      const auto set_nodes = mesh->nodes(0);
+      REQUIRE(std::find(set_nodes.cbegin(), set_nodes.cend(), node) !=
+              set_nodes.cend());
+
+      REQUIRE(mesh->local_cell_index(id) != max_index);
+      const auto cell = mesh->cells()[mesh->local_cell_index(id)];
+      REQUIRE(cell->element_ptr()->type() == "ED2Q4");
+      const auto set_cells = mesh->cells(0);
+      REQUIRE(std::find(set_cells.cbegin(), set_cells.cend(), cell) !=
+              set_cells.cend());
+    }
+
+    // Particles of moved cells
+    mesh->transfer_nonrank_particles(exchange_cells);
+    const unsigned nrank_cells =
+        (mpi_rank == 0) ? ncells - 1 : (mpi_rank == 3 ? ncells + 1 : ncells);
+    REQUIRE(mesh->nparticles() == nrank_cells * 4);
+
+    // Remove cells outside the new halo layer
+    mesh->remove_all_nonrank_cells();
+    check_neighbours(mesh);
+    REQUIRE(mesh->ncells_rank() == nrank_cells);
+  }
+
+  // Create only the cells of each rank and its halo layer, each rank owns a
+  // column of cells on four ranks and the right half of the mesh belongs to
+  // rank 1 on a single rank. Particles are created on four ranks, as no rank
+  // holds the particles of rank 1 on a single rank.
+  if (mpi_size == 1 || mpi_size == 4) {
+    std::vector<Eigen::Matrix<double, Dim, 1>> coordinates;
+    for (unsigned j = 0; j <= ncells; ++j)
+      for (unsigned i = 0; i <= ncells; ++i)
+        coordinates.emplace_back(Eigen::Vector2d(i * 1., j * 1.));
+    std::vector<std::vector<mpm::Index>> cells;
+    std::vector<unsigned> cell_ranks;
+    for (unsigned j = 0; j < ncells; ++j)
+      for (unsigned i = 0; i < ncells; ++i) {
+        const mpm::Index n0 = j * (ncells + 1) + i;
+        cells.emplace_back(std::vector<mpm::Index>{
+            n0, n0 + 1, n0 + ncells + 2, n0 + ncells + 1});
+        cell_ranks.emplace_back((mpi_size == 1) ? (i >= 2 ? 1 : 0) : i);
+      }
+
+    // Cells and nodes of the local rank and its halo layer
+    std::set<mpm::Index> rank_nodes, halo_cells, halo_nodes;
+    mpm::Index nrank_cells = 0;
+    for (mpm::Index i = 0; i < cells.size(); ++i)
+      if (static_cast<int>(cell_ranks[i]) == mpi_rank) {
+        rank_nodes.insert(cells[i].begin(), cells[i].end());
+        ++nrank_cells;
+      }
+    for (mpm::Index i = 0; i < cells.size(); ++i)
+      for (const auto nid : cells[i])
+        if (rank_nodes.count(nid)) {
+          halo_cells.insert(i);
+          halo_nodes.insert(cells[i].begin(), cells[i].end());
+        }
+
+    auto mesh = std::make_shared<mpm::Mesh<Dim>>(0);
+    std::shared_ptr<mpm::Element<Dim>> element =
+        Factory<mpm::Element<Dim>>::instance()->create("ED2Q4");
+    // Ids of nodes and cells are their indices in the global lists
+    std::vector<mpm::Index> node_ids(coordinates.size());
+    std::vector<mpm::Index> cell_ids(cells.size());
+    std::iota(node_ids.begin(), node_ids.end(), 0);
+    std::iota(cell_ids.begin(), cell_ids.end(), 0);
+    REQUIRE(mesh->create_distributed_mesh("N2D", node_ids, coordinates, element,
+                                          cell_ids, cells, cell_ranks) == true);
+    REQUIRE(mesh->is_distributed() == true);
+
+    // The rank holds no more than its cells and the halo layer
+    REQUIRE(mesh->ncells() == halo_cells.size());
+    REQUIRE(mesh->nnodes() == halo_nodes.size());
+    REQUIRE(mesh->node_store()->size() == halo_nodes.size());
+    REQUIRE(mesh->ncells_rank() == nrank_cells);
+    for (mpm::Index i = 0; i < cells.size(); ++i)
+      REQUIRE((mesh->local_cell_index(i) != max_index) ==
+              (halo_cells.count(i) == 1));
+    for (mpm::Index i = 0; i < coordinates.size(); ++i)
+      REQUIRE((mesh->local_node_index(i) != max_index) ==
+              (halo_nodes.count(i) == 1));
+    const unsigned ncolumns =
+        (mpi_size == 1) ? 3 : ((mpi_rank == 0 || mpi_rank == 3) ? 2 : 3);
+    REQUIRE(mesh->ncells() == ncolumns * ncells);
+    check_neighbours(mesh);
+
+    // Colours and the structured grid of a cartesian mesh are recomputed
+    // when the cells of the rank are indexed again
+    auto cartesian = std::make_shared<mpm::Mesh<Dim>>(0, false);
+    REQUIRE(cartesian->create_distributed_mesh("N2D", node_ids, coordinates,
+                                               element, cell_ids, cells,
+                                               cell_ranks) == true);
+    REQUIRE(cartesian->compute_cell_colours() == true);
+    REQUIRE(cartesian->compute_structured_grid() == true);
+    cartesian->remove_all_nonrank_cells();
+    REQUIRE(cartesian->ncells() == ncolumns * ncells);
+    REQUIRE(cartesian->ncell_colours() > 0);
+    REQUIRE(cartesian->is_structured() == true);
+
+    if (mpi_size == 4) {
+      // Material
+      Json jmaterial;
+      jmaterial["density"] = 1000.;
+      jmaterial["youngs_modulus"] = 1.0E+7;
+      jmaterial["poisson_ratio"] = 0.3;
+      std::map<unsigned, std::shared_ptr<mpm::Material<Dim>>> materials;
+      materials[0] = Factory<mpm::Material<Dim>, unsigned,
+                             const Json&>::instance()
+                         ->create("LinearElastic2D", std::move(0), jmaterial);
+      mesh->initialise_material_models(materials);
+      const std::vector<unsigned> mids(1, 0);
+
+      // Particles are generated in cells of the local rank with unique ids
+      REQUIRE(mesh->generate_material_points(2, "P2D", mids, -1, 0) == true);
+      REQUIRE(mesh->nparticles() == nrank_cells * 4);
+      mpm::Index nparticles = mesh->nparticles();
+      MPI_Allreduce(MPI_IN_PLACE, &nparticles, 1, MPI_UNSIGNED_LONG_LONG,
+                    MPI_SUM, MPI_COMM_WORLD);
+      REQUIRE(nparticles == ncells * ncells * 4);
+      std::vector<int> generated(nparticles, 0);
+      mesh->iterate_over_particles(
+          [&generated](std::shared_ptr<mpm::ParticleBase<Dim>> particle) {
+            generated.at(particle->id()) = 1;
+          });
+      MPI_Allreduce(MPI_IN_PLACE, generated.data(), generated.size(), MPI_INT,
+                    MPI_SUM, MPI_COMM_WORLD);
+      for (const auto count : generated) REQUIRE(count == 1);
+
+      // Particles at the nodes are on the boundaries of cells, and each of
+      // them is kept by a single rank
+      REQUIRE(mesh->create_particles("P2D", coordinates, mids, 1, false) ==
+              true);
+      nparticles = mesh->nparticles();
+      MPI_Allreduce(MPI_IN_PLACE, &nparticles, 1, MPI_UNSIGNED_LONG_LONG,
+                    MPI_SUM, MPI_COMM_WORLD);
+      REQUIRE(nparticles == ncells * ncells * 4 + coordinates.size());
+      const auto particles_cells = mesh->particles_cells();
+      for (const auto& particle_cell : particles_cells) {
+        const auto index = mesh->local_cell_index(particle_cell[1]);
+        REQUIRE(mesh->cells()[index]->rank() == mpi_rank);
+      }
+
+      // Each rank reads a slice of the checkpoint and keeps the particles
+      // in its cells
+      const auto particle_ids = [&mesh]() {
+        std::set<mpm::Index> ids;
+        mesh->iterate_over_particles(
+            [&ids](std::shared_ptr<mpm::ParticleBase<Dim>> particle) {
+              ids.insert(particle->id());
+            });
+        return ids;
+      };
+      const auto rank_ids = particle_ids();
+      REQUIRE(mesh->write_particles_hdf5(0, "particles-distributed.h5") ==
+              true);
+      REQUIRE(mesh->read_particles_hdf5(0, "particles-distributed.h5") ==
+              true);
+      REQUIRE(particle_ids() == rank_ids);
+      for (const auto& particle_cell : mesh->particles_cells()) {
+        const auto index = mesh->local_cell_index(particle_cell[1]);
+        REQUIRE(mesh->cells()[index]->rank() == mpi_rank);
+      }
+    }
+  }
+}
+#endif
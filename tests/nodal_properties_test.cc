@@ -285,4 +285,66 @@ TEST_CASE("NodalProperties is checked", "[nodal_properties]") {
       }
     }
   }
+
+  // Check typed access by handle
+  SECTION("Check property handles") {
+    // Declare nodal properties
+    mpm::NodalProperties nodal_properties;
+
+    // Define dimension
+    const unsigned dim = 2;
+
+    // Properties of multimaterial contact have reserved handles
+    REQUIRE(nodal_properties.create_property("areas", nnodes, nmaterials));
+    REQUIRE(nodal_properties.create_property("momenta", nnodes * dim,
+                                             nmaterials));
+    REQUIRE(nodal_properties.create_property("masses", nnodes, nmaterials));
+    REQUIRE(nodal_properties.handle("masses") ==
+            mpm::NodalProperties::Masses);
+    REQUIRE(nodal_properties.handle("momenta") ==
+            mpm::NodalProperties::Momenta);
+    REQUIRE(nodal_properties.handle("areas") ==
+            mpm::NodalProperties::NProperties);
+    REQUIRE_THROWS(nodal_properties.handle("displacements"));
+    REQUIRE_THROWS(nodal_properties.handle("velocities"));
+
+    // Update values in place by handle
+    const unsigned momenta = nodal_properties.handle("momenta");
+    for (int i = 0; i < nnodes; ++i) {
+      for (int j = 0; j < nmaterials; ++j) {
+        Eigen::Matrix<double, dim, 1> momentum;
+        momentum << 1.5 * i, -0.5 * j;
+        nodal_properties.update_property<dim>(momenta, i, j, momentum);
+        nodal_properties.update_property<dim>(momenta, i, j, momentum);
+        nodal_properties.update_property<1>(
+            mpm::NodalProperties::Masses, i, j,
+            Eigen::Matrix<double, 1, 1>::Constant(2. + i));
+      }
+    }
+
+    // Typed access and access by name refer to the same data
+    for (int i = 0; i < nnodes; ++i) {
+      for (int j = 0; j < nmaterials; ++j) {
+        REQUIRE(nodal_properties.property<dim>(momenta, i, j)(0) ==
+                Approx(3. * i).epsilon(tolerance));
+        REQUIRE(nodal_properties.property<dim>(momenta, i, j)(1) ==
+                Approx(-1. * j).epsilon(tolerance));
+        REQUIRE(nodal_properties.property("momenta", i, j, dim)(1, 0) ==
+                Approx(-1. * j).epsilon(tolerance));
+        REQUIRE(nodal_properties.property<1>(mpm::NodalProperties::Masses, i,
+                                             j)(0) ==
+                Approx(2. + i).epsilon(tolerance));
+      }
+    }
+
+    // Assign value through a map
+    nodal_properties.property<dim>(momenta, 1, 1).setConstant(4.);
+    REQUIRE(nodal_properties.property("momenta", 1, 1, dim)(0, 0) ==
+            Approx(4.).epsilon(tolerance));
+
+    // Initialise all nodal properties in place
+    nodal_properties.initialise_nodal_properties();
+    REQUIRE(nodal_properties.property<dim>(momenta, 1, 1).norm() ==
+            Approx(0.).epsilon(tolerance));
+  }
 }
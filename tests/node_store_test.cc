@@ -0,0 +1,242 @@
+#include <memory>
+#include <vector>
+
+#include "Eigen/Dense"
+#include "catch.hpp"
+
+#include "mesh.h"
+#include "node.h"
+#include "node_store.h"
+
+//! \brief Check node store class for 2D case
+TEST_CASE("Node store is checked for 2D case", "[nodestore][2D]") {
+  // Dimension
+  const unsigned Dim = 2;
+  // Degrees of freedom
+  const unsigned Dof = 2;
+  // Number of phases
+  const unsigned Nphases = 1;
+  // Phase
+  const unsigned Nphase = 0;
+  // Tolerance
+  const double Tolerance = 1.E-7;
+
+  // Node store
+  auto store = std::make_shared<mpm::NodeStore<Dim>>(Nphases);
+
+  // Check add and remove
+  SECTION("Check add and remove slots") {
+    mpm::Index handle0, handle1, handle2;
+    REQUIRE(store->add(&handle0) == 0);
+    REQUIRE(store->add(&handle1) == 1);
+    REQUIRE(store->add(&handle2) == 2);
+    REQUIRE(store->size() == 3);
+    REQUIRE(store->nphases() == 1);
+
+    // Check default values
+    REQUIRE(store->mass(handle1, Nphase) == Approx(0.).epsilon(Tolerance));
+    REQUIRE(store->velocity(handle1, Nphase).norm() ==
+            Approx(0.).epsilon(Tolerance));
+
+    store->mass(handle0, Nphase) = 1.;
+    store->mass(handle1, Nphase) = 2.;
+    store->mass(handle2, Nphase) = 3.;
+    store->velocity(handle2, Nphase) << 0.5, -0.5;
+
+    // Remove first slot, last slot is moved in its place
+    store->remove(handle0);
+    REQUIRE(store->size() == 2);
+    REQUIRE(handle2 == 0);
+    REQUIRE(handle1 == 1);
+    REQUIRE(store->mass(handle2, Nphase) == Approx(3.).epsilon(Tolerance));
+    REQUIRE(store->mass(handle1, Nphase) == Approx(2.).epsilon(Tolerance));
+    REQUIRE(store->velocity(handle2, Nphase)(1) ==
+            Approx(-0.5).epsilon(Tolerance));
+
+    // Initialise a slot
+    store->initialise(handle2);
+    REQUIRE(store->mass(handle2, Nphase) == Approx(0.).epsilon(Tolerance));
+    REQUIRE(store->velocity(handle2, Nphase).norm() ==
+            Approx(0.).epsilon(Tolerance));
+    REQUIRE(store->mass(handle1, Nphase) == Approx(2.).epsilon(Tolerance));
+
+    // Initialise all slots
+    store->velocity(handle2, Nphase) << 0.5, -0.5;
+    store->initialise();
+    REQUIRE(store->size() == 2);
+    REQUIRE(store->mass(handle1, Nphase) == Approx(0.).epsilon(Tolerance));
+    REQUIRE(store->velocity(handle2, Nphase).norm() ==
+            Approx(0.).epsilon(Tolerance));
+
+    // Transfer between stores with different number of phases fails
+    auto store2 = std::make_shared<mpm::NodeStore<Dim>>(2);
+    REQUIRE_THROWS(store2->transfer(&handle1, store.get()));
+  }
+
+  // Check nodes share the store
+  SECTION("Check nodal state in store") {
+    Eigen::Vector2d coords;
+    coords << 0.5, 1.5;
+    auto node1 = std::make_shared<mpm::Node<Dim, Dof, Nphases>>(0, coords);
+    coords << 2.5, 3.5;
+    auto node2 = std::make_shared<mpm::Node<Dim, Dof, Nphases>>(1, coords);
+
+    // Each node owns a store until it is assigned to another store
+    REQUIRE(node1->node_store() != node2->node_store());
+
+    node1->update_mass(false, Nphase, 10.);
+    node2->update_mass(false, Nphase, 20.);
+    Eigen::Vector2d momentum;
+    momentum << 10., -20.;
+    node2->update_momentum(false, Nphase, momentum);
+
+    node1->assign_node_store(store);
+    node2->assign_node_store(store);
+    REQUIRE(store->size() == 2);
+    REQUIRE(node1->node_store() == store);
+    REQUIRE(node1->store_index() == 0);
+    REQUIRE(node2->store_index() == 1);
+
+    // State is preserved on transfer
+    REQUIRE(node1->mass(Nphase) == Approx(10.).epsilon(Tolerance));
+    REQUIRE(node2->mass(Nphase) == Approx(20.).epsilon(Tolerance));
+    REQUIRE(node2->momentum(Nphase)(0) == Approx(10.).epsilon(Tolerance));
+    REQUIRE(node2->momentum(Nphase)(1) == Approx(-20.).epsilon(Tolerance));
+
+    // Data is contiguous in the store
+    REQUIRE(store->masses()[0] == Approx(10.).epsilon(Tolerance));
+    REQUIRE(store->masses()[1] == Approx(20.).epsilon(Tolerance));
+
+    // Nodal velocity is computed in the store
+    node2->compute_velocity();
+    REQUIRE(store->velocities()[2] == Approx(0.5).epsilon(Tolerance));
+    REQUIRE(store->velocities()[3] == Approx(-1.).epsilon(Tolerance));
+
+    // Destroying a node releases its slot
+    node1.reset();
+    REQUIRE(store->size() == 1);
+    REQUIRE(node2->store_index() == 0);
+    REQUIRE(node2->mass(Nphase) == Approx(20.).epsilon(Tolerance));
+    REQUIRE(node2->velocity(Nphase)(0) == Approx(0.5).epsilon(Tolerance));
+  }
+
+  // Check computation over active nodes of a mesh
+  SECTION("Check active nodes of a mesh") {
+    auto mesh = std::make_shared<mpm::Mesh<Dim>>(0);
+
+    // Nodes of the mesh and reference nodes outside the mesh
+    std::vector<std::shared_ptr<mpm::NodeBase<Dim>>> nodes, reference;
+    for (unsigned i = 0; i < 4; ++i) {
+      Eigen::Vector2d coords;
+      coords << i * 0.5, 0.;
+      nodes.emplace_back(
+          std::make_shared<mpm::Node<Dim, Dof, Nphases>>(i, coords));
+      reference.emplace_back(
+          std::make_shared<mpm::Node<Dim, Dof, Nphases>>(i, coords));
+      REQUIRE(mesh->add_node(nodes.at(i)) == true);
+    }
+
+    // Nodal state is moved to the store of the mesh
+    REQUIRE(mesh->node_store()->size() == 4);
+    for (const auto& node : nodes)
+      REQUIRE(node->node_store() == mesh->node_store());
+
+    // Node 3 is constrained
+    REQUIRE(nodes.at(3)->assign_velocity_constraint(0, 10.5) == true);
+    REQUIRE(reference.at(3)->assign_velocity_constraint(0, 10.5) == true);
+    REQUIRE(nodes.at(3)->constrained() == true);
+    REQUIRE(nodes.at(0)->constrained() == false);
+
+    // Assign nodal state, node 2 is inactive
+    for (unsigned i = 0; i < 4; ++i) {
+      Eigen::Vector2d momentum, external_force, internal_force;
+      momentum << 1. + i, -2. * i;
+      external_force << 5. * i, 2.;
+      internal_force << -1., 0.5 * i;
+      for (auto node : {nodes.at(i), reference.at(i)}) {
+        node->update_mass(false, Nphase, 2. + i);
+        node->update_momentum(false, Nphase, momentum);
+        node->update_external_force(false, Nphase, external_force);
+        node->update_internal_force(false, Nphase, internal_force);
+        if (i != 2) node->assign_status(true);
+      }
+    }
+
+    mesh->find_active_nodes();
+    REQUIRE(mesh->nactive_nodes() == 3);
+
+    // Compute velocity and acceleration of active nodes in the mesh and of
+    // each reference node
+    const double dt = 0.1;
+    mesh->compute_nodal_velocity();
+    mesh->compute_nodal_acceleration_velocity_cundall(Nphase, dt, 0.05);
+    for (unsigned i = 0; i < 4; ++i) {
+      if (i == 2) continue;
+      reference.at(i)->compute_velocity();
+      reference.at(i)->compute_acceleration_velocity_cundall(Nphase, dt, 0.05);
+    }
+
+    for (unsigned i = 0; i < 4; ++i) {
+      for (unsigned j = 0; j < Dim; ++j) {
+        REQUIRE(nodes.at(i)->velocity(Nphase)(j) ==
+                Approx(reference.at(i)->velocity(Nphase)(j))
+                    .epsilon(Tolerance));
+        REQUIRE(nodes.at(i)->acceleration(Nphase)(j) ==
+                Approx(reference.at(i)->acceleration(Nphase)(j))
+                    .epsilon(Tolerance));
+      }
+    }
+    // Constrained node
+    REQUIRE(nodes.at(3)->velocity(Nphase)(0) ==
+            Approx(10.5).epsilon(Tolerance));
+    // Inactive node
+    REQUIRE(nodes.at(2)->velocity(Nphase).norm() ==
+            Approx(0.).epsilon(Tolerance));
+
+    // Without damping
+    mesh->compute_nodal_acceleration_velocity(Nphase, dt);
+    for (unsigned i = 0; i < 4; ++i) {
+      if (i == 2) continue;
+      reference.at(i)->compute_acceleration_velocity(Nphase, dt);
+      for (unsigned j = 0; j < Dim; ++j)
+        REQUIRE(nodes.at(i)->velocity(Nphase)(j) ==
+                Approx(reference.at(i)->velocity(Nphase)(j))
+                    .epsilon(Tolerance));
+    }
+
+    // All nodes are initialised
+    mesh->initialise_nodes();
+    REQUIRE(mesh->nactive_nodes() == 0);
+    for (const auto& node : nodes) {
+      REQUIRE(node->status() == false);
+      REQUIRE(node->mass(Nphase) == Approx(0.).epsilon(Tolerance));
+    }
+
+    // Node 1 is active in the next step
+    nodes.at(1)->assign_status(true);
+    mesh->find_active_nodes();
+    REQUIRE(mesh->nactive_nodes() == 1);
+    nodes.at(1)->update_mass(true, Nphase, 4.);
+    nodes.at(1)->assign_pressure(Nphase, 2.5);
+    REQUIRE(nodes.at(1)->mass(Nphase) == Approx(4.).epsilon(Tolerance));
+    // Node 2 is inactive and holds state, such as a concentrated force
+    Eigen::Vector2d force;
+    force << 3., -1.;
+    nodes.at(2)->update_external_force(true, Nphase, force);
+    REQUIRE(nodes.at(2)->external_force(Nphase).norm() > 0.);
+    mesh->initialise_nodes();
+    REQUIRE(mesh->nactive_nodes() == 0);
+    REQUIRE(nodes.at(1)->status() == false);
+    REQUIRE(nodes.at(1)->mass(Nphase) == Approx(0.).epsilon(Tolerance));
+    REQUIRE(nodes.at(1)->pressure(Nphase) == Approx(0.).epsilon(Tolerance));
+    REQUIRE(nodes.at(2)->external_force(Nphase).norm() ==
+            Approx(0.).epsilon(Tolerance));
+
+    // Node 1 goes inactive, its state of the last step is reset
+    nodes.at(1)->update_mass(true, Nphase, 2.);
+    mesh->find_active_nodes();
+    REQUIRE(mesh->nactive_nodes() == 0);
+    mesh->initialise_nodes();
+    REQUIRE(nodes.at(1)->mass(Nphase) == Approx(0.).epsilon(Tolerance));
+  }
+}
@@ -1,12 +1,15 @@
 #include <cmath>
 #include <limits>
+#include <map>
 #include <memory>
+#include <vector>
 
 #include "Eigen/Dense"
 #include "catch.hpp"
 
 #include "function_base.h"
 #include "geometry.h"
+#include "linear_function.h"
 #include "node.h"
 
 // Check node class for 1D case
@@ -135,6 +138,26 @@ TEST_CASE("Node is checked for 1D case", "[node][1D]") {
     REQUIRE_NOTHROW(node->update_mass(false, Nphase, mass));
     REQUIRE(node->mass(Nphase) == Approx(100.0).epsilon(Tolerance));
 
+    SECTION("Check unlocked updates") {
+      // Unlocked updates add to the nodal values
+      node->update_mass_unlocked(Nphase, mass);
+      REQUIRE(node->mass(Nphase) == Approx(200.0).epsilon(Tolerance));
+      Eigen::Matrix<double, Dim, 1> vector;
+      vector.setConstant(10.);
+      node->update_momentum_unlocked(Nphase, vector);
+      node->update_external_force_unlocked(Nphase, vector);
+      node->update_internal_force_unlocked(Nphase, 2. * vector);
+      for (unsigned i = 0; i < Dim; ++i) {
+        REQUIRE(node->momentum(Nphase)(i) == Approx(10.).epsilon(Tolerance));
+        REQUIRE(node->external_force(Nphase)(i) ==
+                Approx(10.).epsilon(Tolerance));
+        REQUIRE(node->internal_force(Nphase)(i) ==
+                Approx(20.).epsilon(Tolerance));
+      }
+      node->update_mass_pressure_unlocked(Nphase, 200. * 5.);
+      REQUIRE(node->pressure(Nphase) == Approx(5.).epsilon(Tolerance));
+    }
+
     SECTION("Check nodal pressure") {
       // Check pressure
       REQUIRE(node->pressure(Nphase) == Approx(0.0).epsilon(Tolerance));
@@ -1077,6 +1100,54 @@ TEST_CASE("Node is checked for 2D case", "[node][2D]") {
         REQUIRE(*mitr == material_ids.at(i));
     }
   }
+
+  // Check serialization and deserialization of boundary conditions
+  SECTION("Check serialization and deserialization") {
+    mpm::Index id = 3;
+    coords << 1.5, 2.5;
+    std::shared_ptr<mpm::NodeBase<Dim>> node =
+        std::make_shared<mpm::Node<Dim, Dof, Nphases>>(id, coords);
+
+    // Math function of the concentrated force
+    Json jfunction;
+    jfunction["xvalues"] = std::vector<double>{0.0, 1.0};
+    jfunction["fxvalues"] = std::vector<double>{0.0, 2.0};
+    std::map<unsigned, std::shared_ptr<mpm::FunctionBase>> functions;
+    functions[4] = std::make_shared<mpm::LinearFunction>(4, jfunction);
+
+    // Boundary conditions
+    REQUIRE(node->assign_velocity_constraint(1, -0.5) == true);
+    REQUIRE(node->assign_friction_constraint(1, -1, 0.3) == true);
+    REQUIRE(node->assign_concentrated_force(Nphase, 0, 10., functions[4]) ==
+            true);
+    Eigen::Matrix2d rotation_matrix;
+    rotation_matrix << 0., -1., 1., 0.;
+    node->assign_rotation_matrix(rotation_matrix);
+
+    auto buffer = node->serialize();
+    REQUIRE(buffer.size() > 0);
+
+    const Eigen::Vector2d rcoords = Eigen::Vector2d::Zero();
+    std::shared_ptr<mpm::NodeBase<Dim>> rnode =
+        std::make_shared<mpm::Node<Dim, Dof, Nphases>>(0, rcoords);
+    REQUIRE_NOTHROW(rnode->deserialize(buffer, functions));
+
+    REQUIRE(rnode->id() == id);
+    for (unsigned i = 0; i < Dim; ++i)
+      REQUIRE(rnode->coordinates()(i) == Approx(coords(i)).epsilon(1.E-7));
+    REQUIRE(rnode->constrained() == true);
+    REQUIRE(rnode->velocity_constraints() == node->velocity_constraints());
+    REQUIRE(rnode->serialize() == buffer);
+
+    // Concentrated force is scaled by the math function
+    rnode->apply_concentrated_force(Nphase, 0.5);
+    REQUIRE(rnode->external_force(Nphase)(0) == Approx(10.).epsilon(1.E-7));
+    REQUIRE(rnode->external_force(Nphase)(1) == Approx(0.).epsilon(1.E-7));
+
+    // Math function of the concentrated force is not found
+    functions.clear();
+    REQUIRE_THROWS(rnode->deserialize(buffer, functions));
+  }
 }
 
 // \brief Check node class for 3D case
@@ -0,0 +1,123 @@
+#include <array>
+#include <chrono>
+#include <iostream>
+#include <memory>
+#include <vector>
+
+#include "Eigen/Dense"
+#include "catch.hpp"
+
+#include "cell.h"
+#include "element.h"
+#include "node.h"
+#include "particle.h"
+#include "quadrilateral_element.h"
+
+//! \brief Check particle shape functions for 2D case
+TEST_CASE("Particle shape functions are checked for 2D case",
+          "[particle][shapefn][2D]") {
+  // Dimension
+  const unsigned Dim = 2;
+  // Degree of freedom
+  const unsigned Dof = 2;
+  // Number of phases
+  const unsigned Nphases = 1;
+  // Number of nodes per cell
+  const unsigned Nnodes = 4;
+  // Tolerance
+  const double Tolerance = 1.E-7;
+
+  // Element
+  std::shared_ptr<mpm::Element<Dim>> element =
+      std::make_shared<mpm::QuadrilateralElement<Dim, 4>>();
+
+  // Create a distorted cell
+  auto cell = std::make_shared<mpm::Cell<Dim>>(10, Nnodes, element);
+  Eigen::Vector2d coords;
+  std::vector<std::shared_ptr<mpm::NodeBase<Dim>>> nodes;
+  const std::vector<std::array<double, Dim>> ncoords = {
+      {0.5, 0.5}, {1.75, 0.5}, {1.5, 1.75}, {0.5, 1.5}};
+  for (unsigned i = 0; i < Nnodes; ++i) {
+    coords << ncoords[i][0], ncoords[i][1];
+    nodes.emplace_back(
+        std::make_shared<mpm::Node<Dim, Dof, Nphases>>(i, coords));
+    cell->add_node(i, nodes.back());
+  }
+  REQUIRE(cell->initialise() == true);
+
+  // Particle
+  coords << 0.9, 0.8;
+  std::shared_ptr<mpm::ParticleBase<Dim>> particle =
+      std::make_shared<mpm::Particle<Dim>>(0, coords);
+  REQUIRE(particle->assign_cell(cell) == true);
+  REQUIRE(particle->assign_volume(1.0) == true);
+  particle->assign_mass(1000.);
+
+  SECTION("Check particle shape functions are the element shape functions") {
+    particle->compute_shapefn();
+    particle->map_mass_momentum_to_nodes();
+
+    // Nodal mass is the element shape function times particle mass
+    const Eigen::Vector2d zero = Eigen::Vector2d::Zero();
+    const Eigen::VectorXd shapefn = element->shapefn(
+        particle->reference_location(), particle->natural_size(), zero);
+    for (unsigned i = 0; i < Nnodes; ++i)
+      REQUIRE(nodes[i]->mass(mpm::ParticlePhase::Solid) ==
+              Approx(1000. * shapefn(i)).epsilon(Tolerance));
+  }
+}
+
+//! \brief Benchmark particle shape functions
+//! Run with: ./mpmtest "[benchmark][shapefn]"
+TEST_CASE("Particle shape functions are benchmarked",
+          "[.][benchmark][shapefn][2D]") {
+  // Dimension
+  const unsigned Dim = 2;
+  // Number of repetitions
+  const unsigned nrepeats = 1000000;
+
+  // Element
+  std::shared_ptr<mpm::Element<Dim>> element =
+      std::make_shared<mpm::QuadrilateralElement<Dim, 4>>();
+  Eigen::Matrix<double, 4, Dim> coords;
+  // clang-format off
+  coords << 0.5, 0.5,
+            1.75, 0.5,
+            1.5, 1.75,
+            0.5, 1.5;
+  // clang-format on
+  const Eigen::MatrixXd nodal_coordinates = coords;
+  const Eigen::Vector2d zero = Eigen::Vector2d::Zero();
+  Eigen::Vector2d xi;
+  xi << 0.25, -0.5;
+
+  double sum = 0.;
+  // Dynamically sized shape functions and gradients
+  auto start = std::chrono::steady_clock::now();
+  for (unsigned i = 0; i < nrepeats; ++i) {
+    const Eigen::VectorXd shapefn = element->shapefn(xi, zero, zero);
+    const Eigen::MatrixXd dn_dx =
+        element->dn_dx(xi, nodal_coordinates, zero, zero);
+    sum += shapefn(0) + dn_dx(0, 0);
+  }
+  auto end = std::chrono::steady_clock::now();
+  const double dynamic_time =
+      std::chrono::duration<double, std::milli>(end - start).count();
+
+  // In-place bounded size shape functions and gradients
+  Eigen::VectorXd shapefn;
+  Eigen::MatrixXd dn_dx;
+  start = std::chrono::steady_clock::now();
+  for (unsigned i = 0; i < nrepeats; ++i) {
+    element->shapefn_dn_dx(xi, nodal_coordinates, zero, zero, &shapefn,
+                           &dn_dx);
+    sum += shapefn(0) + dn_dx(0, 0);
+  }
+  end = std::chrono::steady_clock::now();
+  const double fixed_time =
+      std::chrono::duration<double, std::milli>(end - start).count();
+
+  std::cout << "Shape functions and dN/dx of " << nrepeats
+            << " evaluations, dynamic: " << dynamic_time
+            << " ms, in-place: " << fixed_time << " ms (" << sum << ")\n";
+}
@@ -0,0 +1,127 @@
+#include <limits>
+#include <memory>
+
+#include "Eigen/Dense"
+#include "catch.hpp"
+
+#include "factory.h"
+#include "particle.h"
+#include "particle_store.h"
+
+//! \brief Check particle store class for 2D case
+TEST_CASE("Particle store is checked for 2D case", "[particlestore][2D]") {
+  // Dimension
+  const unsigned Dim = 2;
+  // Tolerance
+  const double Tolerance = 1.E-7;
+
+  // Particle store
+  auto store = std::make_shared<mpm::ParticleStore<Dim>>();
+
+  // Check add and remove
+  SECTION("Check add and remove slots") {
+    mpm::Index handle0, handle1, handle2;
+    REQUIRE(store->add(&handle0) == 0);
+    REQUIRE(store->add(&handle1) == 1);
+    REQUIRE(store->add(&handle2) == 2);
+    REQUIRE(store->size() == 3);
+
+    // Check default values
+    REQUIRE(store->mass(handle1) == Approx(0.).epsilon(Tolerance));
+    REQUIRE(store->volume(handle1) == std::numeric_limits<double>::max());
+    REQUIRE(store->cell_id(handle1) == std::numeric_limits<mpm::Index>::max());
+
+    store->mass(handle0) = 1.;
+    store->mass(handle1) = 2.;
+    store->mass(handle2) = 3.;
+
+    // Remove first slot, last slot is moved in its place
+    store->remove(handle0);
+    REQUIRE(store->size() == 2);
+    REQUIRE(handle2 == 0);
+    REQUIRE(handle1 == 1);
+    REQUIRE(store->mass(handle2) == Approx(3.).epsilon(Tolerance));
+    REQUIRE(store->mass(handle1) == Approx(2.).epsilon(Tolerance));
+
+    // Remove last slot
+    store->remove(handle1);
+    REQUIRE(store->size() == 1);
+    REQUIRE(handle2 == 0);
+    REQUIRE(store->mass(handle2) == Approx(3.).epsilon(Tolerance));
+  }
+
+  // Check particles share the store
+  SECTION("Check particle state in store") {
+    Eigen::Vector2d coords;
+    coords << 0.5, 1.5;
+    auto particle1 = std::make_shared<mpm::Particle<Dim>>(0, coords);
+    coords << 2.5, 3.5;
+    auto particle2 = std::make_shared<mpm::Particle<Dim>>(1, coords);
+
+    // Each particle owns a store until it is assigned to another store
+    REQUIRE(particle1->particle_store() != particle2->particle_store());
+
+    particle1->assign_mass(10.);
+    particle2->assign_mass(20.);
+    Eigen::Vector2d velocity;
+    velocity << 1., -1.;
+    particle2->assign_velocity(velocity);
+
+    particle1->assign_particle_store(store);
+    particle2->assign_particle_store(store);
+    REQUIRE(store->size() == 2);
+    REQUIRE(particle1->particle_store() == store);
+    REQUIRE(particle1->store_index() == 0);
+    REQUIRE(particle2->store_index() == 1);
+
+    // State is preserved on transfer
+    REQUIRE(particle1->mass() == Approx(10.).epsilon(Tolerance));
+    REQUIRE(particle2->mass() == Approx(20.).epsilon(Tolerance));
+    REQUIRE(particle2->coordinates()(0) == Approx(2.5).epsilon(Tolerance));
+    REQUIRE(particle2->coordinates()(1) == Approx(3.5).epsilon(Tolerance));
+    REQUIRE(particle2->velocity()(1) == Approx(-1.).epsilon(Tolerance));
+
+    // Data is contiguous in the store
+    REQUIRE(store->masses()[0] == Approx(10.).epsilon(Tolerance));
+    REQUIRE(store->masses()[1] == Approx(20.).epsilon(Tolerance));
+
+    // Destroying a particle releases its slot
+    particle1.reset();
+    REQUIRE(store->size() == 1);
+    REQUIRE(particle2->store_index() == 0);
+    REQUIRE(particle2->mass() == Approx(20.).epsilon(Tolerance));
+    REQUIRE(particle2->coordinates()(0) == Approx(2.5).epsilon(Tolerance));
+  }
+
+  // Check particles created in the store
+  SECTION("Check particle created in store") {
+    Eigen::Vector2d coords;
+    coords << 0.5, 1.5;
+    auto particle1 = std::make_shared<mpm::Particle<Dim>>(0, coords, store);
+    coords << 2.5, 3.5;
+    std::shared_ptr<mpm::ParticleBase<Dim>> particle2 =
+        Factory<mpm::ParticleBase<Dim>, mpm::Index,
+                const Eigen::Matrix<double, Dim, 1>&,
+                const std::shared_ptr<mpm::ParticleStore<Dim>>&>::instance()
+            ->create("P2D", 1, coords, store);
+
+    // Particles hold their state in the given store
+    REQUIRE(store->size() == 2);
+    REQUIRE(particle1->particle_store() == store);
+    REQUIRE(particle2->particle_store() == store);
+    REQUIRE(particle1->store_index() == 0);
+    REQUIRE(particle2->store_index() == 1);
+    REQUIRE(store->coordinates(1)(0) == Approx(2.5).epsilon(Tolerance));
+    REQUIRE(particle2->coordinates()(1) == Approx(3.5).epsilon(Tolerance));
+
+    // Assigning the same store keeps the slot
+    particle2->assign_particle_store(store);
+    REQUIRE(store->size() == 2);
+    REQUIRE(particle2->store_index() == 1);
+
+    // A particle without a store holds its state in a store of its own
+    auto particle3 = std::make_shared<mpm::Particle<Dim>>(2, coords, nullptr);
+    REQUIRE(particle3->particle_store() != store);
+    REQUIRE(particle3->particle_store()->size() == 1);
+  }
+}
@@ -1,6 +1,8 @@
 #include <cmath>
 #include <limits>
+#include <map>
 #include <memory>
+#include <string>
 
 #include <Eigen/Dense>
 #include <boost/filesystem.hpp>
@@ -23,6 +25,7 @@
 #include "node.h"
 #include "partio_writer.h"
 #include "quadrilateral_element.h"
+#include "structured_mesh.h"
 
 //! \brief Check stress update 3D case
 TEST_CASE("Stress update is checked for USF and USL",
@@ -253,3 +256,83 @@ TEST_CASE("Stress update is checked for USF and USL",
     REQUIRE_NOTHROW(mpm_scheme->locate_particles(false));
   }
 }
+
+//! \brief Check fused particle kernels against unfused passes for 2D case
+TEST_CASE("Fused particle kernels are checked for 2D case",
+          "[scheme][fused][2D]") {
+  // Dimension
+  const unsigned Dim = 2;
+  // Phase
+  const unsigned phase = 0;
+  // Tolerance
+  const double Tolerance = 1.E-7;
+  // Time step
+  const double dt = 0.001;
+  // Number of steps
+  const unsigned nsteps = 3;
+  // Gravity
+  Eigen::Matrix<double, Dim, 1> gravity;
+  gravity << 0., -9.81;
+
+  // Particles of a mesh ordered by id
+  const auto ordered_particles = [](
+      const std::shared_ptr<mpm::Mesh<Dim>>& mesh) {
+    std::map<mpm::Index, std::shared_ptr<mpm::ParticleBase<Dim>>> particles;
+    mesh->iterate_over_particles(
+        [&particles](std::shared_ptr<mpm::ParticleBase<Dim>> ptr) {
+#pragma omp critical
+          particles.emplace(ptr->id(), ptr);
+        });
+    return particles;
+  };
+
+  for (const std::string scheme : {"USF", "USL"}) {
+    // Fused and unfused (reference) meshes
+    std::vector<std::shared_ptr<mpm::Mesh<Dim>>> meshes;
+    std::vector<std::shared_ptr<mpm::MPMScheme<Dim>>> schemes;
+    for (const bool fused : {true, false}) {
+      auto mesh = mpm_test::structured_mesh_2d(8, 2);
+      std::shared_ptr<mpm::MPMScheme<Dim>> mpm_scheme;
+      if (scheme == "USF")
+        mpm_scheme = std::make_shared<mpm::MPMSchemeUSF<Dim>>(mesh, dt);
+      else
+        mpm_scheme = std::make_shared<mpm::MPMSchemeUSL<Dim>>(mesh, dt);
+      mpm_scheme->fused_kernels(fused);
+      REQUIRE(mpm_scheme->fused_kernels() == fused);
+      meshes.emplace_back(mesh);
+      schemes.emplace_back(mpm_scheme);
+    }
+
+    for (unsigned step = 0; step < nsteps; ++step) {
+      for (auto& mpm_scheme : schemes) {
+        mpm_scheme->initialise();
+        mpm_scheme->compute_nodal_kinematics(phase);
+        mpm_scheme->precompute_stress_strain(phase, false);
+        mpm_scheme->compute_forces(gravity, phase, step, false);
+        mpm_scheme->compute_particle_kinematics(false, phase, "Cundall",
+                                                0.02);
+        mpm_scheme->postcompute_stress_strain(phase, false);
+        mpm_scheme->locate_particles(true);
+      }
+    }
+
+    // Fused kernels reproduce the unfused passes
+    const auto fused = ordered_particles(meshes.at(0));
+    const auto unfused = ordered_particles(meshes.at(1));
+    REQUIRE(fused.size() == unfused.size());
+    for (const auto& particle : fused) {
+      const auto& reference = unfused.at(particle.first);
+      for (unsigned i = 0; i < Dim; ++i) {
+        REQUIRE(particle.second->coordinates()(i) ==
+                Approx(reference->coordinates()(i)).epsilon(Tolerance));
+        REQUIRE(particle.second->velocity()(i) ==
+                Approx(reference->velocity()(i)).epsilon(Tolerance));
+      }
+      for (unsigned i = 0; i < 6; ++i)
+        REQUIRE(particle.second->stress()(i) ==
+                Approx(reference->stress()(i)).epsilon(Tolerance));
+      REQUIRE(particle.second->volume() ==
+              Approx(reference->volume()).epsilon(Tolerance));
+    }
+  }
+}
@@ -0,0 +1,65 @@
+#include "structured_mesh.h"
+
+#include <map>
+#include <string>
+#include <vector>
+
+#include "Eigen/Dense"
+
+#include "element.h"
+#include "factory.h"
+#include "material.h"
+#include "particle.h"
+
+namespace mpm_test {
+
+// Create a structured mesh of unit quadrilateral cells in 2D with particles
+std::shared_ptr<mpm::Mesh<2>> structured_mesh_2d(unsigned ncells,
+                                                 unsigned nquadratures) {
+  const unsigned Dim = 2;
+  auto mesh = std::make_shared<mpm::Mesh<Dim>>(0);
+
+  // Nodes
+  std::vector<Eigen::Matrix<double, Dim, 1>> coordinates;
+  for (unsigned j = 0; j <= ncells; ++j)
+    for (unsigned i = 0; i <= ncells; ++i)
+      coordinates.emplace_back(Eigen::Vector2d(i * 1., j * 1.));
+  mesh->create_nodes(0, "N2D", coordinates, false);
+
+  // Cells
+  std::shared_ptr<mpm::Element<Dim>> element =
+      Factory<mpm::Element<Dim>>::instance()->create("ED2Q4");
+  std::vector<std::vector<mpm::Index>> cells;
+  for (unsigned j = 0; j < ncells; ++j)
+    for (unsigned i = 0; i < ncells; ++i) {
+      const mpm::Index n0 = j * (ncells + 1) + i;
+      cells.emplace_back(std::vector<mpm::Index>{
+          n0, n0 + 1, n0 + ncells + 2, n0 + ncells + 1});
+    }
+  mesh->create_cells(0, element, cells, false);
+
+  // Material
+  Json jmaterial;
+  jmaterial["density"] = 1000.;
+  jmaterial["youngs_modulus"] = 1.0E+7;
+  jmaterial["poisson_ratio"] = 0.3;
+  std::map<unsigned, std::shared_ptr<mpm::Material<Dim>>> materials;
+  materials[0] =
+      Factory<mpm::Material<Dim>, unsigned, const Json&>::instance()->create(
+          "LinearElastic2D", std::move(0), jmaterial);
+  mesh->initialise_material_models(materials);
+
+  // Particles
+  std::vector<unsigned> mids(1, 0);
+  mesh->generate_material_points(nquadratures, "P2D", mids, -1, 0);
+  mesh->iterate_over_particles(
+      [](std::shared_ptr<mpm::ParticleBase<Dim>> ptr) {
+        ptr->compute_volume();
+        ptr->compute_mass();
+        ptr->assign_velocity(ptr->coordinates());
+        ptr->compute_shapefn();
+      });
+  return mesh;
+}
+
+}  // namespace mpm_test